@@ -0,0 +1,136 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      This program is only built if BUILD_BENCHMARKS is enabled, and is not run as part of the unit tests.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <vector>
+
+#include <boost/make_shared.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Aerodynamics/aerodynamics.h"
+#include "Tudat/Astrodynamics/Aerodynamics/panelMethodKernels.h"
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/GeometricShapes/lawgsPartGeometry.h"
+#include "Tudat/Mathematics/GeometricShapes/sphereSegment.h"
+
+//! Benchmark panel method kernels w.r.t. panel-by-panel computation of aerodynamic force and moment.
+/*!
+ *  Benchmark computation of the pressure force and moment on a meshed sphere (by default with 250,000 panels), using
+ *  the panel method kernels on contiguous panel arrays, w.r.t. computation one panel at a time through the mesh
+ *  accessor functions, for a number of attitudes. Usage: benchmark_PanelMethodKernels [numberOfPanelsPerSide]
+ *  [numberOfAttitudes]
+ */
+int main( int argc, char* argv[ ] )
+{
+    using namespace tudat;
+    using namespace tudat::aerodynamics;
+    using mathematical_constants::PI;
+
+    int numberOfPanelsPerSide = ( argc > 1 ) ? std::atoi( argv[ 1 ] ) : 500;
+    int numberOfAttitudes = ( argc > 2 ) ? std::atoi( argv[ 2 ] ) : 20;
+
+    // Create sphere mesh.
+    boost::shared_ptr< geometric_shapes::SphereSegment > sphere
+            = boost::make_shared< geometric_shapes::SphereSegment >( 1.0 );
+    boost::shared_ptr< geometric_shapes::LawgsPartGeometry > meshedSphere =
+            boost::make_shared< geometric_shapes::LawgsPartGeometry >( );
+    meshedSphere->setMesh( sphere, numberOfPanelsPerSide + 1, numberOfPanelsPerSide + 1 );
+
+    Eigen::Vector3d momentReferencePoint( 0.1, -0.2, 0.3 );
+    SurfacePanelArrays panels( meshedSphere, momentReferencePoint );
+
+    // Use Newtonian compression and vacuum expansion pressures.
+    double machNumber = 10.0;
+    double expansionPressureCoefficient = computeVacuumPressureCoefficient( machNumber, 1.4 );
+
+    Eigen::VectorXd pressureCoefficients = Eigen::VectorXd::Zero( panels.getNumberOfPanels( ) );
+    PanelInclinations inclinations;
+
+    std::vector< Eigen::Vector6d > kernelCoefficients( numberOfAttitudes );
+    std::vector< Eigen::Vector6d > panelLoopCoefficients( numberOfAttitudes );
+
+    // Compute force and moment using kernels on contiguous panel arrays.
+    std::clock_t startClock = std::clock( );
+    for( int k = 0; k < numberOfAttitudes; k++ )
+    {
+        double angleOfAttack = -0.5 + 0.05 * static_cast< double >( k );
+        double angleOfSideslip = 0.01 * static_cast< double >( k );
+        Eigen::Vector3d freestreamVelocityDirection(
+                    std::cos( angleOfAttack ) * std::cos( angleOfSideslip ), std::sin( angleOfSideslip ),
+                    std::sin( angleOfAttack ) * std::cos( angleOfSideslip ) );
+
+        computePanelInclinations( panels, freestreamVelocityDirection, inclinations );
+        computeNewtonianCompressionPressureCoefficients( inclinations, 2.0, pressureCoefficients );
+        setConstantExpansionPressureCoefficients( inclinations, expansionPressureCoefficient, pressureCoefficients );
+
+        kernelCoefficients[ k ].segment( 0, 3 ) = computePanelForce( panels, pressureCoefficients );
+        kernelCoefficients[ k ].segment( 3, 3 ) = computePanelMoment( panels, pressureCoefficients );
+    }
+    double kernelTime = static_cast< double >( std::clock( ) - startClock ) / CLOCKS_PER_SEC;
+
+    // Compute force and moment one panel at a time through mesh accessor functions.
+    startClock = std::clock( );
+    for( int k = 0; k < numberOfAttitudes; k++ )
+    {
+        double angleOfAttack = -0.5 + 0.05 * static_cast< double >( k );
+        double angleOfSideslip = 0.01 * static_cast< double >( k );
+        Eigen::Vector3d freestreamVelocityDirection(
+                    std::cos( angleOfAttack ) * std::cos( angleOfSideslip ), std::sin( angleOfSideslip ),
+                    std::sin( angleOfAttack ) * std::cos( angleOfSideslip ) );
+
+        panelLoopCoefficients[ k ].setZero( );
+        for( int i = 0; i < meshedSphere->getNumberOfLines( ) - 1; i++ )
+        {
+            for( int j = 0; j < meshedSphere->getNumberOfPoints( ) - 1; j++ )
+            {
+                double inclination = PI / 2.0 - std::acos(
+                            meshedSphere->getPanelSurfaceNormal( i, j ).dot( freestreamVelocityDirection ) );
+                double pressureCoefficient = ( inclination > 0.0 ) ?
+                            computeNewtonianPressureCoefficient( inclination ) : expansionPressureCoefficient;
+
+                panelLoopCoefficients[ k ].segment( 0, 3 ) -=
+                        pressureCoefficient * meshedSphere->getPanelArea( i, j ) *
+                        meshedSphere->getPanelSurfaceNormal( i, j );
+                panelLoopCoefficients[ k ].segment( 3, 3 ) -=
+                        pressureCoefficient * meshedSphere->getPanelArea( i, j ) *
+                        ( meshedSphere->getPanelCentroid( i, j ) - momentReferencePoint ).cross(
+                            meshedSphere->getPanelSurfaceNormal( i, j ) );
+            }
+        }
+    }
+    double panelLoopTime = static_cast< double >( std::clock( ) - startClock ) / CLOCKS_PER_SEC;
+
+    // Compute maximum difference of results, to verify that the same coefficients are produced.
+    double maximumDifference = 0.0;
+    for( int k = 0; k < numberOfAttitudes; k++ )
+    {
+        maximumDifference = std::max(
+                    maximumDifference, ( kernelCoefficients[ k ] - panelLoopCoefficients[ k ] ).cwiseAbs( ).maxCoeff( ) );
+    }
+
+    double numberOfProcessedPanels = static_cast< double >( numberOfAttitudes * panels.getNumberOfPanels( ) );
+    std::cout << panels.getNumberOfPanels( ) << " panels, " << numberOfAttitudes << " attitudes" << std::endl;
+    std::cout << "Panel method kernels: " << numberOfProcessedPanels / kernelTime << " panels per second" << std::endl;
+    std::cout << "Panel-by-panel computation: " << numberOfProcessedPanels / panelLoopTime << " panels per second"
+              << std::endl;
+    std::cout << "Maximum force/moment difference: " << maximumDifference << std::endl;
+
+    return EXIT_SUCCESS;
+}
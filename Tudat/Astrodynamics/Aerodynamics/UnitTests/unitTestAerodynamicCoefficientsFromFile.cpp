@@ -13,6 +13,7 @@
 #include <limits>
 
 
+#include <boost/filesystem.hpp>
 #include <boost/test/floating_point_comparison.hpp>
 #include <boost/test/unit_test.hpp>
 
@@ -421,6 +422,98 @@ BOOST_AUTO_TEST_CASE( testAerodynamicCoefficientsFromFile )
     }
 }
 
+//! Test whether coefficients loaded from binary coefficient table files are identical to those loaded from text files.
+BOOST_AUTO_TEST_CASE( testAerodynamicCoefficientsFromBinaryFile )
+{
+    using namespace tudat;
+    using namespace simulation_setup;
+
+    std::map< int, std::string > forceCoefficientFiles;
+    forceCoefficientFiles[ 0 ] = tudat::input_output::getTudatRootPath( )
+            + "/Astrodynamics/Aerodynamics/UnitTests/aurora_CD.txt";
+    forceCoefficientFiles[ 2 ] = tudat::input_output::getTudatRootPath( )
+            + "/Astrodynamics/Aerodynamics/UnitTests/aurora_CL.txt";
+    std::map< int, std::string > momentCoefficientFiles;
+    momentCoefficientFiles[ 1 ] = tudat::input_output::getTudatRootPath( )
+            + "/Astrodynamics/Aerodynamics/UnitTests/aurora_Cm.txt";
+
+    // Convert text files to binary coefficient table files.
+    boost::filesystem::path outputDirectory =
+            boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( "tudat_aero_%%%%-%%%%" );
+    boost::filesystem::create_directories( outputDirectory );
+    std::string forceCoefficientBinaryFile = ( outputDirectory / "auroraForceCoefficients.bin" ).string( );
+    std::string momentCoefficientBinaryFile = ( outputDirectory / "auroraMomentCoefficients.bin" ).string( );
+    input_output::convertAerodynamicCoefficientFilesToBinaryFile< 2 >(
+                forceCoefficientFiles, forceCoefficientBinaryFile );
+    input_output::convertAerodynamicCoefficientFilesToBinaryFile< 2 >(
+                momentCoefficientFiles, momentCoefficientBinaryFile );
+
+    std::vector< aerodynamics::AerodynamicCoefficientsIndependentVariables > independentVariableNames =
+            boost::assign::list_of( aerodynamics::mach_number_dependent )( aerodynamics::angle_of_attack_dependent );
+
+    // Test both multi-linear interpolation (on memory-mapped table) and cubic spline interpolation (on copy of table).
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        boost::shared_ptr< AerodynamicCoefficientSettings > textCoefficientSettings =
+                readTabulatedAerodynamicCoefficientsFromFiles(
+                    forceCoefficientFiles, momentCoefficientFiles, 60.734, 600.0, 60.734, Eigen::Vector3d::Zero( ),
+                    independentVariableNames, true, true );
+        boost::shared_ptr< AerodynamicCoefficientSettings > binaryCoefficientSettings =
+                readTabulatedAerodynamicCoefficientsFromBinaryFiles(
+                    forceCoefficientBinaryFile, momentCoefficientBinaryFile, 60.734, 600.0, 60.734,
+                    Eigen::Vector3d::Zero( ), independentVariableNames, true, true );
+        BOOST_CHECK_EQUAL( ( boost::dynamic_pointer_cast< TabulatedAerodynamicCoefficientSettings< 2 > >(
+                                 binaryCoefficientSettings )->getForceCoefficientTable( ) != NULL ), true );
+
+        if( i == 1 )
+        {
+            boost::shared_ptr< interpolators::InterpolatorSettings > splineSettings =
+                    boost::make_shared< interpolators::InterpolatorSettings >(
+                        interpolators::cubic_spline_interpolator );
+            boost::dynamic_pointer_cast< TabulatedAerodynamicCoefficientSettings< 2 > >(
+                        textCoefficientSettings )->setInterpolationSettings( splineSettings );
+            boost::dynamic_pointer_cast< TabulatedAerodynamicCoefficientSettings< 2 > >(
+                        binaryCoefficientSettings )->setInterpolationSettings( splineSettings );
+        }
+
+        boost::shared_ptr< aerodynamics::AerodynamicCoefficientInterface > textCoefficientInterface =
+                createAerodynamicCoefficientInterface( textCoefficientSettings, "SpacePlane" );
+        boost::shared_ptr< aerodynamics::AerodynamicCoefficientInterface > binaryCoefficientInterface =
+                createAerodynamicCoefficientInterface( binaryCoefficientSettings, "SpacePlane" );
+
+        BOOST_CHECK_EQUAL( binaryCoefficientInterface->getReferenceArea( ), 600.0 );
+        BOOST_CHECK_EQUAL( binaryCoefficientInterface->getReferenceLength( ), 60.734 );
+        BOOST_CHECK_EQUAL( binaryCoefficientInterface->getAreCoefficientsInAerodynamicFrame( ), true );
+        BOOST_CHECK_EQUAL( binaryCoefficientInterface->getAreCoefficientsInNegativeAxisDirection( ), true );
+
+        // Compare coefficients at (and in between) data points.
+        for( double machNumber = 0.0; machNumber <= 25.0; machNumber += 1.3 )
+        {
+            for( double angleOfAttack = -0.17; angleOfAttack <= 0.6; angleOfAttack += 0.0349065850398866 / 2.0 )
+            {
+                std::vector< double > independentVariables;
+                independentVariables.push_back( machNumber );
+                independentVariables.push_back( angleOfAttack );
+
+                textCoefficientInterface->updateCurrentCoefficients( independentVariables );
+                binaryCoefficientInterface->updateCurrentCoefficients( independentVariables );
+
+                for( unsigned int j = 0; j < 3; j++ )
+                {
+                    BOOST_CHECK_SMALL( std::fabs( textCoefficientInterface->getCurrentForceCoefficients( )( j ) -
+                                                  binaryCoefficientInterface->getCurrentForceCoefficients( )( j ) ),
+                                       1.0E-15 );
+                    BOOST_CHECK_SMALL( std::fabs( textCoefficientInterface->getCurrentMomentCoefficients( )( j ) -
+                                                  binaryCoefficientInterface->getCurrentMomentCoefficients( )( j ) ),
+                                       1.0E-15 );
+                }
+            }
+        }
+    }
+
+    boost::filesystem::remove_all( outputDirectory );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
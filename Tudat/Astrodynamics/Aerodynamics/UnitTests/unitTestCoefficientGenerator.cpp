@@ -24,10 +24,13 @@
 #include <Eigen/Core>
 
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Astrodynamics/Aerodynamics/aerodynamics.h"
 #include "Tudat/Astrodynamics/Aerodynamics/hypersonicLocalInclinationAnalysis.h"
+#include "Tudat/Astrodynamics/Aerodynamics/panelMethodKernels.h"
 #include "Tudat/Astrodynamics/Aerodynamics/customAerodynamicCoefficientInterface.h"
 #include "Tudat/Basics/basicTypedefs.h"
 #include "Tudat/Mathematics/GeometricShapes/capsule.h"
+#include "Tudat/Mathematics/GeometricShapes/lawgsPartGeometry.h"
 #include "Tudat/Mathematics/GeometricShapes/sphereSegment.h"
 
 #include "Tudat/Astrodynamics/Aerodynamics/UnitTests/testApolloCapsuleCoefficients.h"
@@ -246,7 +249,8 @@ BOOST_AUTO_TEST_CASE( testAerodynamicCoefficientGenerator )
     }
 }
 
-boost::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInterface( )
+boost::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInterface(
+        const unsigned int numberOfThreads = 1, const bool generateCoefficientsOnDemand = false )
 {
 
     // Create test capsule.
@@ -304,7 +308,7 @@ boost::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInte
     return boost::make_shared< HypersonicLocalInclinationAnalysis >(
                 independentVariableDataPoints, capsule, numberOfLines, numberOfPoints,
                 invertOrders, selectedMethods, PI * pow( capsule->getMiddleRadius( ), 2.0 ),
-                3.9116, momentReference );
+                3.9116, momentReference, numberOfThreads, generateCoefficientsOnDemand );
 }
 //! Apollo capsule test case.
 BOOST_AUTO_TEST_CASE( testApolloCapsule )
@@ -392,6 +396,161 @@ BOOST_AUTO_TEST_CASE( testApolloCapsule )
                        toleranceAerodynamicCoefficients5 );
 }
 
+//! Test parallel and on demand generation of coefficients, by comparison with serial generation at all grid points.
+BOOST_AUTO_TEST_CASE( testParallelAndOnDemandCoefficientGeneration )
+{
+    boost::shared_ptr< HypersonicLocalInclinationAnalysis > coefficientInterface = getApolloCoefficientInterface( );
+    boost::multi_array< Vector6d, 3 > coefficientTables =
+            coefficientInterface->getAerodynamicCoefficientsTables( );
+    BOOST_CHECK_EQUAL( coefficientInterface->getNumberOfGeneratedDataPoints( ),
+                       static_cast< int >( coefficientTables.num_elements( ) ) );
+
+    // Check that coefficients generated in parallel are identical to those generated serially.
+    boost::shared_ptr< HypersonicLocalInclinationAnalysis > parallelCoefficientInterface =
+            getApolloCoefficientInterface( 3 );
+    BOOST_CHECK( parallelCoefficientInterface->getAerodynamicCoefficientsTables( ) == coefficientTables );
+
+    // Create coefficient interface that computes coefficients on demand, and check that no coefficients are computed
+    // at creation.
+    boost::shared_ptr< HypersonicLocalInclinationAnalysis > onDemandCoefficientInterface =
+            getApolloCoefficientInterface( 1, true );
+    BOOST_CHECK_EQUAL( onDemandCoefficientInterface->getNumberOfGeneratedDataPoints( ), 0 );
+
+    // Check that interpolated coefficients are identical to those from fully generated database, and that only the
+    // grid points surrounding the independent variables are computed.
+    std::vector< double > independentVariables( 3 );
+    independentVariables[ 0 ] = 7.0;
+    independentVariables[ 1 ] = -10.0 * PI / 180.0;
+    independentVariables[ 2 ] = 0.2 * PI / 180.0;
+
+    coefficientInterface->updateCurrentCoefficients( independentVariables );
+    onDemandCoefficientInterface->updateCurrentCoefficients( independentVariables );
+    BOOST_CHECK( onDemandCoefficientInterface->getCurrentAerodynamicCoefficients( ) ==
+                 coefficientInterface->getCurrentAerodynamicCoefficients( ) );
+    BOOST_CHECK_EQUAL( onDemandCoefficientInterface->getNumberOfGeneratedDataPoints( ), 8 );
+
+    independentVariables[ 0 ] = 6.0;
+    onDemandCoefficientInterface->updateCurrentCoefficients( independentVariables );
+    BOOST_CHECK_EQUAL( onDemandCoefficientInterface->getNumberOfGeneratedDataPoints( ), 8 );
+
+    independentVariables[ 0 ] = 12.0;
+    independentVariables[ 1 ] = -22.0 * PI / 180.0;
+    coefficientInterface->updateCurrentCoefficients( independentVariables );
+    onDemandCoefficientInterface->updateCurrentCoefficients( independentVariables );
+    BOOST_CHECK( onDemandCoefficientInterface->getCurrentAerodynamicCoefficients( ) ==
+                 coefficientInterface->getCurrentAerodynamicCoefficients( ) );
+    BOOST_CHECK_EQUAL( onDemandCoefficientInterface->getNumberOfGeneratedDataPoints( ), 16 );
+
+    // Check coefficients at individual grid points.
+    boost::array< int, 3 > independentVariableIndices = { { 2, 4, 1 } };
+    BOOST_CHECK( onDemandCoefficientInterface->getAerodynamicCoefficientsDataPoint( independentVariableIndices ) ==
+                 coefficientTables( independentVariableIndices ) );
+
+    // Check that coefficients computed at individual grid points are used by the interpolator, by computing all
+    // grid points surrounding the independent variables before interpolating.
+    boost::shared_ptr< HypersonicLocalInclinationAnalysis > dataPointCoefficientInterface =
+            getApolloCoefficientInterface( 1, true );
+    independentVariableIndices[ 2 ] = 0;
+    for( unsigned int i = 0; i < 8; i++ )
+    {
+        boost::array< int, 3 > surroundingIndices = independentVariableIndices;
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            surroundingIndices[ j ] += ( i >> j ) & 1;
+            independentVariables[ j ] = 0.5 * (
+                        coefficientInterface->getIndependentVariablePoint( j, independentVariableIndices[ j ] ) +
+                        coefficientInterface->getIndependentVariablePoint( j, independentVariableIndices[ j ] + 1 ) );
+        }
+        dataPointCoefficientInterface->getAerodynamicCoefficientsDataPoint( surroundingIndices );
+    }
+    BOOST_CHECK_EQUAL( dataPointCoefficientInterface->getNumberOfGeneratedDataPoints( ), 8 );
+
+    coefficientInterface->updateCurrentCoefficients( independentVariables );
+    dataPointCoefficientInterface->updateCurrentCoefficients( independentVariables );
+    BOOST_CHECK( dataPointCoefficientInterface->getCurrentAerodynamicCoefficients( ) ==
+                 coefficientInterface->getCurrentAerodynamicCoefficients( ) );
+    BOOST_CHECK_EQUAL( dataPointCoefficientInterface->getNumberOfGeneratedDataPoints( ), 8 );
+
+    // Check that all coefficients are computed when using cubic spline interpolation.
+    boost::shared_ptr< interpolators::InterpolatorSettings > cubicSplineSettings =
+            boost::make_shared< interpolators::InterpolatorSettings >( interpolators::cubic_spline_interpolator );
+    coefficientInterface->resetInterpolationSettings( cubicSplineSettings );
+    onDemandCoefficientInterface->resetInterpolationSettings( cubicSplineSettings );
+
+    coefficientInterface->updateCurrentCoefficients( independentVariables );
+    onDemandCoefficientInterface->updateCurrentCoefficients( independentVariables );
+    BOOST_CHECK( onDemandCoefficientInterface->getCurrentAerodynamicCoefficients( ) ==
+                 coefficientInterface->getCurrentAerodynamicCoefficients( ) );
+    BOOST_CHECK( onDemandCoefficientInterface->getAerodynamicCoefficientsTables( ) == coefficientTables );
+}
+
+//! Test panel method kernels on contiguous panel arrays by comparison with computation per panel.
+BOOST_AUTO_TEST_CASE( testPanelMethodKernels )
+{
+    // Create sphere mesh with 400 panels.
+    boost::shared_ptr< geometric_shapes::SphereSegment > sphere
+            = boost::make_shared< geometric_shapes::SphereSegment >( 1.0 );
+    boost::shared_ptr< geometric_shapes::LawgsPartGeometry > meshedSphere =
+            boost::make_shared< geometric_shapes::LawgsPartGeometry >( );
+    meshedSphere->setMesh( sphere, 21, 21 );
+
+    Eigen::Vector3d momentReferencePoint( 0.1, -0.2, 0.3 );
+    SurfacePanelArrays panels( meshedSphere, momentReferencePoint );
+    BOOST_CHECK_EQUAL( panels.getNumberOfPanels( ), 20 * 20 );
+
+    // Use Newtonian compression and vacuum expansion pressures.
+    double machNumber = 10.0;
+    double expansionPressureCoefficient = computeVacuumPressureCoefficient( machNumber, 1.4 );
+
+    Eigen::VectorXd pressureCoefficients = Eigen::VectorXd::Zero( panels.getNumberOfPanels( ) );
+    PanelInclinations inclinations;
+
+    for( int k = 0; k < 5; k++ )
+    {
+        double angleOfAttack = -0.5 + 0.2 * static_cast< double >( k );
+        double angleOfSideslip = 0.05 * static_cast< double >( k );
+        Eigen::Vector3d freestreamVelocityDirection(
+                    std::cos( angleOfAttack ) * std::cos( angleOfSideslip ), std::sin( angleOfSideslip ),
+                    std::sin( angleOfAttack ) * std::cos( angleOfSideslip ) );
+
+        // Compute force and moment using kernels on contiguous panel arrays.
+        computePanelInclinations( panels, freestreamVelocityDirection, inclinations );
+        computeNewtonianCompressionPressureCoefficients( inclinations, 2.0, pressureCoefficients );
+        setConstantExpansionPressureCoefficients( inclinations, expansionPressureCoefficient, pressureCoefficients );
+
+        Vector6d kernelCoefficients;
+        kernelCoefficients.segment( 0, 3 ) = computePanelForce( panels, pressureCoefficients );
+        kernelCoefficients.segment( 3, 3 ) = computePanelMoment( panels, pressureCoefficients );
+
+        // Compute force and moment one panel at a time through mesh accessor functions.
+        Vector6d panelLoopCoefficients = Vector6d::Zero( );
+        for( int i = 0; i < meshedSphere->getNumberOfLines( ) - 1; i++ )
+        {
+            for( int j = 0; j < meshedSphere->getNumberOfPoints( ) - 1; j++ )
+            {
+                double inclination = PI / 2.0 - std::acos(
+                            meshedSphere->getPanelSurfaceNormal( i, j ).dot( freestreamVelocityDirection ) );
+                double pressureCoefficient = ( inclination > 0.0 ) ?
+                            computeNewtonianPressureCoefficient( inclination ) : expansionPressureCoefficient;
+
+                panelLoopCoefficients.segment( 0, 3 ) -=
+                        pressureCoefficient * meshedSphere->getPanelArea( i, j ) *
+                        meshedSphere->getPanelSurfaceNormal( i, j );
+                panelLoopCoefficients.segment( 3, 3 ) -=
+                        pressureCoefficient * meshedSphere->getPanelArea( i, j ) *
+                        ( meshedSphere->getPanelCentroid( i, j ) - momentReferencePoint ).cross(
+                            meshedSphere->getPanelSurfaceNormal( i, j ) );
+            }
+        }
+
+        // Check consistency of results (forces and moments of order PI and 0.2 * PI, respectively).
+        for( int i = 0; i < 6; i++ )
+        {
+            BOOST_CHECK_SMALL( kernelCoefficients( i ) - panelLoopCoefficients( i ), 1.0E-13 );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -23,6 +23,8 @@
 
 #include <boost/assign/list_of.hpp>
 #include <boost/bind.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/make_shared.hpp>
 #include <boost/test/unit_test.hpp>
 
 #include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00Atmosphere.h"
@@ -30,6 +32,7 @@
 #include "Tudat/InputOutput/basicInputOutput.h"
 
 #include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00InputFunctions.h"
+#include "Tudat/Astrodynamics/Aerodynamics/tabulatedNRLMSISE00Atmosphere.h"
 
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 
@@ -1123,6 +1126,282 @@ BOOST_AUTO_TEST_CASE( test_nrlmise_InputFunction_with_adjustment )
     BOOST_CHECK_CLOSE_FRACTION(verificationData[5]*1000 , computedDensity , 1E-11);
 }
 
+//! Perform NRLMSISE-00 test 23 - Test day-indexed input table
+// Compares the input computed from the day-indexed input table to the input computed by nrlmsiseInputFunction,
+// for times throughout all days in the space weather file.
+BOOST_AUTO_TEST_CASE( test_nrlmise_InputTable )
+{
+    using tudat::aerodynamics::NRLMSISE00InputTable;
+
+    // find space weather file
+    std::string cppPath( __FILE__ );
+    std::string folder = cppPath.substr( 0, cppPath.find_last_of("/\\")+1);
+    std::string spaceWeatherFilePath = folder + "swAtmosTestWithAdjust.txt";
+
+    tudat::input_output::solar_activity::SolarActivityDataMap solarActivityData =
+            tudat::input_output::solar_activity::readSolarActivityData(spaceWeatherFilePath) ;
+    boost::shared_ptr< NRLMSISE00InputTable > inputTable = boost::make_shared< NRLMSISE00InputTable >(
+                solarActivityData );
+    BOOST_CHECK_EQUAL( inputTable->getFirstJulianDay( ), solarActivityData.begin( )->first );
+    BOOST_CHECK_EQUAL( inputTable->getNumberOfDays( ), static_cast< int >(
+                           solarActivityData.rbegin( )->first - solarActivityData.begin( )->first ) + 1 );
+
+    // Create atmosphere models using both input function and input table
+    boost::function< tudat::aerodynamics::NRLMSISE00Input (double,double,double,double) > inputFunction =
+            boost::bind(&tudat::aerodynamics::nrlmsiseInputFunction,_1,_2,_3,_4, solarActivityData , false , 0.0 );
+    tudat::aerodynamics::NRLMSISE00Atmosphere atmosphereModel( inputFunction );
+    tudat::aerodynamics::NRLMSISE00Atmosphere tableAtmosphereModel( inputTable );
+
+    double altitude = 400.0E3;
+    double latitude = 60.0 * PI / 180.0;
+    for( tudat::input_output::solar_activity::SolarActivityDataMap::const_iterator dataIterator =
+         solarActivityData.begin( ); dataIterator != solarActivityData.end( ); dataIterator++ )
+    {
+        double startOfDay = tudat::basic_astrodynamics::convertJulianDayToSecondsSinceEpoch(
+                    dataIterator->first, tudat::basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+        for( double time = startOfDay; time < startOfDay + physical_constants::JULIAN_DAY; time += 7877.0 )
+        {
+            double longitude = std::fmod( time, 2.0 * PI ) - PI;
+            NRLMSISE00Input expectedInput = inputFunction( altitude, longitude, latitude, time );
+            NRLMSISE00Input tableInput;
+            inputTable->getInput( tableInput, altitude, longitude, latitude, time );
+
+            BOOST_CHECK_EQUAL( expectedInput.year, tableInput.year );
+            BOOST_CHECK_EQUAL( expectedInput.dayOfTheYear, tableInput.dayOfTheYear );
+            BOOST_CHECK_EQUAL( expectedInput.secondOfTheDay, tableInput.secondOfTheDay );
+            BOOST_CHECK_EQUAL( expectedInput.localSolarTime, tableInput.localSolarTime );
+            BOOST_CHECK_EQUAL( expectedInput.f107, tableInput.f107 );
+            BOOST_CHECK_EQUAL( expectedInput.f107a, tableInput.f107a );
+            BOOST_CHECK_EQUAL( expectedInput.apDaily, tableInput.apDaily );
+            BOOST_CHECK_EQUAL_COLLECTIONS( expectedInput.apVector.begin( ), expectedInput.apVector.end( ),
+                                           tableInput.apVector.begin( ), tableInput.apVector.end( ) );
+
+            BOOST_CHECK_EQUAL( atmosphereModel.getDensity( altitude, longitude, latitude, time ),
+                               tableAtmosphereModel.getDensity( altitude, longitude, latitude, time ) );
+            BOOST_CHECK_EQUAL( tableAtmosphereModel.getNRLMSISE00Input( ).localSolarTime,
+                               expectedInput.localSolarTime );
+        }
+    }
+
+    // Check that times before, after, and in gaps of the solar activity data are rejected
+    std::vector< double > invalidTimes;
+    invalidTimes.push_back( tudat::basic_astrodynamics::convertJulianDayToSecondsSinceEpoch(
+                                solarActivityData.begin( )->first, tudat::basic_astrodynamics::JULIAN_DAY_ON_J2000 ) - 1.0 );
+    invalidTimes.push_back( tudat::basic_astrodynamics::convertJulianDayToSecondsSinceEpoch(
+                                solarActivityData.rbegin( )->first + 1.0, tudat::basic_astrodynamics::JULIAN_DAY_ON_J2000 ) );
+    invalidTimes.push_back( tudat::basic_astrodynamics::convertJulianDayToSecondsSinceEpoch(
+                                tudat::basic_astrodynamics::convertCalendarDateToJulianDay< double >( 1957, 10, 23, 12, 0, 0.0 ),
+                                tudat::basic_astrodynamics::JULIAN_DAY_ON_J2000 ) );
+    NRLMSISE00Input invalidInput;
+    for( unsigned int i = 0; i < invalidTimes.size( ); i++ )
+    {
+        bool isExceptionCaught = false;
+        try
+        {
+            inputTable->getInput( invalidInput, altitude, 0.0, latitude, invalidTimes.at( i ) );
+        }
+        catch( std::runtime_error )
+        {
+            isExceptionCaught = true;
+        }
+        BOOST_CHECK_EQUAL( isExceptionCaught, true );
+    }
+}
+
+//! Perform NRLMSISE-00 test 24 - Test tabulated NRLMSISE00 atmosphere
+// Generates tabulated properties from the NRLMSISE00 model, and checks the interpolated values at and between the grid
+// points, as well as saving and loading the tabulated properties to/from file.
+BOOST_AUTO_TEST_CASE( test_nrlmise_TabulatedAtmosphere )
+{
+    using namespace tudat::aerodynamics;
+
+    // find space weather file
+    std::string cppPath( __FILE__ );
+    std::string folder = cppPath.substr( 0, cppPath.find_last_of("/\\")+1);
+    std::string spaceWeatherFilePath = folder + "swAtmosTestWithAdjust.txt";
+
+    tudat::input_output::solar_activity::SolarActivityDataMap solarActivityData =
+            tudat::input_output::solar_activity::readSolarActivityData(spaceWeatherFilePath) ;
+    boost::shared_ptr< NRLMSISE00InputTable > inputTable = boost::make_shared< NRLMSISE00InputTable >(
+                solarActivityData );
+
+    // Define grid of altitude, latitude, local solar time and day (noon of 2-4 October 1957).
+    std::vector< std::vector< double > > independentVariables( 4 );
+    for( int i = 0; i < 5; i++ )
+    {
+        independentVariables[ 0 ].push_back( 200.0E3 + 100.0E3 * i );
+    }
+    for( int i = 0; i < 7; i++ )
+    {
+        independentVariables[ 1 ].push_back( -PI / 2.0 + PI / 6.0 * i );
+    }
+    for( int i = 0; i < 9; i++ )
+    {
+        independentVariables[ 2 ].push_back( 3.0 * i );
+    }
+    double firstDay = tudat::basic_astrodynamics::convertCalendarDateToJulianDay< double >( 1957, 10, 2, 12, 0, 0.0 ) -
+            tudat::basic_astrodynamics::JULIAN_DAY_ON_J2000;
+    for( int i = 0; i < 3; i++ )
+    {
+        independentVariables[ 3 ].push_back( firstDay + i );
+    }
+
+    // Generate tabulated properties
+    boost::multi_array< NRLMSISE00PropertiesVector, 4 > tabulatedProperties =
+            generateTabulatedNRLMSISE00Properties( inputTable, independentVariables );
+
+    // Check that grid points are reproduced (local solar time of 24 h is evaluated at 0 h, so is not checked).
+    TabulatedNRLMSISE00Atmosphere tabulatedAtmosphere( independentVariables, tabulatedProperties );
+    NRLMSISE00Atmosphere atmosphereModel( inputTable );
+    for( unsigned int i = 0; i < independentVariables[ 0 ].size( ); i++ )
+    {
+        for( unsigned int j = 0; j < independentVariables[ 1 ].size( ); j++ )
+        {
+            for( unsigned int k = 0; k < independentVariables[ 2 ].size( ) - 1; k++ )
+            {
+                for( unsigned int l = 0; l < independentVariables[ 3 ].size( ); l++ )
+                {
+                    double altitude = independentVariables[ 0 ][ i ];
+                    double latitude = independentVariables[ 1 ][ j ];
+                    double time = independentVariables[ 3 ][ l ] * physical_constants::JULIAN_DAY;
+                    double longitude = ( independentVariables[ 2 ][ k ] - 12.0 ) * PI / 12.0;
+
+                    BOOST_CHECK_CLOSE_FRACTION( tabulatedAtmosphere.getDensity( altitude, longitude, latitude, time ),
+                                                atmosphereModel.getDensity( altitude, longitude, latitude, time ),
+                                                1.0E-10 );
+                    BOOST_CHECK_CLOSE_FRACTION( tabulatedAtmosphere.getPressure( altitude, longitude, latitude, time ),
+                                                atmosphereModel.getPressure( altitude, longitude, latitude, time ),
+                                                1.0E-10 );
+                    BOOST_CHECK_CLOSE_FRACTION(
+                                tabulatedAtmosphere.getTemperature( altitude, longitude, latitude, time ),
+                                atmosphereModel.getTemperature( altitude, longitude, latitude, time ), 1.0E-10 );
+                    BOOST_CHECK_CLOSE_FRACTION(
+                                tabulatedAtmosphere.getSpeedOfSound( altitude, longitude, latitude, time ),
+                                atmosphereModel.getSpeedOfSound( altitude, longitude, latitude, time ), 1.0E-10 );
+
+                    Eigen::Matrix< double, 8, 1 > tabulatedNumberDensities =
+                            tabulatedAtmosphere.getNumberDensities( altitude, longitude, latitude, time );
+                    std::vector< double > numberDensities =
+                            atmosphereModel.getNumberDensities( altitude, longitude, latitude, time );
+                    for( unsigned int m = 0; m < 8; m++ )
+                    {
+                        BOOST_CHECK_CLOSE_FRACTION( tabulatedNumberDensities( m ), numberDensities.at( m ), 1.0E-10 );
+                    }
+                }
+            }
+        }
+    }
+
+    // Check that density between grid points is bounded by the density at the surrounding grid points.
+    for( int testIndex = 0; testIndex < 50; testIndex++ )
+    {
+        double altitude = 210.0E3 + 7.7E3 * testIndex;
+        double longitude = -PI + 0.37 * testIndex;
+        double latitude = -1.5 + 0.061 * testIndex;
+        double time = ( firstDay + 0.039 * testIndex ) * physical_constants::JULIAN_DAY;
+
+        boost::array< double, 4 > currentIndependentVariables =
+                TabulatedNRLMSISE00Atmosphere::getIndependentVariables( altitude, longitude, latitude, time );
+        boost::array< int, 4 > lowerIndices;
+        for( unsigned int i = 0; i < 4; i++ )
+        {
+            lowerIndices[ i ] = std::upper_bound( independentVariables[ i ].begin( ), independentVariables[ i ].end( ),
+                                                  currentIndependentVariables[ i ] ) -
+                    independentVariables[ i ].begin( ) - 1;
+        }
+
+        double minimumDensity = TUDAT_NAN, maximumDensity = TUDAT_NAN;
+        for( unsigned int corner = 0; corner < 16; corner++ )
+        {
+            double cornerDensity = std::exp(
+                        tabulatedProperties[ lowerIndices[ 0 ] + ( corner & 1 ) ][ lowerIndices[ 1 ] + ( ( corner >> 1 ) & 1 ) ]
+                    [ lowerIndices[ 2 ] + ( ( corner >> 2 ) & 1 ) ][ lowerIndices[ 3 ] + ( ( corner >> 3 ) & 1 ) ]( 0 ) );
+            minimumDensity = ( corner == 0 ) ? cornerDensity : std::min( minimumDensity, cornerDensity );
+            maximumDensity = ( corner == 0 ) ? cornerDensity : std::max( maximumDensity, cornerDensity );
+        }
+
+        double interpolatedDensity = tabulatedAtmosphere.getDensity( altitude, longitude, latitude, time );
+        BOOST_CHECK( interpolatedDensity >= minimumDensity * ( 1.0 - 1.0E-12 ) );
+        BOOST_CHECK( interpolatedDensity <= maximumDensity * ( 1.0 + 1.0E-12 ) );
+    }
+
+    // Create tabulated atmosphere, saving the generated properties to file, and check that the file contains the
+    // properties and the key of the input table.
+    boost::filesystem::path tabulatedPropertiesFile =
+            boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( "tudat_nrlmsise_%%%%-%%%%.bin" );
+    boost::shared_ptr< TabulatedNRLMSISE00Atmosphere > savedAtmosphere = createTabulatedNRLMSISE00Atmosphere(
+                inputTable, independentVariables, tabulatedPropertiesFile.string( ) );
+    BOOST_CHECK( boost::filesystem::exists( tabulatedPropertiesFile ) );
+
+    std::vector< std::vector< double > > readIndependentVariables;
+    boost::multi_array< NRLMSISE00PropertiesVector, 4 > readProperties;
+    BOOST_CHECK( readTabulatedNRLMSISE00PropertiesFromFile(
+                     tabulatedPropertiesFile.string( ), getTabulatedNRLMSISE00InputKey( inputTable ),
+                     readIndependentVariables, readProperties ) );
+    BOOST_CHECK( readIndependentVariables == independentVariables );
+    BOOST_CHECK( readProperties == tabulatedProperties );
+
+    // Check that the file is rejected for a different input key.
+    std::vector< std::vector< double > > rejectedIndependentVariables;
+    BOOST_CHECK( !readTabulatedNRLMSISE00PropertiesFromFile(
+                     tabulatedPropertiesFile.string( ), getTabulatedNRLMSISE00InputKey( inputTable ) + 1,
+                     rejectedIndependentVariables, readProperties ) );
+    BOOST_CHECK( rejectedIndependentVariables.empty( ) );
+
+    // Check that loaded atmosphere is identical to generated atmosphere.
+    boost::shared_ptr< TabulatedNRLMSISE00Atmosphere > loadedAtmosphere = createTabulatedNRLMSISE00Atmosphere(
+                inputTable, independentVariables, tabulatedPropertiesFile.string( ) );
+    for( int testIndex = 0; testIndex < 50; testIndex++ )
+    {
+        double altitude = 210.0E3 + 7.7E3 * testIndex;
+        double longitude = -PI + 0.37 * testIndex;
+        double latitude = -1.5 + 0.061 * testIndex;
+        double time = ( firstDay + 0.039 * testIndex ) * physical_constants::JULIAN_DAY;
+        BOOST_CHECK_EQUAL( loadedAtmosphere->getDensity( altitude, longitude, latitude, time ),
+                           tabulatedAtmosphere.getDensity( altitude, longitude, latitude, time ) );
+        BOOST_CHECK_EQUAL( loadedAtmosphere->getTemperature( altitude, longitude, latitude, time ),
+                           savedAtmosphere->getTemperature( altitude, longitude, latitude, time ) );
+    }
+
+    // Check that file is not used for different solar activity data (first day removed), but regenerated.
+    tudat::input_output::solar_activity::SolarActivityDataMap otherSolarActivityData = solarActivityData;
+    otherSolarActivityData.erase( otherSolarActivityData.begin( ) );
+    boost::shared_ptr< NRLMSISE00InputTable > otherInputTable = boost::make_shared< NRLMSISE00InputTable >(
+                otherSolarActivityData );
+    BOOST_CHECK( getTabulatedNRLMSISE00InputKey( otherInputTable ) != getTabulatedNRLMSISE00InputKey( inputTable ) );
+
+    createTabulatedNRLMSISE00Atmosphere( otherInputTable, independentVariables, tabulatedPropertiesFile.string( ) );
+    BOOST_CHECK( !readTabulatedNRLMSISE00PropertiesFromFile(
+                     tabulatedPropertiesFile.string( ), getTabulatedNRLMSISE00InputKey( inputTable ),
+                     readIndependentVariables, readProperties ) );
+    BOOST_CHECK( readTabulatedNRLMSISE00PropertiesFromFile(
+                     tabulatedPropertiesFile.string( ), getTabulatedNRLMSISE00InputKey( otherInputTable ),
+                     readIndependentVariables, readProperties ) );
+
+    // Check that file is not used for a different grid.
+    std::vector< std::vector< double > > otherIndependentVariables = independentVariables;
+    otherIndependentVariables[ 0 ].pop_back( );
+    boost::shared_ptr< TabulatedNRLMSISE00Atmosphere > otherGridAtmosphere = createTabulatedNRLMSISE00Atmosphere(
+                otherInputTable, otherIndependentVariables, tabulatedPropertiesFile.string( ) );
+    BOOST_CHECK( otherGridAtmosphere->getGridPoints( ) == otherIndependentVariables );
+
+    // Check that no atmosphere is created without input table.
+    bool isExceptionCaught = false;
+    try
+    {
+        createTabulatedNRLMSISE00Atmosphere(
+                    boost::shared_ptr< NRLMSISE00InputTable >( ), independentVariables,
+                    tabulatedPropertiesFile.string( ) );
+    }
+    catch( std::runtime_error )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+
+    boost::filesystem::remove( tabulatedPropertiesFile );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
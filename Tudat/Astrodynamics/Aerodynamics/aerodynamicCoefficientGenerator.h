@@ -25,7 +25,7 @@
 #include <Eigen/Core>
 
 #include "Tudat/Astrodynamics/Aerodynamics/aerodynamicCoefficientInterface.h"
-#include "Tudat/Mathematics/Interpolators/multiLinearInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/createInterpolator.h"
 #include "Tudat/Basics/basicTypedefs.h"
 
 namespace tudat
@@ -162,6 +162,20 @@ public:
         return dataPointsOfIndependentVariables_;
     }
 
+    //! Function to reset the type of interpolation used for the generated coefficients.
+    /*!
+     *  Function to reset the type of interpolation used for the generated coefficients (multi-linear by default).
+     *  Settings of type cubic_spline_interpolator result in tensor-product cubic spline interpolation, for which the
+     *  coefficients are continuously differentiable w.r.t. all independent variables.
+     *  \param interpolationSettings Settings to be used for creating the multi-dimensional interpolator of the
+     *  coefficients.
+     */
+    void resetInterpolationSettings(
+            const boost::shared_ptr< interpolators::InterpolatorSettings > interpolationSettings )
+    {
+        createInterpolator( interpolationSettings );
+    }
+
     //! Compute the aerodynamic coefficients at current flight condition.
     /*!
      *  Compute the aerodynamic coefficients at current flight conditions (independent variables).
@@ -203,14 +217,35 @@ protected:
 
     //! Function to create the coefficient interpolator from the discrete set in
     //! aerodynamicCoefficients_
-    void createInterpolator( )
+    /*!
+     *  Function to create the coefficient interpolator from the discrete set in aerodynamicCoefficients_. A
+     *  multi-linear interpolator interpolates directly from aerodynamicCoefficients_ (without copying it), so that
+     *  coefficients that are modified after the creation of the interpolator (e.g. when generated on demand) are
+     *  used without re-creating the interpolator. Other interpolators are created from a copy of the coefficients.
+     *  \param interpolationSettings Settings to be used for creating the multi-dimensional interpolator of the
+     *  coefficients (multi-linear interpolation by default, see createMultiDimensionalInterpolator).
+     */
+    void createInterpolator(
+            const boost::shared_ptr< interpolators::InterpolatorSettings > interpolationSettings =
+            boost::make_shared< interpolators::InterpolatorSettings >( interpolators::linear_interpolator ) )
     {
         // Create interpolator for coefficients.
-        coefficientInterpolator_ =
-                boost::make_shared< interpolators::MultiLinearInterpolator< double,
-                Eigen::Vector6d, 3 > >
-                ( dataPointsOfIndependentVariables_, aerodynamicCoefficients_ );
-
+        interpolationSettings_ = interpolationSettings;
+        if( interpolationSettings->getInterpolatorType( ) == interpolators::linear_interpolator )
+        {
+            // Storage of coefficients is owned by this object, which also owns the interpolator.
+            coefficientInterpolator_ = boost::make_shared< interpolators::MultiLinearInterpolator<
+                    double, Eigen::Vector6d, NumberOfIndependentVariables > >(
+                        dataPointsOfIndependentVariables_, aerodynamicCoefficients_, boost::shared_ptr< const void >( ),
+                        interpolationSettings->getSelectedLookupScheme( ) );
+        }
+        else
+        {
+            coefficientInterpolator_ =
+                    interpolators::createMultiDimensionalInterpolator< double, Eigen::Vector6d,
+                    NumberOfIndependentVariables >( dataPointsOfIndependentVariables_, aerodynamicCoefficients_,
+                                                    interpolationSettings );
+        }
     }
 
     //! N-dimensional array containing all computer aerodynamic coefficients.
@@ -232,6 +267,9 @@ protected:
      */
     std::vector< std::vector< double > > dataPointsOfIndependentVariables_;
 
+    //! Settings used to create coefficientInterpolator_.
+    boost::shared_ptr< interpolators::InterpolatorSettings > interpolationSettings_;
+
     //! Interpolator producing continuous aerodynamic coefficients from the discrete calculations
     //! contained in aerodynamicCoefficients_.
     boost::shared_ptr< interpolators::Interpolator< double, Eigen::Vector6d > >
@@ -30,7 +30,8 @@ FlightConditions::FlightConditions(
         const boost::shared_ptr< basic_astrodynamics::BodyShapeModel > shapeModel,
         const boost::shared_ptr< AerodynamicCoefficientInterface > aerodynamicCoefficientInterface,
         const boost::shared_ptr< reference_frames::AerodynamicAngleCalculator > aerodynamicAngleCalculator,
-        const boost::function< double( const std::string& ) > controlSurfaceDeflectionFunction ):
+        const boost::function< double( const std::string& ) > controlSurfaceDeflectionFunction,
+        const bool updateAerodynamicCoefficients ):
     atmosphereModel_( atmosphereModel ),
     shapeModel_( shapeModel ),
     aerodynamicCoefficientInterface_( aerodynamicCoefficientInterface ),
@@ -61,7 +62,8 @@ FlightConditions::FlightConditions(
         updateLatitudeAndLongitudeForAtmosphere_ = 0;
     }
     isLatitudeAndLongitudeSet_ = 0;
-
+    isScalarFlightConditionComputed_.assign( false );
+    updateAerodynamicCoefficients_ = updateAerodynamicCoefficients;
 
     if( updateLatitudeAndLongitudeForAtmosphere_ && aerodynamicAngleCalculator_== NULL )
     {
@@ -90,13 +92,16 @@ void FlightConditions::setAerodynamicCoefficientsIndependentVariableFunction(
     }
 }
 
-//! Function to update all flight conditions.
-void FlightConditions::updateConditions( const double currentTime )
+//! Function to update all flight conditions, with explicit setting of whether the coefficients are updated.
+void FlightConditions::updateConditions( const double currentTime, const bool updateAerodynamicCoefficients )
 {
     if( !( currentTime == currentTime_ ) )
     {
         currentTime_ = currentTime;
 
+        // Clear flight conditions of previous time; these are recomputed when requested.
+        clearComputedFlightConditions( );
+
         // Update aerodynamic angles (but not angles w.r.t. body-fixed frame).
         if( aerodynamicAngleCalculator_!= NULL )
         {
@@ -106,18 +111,21 @@ void FlightConditions::updateConditions( const double currentTime )
         // Calculate state of vehicle in global frame and corotating frame.
         currentBodyCenteredPseudoBodyFixedState_ = bodyCenteredPseudoBodyFixedStateFunction_( );
 
-        updateAerodynamicCoefficientInput( );
-
-        // Update angles from aerodynamic to body-fixed frame (if relevant).
+        // Update angles from aerodynamic to body-fixed frame (if relevant). Any coefficient input required by the
+        // angle functions (e.g. for trim) is computed when requested from getAerodynamicCoefficientIndependentVariables.
         if( aerodynamicAngleCalculator_!= NULL )
         {
             aerodynamicAngleCalculator_->update( currentTime, true );
-            updateAerodynamicCoefficientInput( );
         }
 
-        // Update aerodynamic coefficients.
-        aerodynamicCoefficientInterface_->updateFullCurrentCoefficients(
-                    aerodynamicCoefficientIndependentVariables_, controlSurfaceAerodynamicCoefficientIndependentVariables_ );
+        // Update aerodynamic coefficients, if required.
+        if( updateAerodynamicCoefficients )
+        {
+            updateAerodynamicCoefficientInput( );
+            aerodynamicCoefficientInterface_->updateFullCurrentCoefficients(
+                        aerodynamicCoefficientIndependentVariables_,
+                        controlSurfaceAerodynamicCoefficientIndependentVariables_ );
+        }
     }
 }
 
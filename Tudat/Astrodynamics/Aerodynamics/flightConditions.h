@@ -13,6 +13,7 @@
 
 #include <vector>
 
+#include <boost/array.hpp>
 #include <boost/function.hpp>
 #include <boost/bind.hpp>
 
@@ -35,7 +36,10 @@ namespace aerodynamics
  *  Class for calculating aerodynamic flight characteristics of a vehicle during numerical
  *  integration. Class is used to ensure that dependent variables such as density, altitude, etc.
  *  are only calculated once during each numerical integration step. The get functions of this class
- *  are linked to the various models in the code that subsequently require these values.
+ *  are linked to the various models in the code that subsequently require these values. Scalar flight conditions
+ *  are only computed when first requested after an update. The aerodynamic coefficients are updated by
+ *  updateConditions unless this is switched off, either for all updates (see setUpdateAerodynamicCoefficients) or for
+ *  a single update. The latter is done by the environment updater of a propagation that does not use the coefficients.
  */
 class FlightConditions
 {
@@ -54,7 +58,8 @@ private:
         speed_of_sound_flight_condition,
         airspeed_flight_condition,
         geodetic_latitude_condition,
-        dynamic_pressure_condition
+        dynamic_pressure_condition,
+        number_of_flight_condition_variables
     };
 
 public:
@@ -71,6 +76,8 @@ public:
      *  of the vehicle are calculated.
      *  \param controlSurfaceDeflectionFunction Function returning control surface deflection, with input the control
      *  surface identifier.
+     *  \param updateAerodynamicCoefficients Boolean denoting whether the aerodynamic coefficients are to be updated by
+     *  the updateConditions function (see setUpdateAerodynamicCoefficients).
      */
     FlightConditions( const boost::shared_ptr< aerodynamics::AtmosphereModel > atmosphereModel,
                       const boost::shared_ptr< basic_astrodynamics::BodyShapeModel > shapeModel,
@@ -80,15 +87,33 @@ public:
                       aerodynamicAngleCalculator =
             boost::shared_ptr< reference_frames::AerodynamicAngleCalculator >( ),
                       const boost::function< double( const std::string& )> controlSurfaceDeflectionFunction =
-            boost::function< double( const std::string& )>( ) );
+            boost::function< double( const std::string& )>( ),
+                      const bool updateAerodynamicCoefficients = true );
 
     //! Function to update all flight conditions.
     /*!
-     *  Function to update all flight conditions (altitude, density, force coefficients) to
-     *  current state of vehicle and central body.
+     *  Function to update all flight conditions to current state of vehicle and central body. The body-fixed state and
+     *  aerodynamic angles are updated directly, as are the aerodynamic coefficients if updateAerodynamicCoefficients_
+     *  is true. All other flight conditions (altitude, density, etc.) are computed when first requested.
      *  \param currentTime Time to which conditions are to be updated.
      */
-    void updateConditions( const double currentTime );
+    void updateConditions( const double currentTime )
+    {
+        updateConditions( currentTime, updateAerodynamicCoefficients_ );
+    }
+
+    //! Function to update all flight conditions, with explicit setting of whether the coefficients are updated.
+    /*!
+     *  Function to update all flight conditions to current state of vehicle and central body. The body-fixed state and
+     *  aerodynamic angles are updated directly, as are the aerodynamic coefficients if updateAerodynamicCoefficients
+     *  is true (irrespective of updateAerodynamicCoefficients_). All other flight conditions (altitude, density, etc.)
+     *  are computed when first requested. This function is used by the environment updater of a propagation that
+     *  does not use the aerodynamic coefficients of this object, leaving the setting of updateAerodynamicCoefficients_
+     *  (which may be used by other propagations) unchanged.
+     *  \param currentTime Time to which conditions are to be updated.
+     *  \param updateAerodynamicCoefficients Boolean denoting whether the aerodynamic coefficients are to be updated.
+     */
+    void updateConditions( const double currentTime, const bool updateAerodynamicCoefficients );
 
     //! Function to retrieve (and compute if necessary) the current altitude
     /*!
@@ -97,11 +122,12 @@ public:
      */
     double getCurrentAltitude( )
     {
-        if( scalarFlightConditions_.count( altitude_flight_condition ) == 0 )
+        if( !isScalarFlightConditionComputed_[ altitude_flight_condition ] )
         {
             computeAltitude( );
         }
-        return scalarFlightConditions_.at( altitude_flight_condition );    }
+        return scalarFlightConditions_[ altitude_flight_condition ];
+    }
 
     //! Function to retrieve (and compute if necessary) the current freestream density
     /*!
@@ -110,11 +136,11 @@ public:
      */
     double getCurrentDensity( )
     {
-        if( scalarFlightConditions_.count( density_flight_condition ) == 0 )
+        if( !isScalarFlightConditionComputed_[ density_flight_condition ] )
         {
             computeDensity( );
         }
-        return scalarFlightConditions_.at( density_flight_condition );
+        return scalarFlightConditions_[ density_flight_condition ];
     }
 
     //! Function to retrieve (and compute if necessary) the current freestream temperature
@@ -124,11 +150,11 @@ public:
      */
     double getCurrentFreestreamTemperature( )
     {
-        if( scalarFlightConditions_.count( temperature_flight_condition ) == 0 )
+        if( !isScalarFlightConditionComputed_[ temperature_flight_condition ] )
         {
             computeTemperature( );
         }
-        return scalarFlightConditions_.at( temperature_flight_condition );
+        return scalarFlightConditions_[ temperature_flight_condition ];
     }
 
     //! Function to retrieve (and compute if necessary) the current freestream dynamic pressure
@@ -138,11 +164,11 @@ public:
      */
     double getCurrentDynamicPressure( )
     {
-        if( scalarFlightConditions_.count( dynamic_pressure_condition ) == 0 )
+        if( !isScalarFlightConditionComputed_[ dynamic_pressure_condition ] )
         {
             computeDynamicPressure( );
         }
-        return scalarFlightConditions_.at( dynamic_pressure_condition );
+        return scalarFlightConditions_[ dynamic_pressure_condition ];
     }
 
     //! Function to retrieve (and compute if necessary) the current freestream pressure
@@ -152,11 +178,11 @@ public:
      */
     double getCurrentPressure( )
     {
-        if( scalarFlightConditions_.count( pressure_flight_condition ) == 0 )
+        if( !isScalarFlightConditionComputed_[ pressure_flight_condition ] )
         {
             computeFreestreamPressure( );
         }
-        return scalarFlightConditions_.at( pressure_flight_condition );
+        return scalarFlightConditions_[ pressure_flight_condition ];
     }
 
     /*!
@@ -165,11 +191,11 @@ public:
      */
     double getCurrentAirspeed( )
     {
-        if( scalarFlightConditions_.count( airspeed_flight_condition ) == 0 )
+        if( !isScalarFlightConditionComputed_[ airspeed_flight_condition ] )
         {
             computeAirspeed( );
         }
-        return scalarFlightConditions_.at( airspeed_flight_condition );
+        return scalarFlightConditions_[ airspeed_flight_condition ];
     }
 
     //! Function to retrieve (and compute if necessary) the current speed of sound
@@ -179,11 +205,11 @@ public:
      */
     double getCurrentSpeedOfSound( )
     {
-        if( scalarFlightConditions_.count( speed_of_sound_flight_condition ) == 0 )
+        if( !isScalarFlightConditionComputed_[ speed_of_sound_flight_condition ] )
         {
             computeSpeedOfSound( );
         }
-        return scalarFlightConditions_.at( speed_of_sound_flight_condition );
+        return scalarFlightConditions_[ speed_of_sound_flight_condition ];
     }
 
     //! Function to retrieve (and compute if necessary) the current Mach number
@@ -193,11 +219,11 @@ public:
      */
     double getCurrentMachNumber( )
     {
-        if( scalarFlightConditions_.count( mach_number_flight_condition ) == 0 )
+        if( !isScalarFlightConditionComputed_[ mach_number_flight_condition ] )
         {
             computeMachNumber( );
         }
-        return scalarFlightConditions_.at( mach_number_flight_condition );
+        return scalarFlightConditions_[ mach_number_flight_condition ];
     }
 
     //! Function to retrieve (and compute if necessary) the current geodetic latitude
@@ -207,11 +233,11 @@ public:
      */
     double getCurrentGeodeticLatitude( )
     {
-        if( scalarFlightConditions_.count( geodetic_latitude_condition ) == 0 )
+        if( !isScalarFlightConditionComputed_[ geodetic_latitude_condition ] )
         {
             computeGeodeticLatitude( );
         }
-        return scalarFlightConditions_.at( geodetic_latitude_condition );
+        return scalarFlightConditions_[ geodetic_latitude_condition ];
     }
 
     //! Function to return the current time of the FlightConditions
@@ -301,6 +327,29 @@ public:
         return aerodynamicCoefficientInterface_;
     }
 
+    //! Function to set whether the aerodynamic coefficients are to be updated by updateConditions.
+    /*!
+     *  Function to set whether the aerodynamic coefficients (and their independent variables) are to be updated by
+     *  updateConditions, if not specified explicitly. Note that the environment updater of a propagation does not
+     *  update the coefficients if the propagation uses only other flight conditions (e.g. density), irrespective of
+     *  this setting (see propagators::getBodiesWithoutAerodynamicCoefficientUpdate).
+     *  \param updateAerodynamicCoefficients Boolean denoting whether the aerodynamic coefficients are to be updated.
+     */
+    void setUpdateAerodynamicCoefficients( const bool updateAerodynamicCoefficients )
+    {
+        updateAerodynamicCoefficients_ = updateAerodynamicCoefficients;
+    }
+
+    //! Function to retrieve whether the aerodynamic coefficients are to be updated by updateConditions.
+    /*!
+     *  Function to retrieve whether the aerodynamic coefficients are to be updated by updateConditions.
+     *  \return Boolean denoting whether the aerodynamic coefficients are to be updated.
+     */
+    bool getUpdateAerodynamicCoefficients( )
+    {
+        return updateAerodynamicCoefficients_;
+    }
+
     //! Function to return list of independent variables of the aerodynamic coefficient interface
     /*!
      *  Function to return list of independent variables of the aerodynamic coefficient interface
@@ -345,12 +394,9 @@ public:
     {
         currentTime_ = currentTime;
 
-        scalarFlightConditions_.clear( );
-        isLatitudeAndLongitudeSet_ = 0;
+        clearComputedFlightConditions( );
 
         aerodynamicAngleCalculator_->resetCurrentTime( currentTime_ );
-        aerodynamicCoefficientIndependentVariables_.clear( );
-        controlSurfaceAerodynamicCoefficientIndependentVariables_.clear( );
     }
 
 private:
@@ -366,28 +412,50 @@ private:
             const AerodynamicCoefficientsIndependentVariables independentVariableType,
             const std::string& secondaryIdentifier = "" );
 
+    //! Function to set the value of a scalar flight condition at the current time.
+    /*!
+     * Function to set the value of a scalar flight condition at the current time.
+     * \param variable Identifier of flight condition that is to be set.
+     * \param value Value of flight condition at the current time.
+     */
+    void setScalarFlightCondition( const FlightConditionVariables variable, const double value )
+    {
+        scalarFlightConditions_[ variable ] = value;
+        isScalarFlightConditionComputed_[ variable ] = true;
+    }
+
+    //! Function to clear all flight conditions computed at the current time.
+    void clearComputedFlightConditions( )
+    {
+        isScalarFlightConditionComputed_.assign( false );
+        isLatitudeAndLongitudeSet_ = 0;
+
+        aerodynamicCoefficientIndependentVariables_.clear( );
+        controlSurfaceAerodynamicCoefficientIndependentVariables_.clear( );
+    }
+
     //! Function to compute and set the current latitude and longitude
     void computeLatitudeAndLongitude( )
     {
-        scalarFlightConditions_[ latitude_flight_condition ] = aerodynamicAngleCalculator_->getAerodynamicAngle(
-                    reference_frames::latitude_angle );
-        scalarFlightConditions_[ longitude_flight_condition ] = aerodynamicAngleCalculator_->getAerodynamicAngle(
-                    reference_frames::longitude_angle );
+        setScalarFlightCondition( latitude_flight_condition, aerodynamicAngleCalculator_->getAerodynamicAngle(
+                                      reference_frames::latitude_angle ) );
+        setScalarFlightCondition( longitude_flight_condition, aerodynamicAngleCalculator_->getAerodynamicAngle(
+                                      reference_frames::longitude_angle ) );
         isLatitudeAndLongitudeSet_ = 1;
     }
 
     //! Function to compute and set the current altitude
     void computeAltitude( )
     {
-        scalarFlightConditions_[ altitude_flight_condition ] =
-                shapeModel_->getAltitude( currentBodyCenteredPseudoBodyFixedState_.segment( 0, 3 ) );
+        setScalarFlightCondition( altitude_flight_condition,
+                                  shapeModel_->getAltitude( currentBodyCenteredPseudoBodyFixedState_.segment( 0, 3 ) ) );
     }
 
     //! Function to update input to atmosphere model (altitude, as well as latitude and longitude if needed).
     void updateAtmosphereInput( )
     {
-        if( ( scalarFlightConditions_.count( latitude_flight_condition ) == 0 ||
-              scalarFlightConditions_.count( longitude_flight_condition ) == 0 ) )
+        if( ( !isScalarFlightConditionComputed_[ latitude_flight_condition ] ||
+              !isScalarFlightConditionComputed_[ longitude_flight_condition ] ) )
         {
            if( updateLatitudeAndLongitudeForAtmosphere_ )
             {
@@ -395,12 +463,12 @@ private:
             }
             else
             {
-                scalarFlightConditions_[ latitude_flight_condition ] = 0.0;
-                scalarFlightConditions_[ longitude_flight_condition ] = 0.0;
+                setScalarFlightCondition( latitude_flight_condition, 0.0 );
+                setScalarFlightCondition( longitude_flight_condition, 0.0 );
             }
         }
 
-        if( scalarFlightConditions_.count( altitude_flight_condition ) == 0 )
+        if( !isScalarFlightConditionComputed_[ altitude_flight_condition ] )
         {
             computeAltitude( );
         }
@@ -410,35 +478,33 @@ private:
     void computeDensity( )
     {
         updateAtmosphereInput( );
-        scalarFlightConditions_[ density_flight_condition ] =
-                atmosphereModel_->getDensity(
-                    scalarFlightConditions_.at( altitude_flight_condition ),
-                    scalarFlightConditions_.at( longitude_flight_condition ),
-                    scalarFlightConditions_.at( latitude_flight_condition ), currentTime_ );
+        setScalarFlightCondition( density_flight_condition,
+                                  atmosphereModel_->getDensity(
+                                      scalarFlightConditions_[ altitude_flight_condition ],
+                                      scalarFlightConditions_[ longitude_flight_condition ],
+                                      scalarFlightConditions_[ latitude_flight_condition ], currentTime_ ) );
     }
 
     //! Function to compute and set the current freestream temperature
     void computeTemperature( )
     {
         updateAtmosphereInput( );
-
-             scalarFlightConditions_[ temperature_flight_condition ] =
-                     atmosphereModel_->getTemperature(
-                         scalarFlightConditions_.at( altitude_flight_condition ),
-                         scalarFlightConditions_.at( longitude_flight_condition ),
-                         scalarFlightConditions_.at( latitude_flight_condition ), currentTime_ );
+        setScalarFlightCondition( temperature_flight_condition,
+                                  atmosphereModel_->getTemperature(
+                                      scalarFlightConditions_[ altitude_flight_condition ],
+                                      scalarFlightConditions_[ longitude_flight_condition ],
+                                      scalarFlightConditions_[ latitude_flight_condition ], currentTime_ ) );
     }
 
     //! Function to compute and set the current freestream pressure.
     void computeFreestreamPressure( )
     {
         updateAtmosphereInput( );
-
-             scalarFlightConditions_[ pressure_flight_condition ] =
-                     atmosphereModel_->getPressure(
-                         scalarFlightConditions_.at( altitude_flight_condition ),
-                         scalarFlightConditions_.at( longitude_flight_condition ),
-                         scalarFlightConditions_.at( latitude_flight_condition ), currentTime_ );
+        setScalarFlightCondition( pressure_flight_condition,
+                                  atmosphereModel_->getPressure(
+                                      scalarFlightConditions_[ altitude_flight_condition ],
+                                      scalarFlightConditions_[ longitude_flight_condition ],
+                                      scalarFlightConditions_[ latitude_flight_condition ], currentTime_ ) );
     }
 
 
@@ -446,32 +512,32 @@ private:
     void computeSpeedOfSound( )
     {
         updateAtmosphereInput( );
-        scalarFlightConditions_[ speed_of_sound_flight_condition ]  =
-                atmosphereModel_->getSpeedOfSound(
-                    scalarFlightConditions_.at( altitude_flight_condition ),
-                    scalarFlightConditions_.at( longitude_flight_condition ),
-                    scalarFlightConditions_.at( latitude_flight_condition ), currentTime_ );
+        setScalarFlightCondition( speed_of_sound_flight_condition,
+                                  atmosphereModel_->getSpeedOfSound(
+                                      scalarFlightConditions_[ altitude_flight_condition ],
+                                      scalarFlightConditions_[ longitude_flight_condition ],
+                                      scalarFlightConditions_[ latitude_flight_condition ], currentTime_ ) );
     }
 
     //! Function to compute and set the current airspeed
     void computeAirspeed( )
     {
-        scalarFlightConditions_[ airspeed_flight_condition ] = currentBodyCenteredPseudoBodyFixedState_.segment( 3, 3 ).norm( );
+        setScalarFlightCondition( airspeed_flight_condition,
+                                  currentBodyCenteredPseudoBodyFixedState_.segment( 3, 3 ).norm( ) );
     }
 
     //! Function to compute and set the current freestream dynamic pressure.
     void computeDynamicPressure( )
     {
         double currentAirspeed = getCurrentAirspeed( );
-        scalarFlightConditions_[ dynamic_pressure_condition ] = 0.5 *
-                getCurrentDensity( ) * currentAirspeed * currentAirspeed;
+        setScalarFlightCondition( dynamic_pressure_condition,
+                                  0.5 * getCurrentDensity( ) * currentAirspeed * currentAirspeed );
     }
 
     //! Function to compute and set the current Mach number
     void computeMachNumber( )
     {
-        scalarFlightConditions_[ mach_number_flight_condition ] =
-                getCurrentAirspeed( ) / getCurrentSpeedOfSound( );
+        setScalarFlightCondition( mach_number_flight_condition, getCurrentAirspeed( ) / getCurrentSpeedOfSound( ) );
     }
 
     //! Function to compute and set the current geodetic latitude.
@@ -479,16 +545,16 @@ private:
     {
         if( !geodeticLatitudeFunction_.empty( ) )
         {
-            scalarFlightConditions_[ geodetic_latitude_condition ] = geodeticLatitudeFunction_(
-                        currentBodyCenteredPseudoBodyFixedState_.segment( 0, 3 ) );
+            setScalarFlightCondition( geodetic_latitude_condition, geodeticLatitudeFunction_(
+                                          currentBodyCenteredPseudoBodyFixedState_.segment( 0, 3 ) ) );
         }
         else
         {
-            if( scalarFlightConditions_.count( latitude_flight_condition ) == 0 || !isLatitudeAndLongitudeSet_ )
+            if( !isScalarFlightConditionComputed_[ latitude_flight_condition ] || !isLatitudeAndLongitudeSet_ )
             {
                 computeLatitudeAndLongitude( );
             }
-            scalarFlightConditions_[ geodetic_latitude_condition ] = scalarFlightConditions_[ latitude_flight_condition ] ;
+            setScalarFlightCondition( geodetic_latitude_condition, scalarFlightConditions_[ latitude_flight_condition ] );
         }
     }
 
@@ -522,8 +588,12 @@ private:
     //! Current state of vehicle in body-fixed frame.
     Eigen::Vector6d currentBodyCenteredPseudoBodyFixedState_;
 
-    //! List of atmospheric/flight properties computed at current time step.
-    std::map< FlightConditionVariables, double > scalarFlightConditions_;
+    //! List of atmospheric/flight properties at current time step (only valid if computed, see
+    //! isScalarFlightConditionComputed_).
+    boost::array< double, number_of_flight_condition_variables > scalarFlightConditions_;
+
+    //! List of booleans denoting whether each entry of scalarFlightConditions_ has been computed at current time step.
+    boost::array< bool, number_of_flight_condition_variables > isScalarFlightConditionComputed_;
 
     //! Current time of propagation.
     double currentTime_;
@@ -537,6 +607,9 @@ private:
     //! Boolean denoting whether the current latitude and longitude have been computed at current time step
     bool isLatitudeAndLongitudeSet_;
 
+    //! Boolean denoting whether the aerodynamic coefficients are to be updated by updateConditions().
+    bool updateAerodynamicCoefficients_;
+
     //! Function from which to compute the geodetic latitude as function of body-fixed position (empty if equal to
     //! geographic latitude).
     boost::function< double( const Eigen::Vector3d& ) > geodeticLatitudeFunction_;
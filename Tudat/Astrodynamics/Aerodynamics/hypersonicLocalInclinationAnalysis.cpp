@@ -14,10 +14,10 @@
  */
 
 #include <string>
+#include <thread>
 
 #include <boost/bind.hpp>
 #include <boost/function.hpp>
-#include <boost/lambda/lambda.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/pointer_cast.hpp>
 #include <boost/shared_ptr.hpp>
@@ -126,14 +126,18 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
         const std::vector< std::vector< int > >& selectedMethods,
         const double referenceArea,
         const double referenceLength,
-        const Eigen::Vector3d& momentReferencePoint )
+        const Eigen::Vector3d& momentReferencePoint,
+        const unsigned int numberOfThreads,
+        const bool generateCoefficientsOnDemand )
     : AerodynamicCoefficientGenerator< 3, 6 >(
           dataPointsOfIndependentVariables, referenceLength, referenceArea, referenceLength,
           momentReferencePoint,
           boost::assign::list_of( mach_number_dependent )( angle_of_attack_dependent )
           ( angle_of_sideslip_dependent ), 1, 0 ),
-      stagnationPressureCoefficient( 2.0 ),
       ratioOfSpecificHeats( 1.4 ),
+      numberOfThreads_( numberOfThreads ),
+      generateCoefficientsOnDemand_( generateCoefficientsOnDemand ),
+      areCoefficientsGeneratedSinceInterpolatorCreation_( false ),
       selectedMethods_( selectedMethods )
 {
     // Set geometry if it is a single surface.
@@ -204,20 +208,15 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
         }
     }
 
-    // Allocate memory for panel inclinations and pressureCoefficient_.
-    inclination_.resize( vehicleParts_.size( ) );
-    pressureCoefficient_.resize( vehicleParts_.size( ) );
-    for ( unsigned int i = 0 ; i < vehicleParts_.size( ); i++ )
+    // Store panel properties of each part contiguously.
+    for( unsigned int i = 0; i < vehicleParts_.size( ); i++ )
     {
-        inclination_[ i ].resize( vehicleParts_[ i ]->getNumberOfLines( ) );
-        pressureCoefficient_[ i ].resize( vehicleParts_[ i ]->getNumberOfLines( ) );
-        for ( int j = 0 ; j < vehicleParts_[ i ]->getNumberOfLines( ) ; j++ )
-        {
-            inclination_[ i ][ j ].resize( vehicleParts_[ i ]->getNumberOfPoints( ) );
-            pressureCoefficient_[ i ][ j ].resize( vehicleParts_[ i ]->getNumberOfPoints( ) );
-        }
+        vehiclePartPanels_.push_back( SurfacePanelArrays( vehicleParts_[ i ], momentReferencePoint_ ) );
     }
 
+    // Allocate memory for panel inclinations.
+    allocatePanelValues( inclination_ );
+
     boost::array< int, 3 > numberOfPointsPerIndependentVariables;
     for( int i = 0; i < 3; i++ )
     {
@@ -230,8 +229,26 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
     std::fill( isCoefficientGenerated_.origin( ),
                isCoefficientGenerated_.origin( ) + isCoefficientGenerated_.num_elements( ), 0 );
 
-    generateCoefficients( );
+    if( generateCoefficientsOnDemand_ )
+    {
+        // Set coefficients at grid points that have not yet been computed to NaN, so that they are never used silently.
+        std::fill( aerodynamicCoefficients_.origin( ),
+                   aerodynamicCoefficients_.origin( ) + aerodynamicCoefficients_.num_elements( ),
+                   Vector6d::Constant( TUDAT_NAN ) );
+
+        // Create look-up schemes to find grid points surrounding the independent variables during interpolation.
+        for( int i = 0; i < 3; i++ )
+        {
+            lookUpSchemes_.push_back( boost::make_shared< interpolators::HuntingAlgorithmLookupScheme< double > >(
+                                          dataPointsOfIndependentVariables_[ i ] ) );
+        }
+    }
+    else
+    {
+        generateCoefficients( );
+    }
     createInterpolator( );
+    areCoefficientsGeneratedSinceInterpolatorCreation_ = false;
 }
 
 //! Get aerodynamic coefficients.
@@ -248,26 +265,188 @@ Vector6d HypersonicLocalInclinationAnalysis::getAerodynamicCoefficientsDataPoint
 
 }
 
+//! Compute the aerodynamic coefficients at current flight condition.
+void HypersonicLocalInclinationAnalysis::updateCurrentCoefficients( const std::vector< double >& independentVariables )
+{
+    // Generate coefficients at surrounding grid points if required (size of input is checked by base class function).
+    if( generateCoefficientsOnDemand_ && independentVariables.size( ) == 3 )
+    {
+        generateSurroundingCoefficients( independentVariables );
+    }
+
+    // Re-create interpolator if it does not read directly from the (modified) coefficients.
+    if( areCoefficientsGeneratedSinceInterpolatorCreation_ )
+    {
+        if( interpolationSettings_->getInterpolatorType( ) != interpolators::linear_interpolator )
+        {
+            createInterpolator( interpolationSettings_ );
+        }
+        areCoefficientsGeneratedSinceInterpolatorCreation_ = false;
+    }
+
+    AerodynamicCoefficientGenerator< 3, 6 >::updateCurrentCoefficients( independentVariables );
+}
+
 //! Generate aerodynamic database.
 void HypersonicLocalInclinationAnalysis::generateCoefficients( )
 {
-    // Allocate variable to pass to coefficient determination for independent
-    // variable indices.
+    unsigned int numberOfDataPoints = aerodynamicCoefficients_.num_elements( );
+    if( numberOfDataPoints == 0 )
+    {
+        return;
+    }
+
+    // Compute first value in this thread, so that invalid settings are reported as an exception.
+    generateCoefficientsForIndexRange( 0, 1 );
+
+    // Distribute remaining values over threads, in contiguous blocks (last block computed in this thread).
+    unsigned int numberOfBlocks = std::max( 1u, std::min( numberOfThreads_, numberOfDataPoints - 1 ) );
+    unsigned int numberOfRemainingValues = numberOfDataPoints - 1;
+
+    std::vector< std::exception_ptr > threadExceptions( numberOfBlocks );
+    std::vector< std::thread > threads;
+    for( unsigned int i = 0; i < numberOfBlocks; i++ )
+    {
+        unsigned int startIndex = 1 + ( i * numberOfRemainingValues ) / numberOfBlocks;
+        unsigned int endIndex = 1 + ( ( i + 1 ) * numberOfRemainingValues ) / numberOfBlocks;
+        if( i < numberOfBlocks - 1 )
+        {
+            threads.push_back( std::thread(
+                                   &HypersonicLocalInclinationAnalysis::generateCoefficientsForIndexRangeAndStoreException,
+                                   this, startIndex, endIndex, std::ref( threadExceptions[ i ] ) ) );
+        }
+        else
+        {
+            generateCoefficientsForIndexRangeAndStoreException( startIndex, endIndex, threadExceptions[ i ] );
+        }
+    }
+
+    for( unsigned int i = 0; i < threads.size( ); i++ )
+    {
+        threads.at( i ).join( );
+    }
+
+    // Report first exception that occured in any of the blocks.
+    for( unsigned int i = 0; i < numberOfBlocks; i++ )
+    {
+        if( threadExceptions.at( i ) )
+        {
+            std::rethrow_exception( threadExceptions.at( i ) );
+        }
+    }
+}
+
+//! Generate aerodynamic coefficients for a range of grid points, storing any exception that occurs.
+void HypersonicLocalInclinationAnalysis::generateCoefficientsForIndexRangeAndStoreException(
+        const unsigned int startIndex, const unsigned int endIndex, std::exception_ptr& caughtException )
+{
+    try
+    {
+        generateCoefficientsForIndexRange( startIndex, endIndex );
+    }
+    catch( ... )
+    {
+        caughtException = std::current_exception( );
+    }
+}
+
+//! Generate aerodynamic coefficients for a range of grid points.
+void HypersonicLocalInclinationAnalysis::generateCoefficientsForIndexRange(
+        const unsigned int startIndex, const unsigned int endIndex )
+{
+    unsigned int numberOfMachPoints = dataPointsOfIndependentVariables_[ 0 ].size( );
+    unsigned int numberOfAngleOfSideslipPoints = dataPointsOfIndependentVariables_[ 2 ].size( );
+
+    // Allocate panel inclinations and pressure coefficients used in this function only.
+    std::vector< PanelInclinations > inclinations;
+    std::vector< Eigen::VectorXd > pressureCoefficients;
+    allocatePanelValues( inclinations );
+    allocatePanelValues( pressureCoefficients );
+
     boost::array< int, 3 > independentVariableIndices;
+    int previousAttitudeIndex = -1;
+    for( unsigned int i = startIndex; i < endIndex; i++ )
+    {
+        // Retrieve indices of Mach number, angle of attack and angle of sideslip.
+        int attitudeIndex = i / numberOfMachPoints;
+        independentVariableIndices[ 0 ] = i % numberOfMachPoints;
+        independentVariableIndices[ 1 ] = attitudeIndex / numberOfAngleOfSideslipPoints;
+        independentVariableIndices[ 2 ] = attitudeIndex % numberOfAngleOfSideslipPoints;
+
+        // Update panel inclinations if angle of attack or sideslip has changed.
+        if( attitudeIndex != previousAttitudeIndex )
+        {
+            computeInclinations( dataPointsOfIndependentVariables_[ 1 ][ independentVariableIndices[ 1 ] ],
+                                 dataPointsOfIndependentVariables_[ 2 ][ independentVariableIndices[ 2 ] ],
+                                 inclinations );
+            previousAttitudeIndex = attitudeIndex;
+        }
+
+        aerodynamicCoefficients_( independentVariableIndices ) = computeVehicleCoefficients(
+                    dataPointsOfIndependentVariables_[ 0 ][ independentVariableIndices[ 0 ] ],
+                    inclinations, pressureCoefficients );
+        isCoefficientGenerated_( independentVariableIndices ) = 1;
+    }
+}
 
-    // Iterate over all combinations of independent variables.
-    for ( unsigned int i = 0 ; i < dataPointsOfIndependentVariables_[ 0 ].size( ) ; i++ )
+//! Generate the coefficients at the grid points surrounding a given set of independent variables.
+void HypersonicLocalInclinationAnalysis::generateSurroundingCoefficients(
+        const std::vector< double >& independentVariables )
+{
+    boost::array< int, 3 > independentVariableIndices;
+
+    // For interpolation methods other than multi-linear, interpolated coefficients depend on all grid points.
+    if( interpolationSettings_->getInterpolatorType( ) != interpolators::linear_interpolator )
     {
-        independentVariableIndices[ 0 ] = i;
-        for ( unsigned  int j = 0 ; j < dataPointsOfIndependentVariables_[
-              1 ].size( ) ; j++ )
+        for( unsigned int i = 0; i < dataPointsOfIndependentVariables_[ 0 ].size( ); i++ )
         {
-            independentVariableIndices[ 1 ] = j;
-            for ( unsigned  int k = 0 ; k < dataPointsOfIndependentVariables_[
-                  2 ].size( ) ; k++ )
+            independentVariableIndices[ 0 ] = i;
+            for( unsigned int j = 0; j < dataPointsOfIndependentVariables_[ 1 ].size( ); j++ )
             {
-                independentVariableIndices[ 2 ] = k;
+                independentVariableIndices[ 1 ] = j;
+                for( unsigned int k = 0; k < dataPointsOfIndependentVariables_[ 2 ].size( ); k++ )
+                {
+                    independentVariableIndices[ 2 ] = k;
+                    if( isCoefficientGenerated_( independentVariableIndices ) == 0 )
+                    {
+                        determineVehicleCoefficients( independentVariableIndices );
+                    }
+                }
+            }
+        }
+    }
+    else
+    {
+        // Find lower indices of grid cell containing (or, when extrapolating, nearest to) independent variables.
+        boost::array< int, 3 > lowerIndices;
+        boost::array< int, 3 > upperIndexOffsets;
+        for( int i = 0; i < 3; i++ )
+        {
+            int numberOfPoints = dataPointsOfIndependentVariables_[ i ].size( );
+            if( numberOfPoints > 1 )
+            {
+                lowerIndices[ i ] = std::min( std::max(
+                            lookUpSchemes_[ i ]->findNearestLowerNeighbour( independentVariables[ i ] ), 0 ),
+                                              numberOfPoints - 2 );
+                upperIndexOffsets[ i ] = 1;
+            }
+            else
+            {
+                lowerIndices[ i ] = 0;
+                upperIndexOffsets[ i ] = 0;
+            }
+        }
 
+        // Generate coefficients at corners of grid cell, if not yet computed.
+        for( int corner = 0; corner < 8; corner++ )
+        {
+            for( int i = 0; i < 3; i++ )
+            {
+                independentVariableIndices[ i ] = lowerIndices[ i ] + ( ( corner >> i ) & 1 ) * upperIndexOffsets[ i ];
+            }
+
+            if( isCoefficientGenerated_( independentVariableIndices ) == 0 )
+            {
                 determineVehicleCoefficients( independentVariableIndices );
             }
         }
@@ -277,145 +456,113 @@ void HypersonicLocalInclinationAnalysis::generateCoefficients( )
 //! Generate aerodynamic coefficients at a single set of independent variables.
 void HypersonicLocalInclinationAnalysis::determineVehicleCoefficients(
         const boost::array< int, 3 > independentVariableIndices )
+{
+    // Declare and determine angles of attack and sideslip for analysis.
+    std::pair< double, double > angleOfAttackAndSideslip(
+                dataPointsOfIndependentVariables_[ 1 ][ independentVariableIndices[ 1 ] ],
+                dataPointsOfIndependentVariables_[ 2 ][ independentVariableIndices[ 2 ] ] );
+
+    // Check whether the inclinations of the vehicle panels have already been computed.
+    if ( previouslyComputedInclinations_.count( angleOfAttackAndSideslip ) == 0 )
+    {
+        // Determine panel inclinations, and add them to container.
+        determineInclinations( angleOfAttackAndSideslip.first, angleOfAttackAndSideslip.second );
+        previouslyComputedInclinations_[ angleOfAttackAndSideslip ] = inclination_;
+    }
+
+    std::vector< Eigen::VectorXd > pressureCoefficients;
+    allocatePanelValues( pressureCoefficients );
+
+    aerodynamicCoefficients_( independentVariableIndices ) = computeVehicleCoefficients(
+                dataPointsOfIndependentVariables_[ 0 ][ independentVariableIndices[ 0 ] ],
+                previouslyComputedInclinations_[ angleOfAttackAndSideslip ], pressureCoefficients );
+    isCoefficientGenerated_( independentVariableIndices ) = 1;
+    areCoefficientsGeneratedSinceInterpolatorCreation_ = true;
+}
+
+//! Determine aerodynamic coefficients of the full vehicle.
+Vector6d HypersonicLocalInclinationAnalysis::computeVehicleCoefficients(
+        const double machNumber,
+        const std::vector< PanelInclinations >& inclinations,
+        std::vector< Eigen::VectorXd >& pressureCoefficients ) const
 {
     // Declare coefficients vector and initialize to zeros.
     Vector6d coefficients = Vector6d::Zero( );
 
-    // Loop over all vehicle parts, calculate aerodynamic coefficients and add
-    // to aerodynamicCoefficients_.
+    // Loop over all vehicle parts, calculate aerodynamic coefficients and add to total.
     for ( unsigned int i = 0 ; i < vehicleParts_.size( ) ; i++ )
     {
-        coefficients += determinePartCoefficients( i, independentVariableIndices );
+        coefficients += determinePartCoefficients( i, machNumber, inclinations, pressureCoefficients );
     }
 
-    aerodynamicCoefficients_( independentVariableIndices ) = coefficients;
-    isCoefficientGenerated_( independentVariableIndices ) = 1;
+    return coefficients;
 }
 
 //! Determine aerodynamic coefficients of a single vehicle part.
 Vector6d HypersonicLocalInclinationAnalysis::determinePartCoefficients(
-        const int partNumber, const boost::array< int, 3 > independentVariableIndices )
+        const int partNumber, const double machNumber,
+        const std::vector< PanelInclinations >& inclinations,
+        std::vector< Eigen::VectorXd >& pressureCoefficients ) const
 {
-    // Declare and determine angles of attack and sideslip for analysis.
-    double angleOfAttack =  dataPointsOfIndependentVariables_[ 1 ]
-            [ independentVariableIndices[ 1 ] ];
-
-    double angleOfSideslip =  dataPointsOfIndependentVariables_[ 2 ]
-            [ independentVariableIndices[ 2 ] ];
-
     // Declare partCoefficient vector.
     Vector6d partCoefficients = Vector6d::Zero( );
 
-    // Check whether the inclinations of the vehicle part have already been computed.
-    if ( previouslyComputedInclinations_.count( std::pair< double, double >(
-                                                    angleOfAttack, angleOfSideslip ) ) == 0 )
-    {
-        // Determine panel inclinations for part.
-        determineInclinations( angleOfAttack, angleOfSideslip );
-
-        // Add panel inclinations to container
-        previouslyComputedInclinations_[ std::pair< double, double >(
-                    angleOfAttack, angleOfSideslip ) ] = inclination_;
-    }
-
-    else
-    {
-        // Fetch inclinations from container
-        inclination_ = previouslyComputedInclinations_[ std::pair< double, double >(
-                    angleOfAttack, angleOfSideslip ) ];
-    }
-
-    // Set pressureCoefficient_ array for given independent variables.
-    determinePressureCoefficients( partNumber, independentVariableIndices );
+    // Set pressure coefficients for given independent variables.
+    determinePressureCoefficients( partNumber, machNumber, inclinations, pressureCoefficients );
 
     // Calculate force coefficients from pressure coefficients.
-    partCoefficients.segment( 0, 3 ) = calculateForceCoefficients( partNumber );
+    partCoefficients.segment( 0, 3 ) = calculateForceCoefficients( partNumber, pressureCoefficients );
 
     // Calculate moment coefficients from pressure coefficients.
-    partCoefficients.segment( 3, 3 ) = calculateMomentCoefficients( partNumber );
+    partCoefficients.segment( 3, 3 ) = calculateMomentCoefficients( partNumber, pressureCoefficients );
 
     return partCoefficients;
 }
 
 //! Determine the pressure coefficients on a single vehicle part.
 void HypersonicLocalInclinationAnalysis::determinePressureCoefficients(
-        const int partNumber, const boost::array< int, 3 > independentVariableIndices )
+        const int partNumber, const double machNumber,
+        const std::vector< PanelInclinations >& inclinations,
+        std::vector< Eigen::VectorXd >& pressureCoefficients ) const
 {
-    // Retrieve Mach number.
-    double machNumber = dataPointsOfIndependentVariables_[ 0 ]
-            [ independentVariableIndices[ 0 ] ];
+    // Reset pressure coefficients, so that results do not depend on previous use of the buffer.
+    pressureCoefficients[ partNumber ].setZero( );
 
-    // Determine stagnation point pressure coefficients. Value is computed once
-    // here to prevent its calculation in inner loop.
-    stagnationPressureCoefficient = computeStagnationPressure(
-                machNumber, ratioOfSpecificHeats );
-
-    updateCompressionPressures( machNumber, partNumber );
-    updateExpansionPressures( machNumber, partNumber );
+    updateCompressionPressures( machNumber, partNumber, inclinations, pressureCoefficients );
+    updateExpansionPressures( machNumber, partNumber, inclinations, pressureCoefficients );
 }
 
 //! Determine force coefficients from pressure coefficients.
 Eigen::Vector3d HypersonicLocalInclinationAnalysis::calculateForceCoefficients(
-        const int partNumber )
+        const int partNumber,
+        const std::vector< Eigen::VectorXd >& pressureCoefficients ) const
 {
-    // Declare force coefficient vector and intialize to zeros.
-    Eigen::Vector3d forceCoefficients = Eigen::Vector3d::Zero( );
-
-    // Loop over all panels and add pressures, scaled by panel area, to force
-    // coefficients.
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
-    {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++)
-        {
-            forceCoefficients -=
-                    pressureCoefficient_[ partNumber ][ i ][ j ] *
-                    vehicleParts_[ partNumber ]->getPanelArea( i, j ) *
-                    vehicleParts_[ partNumber ]->getPanelSurfaceNormal( i, j );
-        }
-    }
-
-    // Normalize result by reference area.
-    forceCoefficients /= referenceArea_;
-
-    return forceCoefficients;
+    // Sum pressures over all panels, scaled by panel area, and normalize result by reference area.
+    return computePanelForce( vehiclePartPanels_[ partNumber ], pressureCoefficients[ partNumber ] ) /
+            referenceArea_;
 }
 
 //! Determine moment coefficients from pressure coefficients.
 Eigen::Vector3d HypersonicLocalInclinationAnalysis::calculateMomentCoefficients(
-        const int partNumber )
+        const int partNumber,
+        const std::vector< Eigen::VectorXd >& pressureCoefficients ) const
 {
-    // Declare moment coefficient vector and intialize to zeros.
-    Eigen::Vector3d momentCoefficients = Eigen::Vector3d::Zero( );
-
-    // Declare moment arm for panel moment determination.
-    Eigen::Vector3d referenceDistance ;
-
-    // Loop over all panels and add moments due pressures.
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
-    {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
-        {
-            // Determine moment arm for given panel centroid.
-            referenceDistance = ( vehicleParts_[ partNumber ]->
-                                  getPanelCentroid( i, j ) -  momentReferencePoint_ );
-
-            momentCoefficients -=
-                    pressureCoefficient_[ partNumber ][ i ][ j ] *
-                    vehicleParts_[ partNumber ]->getPanelArea( i, j ) *
-                    ( referenceDistance.cross( vehicleParts_[ partNumber ]->
-                                               getPanelSurfaceNormal( i, j ) ) );
-        }
-    }
-
-    // Scale result by reference length and area.
-    momentCoefficients /= ( referenceLength_ * referenceArea_ );
-
-    return momentCoefficients;
+    // Sum moments due to pressures over all panels, and scale result by reference length and area.
+    return computePanelMoment( vehiclePartPanels_[ partNumber ], pressureCoefficients[ partNumber ] ) /
+            ( referenceLength_ * referenceArea_ );
 }
 
 //! Determines the inclination angle of panels on a single part.
 void HypersonicLocalInclinationAnalysis::determineInclinations( const double angleOfAttack,
                                                                 const double angleOfSideslip )
+{
+    computeInclinations( angleOfAttack, angleOfSideslip, inclination_ );
+}
+
+//! Determine inclination angles of panels on all parts.
+void HypersonicLocalInclinationAnalysis::computeInclinations(
+        const double angleOfAttack, const double angleOfSideslip,
+        std::vector< PanelInclinations >& inclinations ) const
 {
     // Declare free-stream velocity vector.
     Eigen::Vector3d freestreamVelocityDirection;
@@ -428,52 +575,61 @@ void HypersonicLocalInclinationAnalysis::determineInclinations( const double ang
     freestreamVelocityDirection( 1 ) = freestreamVelocityDirectionY;
     freestreamVelocityDirection( 2 ) = freestreamVelocityDirectionZ;
 
-    // Declare cosine of inclination angle.
-    double cosineOfInclination;
-
-    // Loop over all panels of given vehicle part and set inclination angles.
+    // Set inclination angles of all panels of each vehicle part.
     for( unsigned int k = 0; k < vehicleParts_.size( ); k++ )
     {
-        for ( int i = 0 ; i < vehicleParts_[ k ]->getNumberOfLines( ) - 1 ; i++ )
-        {
-            for ( int j = 0 ; j < vehicleParts_[ k ]->getNumberOfPoints( ) - 1 ; j++ )
-            {
+        computePanelInclinations( vehiclePartPanels_[ k ], freestreamVelocityDirection, inclinations[ k ] );
+    }
+}
 
-                // Determine cosine of inclination angle from inner product between
-                // surface normal and free-stream direction.
-                cosineOfInclination = vehicleParts_[ k ]->
-                        getPanelSurfaceNormal( i, j ).
-                        dot( freestreamVelocityDirection );
+//! Allocate array with a single value for each panel on each part.
+void HypersonicLocalInclinationAnalysis::allocatePanelValues(
+        std::vector< Eigen::VectorXd >& panelValues ) const
+{
+    panelValues.resize( vehiclePartPanels_.size( ) );
+    for ( unsigned int i = 0 ; i < vehiclePartPanels_.size( ); i++ )
+    {
+        panelValues[ i ] = Eigen::VectorXd::Zero( vehiclePartPanels_[ i ].getNumberOfPanels( ) );
+    }
+}
 
-                // Set inclination angle.
-                inclination_[ k ][ i ][ j ] = PI / 2.0 - acos( cosineOfInclination );
-            }
-        }
+//! Allocate array with the inclination angle of each panel on each part.
+void HypersonicLocalInclinationAnalysis::allocatePanelValues(
+        std::vector< PanelInclinations >& panelInclinations ) const
+{
+    panelInclinations.resize( vehiclePartPanels_.size( ) );
+    for ( unsigned int i = 0 ; i < vehiclePartPanels_.size( ); i++ )
+    {
+        panelInclinations[ i ].sinesOfInclination =
+                Eigen::VectorXd::Zero( vehiclePartPanels_[ i ].getNumberOfPanels( ) );
+        panelInclinations[ i ].inclinations =
+                Eigen::VectorXd::Zero( vehiclePartPanels_[ i ].getNumberOfPanels( ) );
     }
 }
 
 //! Determine compression pressure coefficients on all parts.
-void HypersonicLocalInclinationAnalysis::updateCompressionPressures( const double machNumber,
-                                                                     const int partNumber )
+void HypersonicLocalInclinationAnalysis::updateCompressionPressures(
+        const double machNumber, const int partNumber,
+        const std::vector< PanelInclinations >& inclinations,
+        std::vector< Eigen::VectorXd >& pressureCoefficients ) const
 {
     int method = selectedMethods_[ 0 ][ partNumber ];
 
+    // Compute (modified) Newtonian pressures directly from sines of inclinations, for all panels at once.
+    if( method == 0 || method == 1 )
+    {
+        computeNewtonianCompressionPressureCoefficients(
+                    inclinations[ partNumber ],
+                    ( method == 0 ) ? 2.0 : computeStagnationPressure( machNumber, ratioOfSpecificHeats ),
+                    pressureCoefficients[ partNumber ] );
+        return;
+    }
+
     boost::function< double( double ) > pressureFunction;
 
     // Switch to analyze part using correct method.
     switch( method )
     {
-    case 0:
-        pressureFunction =
-                boost::bind( aerodynamics::computeNewtonianPressureCoefficient, _1 );
-        break;
-
-    case 1:
-        pressureFunction =
-                boost::bind( aerodynamics::computeModifiedNewtonianPressureCoefficient, _1,
-                             stagnationPressureCoefficient );
-        break;
-
     case 2:
         // Method currently disabled.
         break;
@@ -522,62 +678,49 @@ void HypersonicLocalInclinationAnalysis::updateCompressionPressures( const doubl
         break;
     }
 
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1; i++ )
+    const Eigen::VectorXd& partInclinations = inclinations[ partNumber ].inclinations;
+    for ( int i = 0 ; i < partInclinations.rows( ); i++ )
     {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
+        if ( partInclinations( i ) > 0 )
         {
-            if ( inclination_[ partNumber ][ i ][ j ] > 0 )
-            {
-                // If panel inclination is positive, calculate pressure coefficient.
-                pressureCoefficient_[ partNumber ][ i ][ j ] =
-                        pressureFunction( inclination_[ partNumber ][ i ][ j ] );
-            }
+            // If panel inclination is positive, calculate pressure coefficient.
+            pressureCoefficients[ partNumber ]( i ) = pressureFunction( partInclinations( i ) );
         }
     }
 }
 
 //! Determines expansion pressure coefficients on all parts.
-void HypersonicLocalInclinationAnalysis::updateExpansionPressures( const double machNumber,
-                                                                   const int partNumber )
+void HypersonicLocalInclinationAnalysis::updateExpansionPressures(
+        const double machNumber, const int partNumber,
+        const std::vector< PanelInclinations >& inclinations,
+        std::vector< Eigen::VectorXd >& pressureCoefficients ) const
 {
     // Get analysis method of part to analyze.
     int method = selectedMethods_[ 1 ][ partNumber ];
 
     if ( method == 0 || method == 1 || method == 4 )
     {
-        boost::function< double( ) > pressureFunction;
+        double expansionPressureCoefficient = 0.0;
         switch( method )
         {
         case 0:
-            pressureFunction = boost::bind( &aerodynamics::computeVacuumPressureCoefficient,
-                                            machNumber, ratioOfSpecificHeats );
+            expansionPressureCoefficient = aerodynamics::computeVacuumPressureCoefficient(
+                        machNumber, ratioOfSpecificHeats );
             break;
 
         case 1:
-            pressureFunction = boost::lambda::constant( 0.0 );
+            expansionPressureCoefficient = 0.0;
             break;
 
         case 4:
-            pressureFunction = boost::bind( &aerodynamics::computeHighMachBasePressure,
-                                            machNumber );
+            expansionPressureCoefficient = aerodynamics::computeHighMachBasePressure( machNumber );
             break;
 
         }
 
-        // Iterate over all panels on part.
-        for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
-        {
-            for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
-            {
-                if ( inclination_[ partNumber ][ i ][ j ] <= 0 )
-                {
-                    // If panel inclination is negative, calculate pressure using
-                    // Van Dyke unified method.
-                    pressureCoefficient_[ partNumber ][ i ][ j ] =
-                            pressureFunction( );
-                }
-            }
-        }
+        // Set pressure on all panels with negative inclination.
+        setConstantExpansionPressureCoefficients(
+                    inclinations[ partNumber ], expansionPressureCoefficient, pressureCoefficients[ partNumber ] );
     }
 
     else if( method == 3 || method == 5 || method == 6 )
@@ -614,17 +757,14 @@ void HypersonicLocalInclinationAnalysis::updateExpansionPressures( const double
         }
 
         // Iterate over all panels on part.
-        for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
+        const Eigen::VectorXd& partInclinations = inclinations[ partNumber ].inclinations;
+        for ( int i = 0 ; i < partInclinations.rows( ); i++ )
         {
-            for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
+            if ( partInclinations( i ) <= 0 )
             {
-                if ( inclination_[ partNumber ][ i ][ j ] <= 0 )
-                {
-                    // If panel inclination is negative, calculate pressure using
-                    // Van Dyke unified method.
-                    pressureCoefficient_[ partNumber ][ i ][ j ] =
-                            pressureFunction( inclination_[ partNumber ][ i ][ j ] );
-                }
+                // If panel inclination is negative, calculate pressure using
+                // Van Dyke unified method.
+                pressureCoefficients[ partNumber ]( i ) = pressureFunction( partInclinations( i ) );
             }
         }
     }
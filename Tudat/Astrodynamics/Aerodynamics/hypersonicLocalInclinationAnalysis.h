@@ -18,6 +18,8 @@
 #ifndef TUDAT_HYPERSONIC_LOCAL_INCLINATION_ANALYSIS_H
 #define TUDAT_HYPERSONIC_LOCAL_INCLINATION_ANALYSIS_H
 
+#include <algorithm>
+#include <exception>
 #include <map>
 #include <string>
 #include <vector>
@@ -29,8 +31,10 @@
 #include <Eigen/Core>
 
 #include "Tudat/Astrodynamics/Aerodynamics/aerodynamicCoefficientGenerator.h"
+#include "Tudat/Astrodynamics/Aerodynamics/panelMethodKernels.h"
 #include "Tudat/Basics/basicTypedefs.h"
 #include "Tudat/Mathematics/GeometricShapes/lawgsPartGeometry.h"
+#include "Tudat/Mathematics/Interpolators/lookupScheme.h"
 
 namespace tudat
 {
@@ -62,8 +66,13 @@ std::vector< double > getDefaultHypersonicLocalInclinationAngleOfSideslipPoints(
  * methods. These methods assume that the local pressure on the vehicle is only
  * dependent on the local inclination angle w.r.t. the freestream flow and
  * freestream conditions, such as Mach number and ratio of specific heats.
- * All aerodynamic coefficients can be calculated using the generateCoefficients function, or on an
- * as needed basis by using the getAerodynamicCoefficientsDataPoint function. Note that during the
+ * All aerodynamic coefficients can be calculated using the generateCoefficients function (optionally
+ * distributed over several threads), or on an as needed basis by using the
+ * getAerodynamicCoefficientsDataPoint function. In the latter (on demand) mode, the coefficients at the
+ * grid points surrounding the independent variables passed to updateCurrentCoefficients are computed
+ * when they are first needed by the interpolator. The panel properties of each part are stored contiguously
+ * (see SurfacePanelArrays), so that the inclinations, (modified) Newtonian and constant pressure coefficients, and
+ * force and moment coefficients are computed by vectorized operations over all panels of a part. Note that during the
  * panel inclination determination process, a geometry with outward surface-normals is assumed.
  * The resulting coefficients are expressed in the same reference frame as that of the input
  * geometry.
@@ -99,6 +108,11 @@ public:
      *  and moments.
      *  \param referenceLength Reference length used to non-dimensionalize aerodynamic moments.
      *  \param momentReferencePoint Reference point wrt which aerodynamic moments are calculated.
+     *  \param numberOfThreads Number of threads over which the generation of the coefficients at all grid points is
+     *  distributed (default 1).
+     *  \param generateCoefficientsOnDemand Boolean denoting whether the coefficients are only computed when first
+     *  needed for interpolation, instead of at all grid points in the constructor (default false). If true,
+     *  numberOfThreads is not used.
      */
     HypersonicLocalInclinationAnalysis(
             const std::vector< std::vector< double > >& dataPointsOfIndependentVariables,
@@ -109,7 +123,9 @@ public:
             const std::vector< std::vector< int > >& selectedMethods,
             const double referenceArea,
             const double referenceLength,
-            const Eigen::Vector3d& momentReferencePoint );
+            const Eigen::Vector3d& momentReferencePoint,
+            const unsigned int numberOfThreads = 1,
+            const bool generateCoefficientsOnDemand = false );
 
     //! Default destructor.
     /*!
@@ -129,6 +145,32 @@ public:
     Eigen::Vector6d getAerodynamicCoefficientsDataPoint(
             const boost::array< int, 3 > independentVariables );
 
+    //! Compute the aerodynamic coefficients at current flight condition.
+    /*!
+     *  Compute the aerodynamic coefficients at current flight condition, by interpolating the coefficients at the
+     *  grid points. If the coefficients are generated on demand, the coefficients at the grid points surrounding
+     *  the current flight condition are first computed (if not yet done). The multi-linear interpolator reads the
+     *  coefficients directly from aerodynamicCoefficients_, so that newly computed coefficients are used without
+     *  re-creating it. For interpolation methods other than multi-linear, the coefficients at all grid points are
+     *  computed at the first call to this function, and the interpolator is re-created if any coefficients were
+     *  computed since its creation (including by getAerodynamicCoefficientsDataPoint).
+     *  \param independentVariables Independent variables of force and moment coefficient (Mach number, angle of
+     *  attack and angle of sideslip, respectively).
+     */
+    void updateCurrentCoefficients( const std::vector< double >& independentVariables );
+
+    //! Function to return the number of grid points at which the coefficients have been computed.
+    /*!
+     *  Function to return the number of grid points at which the coefficients have been computed. If the
+     *  coefficients are not generated on demand, this is equal to the total number of grid points.
+     *  \return Number of grid points at which the coefficients have been computed.
+     */
+    int getNumberOfGeneratedDataPoints( ) const
+    {
+        return std::count( isCoefficientGenerated_.origin( ),
+                           isCoefficientGenerated_.origin( ) + isCoefficientGenerated_.num_elements( ), true );
+    }
+
     //! Determine inclination angles of panels on a given part.
     /*!
      * Determines panel inclinations for all panels on all parts for given attitude.
@@ -179,48 +221,104 @@ private:
     /*!
      * Generates aerodynamic database. Settings of geometry,
      * reference quantities, database point settings and analysis methods
-     *  should have been set previously.
+     *  should have been set previously. The computation is distributed over numberOfThreads_ threads.
      */
     void generateCoefficients( );
 
+    //! Generate aerodynamic coefficients for a range of grid points.
+    /*!
+     * Generates aerodynamic coefficients for a range of grid points, using panel inclination and pressure
+     * coefficient buffers local to this function (so that it can be called from several threads concurrently
+     * for non-overlapping ranges). The grid points are ordered such that the Mach number index varies fastest,
+     * followed by the angle of sideslip index and the angle of attack index, so that the panel inclinations only
+     * need to be recomputed when the attitude changes.
+     * \param startIndex Index of first grid point at which coefficients are to be computed.
+     * \param endIndex Index after last grid point at which coefficients are to be computed.
+     */
+    void generateCoefficientsForIndexRange( const unsigned int startIndex, const unsigned int endIndex );
+
+    //! Generate aerodynamic coefficients for a range of grid points, storing any exception that occurs.
+    /*!
+     * Generates aerodynamic coefficients for a range of grid points (see generateCoefficientsForIndexRange), storing
+     * any exception that occurs, so that it can be reported by the thread calling generateCoefficients.
+     * \param startIndex Index of first grid point at which coefficients are to be computed.
+     * \param endIndex Index after last grid point at which coefficients are to be computed.
+     * \param caughtException Exception that occured during the computation, if any (returned by reference).
+     */
+    void generateCoefficientsForIndexRangeAndStoreException(
+            const unsigned int startIndex, const unsigned int endIndex, std::exception_ptr& caughtException );
+
+    //! Generate the coefficients at the grid points surrounding a given set of independent variables.
+    /*!
+     * Generates the coefficients at the grid points surrounding a given set of independent variables (if not yet
+     * computed). Used when coefficients are generated on demand.
+     * \param independentVariables Mach number, angle of attack and angle of sideslip, respectively.
+     */
+    void generateSurroundingCoefficients( const std::vector< double >& independentVariables );
+
     //! Generate aerodynamic coefficients at a single set of independent variables.
     /*!
      * Generates aerodynamic coefficients at a single set of independent variables.
-     * Determines values and sets corresponding entry in vehicleCoefficients_ array.
+     * Determines values and sets corresponding entry in aerodynamicCoefficients_ array (from which the multi-linear
+     * coefficient interpolator reads directly), and flags that other interpolators need to be re-created.
      * \param independentVariableIndices Array of indices from lists of Mach number,
      *          angle of attack and angle of sideslip points at which to perform analysis.
      */
     void determineVehicleCoefficients( const boost::array< int, 3 > independentVariableIndices );
 
+    //! Determine aerodynamic coefficients of the full vehicle.
+    /*!
+     * Determines aerodynamic coefficients of the full vehicle, by summing the coefficients of all parts.
+     * \param machNumber Mach number at which to perform analysis.
+     * \param inclinations Panel inclinations at the angles of attack and sideslip at which to perform analysis.
+     * \param pressureCoefficients Buffer for panel pressure coefficients (must have same size as inclinations).
+     * \return Force and moment coefficients of vehicle.
+     */
+    Eigen::Vector6d computeVehicleCoefficients(
+            const double machNumber,
+            const std::vector< PanelInclinations >& inclinations,
+            std::vector< Eigen::VectorXd >& pressureCoefficients ) const;
+
     //! Determine aerodynamic coefficients for a single LaWGS part.
     /*!
      * Determines aerodynamic coefficients for a single LaWGS part,
-     * calls determinepressureCoefficient_ function for given vehicle part.
+     * calls determinePressureCoefficients function for given vehicle part.
      * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
-     * \param independentVariableIndices Array of indices of independent variables.
+     * \param machNumber Mach number at which to perform analysis.
+     * \param inclinations Panel inclinations at the angles of attack and sideslip at which to perform analysis.
+     * \param pressureCoefficients Buffer for panel pressure coefficients (must have same size as inclinations).
      * \return Force and moment coefficients for requested vehicle part.
      */
     Eigen::Vector6d determinePartCoefficients(
-            const int partNumber, const boost::array< int, 3 > independentVariableIndices );
+            const int partNumber, const double machNumber,
+            const std::vector< PanelInclinations >& inclinations,
+            std::vector< Eigen::VectorXd >& pressureCoefficients ) const;
 
     //! Determine pressure coefficients on a given part.
     /*!
      * Determines pressure coefficients on a single vehicle part.
      * Calls the updateExpansionPressures and updateCompressionPressures for given vehicle part.
      * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
-     * \param independentVariableIndices Array of indices of independent variables.
+     * \param machNumber Mach number at which to perform analysis.
+     * \param inclinations Panel inclinations at the angles of attack and sideslip at which to perform analysis.
+     * \param pressureCoefficients Panel pressure coefficients (values on given part set by this function).
      */
-    void determinePressureCoefficients( const int partNumber,
-                                        const boost::array< int, 3 > independentVariableIndices );
+    void determinePressureCoefficients(
+            const int partNumber, const double machNumber,
+            const std::vector< PanelInclinations >& inclinations,
+            std::vector< Eigen::VectorXd >& pressureCoefficients ) const;
 
     //! Determine force coefficients of a part.
     /*!
      * Sums the pressure coefficients of given part and determines force coefficients from it by
      * non-dimensionalization with reference area.
      * \param partNumber Index from vehicleParts_ array for which determine coefficients.
+     * \param pressureCoefficients Panel pressure coefficients.
      * \return Force coefficients for requested vehicle part.
      */
-    Eigen::Vector3d calculateForceCoefficients( const int partNumber );
+    Eigen::Vector3d calculateForceCoefficients(
+            const int partNumber,
+            const std::vector< Eigen::VectorXd >& pressureCoefficients ) const;
 
     //! Determine moment coefficients of a part.
     /*!
@@ -228,27 +326,66 @@ private:
      * panels on the part. Moment arms are taken from panel centroid to momentReferencePoint. Non-
      * dimensionalization is performed by product of referenceLength and referenceArea.
      * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
+     * \param pressureCoefficients Panel pressure coefficients.
      * \return Moment coefficients for requested vehicle part.
      */
-    Eigen::Vector3d calculateMomentCoefficients( const int partNumber );
+    Eigen::Vector3d calculateMomentCoefficients(
+            const int partNumber,
+            const std::vector< Eigen::VectorXd >& pressureCoefficients ) const;
 
     //! Determine the compression pressure coefficients of a given part.
     /*!
-     * Sets the values of pressureCoefficient_ on given part and at given Mach number for which
+     * Sets the values of pressureCoefficients on given part and at given Mach number for which
      * inclination > 0.
      * \param machNumber Mach number at which to perform analysis.
      * \param partNumber of part from vehicleParts_ which is to be analyzed.
+     * \param inclinations Panel inclinations.
+     * \param pressureCoefficients Panel pressure coefficients (values on given part set by this function).
      */
-    void updateCompressionPressures( const double machNumber, const int partNumber );
+    void updateCompressionPressures(
+            const double machNumber, const int partNumber,
+            const std::vector< PanelInclinations >& inclinations,
+            std::vector< Eigen::VectorXd >& pressureCoefficients ) const;
 
     //! Determine the expansion pressure coefficients of a given part.
     /*!
-     * Determine the values of pressureCoefficient_ on given part and at given Mach number for
+     * Determine the values of pressureCoefficients on given part and at given Mach number for
      * which inclination <= 0.
      * \param machNumber Mach number at which to perform analysis.
      * \param partNumber of part from vehicleParts_ which is to be analyzed.
+     * \param inclinations Panel inclinations.
+     * \param pressureCoefficients Panel pressure coefficients (values on given part set by this function).
      */
-    void updateExpansionPressures( const double machNumber, const int partNumber );
+    void updateExpansionPressures(
+            const double machNumber, const int partNumber,
+            const std::vector< PanelInclinations >& inclinations,
+            std::vector< Eigen::VectorXd >& pressureCoefficients ) const;
+
+    //! Determine inclination angles of panels on all parts.
+    /*!
+     * Determines panel inclinations for all panels on all parts for given attitude.
+     * \param angleOfAttack Angle of attack at which to determine inclination angles.
+     * \param angleOfSideslip Angle of sideslip at which to determine inclination angles.
+     * \param inclinations Panel inclinations (set by this function, must be allocated by allocatePanelValues).
+     */
+    void computeInclinations( const double angleOfAttack, const double angleOfSideslip,
+                              std::vector< PanelInclinations >& inclinations ) const;
+
+    //! Allocate array with a single value for each panel on each part.
+    /*!
+     * Allocate array with a single value for each panel on each part (indices indicate part-panel, see
+     * SurfacePanelArrays for ordering of panels), with all values set to zero.
+     * \param panelValues Array that is to be allocated.
+     */
+    void allocatePanelValues( std::vector< Eigen::VectorXd >& panelValues ) const;
+
+    //! Allocate array with the inclination angle of each panel on each part.
+    /*!
+     * Allocate array with the inclination angle (and its sine) of each panel on each part, with all values set to
+     * zero.
+     * \param panelInclinations Array that is to be allocated.
+     */
+    void allocatePanelValues( std::vector< PanelInclinations >& panelInclinations ) const;
 
     //! Array of vehicle parts.
     /*!
@@ -256,6 +393,13 @@ private:
      */
     std::vector< boost::shared_ptr< geometric_shapes::LawgsPartGeometry > > vehicleParts_;
 
+    //! Contiguously stored panel properties of each vehicle part.
+    /*!
+     * Contiguously stored panel properties of each vehicle part (same order as vehicleParts_), with moment arms
+     * w.r.t. momentReferencePoint_.
+     */
+    std::vector< SurfacePanelArrays > vehiclePartPanels_;
+
     //! Multi-array as which indicates which coefficients have been calculated already.
     /*!
      * Multi-array as which indicates which coefficients have been calculated already. Indices of
@@ -263,40 +407,38 @@ private:
      */
     boost::multi_array< bool, 3 > isCoefficientGenerated_;
 
-    //! Three-dimensional array of panel inclination angles.
+    //! Array of panel inclination angles.
     /*!
-     * Three-dimensional array of panel inclination angles at current values of
-     * independent variables. Indices indicate part-line-point.
+     * Array of panel inclination angles at current values of
+     * independent variables. Indices indicate part-panel.
      */
-    std::vector< std::vector< std::vector< double > > > inclination_;
+    std::vector< PanelInclinations > inclination_;
 
     //! Map of angle of attack and -sideslip pair and associated panel inclinations.
     /*!
      * Map of angle of attack and -sideslip pair and associated panel inclinations.
      */
-    std::map< std::pair< double, double >, std::vector< std::vector< std::vector< double > > > >
-            previouslyComputedInclinations_;
-
-    //! Three-dimensional array of panel pressure coefficients.
-    /*!
-     * Three-dimensional array of panel pressure coefficients at current values
-     * of independent variables. Indices indicate part-line-point.
-     */
-    std::vector< std::vector< std::vector< double > > > pressureCoefficient_;
-
-    //! Stagnation pressure coefficient.
-    /*!
-     * Stagnation pressure coefficient for flow which has passed through a
-     * normal shock wave at current Mach number.
-     */
-    double stagnationPressureCoefficient;
+    std::map< std::pair< double, double >, std::vector< PanelInclinations > > previouslyComputedInclinations_;
 
     //! Ratio of specific heats.
     /*!
      * Ratio of specific heat at constant pressure to specific heat at constant pressure.
      */
     double ratioOfSpecificHeats;
-\
+
+    //! Number of threads over which the generation of the coefficients at all grid points is distributed.
+    unsigned int numberOfThreads_;
+
+    //! Boolean denoting whether the coefficients are only computed when first needed for interpolation.
+    bool generateCoefficientsOnDemand_;
+
+    //! Boolean denoting whether coefficients have been computed since the creation of the coefficient interpolator.
+    bool areCoefficientsGeneratedSinceInterpolatorCreation_;
+
+    //! Look-up schemes for each independent variable, used to find surrounding grid points when generating
+    //! coefficients on demand.
+    std::vector< boost::shared_ptr< interpolators::LookUpScheme< double > > > lookUpSchemes_;
+
     //! Array of selected methods.
     /*!
      * Array of selected methods, first index represents compression/expansion,
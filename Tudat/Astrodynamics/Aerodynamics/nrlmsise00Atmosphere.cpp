@@ -9,6 +9,7 @@
  */
 
 #include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00Atmosphere.h"
+#include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00InputFunctions.h"
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 
 
@@ -33,8 +34,15 @@ void NRLMSISE00Atmosphere::computeProperties(
     hashKey_ = hashKey;
 
     // Retrieve input data.
-    inputData_ = nrlmsise00InputFunction_(
-                altitude, longitude, latitude, time );
+    if( inputTable_ != NULL )
+    {
+        inputTable_->getInput( inputData_, altitude, longitude, latitude, time );
+    }
+    else
+    {
+        inputData_ = nrlmsise00InputFunction_(
+                    altitude, longitude, latitude, time );
+    }
     std::copy( inputData_.apVector.begin( ), inputData_.apVector.end( ), aph_.a );
     std::copy( inputData_.switches.begin( ), inputData_.switches.end( ), flags_.switches);
 
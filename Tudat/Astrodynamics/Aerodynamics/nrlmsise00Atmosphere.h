@@ -18,6 +18,7 @@
 
 #include <boost/function.hpp>
 #include <boost/functional/hash.hpp>
+#include <boost/shared_ptr.hpp>
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
 #include "Tudat/Astrodynamics/Aerodynamics/atmosphereModel.h"
@@ -171,6 +172,8 @@ struct NRLMSISE00Input
     std::vector< int > switches;
 };
 
+class NRLMSISE00InputTable;
+
 //! NRLMSISE-00 atmosphere model class.
 /*!
  *  NRLMSISE-00 atmosphere model class. This class uses the NRLMSISE00 atmosphere model to calculate atmospheric
@@ -231,6 +234,26 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
         useIdealGasLaw_ = useIdealGasLaw;
     }
 
+    //! Constructor using day-indexed input table.
+    /*!
+     * Constructor using a day-indexed input table, from which the NRLMSISE00 model input is retrieved directly into
+     * the input data of this object (see NRLMSISE00InputTable::getInput), so that no input object is copied per
+     * evaluation. The local solar time is computed from the longitude and time.
+     * \param inputTable Day-indexed input table which provides the NRLMSISE00 model input.
+     * \param useIdealGasLaw Variable denoting whether to use the ideal gas law for computation of pressure.
+     */
+    NRLMSISE00Atmosphere( const boost::shared_ptr< NRLMSISE00InputTable > inputTable,
+                          const bool useIdealGasLaw = true )
+        : inputTable_( inputTable )
+    {
+        resetHashKey( );
+        molarGasConstant_ = tudat::physical_constants::MOLAR_GAS_CONSTANT;
+        specificHeatRatio_ = 1.4;
+        GasComponentProperties gasProperties;
+        gasComponentProperties_ = gasProperties; // Default gas properties
+        useIdealGasLaw_ = useIdealGasLaw;
+    }
+
     //! Set gas component properties.
     /*!
      * Sets the gas component properties.
@@ -435,6 +458,9 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
     //! Shared pointer to solar activity function
     NRLMSISE00InputFunction nrlmsise00InputFunction_;
 
+    //! Day-indexed input table (used instead of nrlmsise00InputFunction_ if set).
+    boost::shared_ptr< NRLMSISE00InputTable > inputTable_;
+
     //! Use the ideal gas law for the computation of the pressure.
     bool useIdealGasLaw_;
 
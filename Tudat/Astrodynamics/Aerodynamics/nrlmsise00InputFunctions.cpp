@@ -9,6 +9,7 @@
  */
 
 #include <boost/lexical_cast.hpp>
+#include <boost/make_shared.hpp>
 
 #include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00Atmosphere.h"
 #include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00InputFunctions.h"
@@ -34,41 +35,18 @@ std::vector< double >  eigenToStlVector(
     return stdVector;
 }
 
-//! NRLMSISE00Input function
-NRLMSISE00Input nrlmsiseInputFunction( const double altitude, const double longitude,
-                                       const double latitude, const double time,
-                                       const tudat::input_output::solar_activity::SolarActivityDataMap& solarActivityMap,
-                                       const bool adjustSolarTime,
-                                       const double localSolarTime ) {
-    using namespace tudat::input_output::solar_activity;
-
-    // Declare input data class member
+//! Function to create the part of the NRLMSISE00 input that is constant over a single day.
+NRLMSISE00Input createDailyNrlmsiseInput(
+        const tudat::input_output::solar_activity::SolarActivityDataPtr solarActivity, const double julianDay )
+{
     NRLMSISE00Input nrlmsiseInputData;
 
-    // Julian dates
-    double julianDate = tudat::basic_astrodynamics::convertSecondsSinceEpochToJulianDay(
-                time, basic_astrodynamics::JULIAN_DAY_ON_J2000 );
-    double julianDay = std::floor( julianDate - 0.5 ) + 0.5;
-
-    // Check if solar activity is found for current day.
-    if( solarActivityMap.count( julianDay ) == 0 )
-    {
-        std::string errorMessage = "Solar activity data could not be found for this julian date: "
-                + boost::lexical_cast< std::string >( julianDay ) + " in nrlmsiseInputFunction";
-        throw std::runtime_error( errorMessage );
-    }
-    SolarActivityDataPtr solarActivity = solarActivityMap.at( julianDay );
-
-
     // Compute julian date at the first of januari
     double julianDate1Jan = tudat::basic_astrodynamics::convertCalendarDateToJulianDay(
                 solarActivity->year, 1, 1, 0, 0, 0.0 );
 
     nrlmsiseInputData.year = solarActivity->year; // int
     nrlmsiseInputData.dayOfTheYear = julianDay - julianDate1Jan + 1;
-    nrlmsiseInputData.secondOfTheDay = time -
-            tudat::basic_astrodynamics::convertJulianDayToSecondsSinceEpoch( julianDay,
-                                                            tudat::basic_astrodynamics::JULIAN_DAY_ON_J2000 );
 
     if( solarActivity->fluxQualifier == 1 )
     { // requires adjustment
@@ -83,6 +61,18 @@ NRLMSISE00Input nrlmsiseInputFunction( const double altitude, const double longi
     nrlmsiseInputData.apDaily = solarActivity->planetaryEquivalentAmplitudeAverage;
     nrlmsiseInputData.apVector = eigenToStlVector( solarActivity->planetaryEquivalentAmplitudeVector );
 
+    return nrlmsiseInputData;
+}
+
+//! Function to set the time-of-day dependent members of NRLMSISE00 input.
+void setTimeOfDayNrlmsiseInput( NRLMSISE00Input& nrlmsiseInputData,
+                                const double longitude, const double time, const double julianDay,
+                                const bool adjustSolarTime, const double localSolarTime )
+{
+    nrlmsiseInputData.secondOfTheDay = time -
+            tudat::basic_astrodynamics::convertJulianDayToSecondsSinceEpoch( julianDay,
+                                                            tudat::basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+
     // Compute local solar time
     // Hrs since begin of the day at longitude 0 (GMT) + Hrs passed at current longitude
     if( adjustSolarTime )
@@ -94,9 +84,126 @@ NRLMSISE00Input nrlmsiseInputFunction( const double altitude, const double longi
         nrlmsiseInputData.localSolarTime = nrlmsiseInputData.secondOfTheDay / 3600.0
                 + longitude / ( tudat::mathematical_constants::PI / 12.0 );
     }
+}
+
+//! Function to compute the Julian day (at 0h UT) in which a given time lies.
+double getJulianDayOfTime( const double time )
+{
+    double julianDate = tudat::basic_astrodynamics::convertSecondsSinceEpochToJulianDay(
+                time, basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+    return std::floor( julianDate - 0.5 ) + 0.5;
+}
+
+//! NRLMSISE00Input function
+NRLMSISE00Input nrlmsiseInputFunction( const double altitude, const double longitude,
+                                       const double latitude, const double time,
+                                       const tudat::input_output::solar_activity::SolarActivityDataMap& solarActivityMap,
+                                       const bool adjustSolarTime,
+                                       const double localSolarTime ) {
+    using namespace tudat::input_output::solar_activity;
+
+    // Julian dates
+    double julianDay = getJulianDayOfTime( time );
+
+    // Check if solar activity is found for current day.
+    SolarActivityDataMap::const_iterator solarActivityIterator = solarActivityMap.find( julianDay );
+    if( solarActivityIterator == solarActivityMap.end( ) )
+    {
+        std::string errorMessage = "Solar activity data could not be found for this julian date: "
+                + boost::lexical_cast< std::string >( julianDay ) + " in nrlmsiseInputFunction";
+        throw std::runtime_error( errorMessage );
+    }
+
+    // Declare input data class member
+    NRLMSISE00Input nrlmsiseInputData = createDailyNrlmsiseInput( solarActivityIterator->second, julianDay );
+    setTimeOfDayNrlmsiseInput( nrlmsiseInputData, longitude, time, julianDay, adjustSolarTime, localSolarTime );
 
     return nrlmsiseInputData;
 }
 
+//! Constructor.
+NRLMSISE00InputTable::NRLMSISE00InputTable(
+        const tudat::input_output::solar_activity::SolarActivityDataMap& solarActivityMap )
+{
+    using namespace tudat::input_output::solar_activity;
+
+    if( solarActivityMap.empty( ) )
+    {
+        throw std::runtime_error( "Error when creating NRLMSISE00 input table, no solar activity data provided" );
+    }
+
+    // Allocate daily input for each day between first and last entry of solar activity data.
+    firstJulianDay_ = solarActivityMap.begin( )->first;
+    int numberOfDays = static_cast< int >(
+                std::floor( solarActivityMap.rbegin( )->first - firstJulianDay_ + 0.5 ) ) + 1;
+    dailyInputs_.resize( numberOfDays );
+    isDailyInputAvailable_.resize( numberOfDays, false );
+
+    // Precompute daily input.
+    for( SolarActivityDataMap::const_iterator solarActivityIterator = solarActivityMap.begin( );
+         solarActivityIterator != solarActivityMap.end( ); solarActivityIterator++ )
+    {
+        int dayIndex = static_cast< int >( std::floor( solarActivityIterator->first - firstJulianDay_ + 0.5 ) );
+        dailyInputs_[ dayIndex ] = createDailyNrlmsiseInput(
+                    solarActivityIterator->second, solarActivityIterator->first );
+        isDailyInputAvailable_[ dayIndex ] = true;
+    }
+}
+
+//! Function to retrieve the NRLMSISE00 input at a given time and position.
+void NRLMSISE00InputTable::getInput( NRLMSISE00Input& nrlmsiseInput,
+                                     const double altitude, const double longitude,
+                                     const double latitude, const double time,
+                                     const bool adjustSolarTime, const double localSolarTime ) const
+{
+    double julianDay = getJulianDayOfTime( time );
+
+    // Check if solar activity is available for current day.
+    double dayOffset = std::floor( julianDay - firstJulianDay_ + 0.5 );
+    if( !( dayOffset >= 0.0 && dayOffset < static_cast< double >( dailyInputs_.size( ) ) ) ||
+            !isDailyInputAvailable_[ static_cast< int >( dayOffset ) ] )
+    {
+        std::string errorMessage = "Solar activity data could not be found for this julian date: "
+                + boost::lexical_cast< std::string >( julianDay ) + " in NRLMSISE00InputTable";
+        throw std::runtime_error( errorMessage );
+    }
+
+    // Set daily input (assignment of apVector reuses the existing storage of the output).
+    const NRLMSISE00Input& dailyInput = dailyInputs_[ static_cast< int >( dayOffset ) ];
+    nrlmsiseInput.year = dailyInput.year;
+    nrlmsiseInput.dayOfTheYear = dailyInput.dayOfTheYear;
+    nrlmsiseInput.f107 = dailyInput.f107;
+    nrlmsiseInput.f107a = dailyInput.f107a;
+    nrlmsiseInput.apDaily = dailyInput.apDaily;
+    nrlmsiseInput.apVector = dailyInput.apVector;
+
+    setTimeOfDayNrlmsiseInput( nrlmsiseInput, longitude, time, julianDay, adjustSolarTime, localSolarTime );
+}
+
+//! Function to compute a hash of the contents of the table.
+std::size_t NRLMSISE00InputTable::getHashKey( ) const
+{
+    std::size_t hashKey = 0;
+    boost::hash_combine( hashKey, firstJulianDay_ );
+    for( unsigned int i = 0; i < dailyInputs_.size( ); i++ )
+    {
+        boost::hash_combine( hashKey, static_cast< bool >( isDailyInputAvailable_[ i ] ) );
+        boost::hash_combine( hashKey, dailyInputs_[ i ].year );
+        boost::hash_combine( hashKey, dailyInputs_[ i ].dayOfTheYear );
+        boost::hash_combine( hashKey, dailyInputs_[ i ].f107 );
+        boost::hash_combine( hashKey, dailyInputs_[ i ].f107a );
+        boost::hash_combine( hashKey, dailyInputs_[ i ].apDaily );
+        boost::hash_range( hashKey, dailyInputs_[ i ].apVector.begin( ), dailyInputs_[ i ].apVector.end( ) );
+    }
+    return hashKey;
+}
+
+//! Function to read solar activity data from a space weather file, and create the corresponding NRLMSISE00 input table.
+boost::shared_ptr< NRLMSISE00InputTable > readNRLMSISE00InputTable( const std::string& spaceWeatherFilePath )
+{
+    return boost::make_shared< NRLMSISE00InputTable >(
+                tudat::input_output::solar_activity::readSolarActivityData( spaceWeatherFilePath ) );
+}
+
 }  // namespace aerodynamics
 }  // namespace tudat
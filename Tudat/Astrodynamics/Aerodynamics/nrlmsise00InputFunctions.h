@@ -11,10 +11,13 @@
 #ifndef TUDAT_NRLMSISE00_INPUT_FUNCTIONS_H
 #define TUDAT_NRLMSISE00_INPUT_FUNCTIONS_H
 
+#include <string>
 #include <vector>
 #include <cmath>
 
 #include <boost/function.hpp>
+#include <boost/functional/hash.hpp>
+#include <boost/shared_ptr.hpp>
 
 #include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00Atmosphere.h"
 #include "Tudat/InputOutput/solarActivityData.h"
@@ -46,6 +49,106 @@ NRLMSISE00Input nrlmsiseInputFunction( const double altitude, const double longi
                                        const tudat::input_output::solar_activity::SolarActivityDataMap& solarActivityMap,
                                        const bool adjustSolarTime = false, const double localSolarTime = 0.0 );
 
+//! Function to create the part of the NRLMSISE00 input that is constant over a single day.
+/*!
+ * Function to create the part of the NRLMSISE00 input that is constant over a single day, i.e. the date, the F10.7
+ * fluxes and the Ap indices. The secondOfTheDay and localSolarTime members are not set by this function.
+ * \param solarActivity Solar activity data for the day under consideration.
+ * \param julianDay Julian day (at 0h UT) of the day under consideration.
+ * \return NRLMSISE00 input, of which the time-of-day dependent members are not yet set.
+ */
+NRLMSISE00Input createDailyNrlmsiseInput(
+        const tudat::input_output::solar_activity::SolarActivityDataPtr solarActivity, const double julianDay );
+
+//! Class for day-indexed retrieval of NRLMSISE00 input.
+/*!
+ * Class for day-indexed retrieval of NRLMSISE00 input. The daily part of the input (see createDailyNrlmsiseInput) is
+ * computed once for each day in a SolarActivityDataMap (as created by readSolarActivityData), and stored in a vector
+ * indexed by the number of days since the first day in the map. Consequently, retrieving the input for a given time
+ * requires no map lookup or data conversion, only the time-of-day dependent members are computed. The getInput
+ * function of this class fills a caller-owned input object (typically the one stored by NRLMSISE00Atmosphere), with
+ * values identical to those of nrlmsiseInputFunction.
+ */
+class NRLMSISE00InputTable
+{
+public:
+
+    //! Constructor.
+    /*!
+     * Constructor, precomputes the daily NRLMSISE00 input for each day in the solar activity data.
+     * \param solarActivityMap Solar activity data, with Julian day (at 0h UT) as key.
+     */
+    NRLMSISE00InputTable(
+            const tudat::input_output::solar_activity::SolarActivityDataMap& solarActivityMap );
+
+    //! Function to retrieve the NRLMSISE00 input at a given time and position.
+    /*!
+     * Function to retrieve the NRLMSISE00 input at a given time and position, using the precomputed daily input. The
+     * input is written to an existing object, so that no input object (and its vectors) is allocated per call. The
+     * switches of the input object are not modified.
+     * \param nrlmsiseInput NRLMSISE00 input at given time and position (returned by reference).
+     * \param altitude Altitude at which output is to be computed [m].
+     * \param longitude Longitude at which output is to be computed [rad].
+     * \param latitude Latitude at which output is to be computed [rad].
+     * \param time Time at which output is to be computed (seconds since J2000).
+     * \param adjustSolarTime Boolean denoting whether the computed local solar time should be overidden with
+     * localSolarTime input.
+     * \param localSolarTime Local solar time that is used when adjustSolarTime is set to true.
+     */
+    void getInput( NRLMSISE00Input& nrlmsiseInput,
+                   const double altitude, const double longitude,
+                   const double latitude, const double time,
+                   const bool adjustSolarTime = false, const double localSolarTime = 0.0 ) const;
+
+    //! Function to retrieve the Julian day of the first entry in the table.
+    /*!
+     * Function to retrieve the Julian day of the first entry in the table.
+     * \return Julian day of the first entry in the table.
+     */
+    double getFirstJulianDay( ) const
+    {
+        return firstJulianDay_;
+    }
+
+    //! Function to retrieve the number of days spanned by the table.
+    /*!
+     * Function to retrieve the number of days spanned by the table.
+     * \return Number of days spanned by the table.
+     */
+    int getNumberOfDays( ) const
+    {
+        return static_cast< int >( dailyInputs_.size( ) );
+    }
+
+    //! Function to compute a hash of the contents of the table.
+    /*!
+     * Function to compute a hash of the contents of the table (first day, and date, F10.7 fluxes and Ap indices of all
+     * days), by which data generated from the table can be identified (e.g. in a file).
+     * \return Hash of the contents of the table.
+     */
+    std::size_t getHashKey( ) const;
+
+private:
+
+    //! Julian day (at 0h UT) of the first entry in dailyInputs_.
+    double firstJulianDay_;
+
+    //! Daily part of NRLMSISE00 input, indexed by number of days since firstJulianDay_.
+    std::vector< NRLMSISE00Input > dailyInputs_;
+
+    //! List of booleans denoting whether solar activity data was provided for the corresponding entry of dailyInputs_.
+    std::vector< bool > isDailyInputAvailable_;
+};
+
+//! Function to read solar activity data from a space weather file, and create the corresponding NRLMSISE00 input table.
+/*!
+ * Function to read solar activity data from a space weather file (using readSolarActivityData), and create the
+ * corresponding day-indexed NRLMSISE00 input table.
+ * \param spaceWeatherFilePath Path to space weather file (e.g. from celestrak.com/SpaceData/).
+ * \return Day-indexed NRLMSISE00 input table.
+ */
+boost::shared_ptr< NRLMSISE00InputTable > readNRLMSISE00InputTable( const std::string& spaceWeatherFilePath );
+
 }  // namespace aerodynamics
 }  // namespace tudat
 
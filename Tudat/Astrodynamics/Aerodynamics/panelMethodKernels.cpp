@@ -0,0 +1,107 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Anderson Jr. , J.D, Hypersonic and High-Temperature Gas Dynamics, 2nd edition,
+ *        AIAA Education Series, 2006
+ *
+ */
+
+#include <algorithm>
+
+#include "Tudat/Astrodynamics/Aerodynamics/panelMethodKernels.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace aerodynamics
+{
+
+//! Constructor.
+SurfacePanelArrays::SurfacePanelArrays(
+        const boost::shared_ptr< geometric_shapes::QuadrilateralMeshedSurfaceGeometry > meshedSurface,
+        const Eigen::Vector3d& momentReferencePoint )
+{
+    int numberOfPanelLines = meshedSurface->getNumberOfLines( ) - 1;
+    int numberOfPanelPoints = meshedSurface->getNumberOfPoints( ) - 1;
+    int numberOfPanels = std::max( numberOfPanelLines, 0 ) * std::max( numberOfPanelPoints, 0 );
+
+    panelSurfaceNormals_.resize( numberOfPanels, 3 );
+    panelCentroids_.resize( numberOfPanels, 3 );
+    panelAreas_.resize( numberOfPanels );
+    areaWeightedSurfaceNormals_.resize( numberOfPanels, 3 );
+    areaWeightedMomentArms_.resize( numberOfPanels, 3 );
+
+    // Retrieve properties of each panel.
+    int panelIndex = 0;
+    for( int i = 0; i < numberOfPanelLines; i++ )
+    {
+        for( int j = 0; j < numberOfPanelPoints; j++ )
+        {
+            panelSurfaceNormals_.row( panelIndex ) = meshedSurface->getPanelSurfaceNormal( i, j ).transpose( );
+            panelCentroids_.row( panelIndex ) = meshedSurface->getPanelCentroid( i, j ).transpose( );
+            panelAreas_( panelIndex ) = meshedSurface->getPanelArea( i, j );
+
+            areaWeightedSurfaceNormals_.row( panelIndex ) =
+                    panelAreas_( panelIndex ) * panelSurfaceNormals_.row( panelIndex );
+            areaWeightedMomentArms_.row( panelIndex ) =
+                    panelAreas_( panelIndex ) *
+                    ( meshedSurface->getPanelCentroid( i, j ) - momentReferencePoint ).cross(
+                        meshedSurface->getPanelSurfaceNormal( i, j ) ).transpose( );
+            panelIndex++;
+        }
+    }
+}
+
+//! Compute the inclination angles of all panels of a surface w.r.t. the freestream flow.
+void computePanelInclinations( const SurfacePanelArrays& panels,
+                               const Eigen::Vector3d& freestreamVelocityDirection,
+                               PanelInclinations& panelInclinations )
+{
+    panelInclinations.sinesOfInclination.noalias( ) =
+            panels.getPanelSurfaceNormals( ) * freestreamVelocityDirection;
+    panelInclinations.inclinations =
+            ( mathematical_constants::PI / 2.0 - panelInclinations.sinesOfInclination.array( ).acos( ) ).matrix( );
+}
+
+//! Compute the (modified) Newtonian pressure coefficients of all panels in compression.
+void computeNewtonianCompressionPressureCoefficients( const PanelInclinations& panelInclinations,
+                                                      const double stagnationPressureCoefficient,
+                                                      Eigen::VectorXd& pressureCoefficients )
+{
+    pressureCoefficients = ( panelInclinations.inclinations.array( ) > 0.0 ).select(
+                stagnationPressureCoefficient * panelInclinations.sinesOfInclination.array( ).square( ),
+                pressureCoefficients.array( ) ).matrix( );
+}
+
+//! Set a constant pressure coefficient on all panels in expansion.
+void setConstantExpansionPressureCoefficients( const PanelInclinations& panelInclinations,
+                                               const double expansionPressureCoefficient,
+                                               Eigen::VectorXd& pressureCoefficients )
+{
+    pressureCoefficients = ( panelInclinations.inclinations.array( ) <= 0.0 ).select(
+                expansionPressureCoefficient, pressureCoefficients.array( ) ).matrix( );
+}
+
+//! Compute the force on a surface due to the panel pressure coefficients.
+Eigen::Vector3d computePanelForce( const SurfacePanelArrays& panels,
+                                   const Eigen::VectorXd& pressureCoefficients )
+{
+    return -panels.getAreaWeightedSurfaceNormals( ).transpose( ) * pressureCoefficients;
+}
+
+//! Compute the moment on a surface due to the panel pressure coefficients.
+Eigen::Vector3d computePanelMoment( const SurfacePanelArrays& panels,
+                                    const Eigen::VectorXd& pressureCoefficients )
+{
+    return -panels.getAreaWeightedMomentArms( ).transpose( ) * pressureCoefficients;
+}
+
+} // namespace aerodynamics
+} // namespace tudat
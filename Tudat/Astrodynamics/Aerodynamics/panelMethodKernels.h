@@ -0,0 +1,215 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Anderson Jr. , J.D, Hypersonic and High-Temperature Gas Dynamics, 2nd edition,
+ *        AIAA Education Series, 2006
+ *
+ */
+
+#ifndef TUDAT_PANEL_METHOD_KERNELS_H
+#define TUDAT_PANEL_METHOD_KERNELS_H
+
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "Tudat/Mathematics/GeometricShapes/quadrilateralMeshedSurfaceGeometry.h"
+
+namespace tudat
+{
+namespace aerodynamics
+{
+
+//! Typedef for a vector quantity of each panel of a surface (one row per panel).
+/*!
+ *  Typedef for a vector quantity of each panel of a surface (one row per panel). Since the storage is column-major,
+ *  each of the three components is stored contiguously for all panels (structure-of-arrays).
+ */
+typedef Eigen::Matrix< double, Eigen::Dynamic, 3 > PanelVectors;
+
+//! Class storing the properties of the panels of a meshed surface contiguously.
+/*!
+ *  Class storing the surface normals, centroids and areas of the panels of a quadrilateral meshed surface in
+ *  structure-of-arrays form, so that the computations on all panels of the surface can be performed by
+ *  (vectorized) operations on contiguous arrays. The panel with line index i and point index j of the mesh is stored
+ *  at index i * ( numberOfPoints - 1 ) + j. In addition, the area-weighted surface normals and moment arms (w.r.t. a
+ *  given moment reference point) are precomputed, so that the force and moment coefficients are obtained as
+ *  matrix-vector products with the panel pressure coefficients.
+ */
+class SurfacePanelArrays
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor, retrieves the panel properties from the meshed surface.
+     *  \param meshedSurface Meshed surface from which the panel properties are retrieved.
+     *  \param momentReferencePoint Point w.r.t. which the moment arms of the panels are computed.
+     */
+    SurfacePanelArrays(
+            const boost::shared_ptr< geometric_shapes::QuadrilateralMeshedSurfaceGeometry > meshedSurface,
+            const Eigen::Vector3d& momentReferencePoint );
+
+    //! Function to get the number of panels on the surface.
+    /*!
+     *  Function to get the number of panels on the surface.
+     *  \return Number of panels on the surface.
+     */
+    int getNumberOfPanels( ) const
+    {
+        return panelAreas_.rows( );
+    }
+
+    //! Function to get the outward surface normals of the panels.
+    /*!
+     *  Function to get the outward surface normals of the panels.
+     *  \return Outward surface normals of the panels.
+     */
+    const PanelVectors& getPanelSurfaceNormals( ) const
+    {
+        return panelSurfaceNormals_;
+    }
+
+    //! Function to get the centroids of the panels.
+    /*!
+     *  Function to get the centroids of the panels.
+     *  \return Centroids of the panels.
+     */
+    const PanelVectors& getPanelCentroids( ) const
+    {
+        return panelCentroids_;
+    }
+
+    //! Function to get the areas of the panels.
+    /*!
+     *  Function to get the areas of the panels.
+     *  \return Areas of the panels.
+     */
+    const Eigen::VectorXd& getPanelAreas( ) const
+    {
+        return panelAreas_;
+    }
+
+    //! Function to get the outward surface normals of the panels, multiplied by the panel areas.
+    /*!
+     *  Function to get the outward surface normals of the panels, multiplied by the panel areas.
+     *  \return Outward surface normals of the panels, multiplied by the panel areas.
+     */
+    const PanelVectors& getAreaWeightedSurfaceNormals( ) const
+    {
+        return areaWeightedSurfaceNormals_;
+    }
+
+    //! Function to get the moment arms of the panels, multiplied by the panel areas.
+    /*!
+     *  Function to get the cross products of the vectors from the moment reference point to the panel centroids
+     *  with the panel surface normals, multiplied by the panel areas.
+     *  \return Moment arms of the panels, multiplied by the panel areas.
+     */
+    const PanelVectors& getAreaWeightedMomentArms( ) const
+    {
+        return areaWeightedMomentArms_;
+    }
+
+private:
+
+    //! Outward surface normals of the panels.
+    PanelVectors panelSurfaceNormals_;
+
+    //! Centroids of the panels.
+    PanelVectors panelCentroids_;
+
+    //! Areas of the panels.
+    Eigen::VectorXd panelAreas_;
+
+    //! Outward surface normals of the panels, multiplied by the panel areas.
+    PanelVectors areaWeightedSurfaceNormals_;
+
+    //! Cross products of the vectors from the moment reference point to the panel centroids with the panel surface
+    //! normals, multiplied by the panel areas.
+    PanelVectors areaWeightedMomentArms_;
+};
+
+//! Inclination angles of the panels of a single surface w.r.t. the freestream flow.
+struct PanelInclinations
+{
+    //! Sines of the panel inclination angles (inner products of surface normals and freestream velocity direction).
+    Eigen::VectorXd sinesOfInclination;
+
+    //! Panel inclination angles.
+    Eigen::VectorXd inclinations;
+};
+
+//! Compute the inclination angles of all panels of a surface w.r.t. the freestream flow.
+/*!
+ *  Compute the inclination angles of all panels of a surface w.r.t. the freestream flow, from the inner products of
+ *  the surface normals and the freestream velocity direction. Outward pointing surface normals are assumed.
+ *  \param panels Properties of the panels of the surface.
+ *  \param freestreamVelocityDirection Unit vector in the direction of the freestream velocity, in the frame of the
+ *  surface geometry.
+ *  \param panelInclinations Inclination angles of the panels, and their sines (returned by reference).
+ */
+void computePanelInclinations( const SurfacePanelArrays& panels,
+                               const Eigen::Vector3d& freestreamVelocityDirection,
+                               PanelInclinations& panelInclinations );
+
+//! Compute the (modified) Newtonian pressure coefficients of all panels in compression.
+/*!
+ *  Compute the (modified) Newtonian pressure coefficients of all panels with a positive inclination angle, using the
+ *  sines of the inclination angles directly (Anderson, 2006). The pressure coefficients of the other panels are not
+ *  modified.
+ *  \param panelInclinations Inclination angles of the panels, and their sines.
+ *  \param stagnationPressureCoefficient Pressure coefficient at the stagnation point (2.0 for Newtonian theory).
+ *  \param pressureCoefficients Pressure coefficients of the panels (modified by this function).
+ */
+void computeNewtonianCompressionPressureCoefficients( const PanelInclinations& panelInclinations,
+                                                      const double stagnationPressureCoefficient,
+                                                      Eigen::VectorXd& pressureCoefficients );
+
+//! Set a constant pressure coefficient on all panels in expansion.
+/*!
+ *  Set a constant pressure coefficient on all panels with a zero or negative inclination angle. The pressure
+ *  coefficients of the other panels are not modified.
+ *  \param panelInclinations Inclination angles of the panels, and their sines.
+ *  \param expansionPressureCoefficient Pressure coefficient that is to be set on all panels in expansion.
+ *  \param pressureCoefficients Pressure coefficients of the panels (modified by this function).
+ */
+void setConstantExpansionPressureCoefficients( const PanelInclinations& panelInclinations,
+                                               const double expansionPressureCoefficient,
+                                               Eigen::VectorXd& pressureCoefficients );
+
+//! Compute the force on a surface due to the panel pressure coefficients.
+/*!
+ *  Compute the force on a surface due to the panel pressure coefficients, i.e. the sum of the (inward) pressure
+ *  coefficients times the area of each panel. The result is to be divided by the reference area to obtain the force
+ *  coefficients.
+ *  \param panels Properties of the panels of the surface.
+ *  \param pressureCoefficients Pressure coefficients of the panels.
+ *  \return Force on the surface, non-dimensionalized by the dynamic pressure only.
+ */
+Eigen::Vector3d computePanelForce( const SurfacePanelArrays& panels,
+                                   const Eigen::VectorXd& pressureCoefficients );
+
+//! Compute the moment on a surface due to the panel pressure coefficients.
+/*!
+ *  Compute the moment on a surface due to the panel pressure coefficients, w.r.t. the moment reference point of the
+ *  panels. The result is to be divided by the reference area and length to obtain the moment coefficients.
+ *  \param panels Properties of the panels of the surface.
+ *  \param pressureCoefficients Pressure coefficients of the panels.
+ *  \return Moment on the surface, non-dimensionalized by the dynamic pressure only.
+ */
+Eigen::Vector3d computePanelMoment( const SurfacePanelArrays& panels,
+                                    const Eigen::VectorXd& pressureCoefficients );
+
+} // namespace aerodynamics
+} // namespace tudat
+
+#endif // TUDAT_PANEL_METHOD_KERNELS_H
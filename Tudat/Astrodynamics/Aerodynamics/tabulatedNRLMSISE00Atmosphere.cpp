@@ -0,0 +1,408 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+#include <boost/filesystem.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include "Tudat/Astrodynamics/Aerodynamics/tabulatedNRLMSISE00Atmosphere.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace aerodynamics
+{
+
+//! Identifier at start of each tabulated NRLMSISE00 properties file.
+static const char tabulatedNRLMSISE00FileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'N', 'R', 'L' };
+
+//! Version of tabulated NRLMSISE00 properties file format.
+static const boost::uint32_t tabulatedNRLMSISE00FileVersion = 2;
+
+//! Header of tabulated NRLMSISE00 properties file.
+/*!
+ *  Header of tabulated NRLMSISE00 properties file. The header is followed by the grid points of the four independent
+ *  variables, after which the tabulated properties are stored contiguously (in C storage order).
+ */
+struct TabulatedNRLMSISE00FileHeader
+{
+    //! Identifier of file type (equal to tabulatedNRLMSISE00FileIdentifier).
+    char identifier[ 8 ];
+
+    //! Version of file format.
+    boost::uint32_t version;
+
+    //! Number of tabulated properties at each grid point.
+    boost::uint32_t numberOfProperties;
+
+    //! Key identifying the input from which the properties were generated (see getTabulatedNRLMSISE00InputKey).
+    boost::uint64_t inputKey;
+
+    //! Number of grid points of each of the independent variables.
+    boost::uint64_t numberOfGridPoints[ 4 ];
+};
+
+//! Function to compute the number of seconds since the start of the (UT) day.
+double getSecondOfTheDay( const double time )
+{
+    double secondOfTheDay = std::fmod( time + 0.5 * physical_constants::JULIAN_DAY, physical_constants::JULIAN_DAY );
+    if( secondOfTheDay < 0.0 )
+    {
+        secondOfTheDay += physical_constants::JULIAN_DAY;
+    }
+    return secondOfTheDay;
+}
+
+//! Function to compute the vector of tabulated atmospheric properties from an NRLMSISE00 atmosphere model.
+NRLMSISE00PropertiesVector computeNRLMSISE00PropertiesVector(
+        NRLMSISE00Atmosphere& atmosphereModel, const double altitude, const double latitude,
+        const double localSolarTime, const double day )
+{
+    // Set longitude such that local solar time computed from longitude and time is equal to requested value.
+    double time = day * physical_constants::JULIAN_DAY;
+    double longitude = ( localSolarTime - getSecondOfTheDay( time ) / 3600.0 ) *
+            mathematical_constants::PI / 12.0;
+
+    NRLMSISE00PropertiesVector properties;
+    properties( 0 ) = std::log( atmosphereModel.getDensity( altitude, longitude, latitude, time ) );
+    properties( 1 ) = std::log( atmosphereModel.getPressure( altitude, longitude, latitude, time ) );
+    properties( 2 ) = atmosphereModel.getTemperature( altitude, longitude, latitude, time );
+    properties( 3 ) = atmosphereModel.getSpeedOfSound( altitude, longitude, latitude, time );
+
+    // Number densities that are zero are limited to the smallest positive (normalized) value, to keep their logarithm
+    // finite.
+    std::vector< double > numberDensities = atmosphereModel.getNumberDensities( altitude, longitude, latitude, time );
+    for( unsigned int i = 0; i < 8; i++ )
+    {
+        properties( 4 + i ) = std::log( std::max( numberDensities.at( i ), std::numeric_limits< double >::min( ) ) );
+    }
+    return properties;
+}
+
+//! Function to tabulate the properties of the NRLMSISE00 atmosphere model on a 4-dimensional grid.
+boost::multi_array< NRLMSISE00PropertiesVector, 4 > generateTabulatedNRLMSISE00Properties(
+        const boost::shared_ptr< NRLMSISE00InputTable > inputTable,
+        const std::vector< std::vector< double > >& independentVariables )
+{
+    if( independentVariables.size( ) != 4 )
+    {
+        throw std::runtime_error( "Error when tabulating NRLMSISE00 properties, grid must be 4-dimensional, found " +
+                                  boost::lexical_cast< std::string >( independentVariables.size( ) ) );
+    }
+    if( inputTable == NULL )
+    {
+        throw std::runtime_error( "Error when tabulating NRLMSISE00 properties, no input table provided" );
+    }
+
+    boost::array< unsigned int, 4 > numberOfGridPoints;
+    for( unsigned int i = 0; i < 4; i++ )
+    {
+        numberOfGridPoints[ i ] = independentVariables.at( i ).size( );
+    }
+    boost::multi_array< NRLMSISE00PropertiesVector, 4 > tabulatedProperties( numberOfGridPoints );
+
+    // Evaluate properties at all grid points (sequentially, as the C implementation of the model is not thread-safe).
+    NRLMSISE00Atmosphere atmosphereModel( inputTable );
+    for( unsigned int i = 0; i < numberOfGridPoints[ 0 ]; i++ )
+    {
+        for( unsigned int j = 0; j < numberOfGridPoints[ 1 ]; j++ )
+        {
+            for( unsigned int k = 0; k < numberOfGridPoints[ 2 ]; k++ )
+            {
+                for( unsigned int l = 0; l < numberOfGridPoints[ 3 ]; l++ )
+                {
+                    tabulatedProperties[ i ][ j ][ k ][ l ] = computeNRLMSISE00PropertiesVector(
+                                atmosphereModel, independentVariables[ 0 ][ i ], independentVariables[ 1 ][ j ],
+                            independentVariables[ 2 ][ k ], independentVariables[ 3 ][ l ] );
+                }
+            }
+        }
+    }
+
+    return tabulatedProperties;
+}
+
+//! Function to compute the key identifying the input from which NRLMSISE00 properties are tabulated.
+boost::uint64_t getTabulatedNRLMSISE00InputKey( const boost::shared_ptr< NRLMSISE00InputTable > inputTable )
+{
+    if( inputTable == NULL )
+    {
+        throw std::runtime_error( "Error when computing key of tabulated NRLMSISE00 properties, no input table "
+                                  "provided" );
+    }
+    return static_cast< boost::uint64_t >( inputTable->getHashKey( ) );
+}
+
+//! Function to write tabulated NRLMSISE00 atmospheric properties to a binary file.
+void writeTabulatedNRLMSISE00PropertiesToFile(
+        const std::string& fileName,
+        const std::vector< std::vector< double > >& independentVariables,
+        const boost::multi_array< NRLMSISE00PropertiesVector, 4 >& tabulatedProperties,
+        const boost::uint64_t inputKey )
+{
+    // Set header, and check consistency of input.
+    TabulatedNRLMSISE00FileHeader header;
+    std::memcpy( header.identifier, tabulatedNRLMSISE00FileIdentifier, 8 );
+    header.version = tabulatedNRLMSISE00FileVersion;
+    header.numberOfProperties = NRLMSISE00PropertiesVector::RowsAtCompileTime;
+    header.inputKey = inputKey;
+    if( independentVariables.size( ) != 4 )
+    {
+        throw std::runtime_error( "Error when writing tabulated NRLMSISE00 properties, grid must be 4-dimensional" );
+    }
+    for( unsigned int i = 0; i < 4; i++ )
+    {
+        header.numberOfGridPoints[ i ] = independentVariables.at( i ).size( );
+        if( header.numberOfGridPoints[ i ] != tabulatedProperties.shape( )[ i ] )
+        {
+            throw std::runtime_error( "Error when writing tabulated NRLMSISE00 properties, grid and properties are "
+                                      "inconsistent" );
+        }
+    }
+
+    // Create directory, if needed.
+    boost::filesystem::path filePath( fileName );
+    if( filePath.has_parent_path( ) )
+    {
+        boost::filesystem::create_directories( filePath.parent_path( ) );
+    }
+
+    // Write file to temporary location.
+    boost::filesystem::path temporaryFilePath = filePath;
+    temporaryFilePath += boost::filesystem::unique_path( ".%%%%-%%%%-%%%%.tmp" );
+    {
+        std::ofstream outputStream( temporaryFilePath.string( ).c_str( ), std::ios::binary | std::ios::trunc );
+        if( !outputStream.good( ) )
+        {
+            throw std::runtime_error( "Error when writing tabulated NRLMSISE00 properties, could not open file " +
+                                      temporaryFilePath.string( ) );
+        }
+
+        outputStream.write( reinterpret_cast< const char* >( &header ), sizeof( TabulatedNRLMSISE00FileHeader ) );
+        for( unsigned int i = 0; i < 4; i++ )
+        {
+            outputStream.write( reinterpret_cast< const char* >( independentVariables.at( i ).data( ) ),
+                                independentVariables.at( i ).size( ) * sizeof( double ) );
+        }
+
+        // Write properties in C storage order, independent of storage order of input.
+        boost::array< unsigned int, 4 > indices;
+        for( indices[ 0 ] = 0; indices[ 0 ] < header.numberOfGridPoints[ 0 ]; indices[ 0 ]++ )
+        {
+            for( indices[ 1 ] = 0; indices[ 1 ] < header.numberOfGridPoints[ 1 ]; indices[ 1 ]++ )
+            {
+                for( indices[ 2 ] = 0; indices[ 2 ] < header.numberOfGridPoints[ 2 ]; indices[ 2 ]++ )
+                {
+                    for( indices[ 3 ] = 0; indices[ 3 ] < header.numberOfGridPoints[ 3 ]; indices[ 3 ]++ )
+                    {
+                        boost::array< boost::multi_array< NRLMSISE00PropertiesVector, 4 >::index, 4 > arrayIndices;
+                        for( unsigned int i = 0; i < 4; i++ )
+                        {
+                            arrayIndices[ i ] = indices[ i ] + tabulatedProperties.index_bases( )[ i ];
+                        }
+                        outputStream.write( reinterpret_cast< const char* >( tabulatedProperties( arrayIndices ).data( ) ),
+                                            NRLMSISE00PropertiesVector::RowsAtCompileTime * sizeof( double ) );
+                    }
+                }
+            }
+        }
+
+        if( !outputStream.good( ) )
+        {
+            throw std::runtime_error( "Error when writing tabulated NRLMSISE00 properties file " +
+                                      temporaryFilePath.string( ) );
+        }
+    }
+
+    // Move file to final location
+    boost::filesystem::rename( temporaryFilePath, filePath );
+}
+
+//! Function to read tabulated NRLMSISE00 atmospheric properties from a binary file.
+bool readTabulatedNRLMSISE00PropertiesFromFile(
+        const std::string& fileName,
+        const boost::uint64_t inputKey,
+        std::vector< std::vector< double > >& independentVariables,
+        boost::multi_array< NRLMSISE00PropertiesVector, 4 >& tabulatedProperties )
+{
+    if( !boost::filesystem::exists( fileName ) ||
+            boost::filesystem::file_size( fileName ) < sizeof( TabulatedNRLMSISE00FileHeader ) )
+    {
+        return false;
+    }
+
+    std::ifstream inputStream( fileName.c_str( ), std::ios::binary );
+    if( !inputStream.good( ) )
+    {
+        return false;
+    }
+
+    // Check consistency of header (including key of input) and file size.
+    TabulatedNRLMSISE00FileHeader header;
+    inputStream.read( reinterpret_cast< char* >( &header ), sizeof( TabulatedNRLMSISE00FileHeader ) );
+    if( std::memcmp( header.identifier, tabulatedNRLMSISE00FileIdentifier, 8 ) != 0 ||
+            header.version != tabulatedNRLMSISE00FileVersion ||
+            header.numberOfProperties != NRLMSISE00PropertiesVector::RowsAtCompileTime ||
+            header.inputKey != inputKey )
+    {
+        return false;
+    }
+
+    boost::uint64_t numberOfGridValues = 0, numberOfPropertyVectors = 1;
+    for( unsigned int i = 0; i < 4; i++ )
+    {
+        numberOfGridValues += header.numberOfGridPoints[ i ];
+        numberOfPropertyVectors *= header.numberOfGridPoints[ i ];
+    }
+    if( boost::filesystem::file_size( fileName ) != sizeof( TabulatedNRLMSISE00FileHeader ) +
+            ( numberOfGridValues + numberOfPropertyVectors * header.numberOfProperties ) * sizeof( double ) )
+    {
+        return false;
+    }
+
+    // Read grid and properties.
+    std::vector< std::vector< double > > readIndependentVariables( 4 );
+    boost::array< unsigned int, 4 > numberOfGridPoints;
+    for( unsigned int i = 0; i < 4; i++ )
+    {
+        numberOfGridPoints[ i ] = header.numberOfGridPoints[ i ];
+        readIndependentVariables[ i ].resize( numberOfGridPoints[ i ] );
+        inputStream.read( reinterpret_cast< char* >( readIndependentVariables[ i ].data( ) ),
+                          numberOfGridPoints[ i ] * sizeof( double ) );
+    }
+
+    boost::multi_array< NRLMSISE00PropertiesVector, 4 > readProperties( numberOfGridPoints );
+    for( boost::uint64_t i = 0; i < numberOfPropertyVectors; i++ )
+    {
+        inputStream.read( reinterpret_cast< char* >( readProperties.data( )[ i ].data( ) ),
+                          header.numberOfProperties * sizeof( double ) );
+    }
+
+    if( !inputStream.good( ) )
+    {
+        return false;
+    }
+
+    independentVariables = readIndependentVariables;
+    tabulatedProperties.resize( numberOfGridPoints );
+    tabulatedProperties = readProperties;
+    return true;
+}
+
+//! Constructor.
+TabulatedNRLMSISE00Atmosphere::TabulatedNRLMSISE00Atmosphere(
+        const std::vector< std::vector< double > >& independentVariables,
+        const boost::multi_array< NRLMSISE00PropertiesVector, 4 >& tabulatedProperties,
+        const boost::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings ):
+    independentVariables_( independentVariables ), interpolatorInput_( 4 )
+{
+    if( independentVariables_.size( ) != 4 )
+    {
+        throw std::runtime_error( "Error when creating tabulated NRLMSISE00 atmosphere, grid must be 4-dimensional" );
+    }
+    for( unsigned int i = 0; i < 4; i++ )
+    {
+        if( independentVariables_.at( i ).size( ) != tabulatedProperties.shape( )[ i ] )
+        {
+            throw std::runtime_error( "Error when creating tabulated NRLMSISE00 atmosphere, grid and properties are "
+                                      "inconsistent" );
+        }
+    }
+
+    propertiesInterpolator_ = interpolators::createMultiDimensionalInterpolator< double, NRLMSISE00PropertiesVector, 4 >(
+                independentVariables_, tabulatedProperties, interpolatorSettings );
+
+    currentInput_.assign( std::numeric_limits< double >::quiet_NaN( ) );
+}
+
+//! Function to compute the independent variables of the tabulated properties.
+boost::array< double, 4 > TabulatedNRLMSISE00Atmosphere::getIndependentVariables(
+        const double altitude, const double longitude, const double latitude, const double time )
+{
+    // Compute local solar time (as in nrlmsiseInputFunction), wrapped to [0,24) hours.
+    double localSolarTime = std::fmod( getSecondOfTheDay( time ) / 3600.0 +
+                                       longitude / ( mathematical_constants::PI / 12.0 ), 24.0 );
+    if( localSolarTime < 0.0 )
+    {
+        localSolarTime += 24.0;
+    }
+
+    boost::array< double, 4 > independentVariables =
+    { { altitude, latitude, localSolarTime, time / physical_constants::JULIAN_DAY } };
+    return independentVariables;
+}
+
+//! Function to interpolate the atmospheric properties, if the input differs from the previous call.
+void TabulatedNRLMSISE00Atmosphere::computeProperties(
+        const double altitude, const double longitude, const double latitude, const double time )
+{
+    if( altitude == currentInput_[ 0 ] && longitude == currentInput_[ 1 ] &&
+            latitude == currentInput_[ 2 ] && time == currentInput_[ 3 ] )
+    {
+        return;
+    }
+
+    boost::array< double, 4 > independentVariables = getIndependentVariables( altitude, longitude, latitude, time );
+    std::copy( independentVariables.begin( ), independentVariables.end( ), interpolatorInput_.begin( ) );
+    currentProperties_ = propertiesInterpolator_->interpolate( interpolatorInput_ );
+    density_ = std::exp( currentProperties_( 0 ) );
+    pressure_ = std::exp( currentProperties_( 1 ) );
+
+    currentInput_[ 0 ] = altitude;
+    currentInput_[ 1 ] = longitude;
+    currentInput_[ 2 ] = latitude;
+    currentInput_[ 3 ] = time;
+}
+
+//! Function to create a tabulated NRLMSISE00 atmosphere, reading the tabulated properties from file if available.
+boost::shared_ptr< TabulatedNRLMSISE00Atmosphere > createTabulatedNRLMSISE00Atmosphere(
+        const boost::shared_ptr< NRLMSISE00InputTable > inputTable,
+        const std::vector< std::vector< double > >& independentVariables,
+        const std::string& fileName,
+        const boost::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings )
+{
+    // Try to read tabulated properties, generated from the same input, from file.
+    boost::uint64_t inputKey = getTabulatedNRLMSISE00InputKey( inputTable );
+    if( fileName != "" )
+    {
+        std::vector< std::vector< double > > readIndependentVariables;
+        boost::multi_array< NRLMSISE00PropertiesVector, 4 > readProperties;
+        if( readTabulatedNRLMSISE00PropertiesFromFile(
+                    fileName, inputKey, readIndependentVariables, readProperties ) &&
+                readIndependentVariables == independentVariables )
+        {
+            return boost::make_shared< TabulatedNRLMSISE00Atmosphere >(
+                        readIndependentVariables, readProperties, interpolatorSettings );
+        }
+    }
+
+    // Generate tabulated properties, and save to file.
+    boost::multi_array< NRLMSISE00PropertiesVector, 4 > tabulatedProperties =
+            generateTabulatedNRLMSISE00Properties( inputTable, independentVariables );
+    if( fileName != "" )
+    {
+        writeTabulatedNRLMSISE00PropertiesToFile( fileName, independentVariables, tabulatedProperties, inputKey );
+    }
+
+    return boost::make_shared< TabulatedNRLMSISE00Atmosphere >(
+                independentVariables, tabulatedProperties, interpolatorSettings );
+}
+
+} // namespace aerodynamics
+
+} // namespace tudat
@@ -0,0 +1,322 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_TABULATED_NRLMSISE00_ATMOSPHERE_H
+#define TUDAT_TABULATED_NRLMSISE00_ATMOSPHERE_H
+
+#include <string>
+#include <vector>
+
+#include <boost/array.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/multi_array.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Aerodynamics/atmosphereModel.h"
+#include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00Atmosphere.h"
+#include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00InputFunctions.h"
+#include "Tudat/Mathematics/Interpolators/createInterpolator.h"
+
+namespace tudat
+{
+
+namespace aerodynamics
+{
+
+//! Vector of atmospheric properties tabulated by TabulatedNRLMSISE00Atmosphere.
+/*!
+ *  Vector of atmospheric properties tabulated by TabulatedNRLMSISE00Atmosphere, containing (in this order): natural
+ *  logarithm of density [kg/m^3], natural logarithm of pressure [N/m^2], temperature [K], speed of sound [m/s] and
+ *  the natural logarithms of the number densities [m^-3] of the 8 gas components (in the order of
+ *  NRLMSISE00Atmosphere::getNumberDensities). The density, pressure and number densities are tabulated as logarithms,
+ *  so that their (approximately exponential) variation with altitude is well represented by the interpolation.
+ */
+typedef Eigen::Matrix< double, 12, 1 > NRLMSISE00PropertiesVector;
+
+//! Function to compute the vector of tabulated atmospheric properties from an NRLMSISE00 atmosphere model.
+/*!
+ *  Function to compute the vector of tabulated atmospheric properties (see NRLMSISE00PropertiesVector) from an
+ *  NRLMSISE00 atmosphere model, at a given altitude, latitude, local solar time and day. The longitude at which the
+ *  model is evaluated is chosen such that the local solar time computed by the model's input function (as done by
+ *  nrlmsiseInputFunction and NRLMSISE00InputTable::getInput) is equal to the requested local solar time.
+ *  \param atmosphereModel NRLMSISE00 atmosphere model from which properties are to be computed.
+ *  \param altitude Altitude at which properties are to be computed [m].
+ *  \param latitude Latitude at which properties are to be computed [rad].
+ *  \param localSolarTime Local solar time at which properties are to be computed [hours].
+ *  \param day Day at which properties are to be computed, in Julian days since J2000 (i.e. time / 86400 s).
+ *  \return Vector of atmospheric properties.
+ */
+NRLMSISE00PropertiesVector computeNRLMSISE00PropertiesVector(
+        NRLMSISE00Atmosphere& atmosphereModel, const double altitude, const double latitude,
+        const double localSolarTime, const double day );
+
+//! Function to tabulate the properties of the NRLMSISE00 atmosphere model on a 4-dimensional grid.
+/*!
+ *  Function to tabulate the properties of the NRLMSISE00 atmosphere model (see NRLMSISE00PropertiesVector) on a grid
+ *  of altitude [m], latitude [rad], local solar time [hours] and day (in Julian days since J2000, i.e. time / 86400 s).
+ *  Note that the grid is evaluated sequentially: the C implementation of the model stores intermediate results in
+ *  global (static) variables, so that it can not be evaluated concurrently.
+ *  \param inputTable Day-indexed input table which provides the NRLMSISE00 model input.
+ *  \param independentVariables Grid points of altitude, latitude, local solar time and day, respectively, each sorted
+ *  in ascending order.
+ *  \return Tabulated atmospheric properties, with indices in the order of independentVariables.
+ */
+boost::multi_array< NRLMSISE00PropertiesVector, 4 > generateTabulatedNRLMSISE00Properties(
+        const boost::shared_ptr< NRLMSISE00InputTable > inputTable,
+        const std::vector< std::vector< double > >& independentVariables );
+
+//! Function to compute the key identifying the input from which NRLMSISE00 properties are tabulated.
+/*!
+ *  Function to compute the key identifying the input from which NRLMSISE00 properties are tabulated, i.e. the hash of
+ *  the solar activity data in the input table (see NRLMSISE00InputTable::getHashKey). The key is stored in files
+ *  written by writeTabulatedNRLMSISE00PropertiesToFile, so that properties generated from different input are not
+ *  read from such a file.
+ *  \param inputTable Day-indexed input table which provides the NRLMSISE00 model input.
+ *  \return Key identifying the input from which NRLMSISE00 properties are tabulated.
+ */
+boost::uint64_t getTabulatedNRLMSISE00InputKey( const boost::shared_ptr< NRLMSISE00InputTable > inputTable );
+
+//! Function to write tabulated NRLMSISE00 atmospheric properties to a binary file.
+/*!
+ *  Function to write tabulated NRLMSISE00 atmospheric properties, the grid on which they are tabulated, and the key
+ *  of the input from which they were generated, to a binary file, which can be read by
+ *  readTabulatedNRLMSISE00PropertiesFromFile. The file is first written to a temporary file, which is then renamed,
+ *  so that other processes never read a partially written file.
+ *  \param fileName Name of file to which the properties are to be written.
+ *  \param independentVariables Grid points of altitude, latitude, local solar time and day, respectively.
+ *  \param tabulatedProperties Tabulated atmospheric properties, as generated by generateTabulatedNRLMSISE00Properties.
+ *  \param inputKey Key identifying the input from which the properties were generated (see
+ *  getTabulatedNRLMSISE00InputKey).
+ */
+void writeTabulatedNRLMSISE00PropertiesToFile(
+        const std::string& fileName,
+        const std::vector< std::vector< double > >& independentVariables,
+        const boost::multi_array< NRLMSISE00PropertiesVector, 4 >& tabulatedProperties,
+        const boost::uint64_t inputKey );
+
+//! Function to read tabulated NRLMSISE00 atmospheric properties from a binary file.
+/*!
+ *  Function to read tabulated NRLMSISE00 atmospheric properties, and the grid on which they are tabulated, from a
+ *  binary file written by writeTabulatedNRLMSISE00PropertiesToFile. If the file does not exist, is not a valid file of
+ *  this type, or contains properties generated from different input (i.e. with a different key), false is returned and
+ *  the output arguments are not modified.
+ *  \param fileName Name of file from which the properties are to be read.
+ *  \param inputKey Key identifying the input from which the properties should have been generated (see
+ *  getTabulatedNRLMSISE00InputKey).
+ *  \param independentVariables Grid points of altitude, latitude, local solar time and day, respectively (returned
+ *  by reference).
+ *  \param tabulatedProperties Tabulated atmospheric properties (returned by reference).
+ *  \return True if the properties were successfully read from the file.
+ */
+bool readTabulatedNRLMSISE00PropertiesFromFile(
+        const std::string& fileName,
+        const boost::uint64_t inputKey,
+        std::vector< std::vector< double > >& independentVariables,
+        boost::multi_array< NRLMSISE00PropertiesVector, 4 >& tabulatedProperties );
+
+//! Tabulated NRLMSISE-00 atmosphere model class.
+/*!
+ *  Atmosphere model class that interpolates properties of the NRLMSISE-00 atmosphere model, tabulated on a grid of
+ *  altitude, latitude, local solar time and day (see generateTabulatedNRLMSISE00Properties), instead of evaluating the
+ *  empirical model at each call. The local solar time is computed from the longitude and time in the same manner as
+ *  in nrlmsiseInputFunction (and wrapped to the interval [0,24) hours), so the local solar time grid should cover
+ *  this full interval. The day is computed as the time (in seconds since J2000) divided by 86400 s. Outside of the
+ *  tabulated grid, the properties are extrapolated (for the multi-linear interpolator) from the boundary cells.
+ *  Compared to the NRLMSISE00Atmosphere, the dependency on universal time (for a given local solar time) and
+ *  longitude is neglected, and the variation of the solar activity over a day is interpolated.
+ */
+class TabulatedNRLMSISE00Atmosphere : public AtmosphereModel
+{
+public:
+
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param independentVariables Grid points of altitude [m], latitude [rad], local solar time [hours] and day
+     *  (in Julian days since J2000), respectively, each sorted in ascending order.
+     *  \param tabulatedProperties Tabulated atmospheric properties, as generated by
+     *  generateTabulatedNRLMSISE00Properties.
+     *  \param interpolatorSettings Settings for the multi-dimensional interpolator of the tabulated properties
+     *  (multi-linear interpolation by default, see createMultiDimensionalInterpolator).
+     */
+    TabulatedNRLMSISE00Atmosphere(
+            const std::vector< std::vector< double > >& independentVariables,
+            const boost::multi_array< NRLMSISE00PropertiesVector, 4 >& tabulatedProperties,
+            const boost::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings =
+            boost::make_shared< interpolators::InterpolatorSettings >( interpolators::linear_interpolator ) );
+
+    //! Get local density.
+    /*!
+     *  Returns the local density of the atmosphere in kg per meter^3.
+     *  \param altitude Altitude at which density is to be computed [m].
+     *  \param longitude Longitude at which density is to be computed [rad].
+     *  \param latitude Latitude at which density is to be computed [rad].
+     *  \param time Time at which density is to be computed (seconds since J2000).
+     *  \return Atmospheric density [kg/m^3].
+     */
+    double getDensity( const double altitude, const double longitude,
+                       const double latitude, const double time )
+    {
+        computeProperties( altitude, longitude, latitude, time );
+        return density_;
+    }
+
+    //! Get local pressure.
+    /*!
+     *  Returns the local pressure of the atmosphere in Newton per meter^2.
+     *  \param altitude Altitude at which pressure is to be computed [m].
+     *  \param longitude Longitude at which pressure is to be computed [rad].
+     *  \param latitude Latitude at which pressure is to be computed [rad].
+     *  \param time Time at which pressure is to be computed (seconds since J2000).
+     *  \return Atmospheric pressure [N/m^2].
+     */
+    double getPressure( const double altitude, const double longitude,
+                        const double latitude, const double time )
+    {
+        computeProperties( altitude, longitude, latitude, time );
+        return pressure_;
+    }
+
+    //! Get local temperature.
+    /*!
+     *  Returns the local temperature of the atmosphere in Kelvin.
+     *  \param altitude Altitude at which temperature is to be computed [m].
+     *  \param longitude Longitude at which temperature is to be computed [rad].
+     *  \param latitude Latitude at which temperature is to be computed [rad].
+     *  \param time Time at which temperature is to be computed (seconds since J2000).
+     *  \return Atmospheric temperature [K].
+     */
+    double getTemperature( const double altitude, const double longitude,
+                           const double latitude, const double time )
+    {
+        computeProperties( altitude, longitude, latitude, time );
+        return currentProperties_( 2 );
+    }
+
+    //! Get local speed of sound.
+    /*!
+     *  Returns the local speed of sound in m/s.
+     *  \param altitude Altitude at which speed of sound is to be computed [m].
+     *  \param longitude Longitude at which speed of sound is to be computed [rad].
+     *  \param latitude Latitude at which speed of sound is to be computed [rad].
+     *  \param time Time at which speed of sound is to be computed (seconds since J2000).
+     *  \return Speed of sound [m/s].
+     */
+    double getSpeedOfSound( const double altitude, const double longitude,
+                            const double latitude, const double time )
+    {
+        computeProperties( altitude, longitude, latitude, time );
+        return currentProperties_( 3 );
+    }
+
+    //! Get local number density of the gas components.
+    /*!
+     *  Returns the number density of each gas component (in the order of NRLMSISE00Atmosphere::getNumberDensities).
+     *  \param altitude Altitude at which number densities are to be computed [m].
+     *  \param longitude Longitude at which number densities are to be computed [rad].
+     *  \param latitude Latitude at which number densities are to be computed [rad].
+     *  \param time Time at which number densities are to be computed (seconds since J2000).
+     *  \return Number densities of gas components [m^-3].
+     */
+    Eigen::Matrix< double, 8, 1 > getNumberDensities( const double altitude, const double longitude,
+                                                      const double latitude, const double time )
+    {
+        computeProperties( altitude, longitude, latitude, time );
+        return currentProperties_.segment( 4, 8 ).array( ).exp( ).matrix( );
+    }
+
+    //! Function to compute the independent variables of the tabulated properties.
+    /*!
+     *  Function to compute the independent variables (altitude, latitude, local solar time and day) of the tabulated
+     *  properties from the position and time at which the atmosphere is evaluated.
+     *  \param altitude Altitude [m].
+     *  \param longitude Longitude [rad].
+     *  \param latitude Latitude [rad].
+     *  \param time Time (seconds since J2000).
+     *  \return Independent variables of the tabulated properties.
+     */
+    static boost::array< double, 4 > getIndependentVariables(
+            const double altitude, const double longitude, const double latitude, const double time );
+
+    //! Function to retrieve the grid points of the tabulated properties.
+    /*!
+     *  Function to retrieve the grid points of the tabulated properties.
+     *  \return Grid points of altitude, latitude, local solar time and day, respectively.
+     */
+    std::vector< std::vector< double > > getGridPoints( )
+    {
+        return independentVariables_;
+    }
+
+private:
+
+    //! Function to interpolate the atmospheric properties, if the input differs from the previous call.
+    /*!
+     *  Function to interpolate the atmospheric properties, if the input differs from the previous call.
+     *  \param altitude Altitude [m].
+     *  \param longitude Longitude [rad].
+     *  \param latitude Latitude [rad].
+     *  \param time Time (seconds since J2000).
+     */
+    void computeProperties( const double altitude, const double longitude,
+                            const double latitude, const double time );
+
+    //! Grid points of altitude, latitude, local solar time and day, respectively.
+    std::vector< std::vector< double > > independentVariables_;
+
+    //! Interpolator of the tabulated atmospheric properties.
+    boost::shared_ptr< interpolators::Interpolator< double, NRLMSISE00PropertiesVector > > propertiesInterpolator_;
+
+    //! Pre-allocated vector of independent variables that is passed to the interpolator.
+    std::vector< double > interpolatorInput_;
+
+    //! Altitude, longitude, latitude and time at which current properties were computed.
+    boost::array< double, 4 > currentInput_;
+
+    //! Atmospheric properties interpolated at currentInput_.
+    NRLMSISE00PropertiesVector currentProperties_;
+
+    //! Density at currentInput_.
+    double density_;
+
+    //! Pressure at currentInput_.
+    double pressure_;
+};
+
+//! Function to create a tabulated NRLMSISE00 atmosphere, reading the tabulated properties from file if available.
+/*!
+ *  Function to create a tabulated NRLMSISE00 atmosphere. If a file is provided, and it contains properties tabulated
+ *  on the requested grid from the same input (solar activity data, see getTabulatedNRLMSISE00InputKey), the
+ *  properties are read from this file. Otherwise, the properties are generated by
+ *  generateTabulatedNRLMSISE00Properties, and written to the file (if provided).
+ *  \param inputTable Day-indexed input table which provides the NRLMSISE00 model input.
+ *  \param independentVariables Grid points of altitude [m], latitude [rad], local solar time [hours] and day (in Julian
+ *  days since J2000), respectively, each sorted in ascending order.
+ *  \param fileName Name of file from/to which tabulated properties are read/written (none if empty).
+ *  \param interpolatorSettings Settings for the multi-dimensional interpolator of the tabulated properties.
+ *  \return Tabulated NRLMSISE00 atmosphere.
+ */
+boost::shared_ptr< TabulatedNRLMSISE00Atmosphere > createTabulatedNRLMSISE00Atmosphere(
+        const boost::shared_ptr< NRLMSISE00InputTable > inputTable,
+        const std::vector< std::vector< double > >& independentVariables,
+        const std::string& fileName = "",
+        const boost::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings =
+        boost::make_shared< interpolators::InterpolatorSettings >( interpolators::linear_interpolator ) );
+
+} // namespace aerodynamics
+
+} // namespace tudat
+
+#endif // TUDAT_TABULATED_NRLMSISE00_ATMOSPHERE_H
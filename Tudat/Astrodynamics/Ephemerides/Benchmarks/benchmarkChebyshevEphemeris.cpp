@@ -0,0 +1,101 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      This program is only built if BUILD_BENCHMARKS is enabled, and is not run as part of the unit tests.
+ *
+ */
+
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+
+#include "Tudat/Astrodynamics/Ephemerides/chebyshevEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/keplerEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/tabulatedEphemeris.h"
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
+
+//! Benchmark memory usage and evaluation time of Chebyshev ephemeris w.r.t. tabulated (Lagrange) ephemeris.
+/*!
+ *  Benchmark memory usage and evaluation time of Chebyshev ephemeris w.r.t. tabulated (Lagrange) ephemeris, both
+ *  generated from a Keplerian ephemeris of Mars over 10 years. Usage: benchmark_ChebyshevEphemeris [numberOfEvaluations]
+ */
+int main( int argc, char* argv[ ] )
+{
+    using namespace tudat;
+    using namespace tudat::ephemerides;
+    using namespace tudat::interpolators;
+
+    unsigned int numberOfEvaluations = ( argc > 1 ) ? std::atoi( argv[ 1 ] ) : 200000;
+
+    Eigen::Vector6d marsKeplerElements;
+    marsKeplerElements << 2.279E11, 0.0934, 0.0323, 5.0006, 0.8649, 0.3;
+    boost::shared_ptr< Ephemeris > marsNominalEphemeris = boost::make_shared< KeplerEphemeris >(
+                marsKeplerElements, 0.0, 1.32712440018E20, "Sun", "ECLIPJ2000" );
+
+    // Create tabulated ephemeris, with settings as used for interpolated_spice ephemerides.
+    double initialTime = 0.0;
+    double finalTime = 10.0 * 365.25 * 86400.0;
+    double timeStep = 3600.0;
+    std::map< double, Eigen::Vector6d > marsStateHistory;
+    for( double currentTime = initialTime; currentTime <= finalTime; currentTime += timeStep )
+    {
+        marsStateHistory[ currentTime ] = marsNominalEphemeris->getCartesianState( currentTime );
+    }
+    boost::shared_ptr< TabulatedCartesianEphemeris< > > tabulatedEphemeris =
+            boost::make_shared< TabulatedCartesianEphemeris< > >(
+                boost::make_shared< LagrangeInterpolator< double, Eigen::Vector6d > >( marsStateHistory, 8 ) );
+
+    // Create Chebyshev ephemeris
+    boost::shared_ptr< ChebyshevEphemeris > chebyshevEphemeris = fitChebyshevEphemeris(
+                boost::bind( &Ephemeris::getCartesianState, marsNominalEphemeris, _1 ),
+                initialTime, marsStateHistory.rbegin( )->first, 32.0 * 86400.0, 12, 1.0E-2, 1.0E-8 );
+
+    // Compare memory usage (tabulated data stored as independent and dependent variable vectors, and 8 pre-computed
+    // Lagrange denominators per data point).
+    unsigned int tabulatedMemoryUsage = marsStateHistory.size( ) *
+            ( sizeof( double ) + sizeof( Eigen::Vector6d ) + 8 * sizeof( double ) );
+    unsigned int chebyshevMemoryUsage = chebyshevEphemeris->getDataMemoryUsage( );
+
+    // Compare evaluation time
+    double evaluationTimeStep = ( marsStateHistory.rbegin( )->first - initialTime - 1.0 ) /
+            static_cast< double >( numberOfEvaluations );
+
+    Eigen::Vector6d stateSum = Eigen::Vector6d::Zero( );
+    std::clock_t startClock = std::clock( );
+    for( unsigned int i = 0; i < numberOfEvaluations; i++ )
+    {
+        stateSum += tabulatedEphemeris->getCartesianState( initialTime + static_cast< double >( i ) * evaluationTimeStep );
+    }
+    double tabulatedEvaluationTime = static_cast< double >( std::clock( ) - startClock ) / CLOCKS_PER_SEC;
+
+    startClock = std::clock( );
+    for( unsigned int i = 0; i < numberOfEvaluations; i++ )
+    {
+        stateSum -= chebyshevEphemeris->getCartesianState( initialTime + static_cast< double >( i ) * evaluationTimeStep );
+    }
+    double chebyshevEvaluationTime = static_cast< double >( std::clock( ) - startClock ) / CLOCKS_PER_SEC;
+
+    std::cout << "Tabulated (Lagrange) ephemeris: " << marsStateHistory.size( ) << " states, "
+              << tabulatedMemoryUsage << " bytes, " << tabulatedEvaluationTime << " s for "
+              << numberOfEvaluations << " evaluations" << std::endl;
+    std::cout << "Chebyshev ephemeris: " << chebyshevEphemeris->getNumberOfBlocks( ) << " blocks, "
+              << chebyshevMemoryUsage << " bytes, " << chebyshevEvaluationTime << " s for "
+              << numberOfEvaluations << " evaluations" << std::endl;
+
+    // Print mean position difference of evaluated states, to verify that the same (sequence of) states is produced.
+    std::cout << "Mean position difference: "
+              << stateSum.segment( 0, 3 ).norm( ) / static_cast< double >( numberOfEvaluations ) << " m" << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,127 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/Ephemerides/chebyshevEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/keplerEphemeris.h"
+#include "Tudat/Basics/basicTypedefs.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_chebyshev_ephemeris )
+
+//! Function to create a (Keplerian) ephemeris of Mars, to which Chebyshev ephemerides are fitted in the tests.
+boost::shared_ptr< ephemerides::Ephemeris > getMarsKeplerEphemeris( )
+{
+    Eigen::Vector6d marsKeplerElements;
+    marsKeplerElements << 2.279E11, 0.0934, 0.0323, 5.0006, 0.8649, 0.3;
+    return boost::make_shared< ephemerides::KeplerEphemeris >(
+                marsKeplerElements, 0.0, 1.32712440018E20, "Sun", "ECLIPJ2000" );
+}
+
+//! Test whether the Chebyshev ephemeris meets the tolerances to which it is fitted
+BOOST_AUTO_TEST_CASE( testChebyshevEphemerisFit )
+{
+    using namespace ephemerides;
+
+    boost::shared_ptr< Ephemeris > marsNominalEphemeris = getMarsKeplerEphemeris( );
+
+    double initialTime = 0.0;
+    double finalTime = 2.0 * 365.25 * 86400.0;
+    double positionTolerance = 1.0E-2;
+    double velocityTolerance = 1.0E-8;
+
+    // Fit directly to ephemeris, and to state history generated from ephemeris.
+    boost::shared_ptr< ChebyshevEphemeris > directChebyshevEphemeris = fitChebyshevEphemeris(
+                boost::bind( &Ephemeris::getCartesianState, marsNominalEphemeris, _1 ),
+                initialTime, finalTime, 32.0 * 86400.0, 12, positionTolerance, velocityTolerance );
+
+    std::map< double, Eigen::Vector6d > marsStateHistory;
+    for( double currentTime = initialTime; currentTime <= finalTime; currentTime += 3600.0 )
+    {
+        marsStateHistory[ currentTime ] = marsNominalEphemeris->getCartesianState( currentTime );
+    }
+    boost::shared_ptr< ChebyshevEphemeris > historyChebyshevEphemeris = fitChebyshevEphemerisToStateHistory(
+                marsStateHistory, 32.0 * 86400.0, 12, positionTolerance, velocityTolerance, "Sun", "ECLIPJ2000" );
+
+    BOOST_CHECK_EQUAL( historyChebyshevEphemeris->getReferenceFrameOrigin( ), "Sun" );
+    BOOST_CHECK_CLOSE_FRACTION( directChebyshevEphemeris->getFinalTime( ), finalTime, 1.0E-15 );
+    BOOST_CHECK_CLOSE_FRACTION( historyChebyshevEphemeris->getInitialTime( ), initialTime + 3.0 * 3600.0, 1.0E-15 );
+    BOOST_CHECK_CLOSE_FRACTION( historyChebyshevEphemeris->getFinalTime( ),
+                                marsStateHistory.rbegin( )->first - 3.0 * 3600.0, 1.0E-15 );
+
+    // Check consistency of block data
+    BOOST_CHECK_EQUAL( directChebyshevEphemeris->getCoefficientOffsets( ).size( ),
+                       directChebyshevEphemeris->getNumberOfBlocks( ) + 1 );
+    for( unsigned int i = 0; i < directChebyshevEphemeris->getNumberOfBlocks( ); i++ )
+    {
+        BOOST_CHECK( directChebyshevEphemeris->getPolynomialDegree( i ) <= 12 );
+    }
+
+    // Compare states at arbitrary times (including block boundaries) with original ephemeris
+    for( double currentTime = historyChebyshevEphemeris->getInitialTime( );
+         currentTime <= historyChebyshevEphemeris->getFinalTime( ); currentTime += 7777.0 )
+    {
+        Eigen::Vector6d nominalState = marsNominalEphemeris->getCartesianState( currentTime );
+        Eigen::Vector6d directStateDifference = directChebyshevEphemeris->getCartesianState( currentTime ) -
+                nominalState;
+        Eigen::Vector6d historyStateDifference = historyChebyshevEphemeris->getCartesianState( currentTime ) -
+                nominalState;
+        for( unsigned int i = 0; i < 3; i++ )
+        {
+            BOOST_CHECK_SMALL( directStateDifference( i ), 2.0 * positionTolerance );
+            BOOST_CHECK_SMALL( directStateDifference( i + 3 ), 2.0 * velocityTolerance );
+            BOOST_CHECK_SMALL( historyStateDifference( i ), 2.0 * positionTolerance );
+            BOOST_CHECK_SMALL( historyStateDifference( i + 3 ), 2.0 * velocityTolerance );
+        }
+    }
+
+    // Check continuity at block boundary
+    double blockBoundary = directChebyshevEphemeris->getInitialTime( ) + directChebyshevEphemeris->getBlockLength( );
+    Eigen::Vector6d stateDifferenceAtBoundary =
+            directChebyshevEphemeris->getCartesianState( blockBoundary * ( 1.0 - 1.0E-15 ) ) -
+            directChebyshevEphemeris->getCartesianState( blockBoundary );
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        BOOST_CHECK_SMALL( stateDifferenceAtBoundary( i ), 2.0 * positionTolerance );
+    }
+
+    // Check that inconsistent input is rejected
+    std::vector< unsigned int > invalidOffsets;
+    invalidOffsets.push_back( 0 );
+    invalidOffsets.push_back( 5 );
+    bool isExceptionCaught = false;
+    try
+    {
+        ChebyshevEphemeris invalidEphemeris( 0.0, 1.0, std::vector< double >( 5, 0.0 ), invalidOffsets );
+    }
+    catch( std::runtime_error )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,200 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <boost/make_shared.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/testMacros.h"
+
+#include "Tudat/Astrodynamics/Ephemerides/constantEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/frameManager.h"
+#include "Tudat/Astrodynamics/Ephemerides/keplerEphemeris.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::ephemerides;
+
+BOOST_AUTO_TEST_SUITE( test_frame_path_ephemeris )
+
+//! Test whether compiled frame paths reproduce the states along the frame hierarchy, and whether memoization works.
+BOOST_AUTO_TEST_CASE( testFramePathEphemeris )
+{
+    // Create hierarchy SSB -> Sun -> Mars -> Phobos -> Spacecraft, and SSB -> Sun -> Earth
+    Eigen::Vector6d barycentricSunState;
+    barycentricSunState << 1.0E9, -2.0E8, 3.0E7, 1.0, 2.0, -0.5;
+
+    Eigen::Vector6d marsKeplerElements;
+    marsKeplerElements << 2.279E11, 0.0934, 0.0323, 5.0006, 0.8649, 0.3;
+    Eigen::Vector6d earthKeplerElements;
+    earthKeplerElements << 1.496E11, 0.0167, 0.0001, 5.1, 0.0, 1.2;
+    Eigen::Vector6d phobosKeplerElements;
+    phobosKeplerElements << 9.376E6, 0.0151, 0.019, 1.0, 2.0, 3.0;
+
+    Eigen::Vector6d phobosCentricSpacecraftState;
+    phobosCentricSpacecraftState << 2.0E4, 1.0E4, -5.0E3, 1.0, -3.0, 0.5;
+
+    boost::shared_ptr< ConstantEphemeris > sunEphemeris =
+            boost::make_shared< ConstantEphemeris >( barycentricSunState, "SSB", "ECLIPJ2000" );
+    std::map< std::string, boost::shared_ptr< Ephemeris > > ephemerisList;
+    ephemerisList[ "Sun" ] = sunEphemeris;
+    ephemerisList[ "Mars" ] = boost::make_shared< KeplerEphemeris >(
+                marsKeplerElements, 0.0, 1.32712440018E20, "Sun", "ECLIPJ2000" );
+    ephemerisList[ "Earth" ] = boost::make_shared< KeplerEphemeris >(
+                earthKeplerElements, 0.0, 1.32712440018E20, "Sun", "ECLIPJ2000" );
+    ephemerisList[ "Phobos" ] = boost::make_shared< KeplerEphemeris >(
+                phobosKeplerElements, 0.0, 4.282837E13, "Mars", "ECLIPJ2000" );
+    ephemerisList[ "Spacecraft" ] = boost::make_shared< ConstantEphemeris >(
+                phobosCentricSpacecraftState, "Phobos", "ECLIPJ2000" );
+
+    boost::shared_ptr< ReferenceFrameManager > frameManager =
+            boost::make_shared< ReferenceFrameManager >( ephemerisList );
+
+    // Check compiled path between spacecraft and Earth.
+    boost::shared_ptr< FramePathEphemeris > spacecraftPath = frameManager->getFramePathEphemeris( "Earth", "Spacecraft" );
+    BOOST_CHECK_EQUAL( spacecraftPath->getPathEphemerides( ).size( ), 4 );
+    BOOST_CHECK_EQUAL( spacecraftPath->getReferenceFrameOrigin( ), "Earth" );
+    BOOST_CHECK( spacecraftPath->getPathEphemerides( ).at( 0 ) == ephemerisList.at( "Spacecraft" ) );
+    BOOST_CHECK( spacecraftPath->getAddPathStates( ).at( 2 ) );
+    BOOST_CHECK( !spacecraftPath->getAddPathStates( ).at( 3 ) );
+
+    // Check that compiled paths are reused.
+    BOOST_CHECK( frameManager->getEphemeris( "Earth", "Spacecraft" ) == spacecraftPath );
+    BOOST_CHECK( frameManager->getEphemeris( "Earth", "Spacecraft", true ) != spacecraftPath );
+
+    // Compare states with manually computed states (tolerance accounts for cancellation in different order of
+    // summation).
+    double tolerance = 1.0E-14;
+    for( double currentTime = 0.0; currentTime < 1.0E6; currentTime += 1.0E5 )
+    {
+        Eigen::Vector6d expectedState = phobosCentricSpacecraftState +
+                ephemerisList.at( "Phobos" )->getCartesianState( currentTime ) +
+                ephemerisList.at( "Mars" )->getCartesianState( currentTime ) -
+                ephemerisList.at( "Earth" )->getCartesianState( currentTime );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    frameManager->getEphemeris( "Earth", "Spacecraft" )->getCartesianState( currentTime ),
+                    expectedState, tolerance );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    frameManager->getEphemeris( "Spacecraft", "Earth" )->getCartesianState( currentTime ),
+                    ( -1.0 * expectedState ), tolerance );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    frameManager->getEphemeris( "Earth", "Spacecraft", true )->getCartesianState( currentTime ),
+                    expectedState, tolerance );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    ( frameManager->getEphemeris< long double, double >( "Earth", "Spacecraft" )->
+                      getTemplatedStateFromEphemeris< long double, double >( currentTime ).cast< double >( ) ),
+                    expectedState, tolerance );
+
+        expectedState = barycentricSunState + ephemerisList.at( "Mars" )->getCartesianState( currentTime );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    frameManager->getEphemeris( "SSB", "Mars" )->getCartesianState( currentTime ),
+                    expectedState, tolerance );
+    }
+
+    // Check zero state between identical frames.
+    BOOST_CHECK( frameManager->getEphemeris( "Mars", "Mars" )->getCartesianState( 0.0 ) == Eigen::Vector6d::Zero( ) );
+
+    // Check that memoized state is used until it is reset.
+    boost::shared_ptr< Ephemeris > memoizedSunPath = frameManager->getEphemeris( "Earth", "SSB", true );
+    boost::shared_ptr< Ephemeris > sunPath = frameManager->getEphemeris( "Earth", "SSB", false );
+    Eigen::Vector6d initialState = memoizedSunPath->getCartesianState( 1.0E5 );
+
+    sunEphemeris->updateConstantState( 2.0 * barycentricSunState );
+    BOOST_CHECK( memoizedSunPath->getCartesianState( 1.0E5 ) == initialState );
+    BOOST_CHECK( sunPath->getCartesianState( 1.0E5 ) != initialState );
+
+    frameManager->resetCachedStates( );
+    BOOST_CHECK( memoizedSunPath->getCartesianState( 1.0E5 ) == sunPath->getCartesianState( 1.0E5 ) );
+}
+
+//! Test whether the states of ephemeris origins of bodies are memoized, and reset when required.
+BOOST_AUTO_TEST_CASE( testMemoizedBaseFrameStates )
+{
+    using namespace tudat::simulation_setup;
+
+    // Create bodies with hierarchy SSB -> Sun -> Mars -> Phobos
+    Eigen::Vector6d barycentricSunState;
+    barycentricSunState << 1.0E9, -2.0E8, 3.0E7, 1.0, 2.0, -0.5;
+    Eigen::Vector6d marsKeplerElements;
+    marsKeplerElements << 2.279E11, 0.0934, 0.0323, 5.0006, 0.8649, 0.3;
+    Eigen::Vector6d phobosKeplerElements;
+    phobosKeplerElements << 9.376E6, 0.0151, 0.019, 1.0, 2.0, 3.0;
+
+    boost::shared_ptr< ConstantEphemeris > sunEphemeris =
+            boost::make_shared< ConstantEphemeris >( barycentricSunState, "SSB", "ECLIPJ2000" );
+
+    NamedBodyMap bodyMap;
+    bodyMap[ "Sun" ] = boost::make_shared< Body >( );
+    bodyMap[ "Sun" ]->setEphemeris( sunEphemeris );
+    bodyMap[ "Mars" ] = boost::make_shared< Body >( );
+    bodyMap[ "Mars" ]->setEphemeris( boost::make_shared< KeplerEphemeris >(
+                                         marsKeplerElements, 0.0, 1.32712440018E20, "Sun", "ECLIPJ2000" ) );
+    bodyMap[ "Phobos" ] = boost::make_shared< Body >( );
+    bodyMap[ "Phobos" ]->setEphemeris( boost::make_shared< KeplerEphemeris >(
+                                           phobosKeplerElements, 0.0, 4.282837E13, "Mars", "ECLIPJ2000" ) );
+    bodyMap[ "Deimos" ] = boost::make_shared< Body >( );
+    bodyMap[ "Deimos" ]->setEphemeris( boost::make_shared< KeplerEphemeris >(
+                                           2.0 * phobosKeplerElements, 0.0, 4.282837E13, "Mars", "ECLIPJ2000" ) );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000", true );
+
+    // Compare states with manually computed states.
+    double testTime = 1.0E5;
+    Eigen::Vector6d expectedMarsState = barycentricSunState +
+            bodyMap.at( "Mars" )->getEphemeris( )->getCartesianState( testTime );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                bodyMap.at( "Phobos" )->getStateInBaseFrameFromEphemeris( testTime ),
+                ( expectedMarsState + bodyMap.at( "Phobos" )->getEphemeris( )->getCartesianState( testTime ) ),
+                1.0E-14 );
+
+    // Check that the memoized state of an ephemeris origin is shared by all bodies with that origin.
+    boost::shared_ptr< BaseStateInterface > phobosOriginStateInterface =
+            bodyMap.at( "Phobos" )->getEphemerisFrameToBaseFrame( );
+    BOOST_CHECK_EQUAL( phobosOriginStateInterface, bodyMap.at( "Deimos" )->getEphemerisFrameToBaseFrame( ) );
+
+    // Check that memoized states of ephemeris origins are used until they are reset.
+    sunEphemeris->updateConstantState( 2.0 * barycentricSunState );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                ( phobosOriginStateInterface->getBaseFrameState< double, double >( testTime ) ),
+                expectedMarsState, 1.0E-14 );
+
+    resetCachedBaseFrameStates( bodyMap );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                ( phobosOriginStateInterface->getBaseFrameState< double, double >( testTime ) ),
+                ( expectedMarsState + barycentricSunState ), 1.0E-14 );
+
+    // Check that memoized states are recomputed after an ephemeris is set, also for bodies further down the hierarchy.
+    bodyMap.at( "Sun" )->setEphemeris(
+                boost::make_shared< ConstantEphemeris >(
+                    Eigen::Vector6d( 3.0 * barycentricSunState ), "SSB", "ECLIPJ2000" ) );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                ( phobosOriginStateInterface->getBaseFrameState< double, double >( testTime ) ),
+                ( expectedMarsState + 2.0 * barycentricSunState ), 1.0E-14 );
+
+    // Check that states are not memoized by default.
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+    phobosOriginStateInterface = bodyMap.at( "Phobos" )->getEphemerisFrameToBaseFrame( );
+    BOOST_CHECK( phobosOriginStateInterface != bodyMap.at( "Deimos" )->getEphemerisFrameToBaseFrame( ) );
+    sunEphemeris = boost::dynamic_pointer_cast< ConstantEphemeris >( bodyMap.at( "Sun" )->getEphemeris( ) );
+    sunEphemeris->updateConstantState( 4.0 * barycentricSunState );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                ( phobosOriginStateInterface->getBaseFrameState< double, double >( testTime ) ),
+                ( expectedMarsState + 3.0 * barycentricSunState ), 1.0E-14 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
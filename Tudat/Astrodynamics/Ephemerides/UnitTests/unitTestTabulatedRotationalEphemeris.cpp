@@ -0,0 +1,115 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <ctime>
+#include <iostream>
+
+#include <boost/make_shared.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/unitConversions.h"
+#include "Tudat/Astrodynamics/Ephemerides/simpleRotationalEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/tabulatedRotationalEphemeris.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_tabulated_rotational_ephemeris )
+
+//! Test whether the tabulated rotational ephemeris reproduces the ephemeris from which it is sampled.
+BOOST_AUTO_TEST_CASE( testTabulatedRotationalEphemeris )
+{
+    using namespace ephemerides;
+    using unit_conversions::convertDegreesToRadians;
+
+    // Create Earth-like rotational ephemeris, with inclined pole.
+    boost::shared_ptr< RotationalEphemeris > originalEphemeris = boost::make_shared< SimpleRotationalEphemeris >(
+                convertDegreesToRadians( 10.0 ), convertDegreesToRadians( 66.5 ),
+                convertDegreesToRadians( 190.147 ), 7.292115E-5, 0.0, "ECLIPJ2000", "IAU_Earth" );
+
+    // Sample ephemeris over three days (during which the quaternions change sign several times).
+    double initialTime = -86400.0;
+    double finalTime = 2.0 * 86400.0;
+    double timeStep = 300.0;
+    boost::shared_ptr< TabulatedRotationalEphemeris > tabulatedEphemeris = createTabulatedRotationalEphemeris(
+                originalEphemeris, initialTime, finalTime, timeStep );
+
+    BOOST_CHECK_EQUAL( tabulatedEphemeris->getBaseFrameOrientation( ), "ECLIPJ2000" );
+    BOOST_CHECK_EQUAL( tabulatedEphemeris->getTargetFrameOrientation( ), "IAU_Earth" );
+    BOOST_CHECK_CLOSE_FRACTION( tabulatedEphemeris->getFinalTime( ), finalTime, 1.0E-15 );
+    BOOST_CHECK_EQUAL( tabulatedEphemeris->getQuaternionData( ).size( ), 8 * 865 );
+
+    // Compare rotation matrices, their derivatives and angular velocity vectors at arbitrary times (including
+    // tabulated times)
+    for( double currentTime = initialTime; currentTime <= finalTime; currentTime += 77.7 )
+    {
+        Eigen::Matrix3d rotationToBaseDifference =
+                Eigen::Matrix3d( tabulatedEphemeris->getRotationToBaseFrame( currentTime ) ) -
+                Eigen::Matrix3d( originalEphemeris->getRotationToBaseFrame( currentTime ) );
+        Eigen::Matrix3d rotationToTargetDifference =
+                Eigen::Matrix3d( tabulatedEphemeris->getRotationToTargetFrame( currentTime ) ) -
+                Eigen::Matrix3d( originalEphemeris->getRotationToTargetFrame( currentTime ) );
+        Eigen::Matrix3d rotationToBaseDerivativeDifference =
+                tabulatedEphemeris->getDerivativeOfRotationToBaseFrame( currentTime ) -
+                originalEphemeris->getDerivativeOfRotationToBaseFrame( currentTime );
+        Eigen::Matrix3d rotationToTargetDerivativeDifference =
+                tabulatedEphemeris->getDerivativeOfRotationToTargetFrame( currentTime ) -
+                originalEphemeris->getDerivativeOfRotationToTargetFrame( currentTime );
+        Eigen::Vector3d angularVelocityDifference =
+                tabulatedEphemeris->getRotationalVelocityVectorInBaseFrame( currentTime ) -
+                originalEphemeris->getRotationalVelocityVectorInBaseFrame( currentTime );
+
+        BOOST_CHECK_SMALL( rotationToBaseDifference.cwiseAbs( ).maxCoeff( ), 1.0E-10 );
+        BOOST_CHECK_SMALL( rotationToTargetDifference.cwiseAbs( ).maxCoeff( ), 1.0E-10 );
+        BOOST_CHECK_SMALL( rotationToBaseDerivativeDifference.cwiseAbs( ).maxCoeff( ), 1.0E-14 );
+        BOOST_CHECK_SMALL( rotationToTargetDerivativeDifference.cwiseAbs( ).maxCoeff( ), 1.0E-14 );
+        BOOST_CHECK_SMALL( angularVelocityDifference.cwiseAbs( ).maxCoeff( ), 1.0E-14 );
+
+        // Check consistency of full rotational state with separate functions.
+        Eigen::Quaterniond rotationToTargetFrame;
+        Eigen::Matrix3d rotationToTargetFrameDerivative;
+        Eigen::Vector3d angularVelocityVector;
+        tabulatedEphemeris->getFullRotationalQuantitiesToTargetFrame(
+                    rotationToTargetFrame, rotationToTargetFrameDerivative, angularVelocityVector, currentTime );
+        BOOST_CHECK_SMALL( ( Eigen::Matrix3d( rotationToTargetFrame ) -
+                             Eigen::Matrix3d( tabulatedEphemeris->getRotationToTargetFrame( currentTime ) ) ).
+                           cwiseAbs( ).maxCoeff( ), 1.0E-15 );
+        BOOST_CHECK_SMALL( ( rotationToTargetFrameDerivative -
+                             tabulatedEphemeris->getDerivativeOfRotationToTargetFrame( currentTime ) ).
+                           cwiseAbs( ).maxCoeff( ), 1.0E-18 );
+        BOOST_CHECK_SMALL( ( angularVelocityVector -
+                             tabulatedEphemeris->getRotationalVelocityVectorInBaseFrame( currentTime ) ).
+                           cwiseAbs( ).maxCoeff( ), 1.0E-18 );
+    }
+
+    // Check that inconsistent input is rejected
+    bool isExceptionCaught = false;
+    try
+    {
+        TabulatedRotationalEphemeris invalidEphemeris( 0.0, 1.0, std::vector< double >( 12, 0.0 ) );
+    }
+    catch( std::runtime_error )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,279 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <cmath>
+#include <iterator>
+#include <stdexcept>
+
+#include <boost/bind.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/make_shared.hpp>
+
+#include "Tudat/Astrodynamics/Ephemerides/chebyshevEphemeris.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Constructor, sets Chebyshev coefficients and frame data.
+ChebyshevEphemeris::ChebyshevEphemeris( const double initialTime,
+                                        const double blockLength,
+                                        const std::vector< double >& coefficients,
+                                        const std::vector< unsigned int >& coefficientOffsets,
+                                        const std::string& referenceFrameOrigin,
+                                        const std::string& referenceFrameOrientation ):
+    Ephemeris( referenceFrameOrigin, referenceFrameOrientation ),
+    initialTime_( initialTime ), blockLength_( blockLength ), inverseBlockLength_( 1.0 / blockLength ),
+    coefficients_( coefficients ), coefficientOffsets_( coefficientOffsets )
+{
+    if( !( blockLength_ > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, block length must be positive" );
+    }
+
+    if( coefficientOffsets_.size( ) < 2 )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, no blocks provided" );
+    }
+    numberOfBlocks_ = coefficientOffsets_.size( ) - 1;
+
+    // Check consistency of coefficient offsets.
+    if( coefficientOffsets_.at( 0 ) != 0 || coefficientOffsets_.at( numberOfBlocks_ ) != coefficients_.size( ) )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, coefficient offsets inconsistent with "
+                                  "number of coefficients" );
+    }
+    for( unsigned int i = 0; i < numberOfBlocks_; i++ )
+    {
+        if( ( coefficientOffsets_.at( i + 1 ) <= coefficientOffsets_.at( i ) ) ||
+                ( ( coefficientOffsets_.at( i + 1 ) - coefficientOffsets_.at( i ) ) % 6 != 0 ) )
+        {
+            throw std::runtime_error( "Error when creating Chebyshev ephemeris, number of coefficients in block " +
+                                      boost::lexical_cast< std::string >( i ) + " is inconsistent" );
+        }
+    }
+}
+
+//! Get cartesian state from ephemeris.
+Eigen::Vector6d ChebyshevEphemeris::getCartesianState( const double secondsSinceEpoch )
+{
+    // Retrieve block index directly from time (using first/last block outside of range).
+    double blocksSinceStart = ( secondsSinceEpoch - initialTime_ ) * inverseBlockLength_;
+    unsigned int blockIndex = 0;
+    if( blocksSinceStart >= static_cast< double >( numberOfBlocks_ ) )
+    {
+        blockIndex = numberOfBlocks_ - 1;
+    }
+    else if( blocksSinceStart > 0.0 )
+    {
+        blockIndex = static_cast< unsigned int >( blocksSinceStart );
+    }
+
+    // Compute scaled time in block, in the interval [-1,1]
+    double scaledTime = 2.0 * ( blocksSinceStart - static_cast< double >( blockIndex ) ) - 1.0;
+    double twiceScaledTime = 2.0 * scaledTime;
+
+    // Evaluate Chebyshev series for all state elements by Clenshaw's recurrence.
+    const double* blockCoefficients = &coefficients_[ coefficientOffsets_[ blockIndex ] ];
+    int polynomialDegree = ( coefficientOffsets_[ blockIndex + 1 ] - coefficientOffsets_[ blockIndex ] ) / 6 - 1;
+
+    Eigen::Vector6d currentRecurrenceTerm = Eigen::Vector6d::Zero( );
+    Eigen::Vector6d previousRecurrenceTerm = Eigen::Vector6d::Zero( );
+    Eigen::Vector6d nextRecurrenceTerm;
+    for( int j = polynomialDegree; j > 0; j-- )
+    {
+        nextRecurrenceTerm = twiceScaledTime * currentRecurrenceTerm - previousRecurrenceTerm +
+                Eigen::Map< const Eigen::Vector6d >( blockCoefficients + 6 * j );
+        previousRecurrenceTerm = currentRecurrenceTerm;
+        currentRecurrenceTerm = nextRecurrenceTerm;
+    }
+
+    return scaledTime * currentRecurrenceTerm - previousRecurrenceTerm +
+            Eigen::Map< const Eigen::Vector6d >( blockCoefficients );
+}
+
+//! Function to fit a piecewise Chebyshev ephemeris to a given state function.
+boost::shared_ptr< ChebyshevEphemeris > fitChebyshevEphemeris(
+        const boost::function< Eigen::Vector6d( const double ) > stateFunction,
+        const double initialTime,
+        const double finalTime,
+        const double maximumBlockLength,
+        const unsigned int maximumPolynomialDegree,
+        const double positionTolerance,
+        const double velocityTolerance,
+        const std::string& referenceFrameOrigin,
+        const std::string& referenceFrameOrientation,
+        const unsigned int maximumNumberOfBlockRefinements )
+{
+    if( !( finalTime > initialTime ) || !( maximumBlockLength > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when fitting Chebyshev ephemeris, time interval or block length is invalid" );
+    }
+
+    // Set tolerance per state element
+    Eigen::Vector6d tolerances;
+    tolerances << positionTolerance, positionTolerance, positionTolerance,
+            velocityTolerance, velocityTolerance, velocityTolerance;
+
+    // Pre-compute Chebyshev polynomials at interpolation nodes: T_j( x_k ) = cos( j * theta_k ).
+    unsigned int numberOfNodes = maximumPolynomialDegree + 1;
+    Eigen::VectorXd nodeAngles = Eigen::VectorXd::Zero( numberOfNodes );
+    Eigen::MatrixXd polynomialsAtNodes = Eigen::MatrixXd::Zero( numberOfNodes, numberOfNodes );
+    for( unsigned int k = 0; k < numberOfNodes; k++ )
+    {
+        nodeAngles( k ) = mathematical_constants::PI * ( static_cast< double >( k ) + 0.5 ) /
+                static_cast< double >( numberOfNodes );
+        for( unsigned int j = 0; j < numberOfNodes; j++ )
+        {
+            polynomialsAtNodes( j, k ) = std::cos( static_cast< double >( j ) * nodeAngles( k ) );
+        }
+    }
+
+    // Set initial number of blocks.
+    unsigned int numberOfBlocks = static_cast< unsigned int >(
+                std::ceil( ( finalTime - initialTime ) / maximumBlockLength - 1.0E-12 ) );
+    if( numberOfBlocks == 0 )
+    {
+        numberOfBlocks = 1;
+    }
+
+    Eigen::Matrix< double, 6, Eigen::Dynamic > statesAtNodes =
+            Eigen::Matrix< double, 6, Eigen::Dynamic >::Zero( 6, numberOfNodes );
+    Eigen::Matrix< double, 6, Eigen::Dynamic > blockCoefficients;
+
+    std::vector< double > coefficients;
+    std::vector< unsigned int > coefficientOffsets;
+    for( unsigned int refinement = 0; refinement <= maximumNumberOfBlockRefinements; refinement++ )
+    {
+        double blockLength = ( finalTime - initialTime ) / static_cast< double >( numberOfBlocks );
+
+        coefficients.clear( );
+        coefficientOffsets.clear( );
+        coefficientOffsets.push_back( 0 );
+
+        // Fit and truncate series in each block.
+        for( unsigned int i = 0; i < numberOfBlocks; i++ )
+        {
+            double blockMidTime = initialTime + ( static_cast< double >( i ) + 0.5 ) * blockLength;
+            for( unsigned int k = 0; k < numberOfNodes; k++ )
+            {
+                statesAtNodes.col( k ) = stateFunction( blockMidTime + 0.5 * blockLength * std::cos( nodeAngles( k ) ) );
+            }
+
+            blockCoefficients = 2.0 / static_cast< double >( numberOfNodes ) * statesAtNodes *
+                    polynomialsAtNodes.transpose( );
+            blockCoefficients.col( 0 ) *= 0.5;
+
+            // Determine lowest degree for which the neglected coefficients are (conservatively) below tolerance.
+            unsigned int truncatedDegree = maximumPolynomialDegree;
+            Eigen::Vector6d neglectedCoefficientSum = Eigen::Vector6d::Zero( );
+            while( truncatedDegree > 0 )
+            {
+                neglectedCoefficientSum += blockCoefficients.col( truncatedDegree ).cwiseAbs( );
+                if( ( neglectedCoefficientSum - 0.1 * tolerances ).maxCoeff( ) > 0.0 )
+                {
+                    break;
+                }
+                truncatedDegree--;
+            }
+
+            for( unsigned int j = 0; j <= truncatedDegree; j++ )
+            {
+                for( unsigned int k = 0; k < 6; k++ )
+                {
+                    coefficients.push_back( blockCoefficients( k, j ) );
+                }
+            }
+            coefficientOffsets.push_back( coefficients.size( ) );
+        }
+
+        boost::shared_ptr< ChebyshevEphemeris > chebyshevEphemeris = boost::make_shared< ChebyshevEphemeris >(
+                    initialTime, blockLength, coefficients, coefficientOffsets,
+                    referenceFrameOrigin, referenceFrameOrientation );
+
+        // Verify fit halfway between interpolation nodes, and at block boundaries.
+        bool isFitAccurate = true;
+        for( unsigned int i = 0; ( i < numberOfBlocks ) && isFitAccurate; i++ )
+        {
+            double blockStartTime = initialTime + static_cast< double >( i ) * blockLength;
+            for( unsigned int k = 0; ( k <= numberOfNodes ) && isFitAccurate; k++ )
+            {
+                double testAngle = mathematical_constants::PI * static_cast< double >( k ) /
+                        static_cast< double >( numberOfNodes );
+                double testTime = blockStartTime + 0.5 * blockLength * ( 1.0 + std::cos( testAngle ) );
+                if( ( ( chebyshevEphemeris->getCartesianState( testTime ) - stateFunction( testTime ) ).cwiseAbs( ) -
+                      tolerances ).maxCoeff( ) > 0.0 )
+                {
+                    isFitAccurate = false;
+                }
+            }
+        }
+
+        if( isFitAccurate )
+        {
+            return chebyshevEphemeris;
+        }
+        numberOfBlocks *= 2;
+    }
+
+    throw std::runtime_error( "Error when fitting Chebyshev ephemeris, tolerances not met after " +
+                              boost::lexical_cast< std::string >( maximumNumberOfBlockRefinements ) +
+                              " block refinements" );
+}
+
+//! Function to evaluate a state interpolator (used for fitting of Chebyshev ephemeris to state history).
+Eigen::Vector6d interpolateStateHistory(
+        const boost::shared_ptr< interpolators::LagrangeInterpolator< double, Eigen::Vector6d > > stateInterpolator,
+        const double time )
+{
+    return stateInterpolator->interpolate( time );
+}
+
+//! Function to fit a piecewise Chebyshev ephemeris to a given state history.
+boost::shared_ptr< ChebyshevEphemeris > fitChebyshevEphemerisToStateHistory(
+        const std::map< double, Eigen::Vector6d >& stateHistory,
+        const double maximumBlockLength,
+        const unsigned int maximumPolynomialDegree,
+        const double positionTolerance,
+        const double velocityTolerance,
+        const std::string& referenceFrameOrigin,
+        const std::string& referenceFrameOrientation )
+{
+    if( stateHistory.size( ) < 8 )
+    {
+        throw std::runtime_error( "Error when fitting Chebyshev ephemeris to state history, insufficient states provided" );
+    }
+
+    boost::shared_ptr< interpolators::LagrangeInterpolator< double, Eigen::Vector6d > > stateInterpolator =
+            boost::make_shared< interpolators::LagrangeInterpolator< double, Eigen::Vector6d > >(
+                stateHistory, 8, interpolators::huntingAlgorithm,
+                interpolators::lagrange_cubic_spline_boundary_interpolation );
+
+    // Retrieve interval in which interpolator uses centered Lagrange interpolation (i.e. excluding boundary intervals).
+    std::map< double, Eigen::Vector6d >::const_iterator initialIterator = stateHistory.begin( );
+    std::advance( initialIterator, 3 );
+    std::map< double, Eigen::Vector6d >::const_reverse_iterator finalIterator = stateHistory.rbegin( );
+    std::advance( finalIterator, 3 );
+
+    return fitChebyshevEphemeris(
+                boost::bind( &interpolateStateHistory, stateInterpolator, _1 ),
+                initialIterator->first, finalIterator->first,
+                maximumBlockLength, maximumPolynomialDegree, positionTolerance, velocityTolerance,
+                referenceFrameOrigin, referenceFrameOrientation );
+}
+
+} // namespace ephemerides
+
+} // namespace tudat
@@ -0,0 +1,243 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_CHEBYSHEVEPHEMERIS_H
+#define TUDAT_CHEBYSHEVEPHEMERIS_H
+
+#include <map>
+#include <vector>
+
+#include <boost/function.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Ephemerides/ephemeris.h"
+#include "Tudat/Basics/basicTypedefs.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Class that determines an ephemeris from piecewise Chebyshev polynomials.
+/*!
+ *  Class that determines an ephemeris from piecewise Chebyshev polynomials, in a manner similar to the SPICE SPK type
+ *  3 segments. The time interval of the ephemeris is divided into blocks of equal length, in each of which each of the
+ *  six Cartesian state elements is represented by a Chebyshev series in the scaled time. As all blocks are of equal
+ *  length, the block containing a given time is found directly (without any search). The polynomial degree may differ
+ *  per block. The coefficients of all blocks are stored contiguously, with the coefficients of degree j of the six state
+ *  elements stored at consecutive entries. Objects of this class are typically created by the
+ *  fitChebyshevEphemeris function.
+ */
+class ChebyshevEphemeris : public Ephemeris
+{
+public:
+
+    using Ephemeris::getCartesianState;
+
+    //! Constructor, sets Chebyshev coefficients and frame data.
+    /*!
+     *  Constructor, sets Chebyshev coefficients and frame data.
+     *  \param initialTime Start time of the first block.
+     *  \param blockLength Length of each block.
+     *  \param coefficients Coefficients of all blocks. For block i, the coefficient of degree j for state element k is
+     *  located at entry coefficientOffsets[ i ] + 6 * j + k.
+     *  \param coefficientOffsets Index of first coefficient of each block in coefficients, with an additional final entry
+     *  equal to the size of coefficients (size is number of blocks plus one).
+     *  \param referenceFrameOrigin Origin of reference frame in which state is defined.
+     *  \param referenceFrameOrientation Orientation of reference frame in which state is defined.
+     */
+    ChebyshevEphemeris( const double initialTime,
+                        const double blockLength,
+                        const std::vector< double >& coefficients,
+                        const std::vector< unsigned int >& coefficientOffsets,
+                        const std::string& referenceFrameOrigin = "SSB",
+                        const std::string& referenceFrameOrientation = "ECLIPJ2000" );
+
+    //! Destructor
+    ~ChebyshevEphemeris( ){ }
+
+    //! Get cartesian state from ephemeris.
+    /*!
+     *  Returns cartesian state from ephemeris, evaluated from the Chebyshev series of the block containing the requested
+     *  time by Clenshaw's recurrence. Times outside the range of the ephemeris are evaluated using the first or last block.
+     *  \param secondsSinceEpoch Seconds since epoch.
+     *  \return State in Cartesian elements from ephemeris.
+     */
+    Eigen::Vector6d getCartesianState( const double secondsSinceEpoch );
+
+    //! Function to return the start time of the first block.
+    /*!
+     *  Function to return the start time of the first block.
+     *  \return Start time of the first block.
+     */
+    double getInitialTime( )
+    {
+        return initialTime_;
+    }
+
+    //! Function to return the end time of the last block.
+    /*!
+     *  Function to return the end time of the last block.
+     *  \return End time of the last block.
+     */
+    double getFinalTime( )
+    {
+        return initialTime_ + blockLength_ * static_cast< double >( numberOfBlocks_ );
+    }
+
+    //! Function to return the length of each block.
+    /*!
+     *  Function to return the length of each block.
+     *  \return Length of each block.
+     */
+    double getBlockLength( )
+    {
+        return blockLength_;
+    }
+
+    //! Function to return the number of blocks.
+    /*!
+     *  Function to return the number of blocks.
+     *  \return Number of blocks.
+     */
+    unsigned int getNumberOfBlocks( )
+    {
+        return numberOfBlocks_;
+    }
+
+    //! Function to return the polynomial degree of a given block.
+    /*!
+     *  Function to return the polynomial degree of a given block.
+     *  \param blockIndex Index of block for which degree is to be returned.
+     *  \return Polynomial degree of block.
+     */
+    unsigned int getPolynomialDegree( const unsigned int blockIndex )
+    {
+        return ( coefficientOffsets_.at( blockIndex + 1 ) - coefficientOffsets_.at( blockIndex ) ) / 6 - 1;
+    }
+
+    //! Function to return the coefficients of all blocks.
+    /*!
+     *  Function to return the coefficients of all blocks (see constructor for ordering).
+     *  \return Coefficients of all blocks.
+     */
+    const std::vector< double >& getCoefficients( )
+    {
+        return coefficients_;
+    }
+
+    //! Function to return the index of first coefficient of each block.
+    /*!
+     *  Function to return the index of first coefficient of each block, with an additional final entry equal to the size
+     *  of coefficients.
+     *  \return Index of first coefficient of each block.
+     */
+    const std::vector< unsigned int >& getCoefficientOffsets( )
+    {
+        return coefficientOffsets_;
+    }
+
+    //! Function to return the memory used for storing the ephemeris data
+    /*!
+     *  Function to return the memory used for storing the ephemeris data (coefficients and offsets), in bytes.
+     *  \return Memory used for storing the ephemeris data.
+     */
+    unsigned int getDataMemoryUsage( )
+    {
+        return coefficients_.size( ) * sizeof( double ) + coefficientOffsets_.size( ) * sizeof( unsigned int );
+    }
+
+private:
+
+    //! Start time of the first block.
+    double initialTime_;
+
+    //! Length of each block.
+    double blockLength_;
+
+    //! Inverse of length of each block (pre-computed for efficiency).
+    double inverseBlockLength_;
+
+    //! Number of blocks.
+    unsigned int numberOfBlocks_;
+
+    //! Coefficients of all blocks (see constructor for ordering).
+    std::vector< double > coefficients_;
+
+    //! Index of first coefficient of each block, with an additional final entry equal to the size of coefficients_.
+    std::vector< unsigned int > coefficientOffsets_;
+};
+
+//! Function to fit a piecewise Chebyshev ephemeris to a given state function.
+/*!
+ *  Function to fit a piecewise Chebyshev ephemeris to a given state function. The time interval is divided into blocks
+ *  of equal length, no longer than the given maximum. In each block, a Chebyshev series of the maximum degree is fit to
+ *  the state function by interpolation at the Chebyshev nodes, after which the series is truncated to the lowest degree
+ *  for which the neglected coefficients are below the tolerance. The resulting series are then verified by comparison
+ *  with the state function halfway between the nodes. If the tolerances are not met in any of the blocks, the number of
+ *  blocks is doubled and the fit is repeated.
+ *  \param stateFunction Function returning the Cartesian state as a function of time.
+ *  \param initialTime Start time of the ephemeris.
+ *  \param finalTime End time of the ephemeris.
+ *  \param maximumBlockLength Maximum length of each block.
+ *  \param maximumPolynomialDegree Maximum polynomial degree of the series in each block.
+ *  \param positionTolerance Maximum error of each position component.
+ *  \param velocityTolerance Maximum error of each velocity component.
+ *  \param referenceFrameOrigin Origin of reference frame in which state is defined.
+ *  \param referenceFrameOrientation Orientation of reference frame in which state is defined.
+ *  \param maximumNumberOfBlockRefinements Maximum number of times the number of blocks is doubled before an error is
+ *  thrown.
+ *  \return Piecewise Chebyshev ephemeris fitted to state function.
+ */
+boost::shared_ptr< ChebyshevEphemeris > fitChebyshevEphemeris(
+        const boost::function< Eigen::Vector6d( const double ) > stateFunction,
+        const double initialTime,
+        const double finalTime,
+        const double maximumBlockLength,
+        const unsigned int maximumPolynomialDegree,
+        const double positionTolerance,
+        const double velocityTolerance,
+        const std::string& referenceFrameOrigin = "SSB",
+        const std::string& referenceFrameOrientation = "ECLIPJ2000",
+        const unsigned int maximumNumberOfBlockRefinements = 8 );
+
+//! Function to fit a piecewise Chebyshev ephemeris to a given state history.
+/*!
+ *  Function to fit a piecewise Chebyshev ephemeris to a given state history, such as the numerically propagated states
+ *  of a body. The state history is interpolated by an 8th order Lagrange interpolator, which is used as the state
+ *  function in the fitChebyshevEphemeris function. The interval of the ephemeris is that of the state history, excluding
+ *  the first and last three time steps (in which the Lagrange interpolation is not centered, and less accurate).
+ *  \param stateHistory Map of Cartesian states (values) as a function of time (keys).
+ *  \param maximumBlockLength Maximum length of each block.
+ *  \param maximumPolynomialDegree Maximum polynomial degree of the series in each block.
+ *  \param positionTolerance Maximum error of each position component (w.r.t. interpolated state history).
+ *  \param velocityTolerance Maximum error of each velocity component (w.r.t. interpolated state history).
+ *  \param referenceFrameOrigin Origin of reference frame in which state is defined.
+ *  \param referenceFrameOrientation Orientation of reference frame in which state is defined.
+ *  \return Piecewise Chebyshev ephemeris fitted to state history.
+ */
+boost::shared_ptr< ChebyshevEphemeris > fitChebyshevEphemerisToStateHistory(
+        const std::map< double, Eigen::Vector6d >& stateHistory,
+        const double maximumBlockLength,
+        const unsigned int maximumPolynomialDegree,
+        const double positionTolerance,
+        const double velocityTolerance,
+        const std::string& referenceFrameOrigin = "SSB",
+        const std::string& referenceFrameOrientation = "ECLIPJ2000" );
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_CHEBYSHEVEPHEMERIS_H
@@ -203,6 +203,65 @@ std::vector< boost::shared_ptr< Ephemeris > > ReferenceFrameManager::getDirectEp
     return ephemerisList;
 }
 
+//! Function to retrieve the compiled path between a body and a requested frame origin.
+boost::shared_ptr< FramePathEphemeris > ReferenceFrameManager::getFramePathEphemeris(
+        const std::string& origin, const std::string& body, const bool memoizeStates )
+{
+    // Return previously compiled path, if available.
+    std::pair< std::pair< std::string, std::string >, bool > pathKey =
+            std::make_pair( std::make_pair( origin, body ), memoizeStates );
+    std::map< std::pair< std::pair< std::string, std::string >, bool >,
+            boost::shared_ptr< FramePathEphemeris > >::const_iterator pathIterator =
+            compiledFramePaths_.find( pathKey );
+    if( pathIterator != compiledFramePaths_.end( ) )
+    {
+        return pathIterator->second;
+    }
+
+    std::vector< boost::shared_ptr< Ephemeris > > pathEphemerides;
+    std::vector< bool > addPathStates;
+
+    // If requested 'body' is origin, path is empty (zero state).
+    if( body != origin )
+    {
+        // Find nearest common frame between frames.
+        std::vector< std::string > framesToCheck;
+        framesToCheck.push_back( origin );
+        framesToCheck.push_back( body );
+        std::string nearestCommonFrame = getNearestCommonFrame( framesToCheck ).first;
+
+        // Add ephemerides from nearest common frame to body (added), and from nearest common frame to origin
+        // (subtracted). If either is the nearest common frame, the associated list is empty.
+        std::vector< boost::shared_ptr< Ephemeris > > ephemerisList =
+                getDirectEphemerisFromLowerToUpperFrame( nearestCommonFrame, body );
+        pathEphemerides.insert( pathEphemerides.end( ), ephemerisList.begin( ), ephemerisList.end( ) );
+        addPathStates.insert( addPathStates.end( ), ephemerisList.size( ), true );
+
+        ephemerisList = getDirectEphemerisFromLowerToUpperFrame( nearestCommonFrame, origin );
+        pathEphemerides.insert( pathEphemerides.end( ), ephemerisList.begin( ), ephemerisList.end( ) );
+        addPathStates.insert( addPathStates.end( ), ephemerisList.size( ), false );
+    }
+
+    std::string frameOrientation = ( pathEphemerides.size( ) > 0 ) ?
+                pathEphemerides.at( 0 )->getReferenceFrameOrientation( ) : "ECLIPJ2000";
+    boost::shared_ptr< FramePathEphemeris > framePathEphemeris = boost::make_shared< FramePathEphemeris >(
+                pathEphemerides, addPathStates, memoizeStates, origin, frameOrientation );
+    compiledFramePaths_[ pathKey ] = framePathEphemeris;
+
+    return framePathEphemeris;
+}
+
+//! Function to reset the memoized states of all compiled paths.
+void ReferenceFrameManager::resetCachedStates( )
+{
+    for( std::map< std::pair< std::pair< std::string, std::string >, bool >,
+         boost::shared_ptr< FramePathEphemeris > >::iterator pathIterator = compiledFramePaths_.begin( );
+         pathIterator != compiledFramePaths_.end( ); pathIterator++ )
+    {
+        pathIterator->second->resetCachedStates( );
+    }
+}
+
 //! Return the level at which the requested ephemeris is in the hierarchy.
 std::pair< int, bool > ReferenceFrameManager::getFrameLevel( const std::string& frame )
 {
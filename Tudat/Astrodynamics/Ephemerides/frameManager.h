@@ -22,6 +22,7 @@
 
 #include "Tudat/Astrodynamics/Ephemerides/compositeEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/constantEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/framePathEphemeris.h"
 
 namespace tudat
 {
@@ -66,103 +67,49 @@ public:
     //! Function to retrieve the ephemeris of a body with a requested frame origin.
     /*!
      *  Function to retrieve the ephemeris of a body with a requested frame origin. Both the body
-     *  and the origin must be loaded into the frame manager.
-
+     *  and the origin must be loaded into the frame manager. The path through the frame hierarchy
+     *  is compiled once per (origin, body) pair into a flat list of ephemerides with signs (see
+     *  FramePathEphemeris), and the same object is returned in subsequent calls. The returned
+     *  ephemeris provides states for all state scalar and time types, the template arguments of
+     *  this function are retained for compatibility.
      *  \param origin Origin of ephemeris
      *  \param body Body for which ephemeris is requested.
+     *  \param memoizeStates Boolean denoting whether the returned ephemeris is to memoize the most
+     *  recently computed state, so that repeated queries at the same time require a single path
+     *  evaluation. If true, resetCachedStates must be called when any of the ephemerides in the
+     *  frame manager are modified.
      *  \return Ephemeris of requested body qith requested frame origin
      */
     template< typename StateScalarType = double, typename TimeType = double >
     boost::shared_ptr< Ephemeris > getEphemeris(
-            const std::string& origin, const std::string& body )
+            const std::string& origin, const std::string& body, const bool memoizeStates = false )
     {
-        typedef Eigen::Matrix< StateScalarType, 6, 1 > StateType;
-        boost::shared_ptr< Ephemeris > ephemerisBetweenFrames;
-
-        // If requested 'body' is global base frame, return constant zero ephemeris.
-        if( body == origin )
-        {
-            //NOTE: Should generalize to long double state type.
-            ephemerisBetweenFrames = boost::make_shared< ConstantEphemeris >(
-                        boost::lambda::constant( Eigen::Vector6d::Zero( ) ), origin, "ECLIPJ2000" );
-        }
-        else
-        {
-            // Set frames between which ephemeris must be created.
-            std::vector< std::string > framesToCheck;
-            framesToCheck.push_back( origin );
-            framesToCheck.push_back( body );
-
-            // Find nearest common frame between frames.
-            std::pair< std::string, int > nearestCommonFrame = getNearestCommonFrame( framesToCheck );
-
-            // Initialize list of ephemeris functions for composite ephemeris creation
-            std::map< int, std::pair< boost::function< StateType( const TimeType& ) >, bool > >
-                 totalEphemerisList;
-
-            // If body is nearest common frame, get set of ephemeris and set to subtract them when
-            // making composite ephemeris.
-            std::vector< boost::shared_ptr< Ephemeris > > ephemerisList;
-            if( nearestCommonFrame.first == body )
-            {
-                ephemerisList = getDirectEphemerisFromLowerToUpperFrame( body, origin );
-                for( unsigned int i = 0; i < ephemerisList.size( ); i++ )
-                {
-                    totalEphemerisList[ i ] = std::make_pair(
-                                boost::bind( &Ephemeris::getTemplatedStateFromEphemeris
-                                             < StateScalarType, TimeType >,
-                                             ephemerisList[ i ], _1 ), false );
-                }
-            }
-            // If origin is nearest common frame, get set of ephemeris and set to add them when
-            // making composite ephemeris.
-            else if( nearestCommonFrame.first == origin )
-            {
-                ephemerisList = getDirectEphemerisFromLowerToUpperFrame( origin, body );
-                for( unsigned int i = 0; i < ephemerisList.size( ); i++ )
-                {
-                    totalEphemerisList[ i ] = std::make_pair(
-                                boost::bind( &Ephemeris::getTemplatedStateFromEphemeris
-                                             < StateScalarType, TimeType >,
-                                             ephemerisList[ i ], _1 ), true );
-                }
-            }
-            // If nearest common frame is neither input, create link from both to nearest common frame.
-            else
-            {
-                // Get set of ephemeris from nearest common frame to body and set to add them when
-                // making composite ephemeris.
-                ephemerisList = getDirectEphemerisFromLowerToUpperFrame( nearestCommonFrame.first, body );
-                for( unsigned int i = 0; i < ephemerisList.size( ); i++ )
-                {
-                    totalEphemerisList[ i ] = std::make_pair(
-                                boost::bind( &Ephemeris::getTemplatedStateFromEphemeris
-                                             < StateScalarType, TimeType >,
-                                             ephemerisList[ i ], _1 ), true );
-                }
-                int firstListSize = ephemerisList.size( );
-
-                // Get set of ephemeris from nearest common frame to origin and set to subtract them
-                // when making composite ephemeris.
-                ephemerisList = getDirectEphemerisFromLowerToUpperFrame( nearestCommonFrame.first, origin );
-                for( unsigned int i = 0; i < ephemerisList.size( ); i++ )
-                {
-                    totalEphemerisList[ i + firstListSize ] = std::make_pair(
-                                boost::bind( &Ephemeris::getTemplatedStateFromEphemeris
-                                             < StateScalarType, TimeType >,
-                                             ephemerisList[ i ], _1 ), false );
-                }
-            }
+        return getFramePathEphemeris( origin, body, memoizeStates );
+    }
 
-            // Create composite ephemeris
-            ephemerisBetweenFrames = boost::make_shared< CompositeEphemeris< TimeType, StateScalarType > >(
-                        totalEphemerisList,
-                        std::map< int, boost::function< StateType( const double, const StateType& ) > >( ),
-                        origin );
-        }
+    //! Function to retrieve the compiled path between a body and a requested frame origin.
+    /*!
+     *  Function to retrieve the compiled path between a body and a requested frame origin, as an
+     *  ephemeris object. The path is determined from the nearest common frame of the body and
+     *  origin, and consists of the ephemerides from the nearest common frame up to the body (the
+     *  states of which are added) and those from the nearest common frame up to the origin (the
+     *  states of which are subtracted). Paths are compiled once per (origin, body) pair, and stored
+     *  in this object.
+     *  \param origin Origin of ephemeris
+     *  \param body Body for which ephemeris is requested.
+     *  \param memoizeStates Boolean denoting whether the returned ephemeris is to memoize the most
+     *  recently computed state.
+     *  \return Compiled path between body and origin
+     */
+    boost::shared_ptr< FramePathEphemeris > getFramePathEphemeris(
+            const std::string& origin, const std::string& body, const bool memoizeStates = false );
 
-        return ephemerisBetweenFrames;
-    }
+    //! Function to reset the memoized states of all compiled paths.
+    /*!
+     *  Function to reset the memoized states of all compiled paths, to be called when any of the
+     *  ephemerides in the frame manager are modified.
+     */
+    void resetCachedStates( );
 
     //! Return the level at which the requested ephemeris is in the hierarchy.
     /*!
@@ -222,6 +169,14 @@ private:
      */
     std::map< std::string, int > frameIndexList_;
 
+    //! List of compiled paths between frames.
+    /*!
+     *  List of compiled paths between frames, with the key the origin and body of the path, and
+     *  whether states are memoized.
+     */
+    std::map< std::pair< std::pair< std::string, std::string >, bool >,
+    boost::shared_ptr< FramePathEphemeris > > compiledFramePaths_;
+
     //! Returns an ephemeris along a single line of the hierarchy tree.
     /*!
      *  Returns an ephemeris along a single line of the hierarchy tree, i.e. returned ephemeris
@@ -0,0 +1,135 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <stdexcept>
+
+#include "Tudat/Astrodynamics/Ephemerides/framePathEphemeris.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Constructor.
+FramePathEphemeris::FramePathEphemeris( const std::vector< boost::shared_ptr< Ephemeris > >& pathEphemerides,
+                                        const std::vector< bool >& addPathStates,
+                                        const bool memoizeStates,
+                                        const std::string& referenceFrameOrigin,
+                                        const std::string& referenceFrameOrientation ):
+    Ephemeris( referenceFrameOrigin, referenceFrameOrientation ),
+    pathEphemerides_( pathEphemerides ), addPathStates_( addPathStates ), memoizeStates_( memoizeStates ),
+    cachedStateTime_( TUDAT_NAN ), cachedLongStateTime_( TUDAT_NAN )
+{
+    if( pathEphemerides_.size( ) != addPathStates_.size( ) )
+    {
+        throw std::runtime_error( "Error when creating frame path ephemeris, input sizes are inconsistent" );
+    }
+}
+
+//! Get state from ephemeris.
+Eigen::Vector6d FramePathEphemeris::getCartesianState( const double secondsSinceEpoch )
+{
+    // Return memoized state, if computed at the same time.
+    if( memoizeStates_ && secondsSinceEpoch == cachedStateTime_ )
+    {
+        return cachedState_;
+    }
+
+    Eigen::Vector6d state = Eigen::Vector6d::Zero( );
+    for( unsigned int i = 0; i < pathEphemerides_.size( ); i++ )
+    {
+        if( addPathStates_[ i ] )
+        {
+            state += pathEphemerides_[ i ]->getCartesianState( secondsSinceEpoch );
+        }
+        else
+        {
+            state -= pathEphemerides_[ i ]->getCartesianState( secondsSinceEpoch );
+        }
+    }
+
+    if( memoizeStates_ )
+    {
+        cachedStateTime_ = secondsSinceEpoch;
+        cachedState_ = state;
+    }
+    return state;
+}
+
+//! Get state from ephemeris (with long double as state scalar).
+Eigen::Matrix< long double, 6, 1 > FramePathEphemeris::getCartesianLongState( const double secondsSinceEpoch )
+{
+    // Return memoized state, if computed at the same time.
+    if( memoizeStates_ && secondsSinceEpoch == cachedLongStateTime_ )
+    {
+        return cachedLongState_;
+    }
+
+    Eigen::Matrix< long double, 6, 1 > state = Eigen::Matrix< long double, 6, 1 >::Zero( );
+    for( unsigned int i = 0; i < pathEphemerides_.size( ); i++ )
+    {
+        if( addPathStates_[ i ] )
+        {
+            state += pathEphemerides_[ i ]->getCartesianLongState( secondsSinceEpoch );
+        }
+        else
+        {
+            state -= pathEphemerides_[ i ]->getCartesianLongState( secondsSinceEpoch );
+        }
+    }
+
+    if( memoizeStates_ )
+    {
+        cachedLongStateTime_ = secondsSinceEpoch;
+        cachedLongState_ = state;
+    }
+    return state;
+}
+
+//! Get state from ephemeris (with double as state scalar and Time as time type).
+Eigen::Vector6d FramePathEphemeris::getCartesianStateFromExtendedTime( const Time& currentTime )
+{
+    Eigen::Vector6d state = Eigen::Vector6d::Zero( );
+    for( unsigned int i = 0; i < pathEphemerides_.size( ); i++ )
+    {
+        if( addPathStates_[ i ] )
+        {
+            state += pathEphemerides_[ i ]->getCartesianStateFromExtendedTime( currentTime );
+        }
+        else
+        {
+            state -= pathEphemerides_[ i ]->getCartesianStateFromExtendedTime( currentTime );
+        }
+    }
+    return state;
+}
+
+//! Get state from ephemeris (with long double as state scalar and Time as time type).
+Eigen::Matrix< long double, 6, 1 > FramePathEphemeris::getCartesianLongStateFromExtendedTime( const Time& currentTime )
+{
+    Eigen::Matrix< long double, 6, 1 > state = Eigen::Matrix< long double, 6, 1 >::Zero( );
+    for( unsigned int i = 0; i < pathEphemerides_.size( ); i++ )
+    {
+        if( addPathStates_[ i ] )
+        {
+            state += pathEphemerides_[ i ]->getCartesianLongStateFromExtendedTime( currentTime );
+        }
+        else
+        {
+            state -= pathEphemerides_[ i ]->getCartesianLongStateFromExtendedTime( currentTime );
+        }
+    }
+    return state;
+}
+
+} // namespace ephemerides
+
+} // namespace tudat
@@ -0,0 +1,164 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_FRAMEPATHEPHEMERIS_H
+#define TUDAT_FRAMEPATHEPHEMERIS_H
+
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include "Tudat/Astrodynamics/Ephemerides/ephemeris.h"
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Ephemeris class that evaluates a precomputed path between two frames of the frame hierarchy.
+/*!
+ *  Ephemeris class that evaluates a precomputed ('compiled') path between two frames of the frame hierarchy, as
+ *  determined by the ReferenceFrameManager. The path consists of a flat list of ephemerides, the states of which are
+ *  added or subtracted to obtain the state of the target w.r.t. the observer. Contrary to the CompositeEphemeris, the
+ *  constituent ephemerides are called directly (without intermediate function objects). Optionally, the most recently
+ *  computed state (for double and long double state scalars) is memoized, so that repeated queries at the same time
+ *  (as typically occur during a single environment update) require only a single evaluation of the path. When the
+ *  memoized state is used, the resetCachedStates function must be called whenever one of the constituent ephemerides
+ *  is modified.
+ */
+class FramePathEphemeris : public Ephemeris
+{
+public:
+
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    using Ephemeris::getCartesianState;
+
+    //! Constructor.
+    /*!
+     *  Constructor, sets constituent ephemerides of the path.
+     *  \param pathEphemerides Ephemerides of which the states are to be added or subtracted. An empty list results in
+     *  a zero state.
+     *  \param addPathStates List of booleans denoting whether the state of the ephemeris with the same index in
+     *  pathEphemerides is to be added (if true) or subtracted (if false).
+     *  \param memoizeStates Boolean denoting whether the most recently computed state is to be memoized.
+     *  \param referenceFrameOrigin Origin of reference frame in which state is defined.
+     *  \param referenceFrameOrientation Orientation of reference frame in which state is defined.
+     */
+    FramePathEphemeris( const std::vector< boost::shared_ptr< Ephemeris > >& pathEphemerides,
+                        const std::vector< bool >& addPathStates,
+                        const bool memoizeStates,
+                        const std::string& referenceFrameOrigin = "SSB",
+                        const std::string& referenceFrameOrientation = "ECLIPJ2000" );
+
+    //! Destructor
+    ~FramePathEphemeris( ){ }
+
+    //! Get state from ephemeris.
+    /*!
+     *  Returns state from ephemeris at given time, by adding and subtracting the states of the constituent ephemerides,
+     *  or from the memoized state if it was computed at the same time.
+     *  \param secondsSinceEpoch Seconds since epoch at which ephemeris is to be evaluated.
+     *  \return State from ephemeris.
+     */
+    Eigen::Vector6d getCartesianState( const double secondsSinceEpoch );
+
+    //! Get state from ephemeris (with long double as state scalar).
+    /*!
+     *  Returns state from ephemeris with long double as state scalar at given time, by adding and subtracting the
+     *  (long double) states of the constituent ephemerides, or from the memoized state if it was computed at the same
+     *  time.
+     *  \param secondsSinceEpoch Seconds since epoch at which ephemeris is to be evaluated.
+     *  \return State from ephemeris with long double as state scalar
+     */
+    Eigen::Matrix< long double, 6, 1 > getCartesianLongState( const double secondsSinceEpoch );
+
+    //! Get state from ephemeris (with double as state scalar and Time as time type).
+    /*!
+     *  Returns state from ephemeris with double as state scalar at given time (as custom Time type), by adding and
+     *  subtracting the states of the constituent ephemerides (no memoization is used).
+     *  \param currentTime Time at which state is to be evaluated
+     *  \return State from ephemeris with double as state scalar
+     */
+    Eigen::Vector6d getCartesianStateFromExtendedTime( const Time& currentTime );
+
+    //! Get state from ephemeris (with long double as state scalar and Time as time type).
+    /*!
+     *  Returns state from ephemeris with long double as state scalar at given time (as custom Time type), by adding and
+     *  subtracting the states of the constituent ephemerides (no memoization is used).
+     *  \param currentTime Time at which state is to be evaluated
+     *  \return State from ephemeris with long double as state scalar
+     */
+    Eigen::Matrix< long double, 6, 1 > getCartesianLongStateFromExtendedTime( const Time& currentTime );
+
+    //! Function to reset the memoized states
+    /*!
+     *  Function to reset the memoized states, so that the path is re-evaluated at the next call. This function must be
+     *  called when the constituent ephemerides are modified.
+     */
+    void resetCachedStates( )
+    {
+        cachedStateTime_ = TUDAT_NAN;
+        cachedLongStateTime_ = TUDAT_NAN;
+    }
+
+    //! Function to return the ephemerides of which the states are added or subtracted.
+    /*!
+     *  Function to return the ephemerides of which the states are added or subtracted.
+     *  \return Ephemerides of which the states are added or subtracted.
+     */
+    std::vector< boost::shared_ptr< Ephemeris > > getPathEphemerides( )
+    {
+        return pathEphemerides_;
+    }
+
+    //! Function to return whether the states of the constituent ephemerides are added or subtracted.
+    /*!
+     *  Function to return whether the states of the constituent ephemerides are added (if true) or subtracted
+     *  (if false).
+     *  \return List of booleans denoting whether the states of the constituent ephemerides are added or subtracted.
+     */
+    std::vector< bool > getAddPathStates( )
+    {
+        return addPathStates_;
+    }
+
+private:
+
+    //! Ephemerides of which the states are added or subtracted.
+    std::vector< boost::shared_ptr< Ephemeris > > pathEphemerides_;
+
+    //! List of booleans denoting whether the states of pathEphemerides_ are added (if true) or subtracted (if false).
+    std::vector< bool > addPathStates_;
+
+    //! Boolean denoting whether the most recently computed state is to be memoized.
+    bool memoizeStates_;
+
+    //! Time at which cachedState_ was computed (NaN if not computed).
+    double cachedStateTime_;
+
+    //! Most recently computed state (with double as state scalar).
+    Eigen::Vector6d cachedState_;
+
+    //! Time at which cachedLongState_ was computed (NaN if not computed).
+    double cachedLongStateTime_;
+
+    //! Most recently computed state (with long double as state scalar).
+    Eigen::Matrix< long double, 6, 1 > cachedLongState_;
+};
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_FRAMEPATHEPHEMERIS_H
@@ -0,0 +1,227 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <cmath>
+#include <stdexcept>
+
+#include <boost/make_shared.hpp>
+
+#include "Tudat/Astrodynamics/Ephemerides/tabulatedRotationalEphemeris.h"
+#include "Tudat/Mathematics/BasicMathematics/linearAlgebra.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Constructor, sets tabulated quaternions and frame data.
+TabulatedRotationalEphemeris::TabulatedRotationalEphemeris( const double initialTime,
+                                                            const double timeStep,
+                                                            const std::vector< double >& quaternionData,
+                                                            const std::string& baseFrameOrientation,
+                                                            const std::string& targetFrameOrientation ):
+    RotationalEphemeris( baseFrameOrientation, targetFrameOrientation ),
+    initialTime_( initialTime ), timeStep_( timeStep ), inverseTimeStep_( 1.0 / timeStep ),
+    quaternionData_( quaternionData )
+{
+    if( !( timeStep_ > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when creating tabulated rotational ephemeris, time step must be positive" );
+    }
+
+    if( quaternionData_.size( ) % 8 != 0 || quaternionData_.size( ) < 16 )
+    {
+        throw std::runtime_error( "Error when creating tabulated rotational ephemeris, size of quaternion data is "
+                                  "inconsistent, or less than two quaternions provided" );
+    }
+    numberOfTabulatedTimes_ = quaternionData_.size( ) / 8;
+}
+
+//! Get rotation quaternion from target frame to base frame.
+Eigen::Quaterniond TabulatedRotationalEphemeris::getRotationToBaseFrame( const double secondsSinceEpoch )
+{
+    Eigen::Vector4d quaternion, quaternionDerivative;
+    interpolateQuaternion( secondsSinceEpoch, quaternion, quaternionDerivative );
+    return Eigen::Quaterniond( quaternion( 0 ), quaternion( 1 ), quaternion( 2 ), quaternion( 3 ) );
+}
+
+//! Function to calculate the derivative of the rotation matrix from target frame to base frame.
+Eigen::Matrix3d TabulatedRotationalEphemeris::getDerivativeOfRotationToBaseFrame( const double secondsSinceEpoch )
+{
+    Eigen::Vector4d quaternion, quaternionDerivative;
+    interpolateQuaternion( secondsSinceEpoch, quaternion, quaternionDerivative );
+    return getRotationMatrixDerivativeFromQuaternion( quaternion, quaternionDerivative );
+}
+
+//! Function to retrieve the angular velocity vector, expressed in base frame.
+Eigen::Vector3d TabulatedRotationalEphemeris::getRotationalVelocityVectorInBaseFrame( const double secondsSinceEpoch )
+{
+    Eigen::Vector4d quaternion, quaternionDerivative;
+    interpolateQuaternion( secondsSinceEpoch, quaternion, quaternionDerivative );
+
+    // Compute vector part of 2 * dq/dt * q^{-1}
+    return 2.0 * ( quaternion( 0 ) * quaternionDerivative.segment( 1, 3 ) -
+                   quaternionDerivative( 0 ) * quaternion.segment( 1, 3 ) -
+                   Eigen::Vector3d( quaternionDerivative.segment( 1, 3 ) ).cross(
+                       Eigen::Vector3d( quaternion.segment( 1, 3 ) ) ) );
+}
+
+//! Function to calculate the full rotational state at given time
+void TabulatedRotationalEphemeris::getFullRotationalQuantitiesToTargetFrame(
+        Eigen::Quaterniond& currentRotationToLocalFrame,
+        Eigen::Matrix3d& currentRotationToLocalFrameDerivative,
+        Eigen::Vector3d& currentAngularVelocityVectorInGlobalFrame,
+        const double secondsSinceEpoch )
+{
+    Eigen::Vector4d quaternion, quaternionDerivative;
+    interpolateQuaternion( secondsSinceEpoch, quaternion, quaternionDerivative );
+
+    currentRotationToLocalFrame =
+            Eigen::Quaterniond( quaternion( 0 ), quaternion( 1 ), quaternion( 2 ), quaternion( 3 ) ).inverse( );
+    currentRotationToLocalFrameDerivative =
+            getRotationMatrixDerivativeFromQuaternion( quaternion, quaternionDerivative ).transpose( );
+    currentAngularVelocityVectorInGlobalFrame =
+            2.0 * ( quaternion( 0 ) * quaternionDerivative.segment( 1, 3 ) -
+                    quaternionDerivative( 0 ) * quaternion.segment( 1, 3 ) -
+                    Eigen::Vector3d( quaternionDerivative.segment( 1, 3 ) ).cross(
+                        Eigen::Vector3d( quaternion.segment( 1, 3 ) ) ) );
+}
+
+//! Function to interpolate the (normalized) quaternion and its time derivative.
+void TabulatedRotationalEphemeris::interpolateQuaternion( const double secondsSinceEpoch,
+                                                          Eigen::Vector4d& quaternion,
+                                                          Eigen::Vector4d& quaternionDerivative )
+{
+    // Retrieve interval index directly from time (using first/last interval outside of range).
+    double stepsSinceStart = ( secondsSinceEpoch - initialTime_ ) * inverseTimeStep_;
+    unsigned int intervalIndex = 0;
+    if( stepsSinceStart >= static_cast< double >( numberOfTabulatedTimes_ - 1 ) )
+    {
+        intervalIndex = numberOfTabulatedTimes_ - 2;
+    }
+    else if( stepsSinceStart > 0.0 )
+    {
+        intervalIndex = static_cast< unsigned int >( stepsSinceStart );
+    }
+
+    // Compute cubic Hermite basis functions and their derivatives w.r.t. scaled time.
+    double s = stepsSinceStart - static_cast< double >( intervalIndex );
+    double s2 = s * s;
+    double s3 = s2 * s;
+
+    double startValueWeight = 2.0 * s3 - 3.0 * s2 + 1.0;
+    double startDerivativeWeight = ( s3 - 2.0 * s2 + s ) * timeStep_;
+    double endValueWeight = -2.0 * s3 + 3.0 * s2;
+    double endDerivativeWeight = ( s3 - s2 ) * timeStep_;
+
+    double startValueRateWeight = ( 6.0 * s2 - 6.0 * s ) * inverseTimeStep_;
+    double startDerivativeRateWeight = 3.0 * s2 - 4.0 * s + 1.0;
+    double endValueRateWeight = -startValueRateWeight;
+    double endDerivativeRateWeight = 3.0 * s2 - 2.0 * s;
+
+    // Interpolate quaternion components and their derivatives.
+    const double* startData = &quaternionData_[ 8 * intervalIndex ];
+    const double* endData = startData + 8;
+    for( unsigned int i = 0; i < 4; i++ )
+    {
+        quaternion( i ) = startValueWeight * startData[ i ] + startDerivativeWeight * startData[ i + 4 ] +
+                endValueWeight * endData[ i ] + endDerivativeWeight * endData[ i + 4 ];
+        quaternionDerivative( i ) =
+                startValueRateWeight * startData[ i ] + startDerivativeRateWeight * startData[ i + 4 ] +
+                endValueRateWeight * endData[ i ] + endDerivativeRateWeight * endData[ i + 4 ];
+    }
+
+    // Normalize quaternion, and compute derivative of normalized quaternion.
+    double inverseQuaternionNorm = 1.0 / quaternion.norm( );
+    quaternion *= inverseQuaternionNorm;
+    quaternionDerivative = ( quaternionDerivative - quaternion * quaternion.dot( quaternionDerivative ) ) *
+            inverseQuaternionNorm;
+}
+
+//! Function to compute the derivative of a rotation matrix from the associated quaternion and its time derivative.
+Eigen::Matrix3d getRotationMatrixDerivativeFromQuaternion(
+        const Eigen::Vector4d& quaternion, const Eigen::Vector4d& quaternionDerivative )
+{
+    // Differentiate R = ( w^2 - v.v ) I + 2 v v^T + 2 w [v]x
+    Eigen::Vector3d vectorPart = quaternion.segment( 1, 3 );
+    Eigen::Vector3d vectorPartDerivative = quaternionDerivative.segment( 1, 3 );
+
+    return 2.0 * ( quaternion( 0 ) * quaternionDerivative( 0 ) - vectorPart.dot( vectorPartDerivative ) ) *
+            Eigen::Matrix3d::Identity( ) +
+            2.0 * ( vectorPartDerivative * vectorPart.transpose( ) + vectorPart * vectorPartDerivative.transpose( ) ) +
+            2.0 * quaternionDerivative( 0 ) * linear_algebra::getCrossProductMatrix( vectorPart ) +
+            2.0 * quaternion( 0 ) * linear_algebra::getCrossProductMatrix( vectorPartDerivative );
+}
+
+//! Function to create a tabulated rotational ephemeris by sampling another rotational ephemeris.
+boost::shared_ptr< TabulatedRotationalEphemeris > createTabulatedRotationalEphemeris(
+        const boost::shared_ptr< RotationalEphemeris > originalRotationalEphemeris,
+        const double initialTime,
+        const double finalTime,
+        const double timeStep )
+{
+    if( !( finalTime > initialTime ) || !( timeStep > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when creating tabulated rotational ephemeris, inconsistent time settings" );
+    }
+
+    // Determine number of tabulated times, such that the final time is covered.
+    unsigned int numberOfTabulatedTimes =
+            static_cast< unsigned int >( std::ceil( ( finalTime - initialTime ) / timeStep - 1.0E-12 ) ) + 1;
+    if( numberOfTabulatedTimes < 2 )
+    {
+        numberOfTabulatedTimes = 2;
+    }
+
+    std::vector< double > quaternionData( 8 * numberOfTabulatedTimes );
+    Eigen::Vector4d quaternion, previousQuaternion;
+    for( unsigned int i = 0; i < numberOfTabulatedTimes; i++ )
+    {
+        double currentTime = initialTime + static_cast< double >( i ) * timeStep;
+
+        // Retrieve quaternion, and choose its sign to be continuous with previous quaternion.
+        Eigen::Quaterniond currentRotation = originalRotationalEphemeris->getRotationToBaseFrame( currentTime );
+        quaternion << currentRotation.w( ), currentRotation.x( ), currentRotation.y( ), currentRotation.z( );
+        quaternion.normalize( );
+        if( i > 0 && quaternion.dot( previousQuaternion ) < 0.0 )
+        {
+            quaternion *= -1.0;
+        }
+        previousQuaternion = quaternion;
+
+        // Compute quaternion derivative as dq/dt = 0.5 * ( 0, omega ) * q, with omega in base frame.
+        Eigen::Vector3d angularVelocity =
+                originalRotationalEphemeris->getRotationalVelocityVectorInBaseFrame( currentTime );
+        Eigen::Vector3d vectorPart = quaternion.segment( 1, 3 );
+
+        for( unsigned int j = 0; j < 4; j++ )
+        {
+            quaternionData[ 8 * i + j ] = quaternion( j );
+        }
+        quaternionData[ 8 * i + 4 ] = -0.5 * angularVelocity.dot( vectorPart );
+        Eigen::Vector3d vectorPartDerivative =
+                0.5 * ( quaternion( 0 ) * angularVelocity + angularVelocity.cross( vectorPart ) );
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            quaternionData[ 8 * i + 5 + j ] = vectorPartDerivative( j );
+        }
+    }
+
+    return boost::make_shared< TabulatedRotationalEphemeris >(
+                initialTime, timeStep, quaternionData,
+                originalRotationalEphemeris->getBaseFrameOrientation( ),
+                originalRotationalEphemeris->getTargetFrameOrientation( ) );
+}
+
+} // namespace ephemerides
+
+} // namespace tudat
@@ -0,0 +1,237 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_TABULATEDROTATIONALEPHEMERIS_H
+#define TUDAT_TABULATEDROTATIONALEPHEMERIS_H
+
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "Tudat/Astrodynamics/Ephemerides/rotationalEphemeris.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Class that determines a rotational ephemeris by interpolating tabulated quaternions.
+/*!
+ *  Class that determines a rotational ephemeris by interpolating tabulated quaternions, typically sampled once from a
+ *  rotational ephemeris that is computationally expensive to evaluate (such as a SpiceRotationalEphemeris). The
+ *  rotation quaternion from target to base frame and its time derivative are tabulated at equidistant times. In between
+ *  these times, the quaternion components are interpolated by cubic Hermite polynomials, after which the result is
+ *  normalized. The rotation matrix derivatives and angular velocity vector are computed analytically from the
+ *  interpolated quaternion and its derivative, so that these are consistent with the interpolated rotation. As the
+ *  tabulated times are equidistant, the interval containing a given time is found directly (without any search), and
+ *  objects of this class have no mutable state.
+ */
+class TabulatedRotationalEphemeris : public RotationalEphemeris
+{
+public:
+
+    //! Constructor, sets tabulated quaternions and frame data.
+    /*!
+     *  Constructor, sets tabulated quaternions and frame data.
+     *  \param initialTime Time of the first tabulated quaternion.
+     *  \param timeStep Time between subsequent tabulated quaternions.
+     *  \param quaternionData Tabulated quaternions (rotation from target to base frame) and their time derivatives.
+     *  For the tabulated time i, entries 8 * i to 8 * i + 3 are the quaternion (in order w, x, y, z), and entries 8 * i + 4
+     *  to 8 * i + 7 are its time derivative (in the same order). Subsequent quaternions should not differ in sign.
+     *  \param baseFrameOrientation Base frame identifier.
+     *  \param targetFrameOrientation Target frame identifier.
+     */
+    TabulatedRotationalEphemeris( const double initialTime,
+                                  const double timeStep,
+                                  const std::vector< double >& quaternionData,
+                                  const std::string& baseFrameOrientation = "",
+                                  const std::string& targetFrameOrientation = "" );
+
+    //! Destructor
+    ~TabulatedRotationalEphemeris( ){ }
+
+    //! Get rotation quaternion from target frame to base frame.
+    /*!
+     *  Returns the rotation quaternion from target frame to base frame at specified time, interpolated from the
+     *  tabulated data.
+     *  \param secondsSinceEpoch Seconds since epoch at which ephemeris is to be evaluated.
+     *  \return Rotation quaternion computed.
+     */
+    Eigen::Quaterniond getRotationToBaseFrame( const double secondsSinceEpoch );
+
+    //! Get rotation quaternion to target frame from base frame.
+    /*!
+     *  Returns the rotation quaternion to target frame from base frame at specified time, interpolated from the
+     *  tabulated data.
+     *  \param secondsSinceEpoch Seconds since epoch at which ephemeris is to be evaluated.
+     *  \return Rotation quaternion computed.
+     */
+    Eigen::Quaterniond getRotationToTargetFrame( const double secondsSinceEpoch )
+    {
+        return getRotationToBaseFrame( secondsSinceEpoch ).inverse( );
+    }
+
+    //! Function to calculate the derivative of the rotation matrix from target frame to base frame.
+    /*!
+     *  Function to calculate the derivative of the rotation matrix from target frame to base frame at specified time,
+     *  from the interpolated quaternion and its derivative.
+     *  \param secondsSinceEpoch Seconds since epoch at which ephemeris is to be evaluated.
+     *  \return Derivative of rotation from target (typically local) to base (typically global) frame at specified time.
+     */
+    Eigen::Matrix3d getDerivativeOfRotationToBaseFrame( const double secondsSinceEpoch );
+
+    //! Function to calculate the derivative of the rotation matrix from base frame to target frame.
+    /*!
+     *  Function to calculate the derivative of the rotation matrix from base frame to target frame at specified time,
+     *  from the interpolated quaternion and its derivative.
+     *  \param secondsSinceEpoch Seconds since epoch at which ephemeris is to be evaluated.
+     *  \return Derivative of rotation from base (typically global) to target (typically local) frame at specified time.
+     */
+    Eigen::Matrix3d getDerivativeOfRotationToTargetFrame( const double secondsSinceEpoch )
+    {
+        return getDerivativeOfRotationToBaseFrame( secondsSinceEpoch ).transpose( );
+    }
+
+    //! Function to retrieve the angular velocity vector, expressed in base frame.
+    /*!
+     *  Function to retrieve the angular velocity vector, expressed in base frame, computed directly from the
+     *  interpolated quaternion and its derivative.
+     *  \param secondsSinceEpoch Seconds since epoch at which ephemeris is to be evaluated.
+     *  \return Angular velocity vector, expressed in base frame.
+     */
+    Eigen::Vector3d getRotationalVelocityVectorInBaseFrame( const double secondsSinceEpoch );
+
+    //! Function to calculate the full rotational state at given time
+    /*!
+     *  Function to calculate the full rotational state at given time (rotation matrix, derivative of rotation matrix
+     *  and angular velocity vector), for which the tabulated data is interpolated only once.
+     *  \param currentRotationToLocalFrame Current rotation to local frame (returned by reference)
+     *  \param currentRotationToLocalFrameDerivative Current derivative of rotation matrix to local frame
+     *  (returned by reference)
+     *  \param currentAngularVelocityVectorInGlobalFrame Current angular velocity vector, expressed in global frame
+     *  (returned by reference)
+     *  \param secondsSinceEpoch Seconds since epoch at which ephemeris is to be evaluated.
+     */
+    void getFullRotationalQuantitiesToTargetFrame(
+            Eigen::Quaterniond& currentRotationToLocalFrame,
+            Eigen::Matrix3d& currentRotationToLocalFrameDerivative,
+            Eigen::Vector3d& currentAngularVelocityVectorInGlobalFrame,
+            const double secondsSinceEpoch );
+
+    //! Function to return the time of the first tabulated quaternion.
+    /*!
+     *  Function to return the time of the first tabulated quaternion.
+     *  \return Time of the first tabulated quaternion.
+     */
+    double getInitialTime( )
+    {
+        return initialTime_;
+    }
+
+    //! Function to return the time of the last tabulated quaternion.
+    /*!
+     *  Function to return the time of the last tabulated quaternion.
+     *  \return Time of the last tabulated quaternion.
+     */
+    double getFinalTime( )
+    {
+        return initialTime_ + timeStep_ * static_cast< double >( numberOfTabulatedTimes_ - 1 );
+    }
+
+    //! Function to return the time between subsequent tabulated quaternions.
+    /*!
+     *  Function to return the time between subsequent tabulated quaternions.
+     *  \return Time between subsequent tabulated quaternions.
+     */
+    double getTimeStep( )
+    {
+        return timeStep_;
+    }
+
+    //! Function to return the tabulated quaternions and their time derivatives.
+    /*!
+     *  Function to return the tabulated quaternions and their time derivatives (see constructor for ordering).
+     *  \return Tabulated quaternions and their time derivatives.
+     */
+    const std::vector< double >& getQuaternionData( )
+    {
+        return quaternionData_;
+    }
+
+private:
+
+    //! Function to interpolate the (normalized) quaternion and its time derivative.
+    /*!
+     *  Function to interpolate the (normalized) quaternion from target to base frame and its time derivative, from the
+     *  tabulated data. Times outside the range of the tabulated data are evaluated using the first or last interval.
+     *  \param secondsSinceEpoch Seconds since epoch at which ephemeris is to be evaluated.
+     *  \param quaternion Interpolated quaternion, in order w, x, y, z (returned by reference).
+     *  \param quaternionDerivative Time derivative of interpolated quaternion, in order w, x, y, z (returned by
+     *  reference).
+     */
+    void interpolateQuaternion( const double secondsSinceEpoch,
+                                Eigen::Vector4d& quaternion,
+                                Eigen::Vector4d& quaternionDerivative );
+
+    //! Time of the first tabulated quaternion.
+    double initialTime_;
+
+    //! Time between subsequent tabulated quaternions.
+    double timeStep_;
+
+    //! Inverse of time between subsequent tabulated quaternions (pre-computed for efficiency).
+    double inverseTimeStep_;
+
+    //! Number of tabulated quaternions.
+    unsigned int numberOfTabulatedTimes_;
+
+    //! Tabulated quaternions and their time derivatives (see constructor for ordering).
+    std::vector< double > quaternionData_;
+};
+
+//! Function to compute the derivative of a rotation matrix from the associated quaternion and its time derivative.
+/*!
+ *  Function to compute the derivative of a rotation matrix from the associated (normalized) quaternion and its time
+ *  derivative, by differentiating the expression for the rotation matrix in terms of the quaternion components.
+ *  \param quaternion Quaternion representing the rotation, in order w, x, y, z.
+ *  \param quaternionDerivative Time derivative of quaternion, in order w, x, y, z.
+ *  \return Time derivative of the rotation matrix.
+ */
+Eigen::Matrix3d getRotationMatrixDerivativeFromQuaternion(
+        const Eigen::Vector4d& quaternion, const Eigen::Vector4d& quaternionDerivative );
+
+//! Function to create a tabulated rotational ephemeris by sampling another rotational ephemeris.
+/*!
+ *  Function to create a tabulated rotational ephemeris by sampling another rotational ephemeris (rotation to base frame
+ *  and its derivative) at equidistant times. The time derivatives of the quaternions are computed from the angular
+ *  velocity vector of the original ephemeris, and the signs of the quaternions are chosen such that subsequent
+ *  quaternions are continuous.
+ *  \param originalRotationalEphemeris Rotational ephemeris that is to be sampled.
+ *  \param initialTime Start time of the tabulated rotational ephemeris.
+ *  \param finalTime End time of the tabulated rotational ephemeris (rounded up to an integer number of time steps).
+ *  \param timeStep Time between subsequent tabulated quaternions.
+ *  \return Tabulated rotational ephemeris, with the same frames as originalRotationalEphemeris.
+ */
+boost::shared_ptr< TabulatedRotationalEphemeris > createTabulatedRotationalEphemeris(
+        const boost::shared_ptr< RotationalEphemeris > originalRotationalEphemeris,
+        const double initialTime,
+        const double finalTime,
+        const double timeStep );
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_TABULATEDROTATIONALEPHEMERIS_H
@@ -232,6 +232,47 @@ BOOST_AUTO_TEST_CASE( testLightWithSpice )
     BOOST_CHECK_CLOSE_FRACTION( newtonianLightTime + expectedCorrection,
                                 testMoonLightTime,
                                 1E-14 );
+
+    // Create light-time object that is started from the previous light-time solution.
+    boost::shared_ptr< LightTimeCalculator< > > warmStartedLightTimeEarthToMoon =
+            boost::make_shared< LightTimeCalculator< > >
+            ( boost::bind( &Ephemeris::getCartesianState, earthEphemeris, _1 ),
+              boost::bind( &Ephemeris::getCartesianState, moonEphemeris, _1 ) );
+    warmStartedLightTimeEarthToMoon->setUseWarmStart( true );
+
+    // Test whether warm-started solution is equal to regular solution, both for reception and transmission time input.
+    for( int i = 0; i < 20; i++ )
+    {
+        double currentTestTime = testTime + static_cast< double >( i ) * 60.0;
+        BOOST_CHECK_CLOSE_FRACTION( warmStartedLightTimeEarthToMoon->calculateLightTime( currentTestTime, true ),
+                                    lightTimeEarthToMoon->calculateLightTime( currentTestTime, true ),
+                                    1E-14 );
+    }
+    for( int i = 0; i < 20; i++ )
+    {
+        double currentTestTime = testTime + static_cast< double >( i ) * 60.0;
+        BOOST_CHECK_CLOSE_FRACTION( warmStartedLightTimeEarthToMoon->calculateLightTime( currentTestTime, false ),
+                                    lightTimeEarthToMoon->calculateLightTime( currentTestTime, false ),
+                                    1E-14 );
+    }
+
+    // Test whether solution retrieved from cache is equal to computed solution.
+    boost::shared_ptr< LightTimeSolutionCache< > > lightTimeSolutionCache =
+            boost::make_shared< LightTimeSolutionCache< > >( );
+    warmStartedLightTimeEarthToMoon->setSolutionCache( lightTimeSolutionCache );
+    Eigen::Vector6d cachedEarthState, cachedMoonState;
+    double computedLightTime = warmStartedLightTimeEarthToMoon->calculateLightTimeWithLinkEndsStates(
+                testMoonState, testEarthState, testTime, true );
+    BOOST_CHECK_EQUAL( lightTimeSolutionCache->getNumberOfSolutions( ), 1 );
+    double cachedLightTime = warmStartedLightTimeEarthToMoon->calculateLightTimeWithLinkEndsStates(
+                cachedMoonState, cachedEarthState, testTime, true );
+    BOOST_CHECK_EQUAL( lightTimeSolutionCache->getNumberOfSolutions( ), 1 );
+    BOOST_CHECK_EQUAL( computedLightTime, cachedLightTime );
+    for( int i = 0; i < 6; i++ )
+    {
+        BOOST_CHECK_EQUAL( testEarthState( i ), cachedEarthState( i ) );
+        BOOST_CHECK_EQUAL( testMoonState( i ), cachedMoonState( i ) );
+    }
 }
 
 BOOST_AUTO_TEST_SUITE_END( )
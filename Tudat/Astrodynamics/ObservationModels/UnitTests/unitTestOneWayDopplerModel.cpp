@@ -23,6 +23,7 @@
 
 #include "Tudat/SimulationSetup/EnvironmentSetup/body.h"
 #include "Tudat/Astrodynamics/ObservationModels/oneWayRangeObservationModel.h"
+#include "Tudat/Astrodynamics/ObservationModels/oneWayDopplerObservationModel.h"
 #include "Tudat/SimulationSetup/EstimationSetup/createObservationModel.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/defaultBodies.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
@@ -149,6 +150,113 @@ BOOST_AUTO_TEST_CASE( testOneWayDoppplerModel )
     }
 }
 
+//! Test whether one-way range and Doppler observation models of the same link share a single light-time solution.
+BOOST_AUTO_TEST_CASE( testSharedLightTimeSolutionOfRangeAndDoppler )
+{
+    // Load Spice kernels
+    std::string kernelsPath = input_output::getSpiceKernelPath( );
+    spice_interface::loadSpiceKernelInTudat( kernelsPath + "de-403-masses.tpc");
+    spice_interface::loadSpiceKernelInTudat( kernelsPath + "naif0009.tls");
+    spice_interface::loadSpiceKernelInTudat( kernelsPath + "pck00009.tpc");
+    spice_interface::loadSpiceKernelInTudat( kernelsPath + "de421.bsp");
+
+    // Define bodies to use.
+    std::vector< std::string > bodiesToCreate;
+    bodiesToCreate.push_back( "Earth" );
+    bodiesToCreate.push_back( "Sun" );
+    bodiesToCreate.push_back( "Mars" );
+
+    // Create bodies
+    double initialEphemerisTime = 0.0;
+    double finalEphemerisTime = initialEphemerisTime + 7.0 * 86400.0;
+    double buffer = 36000.0;
+    NamedBodyMap bodyMap = createBodies(
+                getDefaultBodySettings( bodiesToCreate, initialEphemerisTime - buffer, finalEphemerisTime + buffer ) );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    // Define link ends for observations.
+    LinkEnds linkEnds;
+    linkEnds[ transmitter ] = std::make_pair( "Earth" , ""  );
+    linkEnds[ receiver ] = std::make_pair( "Mars" , ""  );
+
+    // Create observation settings, with different (but identically defined) light-time correction settings objects
+    std::vector< std::string > perturbingBodies;
+    perturbingBodies.push_back( "Sun" );
+    boost::shared_ptr< ObservationSettings > rangeSettings = boost::make_shared< ObservationSettings >(
+                one_way_range, boost::make_shared< FirstOrderRelativisticLightTimeCorrectionSettings >(
+                    perturbingBodies ) );
+    boost::shared_ptr< ObservationSettings > dopplerSettings = boost::make_shared< ObservationSettings >(
+                one_way_doppler, boost::make_shared< FirstOrderRelativisticLightTimeCorrectionSettings >(
+                    perturbingBodies ) );
+
+    // Create observation models that share light-time solutions, and observation models that do not.
+    boost::shared_ptr< ObservationEvaluationCache< double, double > > observationEvaluationCache =
+            boost::make_shared< ObservationEvaluationCache< double, double > >( );
+    boost::shared_ptr< ObservationModel< 1, double, double > > sharedRangeModel =
+            ObservationModelCreator< 1, double, double >::createObservationModel(
+                linkEnds, rangeSettings, bodyMap, observationEvaluationCache );
+    boost::shared_ptr< ObservationModel< 1, double, double > > sharedDopplerModel =
+            ObservationModelCreator< 1, double, double >::createObservationModel(
+                linkEnds, dopplerSettings, bodyMap, observationEvaluationCache );
+    boost::shared_ptr< ObservationModel< 1, double, double > > rangeModel =
+            ObservationModelCreator< 1, double, double >::createObservationModel(
+                linkEnds, rangeSettings, bodyMap );
+    boost::shared_ptr< ObservationModel< 1, double, double > > dopplerModel =
+            ObservationModelCreator< 1, double, double >::createObservationModel(
+                linkEnds, dopplerSettings, bodyMap );
+
+    // Check whether light-time calculator is shared
+    boost::shared_ptr< LightTimeCalculator< double, double > > sharedLightTimeCalculator =
+            boost::dynamic_pointer_cast< OneWayRangeObservationModel< double, double > >(
+                sharedRangeModel )->getLightTimeCalculator( );
+    BOOST_CHECK( sharedLightTimeCalculator ==
+                 ( boost::dynamic_pointer_cast< OneWayDopplerObservationModel< double, double > >(
+                       sharedDopplerModel )->getLightTimeCalculator( ) ) );
+    boost::shared_ptr< LightTimeSolutionCache< double, double > > lightTimeSolutionCache =
+            sharedLightTimeCalculator->getSolutionCache( );
+
+    // Compute range, and subsequently Doppler, observations at the same list of times.
+    int numberOfObservations = 100;
+    std::vector< double > observationTimes;
+    for( int i = 0; i < numberOfObservations; i++ )
+    {
+        observationTimes.push_back( initialEphemerisTime + static_cast< double >( i ) * 3600.0 );
+    }
+
+    std::vector< double > linkEndTimes, sharedLinkEndTimes;
+    std::vector< Eigen::Vector6d > linkEndStates, sharedLinkEndStates;
+    for( int i = 0; i < numberOfObservations; i++ )
+    {
+        double sharedRange = sharedRangeModel->computeObservationsWithLinkEndData(
+                    observationTimes.at( i ), receiver, sharedLinkEndTimes, sharedLinkEndStates )( 0 );
+        double range = rangeModel->computeObservationsWithLinkEndData(
+                    observationTimes.at( i ), receiver, linkEndTimes, linkEndStates )( 0 );
+        BOOST_CHECK_EQUAL( sharedRange, range );
+    }
+
+    // Light-time equation should have been solved once per epoch
+    BOOST_CHECK_EQUAL( lightTimeSolutionCache->getNumberOfSolutions( ), numberOfObservations );
+    BOOST_CHECK_EQUAL( lightTimeSolutionCache->getNumberOfRetrievedSolutions( ), 0 );
+
+    for( int i = 0; i < numberOfObservations; i++ )
+    {
+        double sharedDoppler = sharedDopplerModel->computeObservationsWithLinkEndData(
+                    observationTimes.at( i ), receiver, sharedLinkEndTimes, sharedLinkEndStates )( 0 );
+        double doppler = dopplerModel->computeObservationsWithLinkEndData(
+                    observationTimes.at( i ), receiver, linkEndTimes, linkEndStates )( 0 );
+        BOOST_CHECK_CLOSE_FRACTION( sharedDoppler, doppler, 1.0E-12 );
+        for( unsigned int j = 0; j < linkEndStates.size( ); j++ )
+        {
+            BOOST_CHECK_EQUAL( sharedLinkEndTimes.at( j ), linkEndTimes.at( j ) );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( sharedLinkEndStates.at( j ), linkEndStates.at( j ), 1.0E-15 );
+        }
+    }
+
+    // Doppler observations should have retrieved the light-time solution of the range observations
+    BOOST_CHECK_EQUAL( lightTimeSolutionCache->getNumberOfSolutions( ), numberOfObservations );
+    BOOST_CHECK_EQUAL( lightTimeSolutionCache->getNumberOfRetrievedSolutions( ), numberOfObservations );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -16,6 +16,7 @@
 #include <boost/function.hpp>
 #include <boost/lexical_cast.hpp>
 
+#include <algorithm>
 #include <iostream>
 #include <map>
 #include <vector>
@@ -66,6 +67,280 @@ private:
     LightTimeCorrectionFunction lightTimeCorrectionFunction_;
 };
 
+//! Class to store light-time solutions of a single link, as a function of the time at the reference link end.
+/*!
+ *  Class to store light-time solutions (light time and states of the receiver and transmitter) of a single link, as a
+ *  function of the time at the reference link end (reception or transmission). An object of this type can be set in a
+ *  LightTimeCalculator (see LightTimeCalculator::setSolutionCache), in which case the calculator retrieves the solution
+ *  from this object if it has already been computed for the given input. This prevents redundant light-time solutions
+ *  when multiple observables (e.g. one-way range and Doppler) are computed at identical epochs of the same link.
+ *  The solutions are stored in flat arrays (one set per reference link end), which are used as a ring buffer once the
+ *  maximum number of solutions is reached, so that the oldest solutions are overwritten first. Since observations are
+ *  typically computed in chronological order, and the same list of times is typically queried for each observable,
+ *  the entry following the previously retrieved solution is checked first, followed by a binary search (if the
+ *  solutions were added in chronological order) or a linear search.
+ *  NOTE: the stored solutions must be cleared (clearSolutions) whenever the environment (e.g. ephemerides) changes.
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+class LightTimeSolutionCache
+{
+public:
+
+    //! Typedef for translational state type
+    typedef Eigen::Matrix< ObservationScalarType, 6, 1 > StateType;
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param maximumNumberOfSolutions Maximum number of stored solutions per reference link end. If this number is
+     * exceeded, the oldest solutions are overwritten.
+     */
+    LightTimeSolutionCache( const unsigned int maximumNumberOfSolutions = 100000 ):
+        maximumNumberOfSolutions_( std::max( maximumNumberOfSolutions, 1U ) ),
+        numberOfRetrievedSolutions_( 0 ){ }
+
+    //! Function to retrieve a stored light-time solution
+    /*!
+     * Function to retrieve a stored light-time solution
+     * \param time Time at reception or transmission.
+     * \param isTimeAtReception True if input time is at reception, false if at transmission.
+     * \param lightTime Light time of stored solution (returned by reference, if solution is found).
+     * \param receiverState State of receiver of stored solution (returned by reference, if solution is found).
+     * \param transmitterState State of transmitter of stored solution (returned by reference, if solution is found).
+     * \return True if solution is found, false otherwise.
+     */
+    bool getSolution( const TimeType time,
+                      const bool isTimeAtReception,
+                      ObservationScalarType& lightTime,
+                      StateType& receiverState,
+                      StateType& transmitterState )
+    {
+        SolutionStore& currentStore = solutionStores_[ isTimeAtReception ];
+
+        int solutionIndex = currentStore.findSolution( time );
+        if( solutionIndex < 0 )
+        {
+            return false;
+        }
+
+        lightTime = currentStore.lightTimes_[ solutionIndex ];
+        receiverState = Eigen::Map< const StateType >( currentStore.receiverStates_.data( ) + 6 * solutionIndex );
+        transmitterState = Eigen::Map< const StateType >( currentStore.transmitterStates_.data( ) + 6 * solutionIndex );
+        numberOfRetrievedSolutions_++;
+        return true;
+    }
+
+    //! Function to store a light-time solution
+    /*!
+     * Function to store a light-time solution. If the maximum number of solutions is reached, the oldest solution is
+     * overwritten.
+     * \param time Time at reception or transmission.
+     * \param isTimeAtReception True if input time is at reception, false if at transmission.
+     * \param lightTime Light time of solution.
+     * \param receiverState State of receiver of solution.
+     * \param transmitterState State of transmitter of solution.
+     */
+    void addSolution( const TimeType time,
+                      const bool isTimeAtReception,
+                      const ObservationScalarType lightTime,
+                      const StateType& receiverState,
+                      const StateType& transmitterState )
+    {
+        solutionStores_[ isTimeAtReception ].addSolution(
+                    time, lightTime, receiverState, transmitterState, maximumNumberOfSolutions_ );
+    }
+
+    //! Function to remove all stored solutions
+    void clearSolutions( )
+    {
+        solutionStores_[ 0 ].clear( );
+        solutionStores_[ 1 ].clear( );
+    }
+
+    //! Function to retrieve the number of stored solutions
+    /*!
+     * Function to retrieve the number of stored solutions
+     * \return Number of stored solutions
+     */
+    unsigned int getNumberOfSolutions( )
+    {
+        return solutionStores_[ 0 ].times_.size( ) + solutionStores_[ 1 ].times_.size( );
+    }
+
+    //! Function to retrieve the number of times a stored solution was retrieved
+    /*!
+     * Function to retrieve the number of times a stored solution was retrieved (i.e. the number of times a light-time
+     * solution was not recomputed) since the creation of this object, or the last call to
+     * resetNumberOfRetrievedSolutions.
+     * \return Number of times a stored solution was retrieved
+     */
+    unsigned int getNumberOfRetrievedSolutions( )
+    {
+        return numberOfRetrievedSolutions_;
+    }
+
+    //! Function to reset the number of times a stored solution was retrieved to zero.
+    void resetNumberOfRetrievedSolutions( )
+    {
+        numberOfRetrievedSolutions_ = 0;
+    }
+
+private:
+
+    //! Struct containing the stored light-time solutions for a single reference link end, in flat arrays.
+    struct SolutionStore
+    {
+        //! Constructor
+        SolutionStore( ): oldestSolutionIndex_( 0 ), previousSolutionIndex_( -1 ), isChronological_( true ){ }
+
+        //! Function to find the index of the stored solution at the given time (-1 if no solution is found).
+        int findSolution( const TimeType time )
+        {
+            int numberOfSolutions = times_.size( );
+            if( numberOfSolutions == 0 )
+            {
+                return -1;
+            }
+
+            // Check (in chronological order) the solutions at and following the previously retrieved solution.
+            if( previousSolutionIndex_ >= 0 )
+            {
+                int nextSolutionIndex = ( previousSolutionIndex_ + 1 ) % numberOfSolutions;
+                if( times_[ nextSolutionIndex ] == time )
+                {
+                    previousSolutionIndex_ = nextSolutionIndex;
+                    return previousSolutionIndex_;
+                }
+                else if( times_[ previousSolutionIndex_ ] == time )
+                {
+                    return previousSolutionIndex_;
+                }
+            }
+
+            int solutionIndex = -1;
+            if( isChronological_ )
+            {
+                // Perform binary search over solutions, sorted from oldest to newest.
+                int lowerIndex = 0;
+                int upperIndex = numberOfSolutions;
+                while( lowerIndex < upperIndex )
+                {
+                    int middleIndex = ( lowerIndex + upperIndex ) / 2;
+                    if( times_[ ( oldestSolutionIndex_ + middleIndex ) % numberOfSolutions ] < time )
+                    {
+                        lowerIndex = middleIndex + 1;
+                    }
+                    else
+                    {
+                        upperIndex = middleIndex;
+                    }
+                }
+
+                if( lowerIndex < numberOfSolutions &&
+                        times_[ ( oldestSolutionIndex_ + lowerIndex ) % numberOfSolutions ] == time )
+                {
+                    solutionIndex = ( oldestSolutionIndex_ + lowerIndex ) % numberOfSolutions;
+                }
+            }
+            else
+            {
+                // Perform linear search, starting from newest solution.
+                for( int i = numberOfSolutions - 1; i >= 0; i-- )
+                {
+                    int currentIndex = ( oldestSolutionIndex_ + i ) % numberOfSolutions;
+                    if( times_[ currentIndex ] == time )
+                    {
+                        solutionIndex = currentIndex;
+                        break;
+                    }
+                }
+            }
+
+            if( solutionIndex >= 0 )
+            {
+                previousSolutionIndex_ = solutionIndex;
+            }
+            return solutionIndex;
+        }
+
+        //! Function to add a solution, overwriting the oldest solution if the maximum number of solutions is reached.
+        void addSolution( const TimeType time,
+                          const ObservationScalarType lightTime,
+                          const StateType& receiverState,
+                          const StateType& transmitterState,
+                          const unsigned int maximumNumberOfSolutions )
+        {
+            int newestSolutionIndex = ( times_.size( ) == 0 ) ?
+                        -1 : ( oldestSolutionIndex_ + times_.size( ) - 1 ) % times_.size( );
+            if( newestSolutionIndex >= 0 && !( times_[ newestSolutionIndex ] < time ) )
+            {
+                isChronological_ = false;
+            }
+
+            if( times_.size( ) < maximumNumberOfSolutions )
+            {
+                times_.push_back( time );
+                lightTimes_.push_back( lightTime );
+                receiverStates_.insert( receiverStates_.end( ), receiverState.data( ), receiverState.data( ) + 6 );
+                transmitterStates_.insert(
+                            transmitterStates_.end( ), transmitterState.data( ), transmitterState.data( ) + 6 );
+            }
+            else
+            {
+                // Overwrite oldest solution
+                int newSolutionIndex = oldestSolutionIndex_;
+                times_[ newSolutionIndex ] = time;
+                lightTimes_[ newSolutionIndex ] = lightTime;
+                Eigen::Map< StateType >( receiverStates_.data( ) + 6 * newSolutionIndex ) = receiverState;
+                Eigen::Map< StateType >( transmitterStates_.data( ) + 6 * newSolutionIndex ) = transmitterState;
+                oldestSolutionIndex_ = ( oldestSolutionIndex_ + 1 ) % times_.size( );
+            }
+        }
+
+        //! Function to remove all stored solutions.
+        void clear( )
+        {
+            times_.clear( );
+            lightTimes_.clear( );
+            receiverStates_.clear( );
+            transmitterStates_.clear( );
+            oldestSolutionIndex_ = 0;
+            previousSolutionIndex_ = -1;
+            isChronological_ = true;
+        }
+
+        //! Times at the reference link end of the stored solutions.
+        std::vector< TimeType > times_;
+
+        //! Light times of the stored solutions.
+        std::vector< ObservationScalarType > lightTimes_;
+
+        //! States of receiver at reception time of the stored solutions (6 entries per solution).
+        std::vector< ObservationScalarType > receiverStates_;
+
+        //! States of transmitter at transmission time of the stored solutions (6 entries per solution).
+        std::vector< ObservationScalarType > transmitterStates_;
+
+        //! Index of the oldest stored solution (start of the ring buffer).
+        int oldestSolutionIndex_;
+
+        //! Index of the most recently retrieved solution (-1 if none).
+        int previousSolutionIndex_;
+
+        //! Boolean denoting whether the solutions were added in strictly increasing order of time.
+        bool isChronological_;
+    };
+
+    //! Stored light-time solutions, with time at transmission (index 0) and reception (index 1) as reference.
+    SolutionStore solutionStores_[ 2 ];
+
+    //! Maximum number of stored solutions per reference link end.
+    unsigned int maximumNumberOfSolutions_;
+
+    //! Number of times a stored solution was retrieved.
+    unsigned int numberOfRetrievedSolutions_;
+};
+
 //! Class to calculate the light time between two points.
 /*!
  *  This class calculates the light time between two points, of which the state functions
@@ -102,7 +377,11 @@ public:
         stateFunctionOfReceivingBody_( positionFunctionOfReceivingBody ),
         correctionFunctions_( correctionFunctions ),
         iterateCorrections_( iterateCorrections ),
-        currentCorrection_( 0.0 ){ }
+        currentCorrection_( 0.0 ), useWarmStart_( false )
+    {
+        isPreviousLightTimeSet_[ 0 ] = false;
+        isPreviousLightTimeSet_[ 1 ] = false;
+    }
 
     LightTimeCalculator(
             const boost::function< StateType( const TimeType ) > positionFunctionOfTransmittingBody,
@@ -112,8 +391,11 @@ public:
         stateFunctionOfTransmittingBody_( positionFunctionOfTransmittingBody ),
         stateFunctionOfReceivingBody_( positionFunctionOfReceivingBody ),
         iterateCorrections_( iterateCorrections ),
-        currentCorrection_( 0.0 )
+        currentCorrection_( 0.0 ), useWarmStart_( false )
     {
+        isPreviousLightTimeSet_[ 0 ] = false;
+        isPreviousLightTimeSet_[ 1 ] = false;
+
         for( unsigned int i = 0; i < correctionFunctions.size( ); i++ )
         {
             correctionFunctions_.push_back(
@@ -178,6 +460,11 @@ public:
      *  Function to calculate the transmitter state at transmission time, the receiver state at
      *  reception time, and the light time.
      *  The input time can be either at transmission or reception (default) time.
+     *  The light-time equation is solved by a Newton iteration, using the velocity of the link end at which the
+     *  time is not fixed to compute the derivative of the Euclidean light time w.r.t. the light time. If the warm start
+     *  is enabled (see setUseWarmStart), the iteration is started from the light time found in the previous call of this
+     *  function, instead of from the instantaneous geometric distance, so that the link end at which the time is
+     *  not fixed is typically evaluated only once or twice.
      *  \param receiverStateOutput Output by reference of receiver state.
      *  \param transmitterStateOutput Output by reference of transmitter state.
      *  \param time Time at reception or transmission.
@@ -194,26 +481,59 @@ public:
             const ObservationScalarType tolerance =
             ( getDefaultLightTimeTolerance< ObservationScalarType >( ) ) )
     {
-        using physical_constants::SPEED_OF_LIGHT;
         using std::fabs;
 
-        // Initialize reception and transmission times and states to initial guess (zero light time)
+        // Retrieve solution from cache, if available.
+        ObservationScalarType cachedLightTime;
+        if( solutionCache_ != NULL )
+        {
+            if( solutionCache_->getSolution(
+                        time, isTimeAtReception, cachedLightTime, receiverStateOutput, transmitterStateOutput ) )
+            {
+                return cachedLightTime;
+            }
+        }
+
+        // Initialize reception and transmission times and states at link end with fixed time.
         TimeType receptionTime = time;
         TimeType transmissionTime = time;
-        StateType receiverState = stateFunctionOfReceivingBody_( receptionTime );
-        StateType transmitterState =
-                stateFunctionOfTransmittingBody_( transmissionTime );
+        StateType receiverState;
+        StateType transmitterState;
+        if( isTimeAtReception )
+        {
+            receiverState = stateFunctionOfReceivingBody_( receptionTime );
+        }
+        else
+        {
+            transmitterState = stateFunctionOfTransmittingBody_( transmissionTime );
+        }
+
+        // Set initial light-time estimate, from previous solution if warm start is used (zero light time otherwise).
+        ObservationScalarType currentLightTimeEstimate =
+                mathematical_constants::getFloatingInteger< ObservationScalarType >( 0 );
+        bool isWarmStartUsed = useWarmStart_ && isPreviousLightTimeSet_[ isTimeAtReception ];
+        if( isWarmStartUsed )
+        {
+            currentLightTimeEstimate = previousLightTime_[ isTimeAtReception ];
+        }
+        updateUnfixedLinkEndState( receiverState, transmitterState, receptionTime, transmissionTime,
+                                   time, currentLightTimeEstimate, isTimeAtReception );
 
         // Set initial light-time correction.
         setTotalLightTimeCorrection(
                     transmitterState, receiverState, transmissionTime, receptionTime );
 
-        // Calculate light-time solution assuming infinte speed of signal as initial estimate.
-        ObservationScalarType previousLightTimeCalculation =
-                calculateNewLightTimeEstime( receiverState, transmitterState );
+        // Calculate light-time solution assuming infinte speed of signal as initial estimate, if no warm start is used.
+        if( !isWarmStartUsed )
+        {
+            currentLightTimeEstimate = calculateNewLightTimeEstime( receiverState, transmitterState );
+            updateUnfixedLinkEndState( receiverState, transmitterState, receptionTime, transmissionTime,
+                                       time, currentLightTimeEstimate, isTimeAtReception );
+        }
 
         // Set variables for iteration
         ObservationScalarType newLightTimeCalculation = 0.0;
+        ObservationScalarType lightTimeDerivative;
         bool isToleranceReached = false;
 
         // Recalculate light-time solution until tolerance is reached.
@@ -236,23 +556,11 @@ public:
                             transmitterState, receiverState, transmissionTime, receptionTime );
             }
 
-            // Update light-time estimate for this iteration.
-            if( isTimeAtReception )
-            {
-                receptionTime = time;
-                transmissionTime = time - previousLightTimeCalculation;
-                transmitterState = ( stateFunctionOfTransmittingBody_( transmissionTime ) );
-            }
-            else
-            {
-                receptionTime = time + previousLightTimeCalculation;
-                transmissionTime = time;
-                receiverState = ( stateFunctionOfReceivingBody_( receptionTime ) );
-            }
+            // Compute light time from current link end states.
             newLightTimeCalculation = calculateNewLightTimeEstime( receiverState, transmitterState );
 
             // Check for convergence.
-            if( fabs( newLightTimeCalculation - previousLightTimeCalculation ) < tolerance )
+            if( fabs( newLightTimeCalculation - currentLightTimeEstimate ) < tolerance )
             {
                 // If convergence reached, but light-time corrections not iterated,
                 // perform 1 more iteration to check for change in correction.
@@ -275,27 +583,86 @@ public:
                     std::string errorMessage  =
                             "Warning, light time unconverged at level " +
                             boost::lexical_cast< std::string >(
-                                fabs( newLightTimeCalculation - previousLightTimeCalculation ) ) +
+                                fabs( newLightTimeCalculation - currentLightTimeEstimate ) ) +
                             "; current light-time corrections are: "  +
                             boost::lexical_cast< std::string >( currentCorrection_ ) + " and input time was " +
                             boost::lexical_cast< std::string >( time );
                    std::cerr << errorMessage <<std::endl;
                 }
-
-                // Update light time for new iteration.
-                previousLightTimeCalculation = newLightTimeCalculation;
+                else
+                {
+                    // Perform Newton step on f(t) = t - ( |r_R - r_T| / c + corrections ), with derivative
+                    // f'(t) = 1 - ( d|r_R - r_T|/dt ) / c, which follows from the velocity of the link end at which the
+                    // time is not fixed.
+                    lightTimeDerivative = calculateEuclideanLightTimeDerivative(
+                                receiverState, transmitterState, isTimeAtReception );
+                    currentLightTimeEstimate -= ( currentLightTimeEstimate - newLightTimeCalculation ) /
+                            ( mathematical_constants::getFloatingInteger< ObservationScalarType >( 1 ) -
+                              lightTimeDerivative );
+
+                    // Update state of link end for new iteration.
+                    updateUnfixedLinkEndState( receiverState, transmitterState, receptionTime, transmissionTime,
+                                               time, currentLightTimeEstimate, isTimeAtReception );
+                }
             }
 
             counter++;
         }
 
+        // Store solution for warm start of next call.
+        previousLightTime_[ isTimeAtReception ] = newLightTimeCalculation;
+        isPreviousLightTimeSet_[ isTimeAtReception ] = true;
+
         // Set output variables and return the light time.
         receiverStateOutput = receiverState;
         transmitterStateOutput = transmitterState;
 
+        if( solutionCache_ != NULL )
+        {
+            solutionCache_->addSolution(
+                        time, isTimeAtReception, newLightTimeCalculation, receiverState, transmitterState );
+        }
+
         return newLightTimeCalculation;
     }
 
+    //! Function to set whether the light-time iteration is to be started from the previous solution.
+    /*!
+     *  Function to set whether the light-time iteration is to be started from the previous solution (on this link).
+     *  Using this warm start reduces the number of link end state evaluations when this object is called at subsequent
+     *  (closely spaced) times, e.g. when simulating the observations of a tracking pass.
+     *  \param useWarmStart Boolean denoting whether the warm start is to be used.
+     */
+    void setUseWarmStart( const bool useWarmStart )
+    {
+        useWarmStart_ = useWarmStart;
+        isPreviousLightTimeSet_[ 0 ] = false;
+        isPreviousLightTimeSet_[ 1 ] = false;
+    }
+
+    //! Function to set the object in which light-time solutions are stored for reuse.
+    /*!
+     *  Function to set the object in which light-time solutions are stored for reuse. If set, the solution for a given
+     *  time/reference link end is retrieved from this object if available, instead of being recomputed. Note that
+     *  the tolerance of the stored solution is not checked.
+     *  \param solutionCache Object in which light-time solutions are stored for reuse (NULL if not used).
+     */
+    void setSolutionCache(
+            const boost::shared_ptr< LightTimeSolutionCache< ObservationScalarType, TimeType > > solutionCache )
+    {
+        solutionCache_ = solutionCache;
+    }
+
+    //! Function to get the object in which light-time solutions are stored for reuse.
+    /*!
+     *  Function to get the object in which light-time solutions are stored for reuse.
+     *  \return Object in which light-time solutions are stored for reuse (NULL if not used).
+     */
+    boost::shared_ptr< LightTimeSolutionCache< ObservationScalarType, TimeType > > getSolutionCache( )
+    {
+        return solutionCache_;
+    }
+
     //! Function to get list of light-time correction functions
     /*!
      * Function to get list of light-time correction functions
@@ -342,6 +709,76 @@ protected:
     //! Current light-time correction.
     double currentCorrection_;
 
+    //! Boolean denoting whether the light-time iteration is started from the previous solution.
+    bool useWarmStart_;
+
+    //! Object in which light-time solutions are stored for reuse (NULL if not used).
+    boost::shared_ptr< LightTimeSolutionCache< ObservationScalarType, TimeType > > solutionCache_;
+
+    //! Booleans denoting whether previousLightTime_ entries have been set (index 1: time at reception, 0: at transmission)
+    bool isPreviousLightTimeSet_[ 2 ];
+
+    //! Light times computed in previous call to calculateLightTimeWithLinkEndsStates (index 1: time at reception, 0: at
+    //! transmission)
+    ObservationScalarType previousLightTime_[ 2 ];
+
+    //! Function to set the time and state of the link end at which the time is not fixed.
+    /*!
+     *  Function to set the time and state of the link end at which the time is not fixed (transmitter if the input time
+     *  is at reception, receiver otherwise), for a given light-time estimate.
+     *  \param receiverState State of receiver (returned by reference if time is at transmission).
+     *  \param transmitterState State of transmitter (returned by reference if time is at reception).
+     *  \param receptionTime Time at reception (returned by reference).
+     *  \param transmissionTime Time at transmission (returned by reference).
+     *  \param time Time at reception or transmission.
+     *  \param lightTime Current estimate of light time.
+     *  \param isTimeAtReception True if input time is at reception, false if at transmission.
+     */
+    void updateUnfixedLinkEndState(
+            StateType& receiverState,
+            StateType& transmitterState,
+            TimeType& receptionTime,
+            TimeType& transmissionTime,
+            const TimeType time,
+            const ObservationScalarType lightTime,
+            const bool isTimeAtReception )
+    {
+        if( isTimeAtReception )
+        {
+            receptionTime = time;
+            transmissionTime = time - lightTime;
+            transmitterState = stateFunctionOfTransmittingBody_( transmissionTime );
+        }
+        else
+        {
+            receptionTime = time + lightTime;
+            transmissionTime = time;
+            receiverState = stateFunctionOfReceivingBody_( receptionTime );
+        }
+    }
+
+    //! Function to calculate the derivative of the Euclidean light time w.r.t. the light time.
+    /*!
+     *  Function to calculate the derivative of the Euclidean light time (|r_R - r_T| / c) w.r.t. the light time, for
+     *  a fixed time at the reception or transmission link end, from the velocity of the other link end.
+     *  \param receiverState Current state of receiver.
+     *  \param transmitterState Current state of transmitter.
+     *  \param isTimeAtReception True if input time is at reception, false if at transmission.
+     *  \return Derivative of the Euclidean light time w.r.t. the light time.
+     */
+    ObservationScalarType calculateEuclideanLightTimeDerivative(
+            const StateType& receiverState,
+            const StateType& transmitterState,
+            const bool isTimeAtReception ) const
+    {
+        PositionType relativePosition = ( receiverState - transmitterState ).segment( 0, 3 );
+        PositionType unfixedLinkEndVelocity = isTimeAtReception ?
+                    PositionType( transmitterState.segment( 3, 3 ) ) : PositionType( receiverState.segment( 3, 3 ) );
+
+        return relativePosition.normalized( ).dot( unfixedLinkEndVelocity ) /
+                physical_constants::getSpeedOfLight< ObservationScalarType >( );
+    }
+
     //! Function to calculate a new light-time estimate from the link-ends states.
     /*!
      *  Function to calculate a new light-time estimate from the states of the two ends of the
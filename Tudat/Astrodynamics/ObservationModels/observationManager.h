@@ -11,6 +11,10 @@
 #ifndef TUDAT_OBSERVATIONMANAGER_H
 #define TUDAT_OBSERVATIONMANAGER_H
 
+#include <algorithm>
+#include <limits>
+
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 #include "Tudat/Astrodynamics/ObservationModels/observableTypes.h"
 #include "Tudat/Astrodynamics/ObservationModels/observationModel.h"
 #include "Tudat/Astrodynamics/ObservationModels/linkTypeDefs.h"
@@ -52,7 +56,8 @@ public:
             const std::map< LinkEnds, boost::shared_ptr< observation_partials::PositionPartialScaling  > >&
             observationPartialScalers ):
         observableType_( observableType ), stateTransitionMatrixInterface_( stateTransitionMatrixInterface ),
-        observationPartialScalers_( observationPartialScalers )
+        observationPartialScalers_( observationPartialScalers ),
+        statePartialTimeInterval_( std::numeric_limits< double >::max( ), -std::numeric_limits< double >::max( ) )
     {
         if( stateTransitionMatrixInterface_ != NULL )
         {
@@ -91,6 +96,44 @@ public:
                                      const LinkEnds linkEnds,
                                      const LinkEndType linkEndAssociatedWithTime ) = 0;
 
+    //! Function to simulate observations and associated partials at a sorted set of times, into preallocated output.
+    /*!
+     *  Function to simulate observations between specified link ends and associated partials at a set of observation times,
+     *  which must be sorted in ascending order. The results are written directly into the provided observation vector and
+     *  partials matrix, starting at row startIndex, so that no intermediate containers are created. The monotonic ordering
+     *  of the times ensures that the (hunting) lookup schemes of the interpolated state transition matrices and ephemerides
+     *  only advance their cursors between subsequent observations.
+     *  \param sortedTimes Vector of times at which observations are performed, in ascending order.
+     *  \param linkEnds Set of stations, S/C etc. in link, with specifiers of type of link end.
+     *  \param linkEndAssociatedWithTime Link end at which input times are valid, i.e. link end for which associated time
+     *  is kept constant (to input value)
+     *  \param observations Vector of observations, of which the entries starting at startIndex are set by this function
+     *  (returned by reference)
+     *  \param partials Matrix of observation partials, of which the rows starting at startIndex are set by this function
+     *  (returned by reference)
+     *  \param startIndex Row index in observations and partials at which the first computed observation is to be set.
+     *  \return Number of rows that were set in observations and partials.
+     */
+    virtual int computeSortedObservationsWithPartials(
+            const std::vector< TimeType >& sortedTimes,
+            const LinkEnds& linkEnds,
+            const LinkEndType linkEndAssociatedWithTime,
+            Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >& observations,
+            Eigen::MatrixXd& partials,
+            const int startIndex = 0 ) = 0;
+
+    //! Function to retrieve the interval of times at which state partials were evaluated in last sorted computation.
+    /*!
+     *  Function to retrieve the interval of times at which the partials w.r.t. the estimated states (and consequently
+     *  the states of the estimated bodies) were evaluated during the last call of computeSortedObservationsWithPartials.
+     *  \return Pair of first and last time at which state partials were evaluated (first larger than second if no state
+     *  partials were evaluated).
+     */
+    std::pair< double, double > getStatePartialTimeIntervalOfSortedObservations( )
+    {
+        return statePartialTimeInterval_;
+    }
+
 protected:
 
     //! Function to get the state transition and sensitivity matrix.
@@ -133,6 +176,9 @@ protected:
     //! compute the observation partials in the derived class
     std::map< LinkEnds, boost::shared_ptr< observation_partials::PositionPartialScaling  > > observationPartialScalers_;
 
+    //! First and last time at which state partials were evaluated in last call of computeSortedObservationsWithPartials
+    std::pair< double, double > statePartialTimeInterval_;
+
     //! Size of (square) state transition matrix.
     /*!
      *  Size of (square) state transition matrix.
@@ -186,7 +232,8 @@ public:
             stateTransitionMatrixInterface ):
         ObservationManagerBase< ObservationScalarType, TimeType >(
             observableType, stateTransitionMatrixInterface, observationPartialScalers ),
-        observationSimulator_( observationSimulator ), observationPartials_( observationPartials ){ }
+        observationSimulator_( observationSimulator ), observationPartials_( observationPartials ),
+        oldestStateTransitionMatrixCacheEntry_( 0 ){ }
 
     //! Virtual destructor
     virtual ~ObservationManager( ){ }
@@ -246,6 +293,7 @@ public:
         // Get observation model.
         boost::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > selectedObservationModel =
                 observationSimulator_->getObservationModel( linkEnds );
+        resetStateTransitionMatrixCache( );
 
         // Initialize vectors of states and times of link ends to be used in calculations.
         std::vector< Eigen::Vector6d > vectorOfStates;
@@ -276,6 +324,81 @@ public:
                                utilities::createConcatenatedEigenMatrixFromMapValues( observationMatrices ) );
     }
 
+    //! Function to simulate observations and associated partials at a sorted set of times, into preallocated output.
+    /*!
+     *  Function to simulate observations between specified link ends and associated partials at a set of observation times,
+     *  which must be sorted in ascending order. The results are written directly into the provided observation vector and
+     *  partials matrix, starting at row startIndex, so that no intermediate containers are created. The monotonic ordering
+     *  of the times ensures that the (hunting) lookup schemes of the interpolated state transition matrices and ephemerides
+     *  only advance their cursors between subsequent observations.
+     *  \param sortedTimes Vector of times at which observations are performed, in ascending order.
+     *  \param linkEnds Set of stations, S/C etc. in link, with specifiers of type of link end.
+     *  \param linkEndAssociatedWithTime Link end at which input times are valid, i.e. link end for which associated time
+     *  is kept constant (to input value)
+     *  \param observations Vector of observations, of which the entries starting at startIndex are set by this function
+     *  (returned by reference)
+     *  \param partials Matrix of observation partials, of which the rows starting at startIndex are set by this function
+     *  (returned by reference)
+     *  \param startIndex Row index in observations and partials at which the first computed observation is to be set.
+     *  \return Number of rows that were set in observations and partials.
+     */
+    int computeSortedObservationsWithPartials(
+            const std::vector< TimeType >& sortedTimes,
+            const LinkEnds& linkEnds,
+            const LinkEndType linkEndAssociatedWithTime,
+            Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >& observations,
+            Eigen::MatrixXd& partials,
+            const int startIndex = 0 )
+    {
+        if( !std::is_sorted( sortedTimes.begin( ), sortedTimes.end( ) ) )
+        {
+            throw std::runtime_error( "Error when computing sorted observations with partials, input times are not sorted" );
+        }
+
+        int fullParameterVectorSize = stateTransitionMatrixInterface_->getFullParameterVectorSize( );
+        if( partials.cols( ) != fullParameterVectorSize )
+        {
+            throw std::runtime_error( "Error when computing sorted observations with partials, partial matrix size is inconsistent" );
+        }
+
+        // Get observation model.
+        boost::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > selectedObservationModel =
+                observationSimulator_->getObservationModel( linkEnds );
+        resetStateTransitionMatrixCache( );
+        this->statePartialTimeInterval_ = std::make_pair( std::numeric_limits< double >::max( ),
+                                                          -std::numeric_limits< double >::max( ) );
+
+        // Iterate over all observation times
+        int currentIndex = startIndex;
+        int currentObservationSize;
+        for( unsigned int i = 0; i < sortedTimes.size( ); i++ )
+        {
+            // Compute observation, reusing the memory of the link end states/times.
+            vectorOfTimes_.clear( );
+            vectorOfStates_.clear( );
+            currentObservation_ = selectedObservationModel->computeObservationsWithLinkEndData(
+                        sortedTimes[ i ], linkEndAssociatedWithTime, vectorOfTimes_, vectorOfStates_ );
+            currentObservationSize = currentObservation_.rows( );
+
+            if( ( currentIndex + currentObservationSize > observations.rows( ) ) ||
+                    ( currentIndex + currentObservationSize > partials.rows( ) ) )
+            {
+                throw std::runtime_error( "Error when computing sorted observations with partials, output is too small" );
+            }
+
+            // Set observation and partials directly in output
+            observations.segment( currentIndex, currentObservationSize ) = currentObservation_;
+            partials.block( currentIndex, 0, currentObservationSize, fullParameterVectorSize ).setZero( );
+            addObservationPartialMatrix(
+                        currentObservationSize, vectorOfStates_, vectorOfTimes_, linkEnds, linkEndAssociatedWithTime,
+                        partials.block( currentIndex, 0, currentObservationSize, fullParameterVectorSize ) );
+
+            currentIndex += currentObservationSize;
+        }
+
+        return currentIndex - startIndex;
+    }
+
     //! Function to return the full list of observation partial objects
     /*!
      * Function to return the full list of observation partial objects
@@ -322,30 +445,65 @@ protected:
     {
         // Initialize partial vector of observation w.r.t. all parameter.
         int fullParameterVector = stateTransitionMatrixInterface_->getFullParameterVectorSize( );
-        Eigen::Matrix< double, ObservationSize, Eigen::Dynamic > partialMatrix =
-                Eigen::MatrixXd::Zero( observationSize, fullParameterVector );
+        Eigen::MatrixXd partialMatrix = Eigen::MatrixXd::Zero( observationSize, fullParameterVector );
 
-        // Initialize list of [Phi;S] matrices at times required by calculation (key)
-        std::map< double, Eigen::MatrixXd > combinedStateTransitionMatrices;
+        addObservationPartialMatrix( observationSize, states, times, linkEnds, linkEndAssociatedWithTime,
+                                     partialMatrix.block( 0, 0, observationSize, fullParameterVector ) );
+
+        return partialMatrix;
+    }
+
+    //! Function to add the partials of an observation w.r.t. the parameter vector to an existing matrix block.
+    /*!
+     *  Function to add the partials of an observation w.r.t. the parameter vector to an existing matrix block, computed from
+     *  given states of link ends and reception and transmission times. State transition/sensitivity matrices are retrieved
+     *  through the stateTransitionMatrixCache_, so that matrices at identical times are not re-interpolated.
+     *  \param observationSize Size of single observation
+     *  \param states States of link ends, order determined by updatePartials( )
+     *  and calculatePartial( ) functions expected inputs.
+     *  \param times Times at link ends (reception, transmission, reflection, etc. ), order determined by updatePartials( )
+     *  and calculatePartial( ) functions expected inputs.
+     *  \param linkEnds Set of stations, S/C etc. in link, with specifiers of type of link end.
+     *  \param linkEndAssociatedWithTime Reference link end for observations
+     *  \param partialMatrix Block of matrix (of size observationSize x full parameter vector size) to which partials of
+     *  observation w.r.t. parameter vector are added.
+     */
+    void addObservationPartialMatrix(
+            const int observationSize,
+            const std::vector< Eigen::Vector6d >& states,
+            const std::vector< double >& times,
+            const LinkEnds& linkEnds,
+            const LinkEndType linkEndAssociatedWithTime,
+            Eigen::Block< Eigen::MatrixXd > partialMatrix )
+    {
+        int fullParameterVector = stateTransitionMatrixInterface_->getFullParameterVectorSize( );
 
         // Perform updates of dependent variables used by (subset of) observation partials.
         updatePartials( states, times, linkEnds, linkEndAssociatedWithTime );
 
-        currentLinkEndPartials = observationPartials_[ linkEnds ];
+        typename std::map< LinkEnds, std::map< std::pair< int, int >, boost::shared_ptr<
+                observation_partials::ObservationPartial< ObservationSize > > > >::iterator currentLinkEndPartials =
+                observationPartials_.find( linkEnds );
+        if( currentLinkEndPartials == observationPartials_.end( ) )
+        {
+            return;
+        }
 
         // Iterate over all observation partials associated with given link ends.
         for( typename std::map< std::pair< int, int >, boost::shared_ptr<
              observation_partials::ObservationPartial< ObservationSize > > >::iterator
-             partialIterator = currentLinkEndPartials.begin( );
-             partialIterator != currentLinkEndPartials.end( ); partialIterator++ )
+             partialIterator = currentLinkEndPartials->second.begin( );
+             partialIterator != currentLinkEndPartials->second.end( ); partialIterator++ )
         {
             // Get Observation partial start and size indices in parameter veector.
             std::pair< int, int > currentIndexInfo = partialIterator->first;
 
             // Calculate partials of observation w.r.t. parameters, with associated observation times (single partial
-            // can consist of multiple partial matrices, associated at different times)
-            std::vector< std::pair< Eigen::Matrix< double, ObservationSize, Eigen::Dynamic >, double > > singlePartialSet =
-                    partialIterator->second->calculatePartial( states, times, linkEndAssociatedWithTime );
+            // can consist of multiple partial matrices, associated at different times), reusing memory of partial list.
+            partialIterator->second->calculatePartialIntoList(
+                        states, times, linkEndAssociatedWithTime, currentPartialSet_ );
+            const std::vector< std::pair< Eigen::Matrix< double, ObservationSize, Eigen::Dynamic >, double > >&
+                    singlePartialSet = currentPartialSet_;
 
             // If start index is smaller than size of state transition,
             // current partial is w.r.t. to a body to be estimated current state.
@@ -353,16 +511,15 @@ protected:
             {
                 for( unsigned int i = 0; i < singlePartialSet.size( ); i++ )
                 {
-                    // Evaluate [Phi;S] matrix at each time instant associated with partial, if not yet evaluated.
-                    if( combinedStateTransitionMatrices.count( singlePartialSet[ i ].second ) == 0 )
-                    {
-                        combinedStateTransitionMatrices[ singlePartialSet[ i ].second ] =
-                                this->getCombinedStateTransitionAndSensitivityMatrix( singlePartialSet[ i ].second );
-                    }
-
-                    // Add partial of observation h w.r.t. initial state x_{0} (dh/dx_{0}=dh/dx*dx/dx_{0})
-                    partialMatrix += ( singlePartialSet[ i ].first ) *
-                            combinedStateTransitionMatrices[ singlePartialSet[ i ].second ].block
+                    this->statePartialTimeInterval_.first =
+                            std::min( this->statePartialTimeInterval_.first, singlePartialSet[ i ].second );
+                    this->statePartialTimeInterval_.second =
+                            std::max( this->statePartialTimeInterval_.second, singlePartialSet[ i ].second );
+
+                    // Add partial of observation h w.r.t. initial state x_{0} (dh/dx_{0}=dh/dx*dx/dx_{0}), with [Phi;S]
+                    // evaluated at time instant associated with partial
+                    partialMatrix.noalias( ) += ( singlePartialSet[ i ].first ) *
+                            getCachedCombinedStateTransitionAndSensitivityMatrix( singlePartialSet[ i ].second ).block
                             ( currentIndexInfo.first, 0, currentIndexInfo.second, fullParameterVector );
                 }
             }
@@ -376,8 +533,54 @@ protected:
                 }
             }
         }
+    }
 
-        return partialMatrix;
+    //! Function to invalidate all entries of the cache of [Phi;S] matrices, retaining the allocated memory.
+    void resetStateTransitionMatrixCache( )
+    {
+        for( unsigned int i = 0; i < stateTransitionMatrixCache_.size( ); i++ )
+        {
+            stateTransitionMatrixCache_[ i ].first = TUDAT_NAN;
+        }
+    }
+
+    //! Function to retrieve the state transition and sensitivity matrix, reusing previously interpolated values.
+    /*!
+     *  Function to retrieve the concatenated state transition and sensitivity matrix [Phi;S] at a given time. The most
+     *  recently evaluated matrices are stored in a small fixed-size cache, so that matrices at time instants shared between
+     *  partials (and subsequent observations) are interpolated only once. The memory of the cache is reused between calls,
+     *  with new matrices interpolated directly into the cache entries.
+     *  \param evaluationTime Time at which matrices are to be evaluated
+     *  \return Concatenated state transition and sensitivity matrices at given time.
+     */
+    const Eigen::MatrixXd& getCachedCombinedStateTransitionAndSensitivityMatrix( const double evaluationTime )
+    {
+        for( unsigned int i = 0; i < stateTransitionMatrixCache_.size( ); i++ )
+        {
+            if( stateTransitionMatrixCache_[ i ].first == evaluationTime )
+            {
+                return stateTransitionMatrixCache_[ i ].second;
+            }
+        }
+
+        // Add new entry to cache, or overwrite oldest entry if cache is full.
+        std::pair< double, Eigen::MatrixXd >* newEntry;
+        if( stateTransitionMatrixCache_.size( ) < maximumStateTransitionMatrixCacheSize_ )
+        {
+            stateTransitionMatrixCache_.push_back( std::make_pair( evaluationTime, Eigen::MatrixXd( ) ) );
+            newEntry = &stateTransitionMatrixCache_.back( );
+        }
+        else
+        {
+            newEntry = &stateTransitionMatrixCache_[ oldestStateTransitionMatrixCacheEntry_ ];
+            oldestStateTransitionMatrixCacheEntry_ =
+                    ( oldestStateTransitionMatrixCacheEntry_ + 1 ) % maximumStateTransitionMatrixCacheSize_;
+        }
+
+        newEntry->first = evaluationTime;
+        this->stateTransitionMatrixInterface_->computeFullCombinedStateTransitionAndSensitivityMatrix(
+                    evaluationTime, newEntry->second );
+        return newEntry->second;
     }
 
     //! Object used to simulate ideal observations of the  observableType
@@ -393,9 +596,26 @@ protected:
     std::map< LinkEnds, std::map< std::pair< int, int >, boost::shared_ptr<
     observation_partials::ObservationPartial< ObservationSize > > > > observationPartials_;
 
-    //! Pre-declared map used in computation of partials.
-    std::map< std::pair< int, int >, boost::shared_ptr< observation_partials::ObservationPartial< ObservationSize > > >
-    currentLinkEndPartials;
+    //! Cache of most recently evaluated [Phi;S] matrices, with associated evaluation times.
+    std::vector< std::pair< double, Eigen::MatrixXd > > stateTransitionMatrixCache_;
+
+    //! Maximum number of entries in stateTransitionMatrixCache_
+    static const unsigned int maximumStateTransitionMatrixCacheSize_ = 4;
+
+    //! Index of oldest entry in stateTransitionMatrixCache_ (to be overwritten first when cache is full).
+    unsigned int oldestStateTransitionMatrixCacheEntry_;
+
+    //! Pre-declared list of link end times, reused between observations by computeSortedObservationsWithPartials
+    std::vector< double > vectorOfTimes_;
+
+    //! Pre-declared list of link end states, reused between observations by computeSortedObservationsWithPartials
+    std::vector< Eigen::Vector6d > vectorOfStates_;
+
+    //! Pre-declared current observation, used by computeSortedObservationsWithPartials
+    Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > currentObservation_;
+
+    //! Pre-declared list of partials (with associated times) of single ObservationPartial, reused between partials
+    std::vector< std::pair< Eigen::Matrix< double, ObservationSize, Eigen::Dynamic >, double > > currentPartialSet_;
 
 };
 
@@ -96,6 +96,25 @@ public:
             const std::vector< double >& times,
             const observation_models::LinkEndType linkEndOfFixedTime = observation_models::receiver ) = 0;
 
+    //! Function to calculate the observation partial(s) at required time(s) and state(s) into an existing list.
+    /*!
+     *  Function to calculate the observation partial(s) at required time(s) and state(s) into an existing list, so that
+     *  the memory of the list may be reused between calls. The default implementation assigns the output of
+     *  calculatePartial; derived classes may override this function to set the existing list entries in place.
+     *  \param states Link end states. Index maps to link end for a given ObsevableType through getLinkEndIndex function.
+     *  \param times Link end times.
+     *  \param linkEndOfFixedTime Link end that is kept fixed when computing the observable.
+     *  \param partials Vector of pairs containing partial values and associated times (returned by reference).
+     */
+    virtual void calculatePartialIntoList(
+            const std::vector< Eigen::Vector6d >& states,
+            const std::vector< double >& times,
+            const observation_models::LinkEndType linkEndOfFixedTime,
+            std::vector< std::pair< Eigen::Matrix< double, ObservationSize, Eigen::Dynamic >, double > >& partials )
+    {
+        partials = calculatePartial( states, times, linkEndOfFixedTime );
+    }
+
     //! Function to get parameter id of for specifc parameter of which partial is computed by object.
     /*!
      * Function to get parameter id of for specifc parameter of which partial is computed by object.
@@ -51,13 +51,27 @@ OneWayRangePartial::OneWayRangePartialReturnType OneWayRangePartial::calculatePa
         const std::vector< Eigen::Vector6d >& states,
         const std::vector< double >& times,
         const observation_models::LinkEndType linkEndOfFixedTime )
+{
+    OneWayRangePartialReturnType returnPartial;
+    calculatePartialIntoList( states, times, linkEndOfFixedTime, returnPartial );
+    return returnPartial;
+}
+
+//! Function to calculate the observation partial(s) at required time and state into an existing list.
+void OneWayRangePartial::calculatePartialIntoList(
+        const std::vector< Eigen::Vector6d >& states,
+        const std::vector< double >& times,
+        const observation_models::LinkEndType linkEndOfFixedTime,
+        OneWayRangePartialReturnType& partials )
 {
     if( linkEndOfFixedTime != oneWayRangeScaler_->getCurrentLinkEndType( ) )
     {
         throw std::runtime_error( "Error one-way range partial and scaling are inconsistent" );
     }
 
-    OneWayRangePartialReturnType returnPartial;
+    // Resize list (retaining memory of existing entries if size is unchanged).
+    partials.resize( positionPartialList_.size( ) + lighTimeCorrectionPartialsFunctions_.size( ) );
+    unsigned int currentPartialIndex = 0;
 
     // Iterate over all link ends
     for( positionPartialIterator_ = positionPartialList_.begin( ); positionPartialIterator_ != positionPartialList_.end( );
@@ -75,22 +89,21 @@ OneWayRangePartial::OneWayRangePartialReturnType OneWayRangePartial::calculatePa
         }
 
         // Scale position partials
-        returnPartial.push_back(
-                    std::make_pair(
-                        oneWayRangeScaler_->getScalingFactor( positionPartialIterator_->first ) *
-                        ( positionPartialIterator_->second->calculatePartialOfPosition(
-                              currentState_ , currentTime_ ) ), currentTime_ ) );
+        partials[ currentPartialIndex ].first.noalias( ) =
+                oneWayRangeScaler_->getScalingFactor( positionPartialIterator_->first ) *
+                ( positionPartialIterator_->second->calculatePartialOfPosition( currentState_ , currentTime_ ) );
+        partials[ currentPartialIndex ].second = currentTime_;
+        currentPartialIndex++;
     }
 
     // Add scaled light-time correcion partials.
     for( unsigned int i = 0; i < lighTimeCorrectionPartialsFunctions_.size( ); i++ )
     {
-        returnPartial.push_back( lighTimeCorrectionPartialsFunctions_.at( i )( states, times ) );
-        returnPartial[ returnPartial.size( ) - 1 ].first *=
+        partials[ currentPartialIndex ] = lighTimeCorrectionPartialsFunctions_.at( i )( states, times );
+        partials[ currentPartialIndex ].first *=
                 physical_constants::SPEED_OF_LIGHT * oneWayRangeScaler_->getLightTimePartialScalingFactor( );
+        currentPartialIndex++;
     }
-
-    return returnPartial;
 }
 
 }
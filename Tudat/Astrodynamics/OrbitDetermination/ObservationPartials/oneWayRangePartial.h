@@ -160,6 +160,21 @@ public:
             const std::vector< double >& times,
             const observation_models::LinkEndType linkEndOfFixedTime );
 
+    //! Function to calculate the observation partial(s) at required time and state into an existing list.
+    /*!
+     *  Function to calculate the observation partial(s) at required time and state into an existing list, reusing the
+     *  memory of the list (and its partial matrices) if it is of the correct size.
+     *  \param states Link end states. Index maps to link end for a given ObsevableType through getLinkEndIndex function.
+     *  \param times Link end time.
+     *  \param linkEndOfFixedTime Link end that is kept fixed when computing the observable.
+     *  \param partials Vector of pairs containing partial values and associated times (returned by reference).
+     */
+    virtual void calculatePartialIntoList(
+            const std::vector< Eigen::Vector6d >& states,
+            const std::vector< double >& times,
+            const observation_models::LinkEndType linkEndOfFixedTime,
+            OneWayRangePartialReturnType& partials );
+
     //! Function to get scaling object used for mapping partials of positions to partials of observable
     /*!
      * Function to get scaling object used for mapping partials of positions to partials of observable
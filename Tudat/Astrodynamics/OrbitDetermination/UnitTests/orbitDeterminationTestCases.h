@@ -38,12 +38,22 @@ Eigen::VectorXd getDefaultInitialParameterPerturbation( )
     return parameterPerturbations;
 }
 
+//! Function to create the orbit determination manager and simulated observations of the estimation test case.
+/*!
+ *  Function to create the orbit determination manager and simulated observations of the estimation test case, in which
+ *  the initial state of the Earth and the gravitational parameter of the Moon are estimated.
+ *  \param observableType Type of observable(s) that is simulated (0: position; 1: one-way range; 2: angular position;
+ *  3: one-way Doppler; 4: one-way range, angular position and one-way Doppler)
+ *  \param observationsAndTimes Simulated observations and associated times (returned by reference)
+ *  \param parametersToEstimate Set of estimated parameters, set to their true values (returned by reference)
+ *  \return Orbit determination manager of test case
+ */
 template< typename TimeType = double, typename StateScalarType  = double >
-std::pair< boost::shared_ptr< PodOutput< StateScalarType > >, Eigen::VectorXd > executeParameterEstimation(
-        const int observableType = 1,
-        Eigen::VectorXd parameterPerturbation = getDefaultInitialParameterPerturbation( ),
-        Eigen::MatrixXd inverseAPrioriCovariance  = Eigen::MatrixXd::Zero( 7, 7 ),
-        const double weight = 1.0 )
+boost::shared_ptr< OrbitDeterminationManager< StateScalarType, TimeType > > createEstimationTestCase(
+        const int observableType,
+        std::map< ObservableType, std::map< LinkEnds, std::pair< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >,
+        std::pair< std::vector< TimeType >, LinkEndType > > > >& observationsAndTimes,
+        boost::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > >& parametersToEstimate )
 {
     //Load spice kernels.
     std::string kernelsPath = input_output::getSpiceKernelPath( );
@@ -121,8 +131,7 @@ std::pair< boost::shared_ptr< PodOutput< StateScalarType > >, Eigen::VectorXd >
                               centralBodyMap[ "Earth" ] ) );
     parameterNames.push_back( boost::make_shared< EstimatableParameterSettings >( "Moon", gravitational_parameter ) );
 
-    boost::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > > parametersToEstimate =
-            createParametersToEstimate< StateScalarType >( parameterNames, bodyMap );
+    parametersToEstimate = createParametersToEstimate< StateScalarType >( parameterNames, bodyMap );
 
 
     // Define integrator settings.
@@ -183,8 +192,8 @@ std::pair< boost::shared_ptr< PodOutput< StateScalarType > >, Eigen::VectorXd >
 
 
     // Create orbit determination object.
-    OrbitDeterminationManager< StateScalarType, TimeType > orbitDeterminationManager =
-            OrbitDeterminationManager< StateScalarType, TimeType >(
+    boost::shared_ptr< OrbitDeterminationManager< StateScalarType, TimeType > > orbitDeterminationManager =
+            boost::make_shared< OrbitDeterminationManager< StateScalarType, TimeType > >(
                 bodyMap, parametersToEstimate, observationSettingsMap,
                 integratorSettings, propagatorSettings );
 
@@ -238,13 +247,31 @@ std::pair< boost::shared_ptr< PodOutput< StateScalarType > >, Eigen::VectorXd >
 
     singleObservableSimulationInput.clear( );
 
+    // Simulate observations
+    observationsAndTimes = simulateObservations< StateScalarType, TimeType >(
+                measurementSimulationInput, orbitDeterminationManager->getObservationManagers( ) );
+
+    return orbitDeterminationManager;
+}
+
+template< typename TimeType = double, typename StateScalarType  = double >
+std::pair< boost::shared_ptr< PodOutput< StateScalarType > >, Eigen::VectorXd > executeParameterEstimation(
+        const int observableType = 1,
+        Eigen::VectorXd parameterPerturbation = getDefaultInitialParameterPerturbation( ),
+        Eigen::MatrixXd inverseAPrioriCovariance  = Eigen::MatrixXd::Zero( 7, 7 ),
+        const double weight = 1.0,
+        const int numberOfObservationTimesPerChunk = 0 )
+{
     typedef Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > ObservationVectorType;
     typedef std::map< LinkEnds, std::pair< ObservationVectorType, std::pair< std::vector< TimeType >, LinkEndType > > > SingleObservablePodInputType;
     typedef std::map< ObservableType, SingleObservablePodInputType > PodInputDataType;
 
-    // Simulate observations
-    PodInputDataType observationsAndTimes = simulateObservations< StateScalarType, TimeType >(
-                measurementSimulationInput, orbitDeterminationManager.getObservationManagers( ) );
+    // Create orbit determination object and simulate observations
+    PodInputDataType observationsAndTimes;
+    boost::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > > parametersToEstimate;
+    boost::shared_ptr< OrbitDeterminationManager< StateScalarType, TimeType > > orbitDeterminationManager =
+            createEstimationTestCase< TimeType, StateScalarType >(
+                observableType, observationsAndTimes, parametersToEstimate );
 
     // Perturb parameter estimate
     Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > initialParameterEstimate =
@@ -278,9 +305,19 @@ std::pair< boost::shared_ptr< PodOutput< StateScalarType > >, Eigen::VectorXd >
         podInput->setConstantWeightsMatrix( weight );
     }
 
-    // Perform estimation
-    boost::shared_ptr< PodOutput< StateScalarType > > podOutput = orbitDeterminationManager.estimateParameters(
-                podInput, boost::make_shared< EstimationConvergenceChecker >( ), true, true, false, false );
+    // Perform estimation (sequentially if chunk size is provided)
+    boost::shared_ptr< PodOutput< StateScalarType > > podOutput;
+    if( numberOfObservationTimesPerChunk > 0 )
+    {
+        podOutput = orbitDeterminationManager->estimateParametersSequentially(
+                    podInput, numberOfObservationTimesPerChunk, Eigen::VectorXd::Zero( 0 ),
+                    boost::make_shared< EstimationConvergenceChecker >( ), false, true, false );
+    }
+    else
+    {
+        podOutput = orbitDeterminationManager->estimateParameters(
+                    podInput, boost::make_shared< EstimationConvergenceChecker >( ), true, true, false, false );
+    }
 
     return std::make_pair( podOutput,
                            ( podOutput->parameterEstimate_.template cast< double >( ) -
@@ -59,6 +59,267 @@ BOOST_AUTO_TEST_CASE( test_EstimationFromPosition )
     }
 }
 
+//! This test checks whether the sequential (square-root information filter) estimation gives the same result as the
+//! batch estimation
+BOOST_AUTO_TEST_CASE( test_SequentialEstimationFromPosition )
+{
+    for( int simulationType = 0; simulationType < 5; simulationType++ )
+    {
+        std::pair< boost::shared_ptr< PodOutput< double > >, Eigen::VectorXd > batchOutput =
+                executeParameterEstimation< double, double >( simulationType );
+        std::pair< boost::shared_ptr< PodOutput< double > >, Eigen::VectorXd > sequentialOutput =
+                executeParameterEstimation< double, double >(
+                    simulationType, getDefaultInitialParameterPerturbation( ), Eigen::MatrixXd::Zero( 7, 7 ), 1.0, 50 );
+
+        // Check whether both estimates are equal (arc-wise integration reproduces the fixed-step batch integration)
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_SMALL( batchOutput.second( j ) - sequentialOutput.second( j ), 1.0E-5 );
+        }
+
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_SMALL( batchOutput.second( j + 3 ) - sequentialOutput.second( j + 3 ), 1.0E-10 );
+        }
+
+        BOOST_CHECK_SMALL( batchOutput.second( 6 ) - sequentialOutput.second( 6 ), 1.0 );
+    }
+}
+
+//! Function to retrieve the subset of observations (and associated times) before or after a given time.
+std::map< ObservableType, std::map< LinkEnds, std::pair< Eigen::VectorXd, std::pair< std::vector< double >, LinkEndType > > > >
+getObservationsBeforeOrAfterTime(
+        const std::map< ObservableType, std::map< LinkEnds, std::pair< Eigen::VectorXd,
+        std::pair< std::vector< double >, LinkEndType > > > >& observationsAndTimes,
+        const double splitTime, const bool getObservationsBeforeTime )
+{
+    typedef std::map< LinkEnds, std::pair< Eigen::VectorXd, std::pair< std::vector< double >, LinkEndType > > >
+            SingleObservablePodInputType;
+    typedef std::map< ObservableType, SingleObservablePodInputType > PodInputDataType;
+
+    PodInputDataType observationSubset;
+    for( PodInputDataType::const_iterator observableIterator = observationsAndTimes.begin( );
+         observableIterator != observationsAndTimes.end( ); observableIterator++ )
+    {
+        for( SingleObservablePodInputType::const_iterator dataIterator = observableIterator->second.begin( );
+             dataIterator != observableIterator->second.end( ); dataIterator++ )
+        {
+            const std::vector< double >& observationTimes = dataIterator->second.second.first;
+            int observationSize = dataIterator->second.first.rows( ) / observationTimes.size( );
+
+            // Retrieve observations in subset, observations at single time are stored consecutively.
+            std::vector< double > subsetTimes;
+            std::vector< double > subsetObservations;
+            for( unsigned int i = 0; i < observationTimes.size( ); i++ )
+            {
+                if( ( observationTimes.at( i ) < splitTime ) == getObservationsBeforeTime )
+                {
+                    subsetTimes.push_back( observationTimes.at( i ) );
+                    for( int j = 0; j < observationSize; j++ )
+                    {
+                        subsetObservations.push_back( dataIterator->second.first( i * observationSize + j ) );
+                    }
+                }
+            }
+
+            observationSubset[ observableIterator->first ][ dataIterator->first ] = std::make_pair(
+                        Eigen::Map< Eigen::VectorXd >( subsetObservations.data( ), subsetObservations.size( ) ),
+                        std::make_pair( subsetTimes, dataIterator->second.second.second ) );
+        }
+    }
+    return observationSubset;
+}
+
+//! This test checks whether the sequential (square-root information filter) estimation gives the same result as the
+//! batch estimation when the data is split over two subsequent calls (continuing from the previous estimation), and
+//! whether process noise is correctly processed.
+BOOST_AUTO_TEST_CASE( test_SequentialEstimationContinuationAndProcessNoise )
+{
+    typedef std::map< LinkEnds, std::pair< Eigen::VectorXd, std::pair< std::vector< double >, LinkEndType > > >
+            SingleObservablePodInputType;
+    typedef std::map< ObservableType, SingleObservablePodInputType > PodInputDataType;
+
+    for( int simulationType = 0; simulationType < 2; simulationType++ )
+    {
+        // Create orbit determination manager and simulate observations
+        PodInputDataType observationsAndTimes;
+        boost::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > > parametersToEstimate;
+        boost::shared_ptr< OrbitDeterminationManager< double, double > > orbitDeterminationManager =
+                createEstimationTestCase< double, double >(
+                    simulationType, observationsAndTimes, parametersToEstimate );
+
+        Eigen::VectorXd truthParameters = parametersToEstimate->getFullParameterValues< double >( );
+        Eigen::VectorXd initialParameterEstimate = truthParameters + getDefaultInitialParameterPerturbation( );
+
+        // Perform batch estimation on full data set
+        boost::shared_ptr< PodInput< double, double > > podInput = boost::make_shared< PodInput< double, double > >(
+                    observationsAndTimes, truthParameters.rows( ), Eigen::MatrixXd::Zero( 7, 7 ),
+                    initialParameterEstimate - orbitDeterminationManager->getCurrentParameterEstimate( ) );
+        podInput->setConstantWeightsMatrix( 1.0 );
+        boost::shared_ptr< PodOutput< double > > batchOutput = orbitDeterminationManager->estimateParameters(
+                    podInput, boost::make_shared< EstimationConvergenceChecker >( ), true, true, false, false );
+
+        // Perform sequential estimation on first half of data, and continue with second half in subsequent call.
+        double splitTime = 2.0E7;
+        boost::shared_ptr< PodInput< double, double > > firstPodInput = boost::make_shared< PodInput< double, double > >(
+                    getObservationsBeforeOrAfterTime( observationsAndTimes, splitTime, true ), truthParameters.rows( ),
+                    Eigen::MatrixXd::Zero( 7, 7 ),
+                    initialParameterEstimate - orbitDeterminationManager->getCurrentParameterEstimate( ) );
+        firstPodInput->setConstantWeightsMatrix( 1.0 );
+        boost::shared_ptr< PodOutput< double > > firstSequentialOutput =
+                orbitDeterminationManager->estimateParametersSequentially(
+                    firstPodInput, 50, Eigen::VectorXd::Zero( 0 ),
+                    boost::make_shared< EstimationConvergenceChecker >( ), false, true, false );
+
+        boost::shared_ptr< PodInput< double, double > > secondPodInput = boost::make_shared< PodInput< double, double > >(
+                    getObservationsBeforeOrAfterTime( observationsAndTimes, splitTime, false ), truthParameters.rows( ),
+                    Eigen::MatrixXd::Zero( 7, 7 ),
+                    firstSequentialOutput->parameterEstimate_ - orbitDeterminationManager->getCurrentParameterEstimate( ) );
+        secondPodInput->setConstantWeightsMatrix( 1.0 );
+        boost::shared_ptr< PodOutput< double > > continuedSequentialOutput =
+                orbitDeterminationManager->estimateParametersSequentially(
+                    secondPodInput, 50, Eigen::VectorXd::Zero( 0 ),
+                    boost::make_shared< EstimationConvergenceChecker >( ), true, true, false );
+
+        // Perform sequential estimation on full data set, with zero process noise (equivalent to no process noise).
+        podInput = boost::make_shared< PodInput< double, double > >(
+                    observationsAndTimes, truthParameters.rows( ), Eigen::MatrixXd::Zero( 7, 7 ),
+                    initialParameterEstimate - orbitDeterminationManager->getCurrentParameterEstimate( ) );
+        podInput->setConstantWeightsMatrix( 1.0 );
+        boost::shared_ptr< PodOutput< double > > zeroNoiseSequentialOutput =
+                orbitDeterminationManager->estimateParametersSequentially(
+                    podInput, 50, Eigen::VectorXd::Zero( 7 ),
+                    boost::make_shared< EstimationConvergenceChecker >( ), false, true, false );
+
+        // Perform sequential estimation on full data set, with process noise on gravitational parameter of Moon.
+        Eigen::VectorXd processNoiseVariances = Eigen::VectorXd::Zero( 7 );
+        processNoiseVariances( 6 ) = 1.0E4;
+        podInput = boost::make_shared< PodInput< double, double > >(
+                    observationsAndTimes, truthParameters.rows( ), Eigen::MatrixXd::Zero( 7, 7 ),
+                    initialParameterEstimate - orbitDeterminationManager->getCurrentParameterEstimate( ) );
+        podInput->setConstantWeightsMatrix( 1.0 );
+        boost::shared_ptr< PodOutput< double > > noisySequentialOutput =
+                orbitDeterminationManager->estimateParametersSequentially(
+                    podInput, 50, processNoiseVariances,
+                    boost::make_shared< EstimationConvergenceChecker >( ), false, true, false );
+
+        Eigen::VectorXd batchEstimate = batchOutput->parameterEstimate_;
+        Eigen::VectorXd continuedSequentialEstimate = continuedSequentialOutput->parameterEstimate_;
+        Eigen::VectorXd zeroNoiseSequentialEstimate = zeroNoiseSequentialOutput->parameterEstimate_;
+        Eigen::VectorXd noisySequentialEstimate = noisySequentialOutput->parameterEstimate_;
+
+        // Check whether continued and zero process noise sequential estimates are equal to batch estimate.
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_SMALL( batchEstimate( j ) - continuedSequentialEstimate( j ), 1.0E-4 );
+            BOOST_CHECK_SMALL( batchEstimate( j + 3 ) - continuedSequentialEstimate( j + 3 ), 1.0E-9 );
+
+            BOOST_CHECK_SMALL( batchEstimate( j ) - zeroNoiseSequentialEstimate( j ), 1.0E-5 );
+            BOOST_CHECK_SMALL( batchEstimate( j + 3 ) - zeroNoiseSequentialEstimate( j + 3 ), 1.0E-10 );
+        }
+        BOOST_CHECK_SMALL( batchEstimate( 6 ) - continuedSequentialEstimate( 6 ), 10.0 );
+        BOOST_CHECK_SMALL( batchEstimate( 6 ) - zeroNoiseSequentialEstimate( 6 ), 1.0 );
+
+        // Check whether estimate with process noise converges to true parameters (data is ideal).
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_SMALL( noisySequentialEstimate( j ) - truthParameters( j ), 1.0E-1 );
+            BOOST_CHECK_SMALL( noisySequentialEstimate( j + 3 ) - truthParameters( j + 3 ), 2.0E-6 );
+        }
+        BOOST_CHECK_SMALL( noisySequentialEstimate( 6 ) - truthParameters( 6 ), 2.0E4 );
+
+        // Check whether process noise reduces information content of gravitational parameter only.
+        Eigen::MatrixXd zeroNoiseInverseCovariance = zeroNoiseSequentialOutput->getUnnormalizedInverseCovarianceMatrix( );
+        Eigen::MatrixXd noisyInverseCovariance = noisySequentialOutput->getUnnormalizedInverseCovarianceMatrix( );
+        BOOST_CHECK_EQUAL( noisyInverseCovariance( 6, 6 ) < zeroNoiseInverseCovariance( 6, 6 ), true );
+
+        // Check whether continuation without previous sequential estimation is rejected.
+        boost::shared_ptr< OrbitDeterminationManager< double, double > > newOrbitDeterminationManager =
+                createEstimationTestCase< double, double >(
+                    simulationType, observationsAndTimes, parametersToEstimate );
+        bool isExceptionCaught = false;
+        try
+        {
+            newOrbitDeterminationManager->estimateParametersSequentially(
+                        secondPodInput, 50, Eigen::VectorXd::Zero( 0 ),
+                        boost::make_shared< EstimationConvergenceChecker >( ), true, true, false );
+        }
+        catch( std::runtime_error )
+        {
+            isExceptionCaught = true;
+        }
+        BOOST_CHECK_EQUAL( isExceptionCaught, true );
+    }
+}
+
+//! This test checks whether the observations and partials computed by the observation managers for sorted observation
+//! times (into preallocated output) are equal to those computed for arbitrary observation times.
+BOOST_AUTO_TEST_CASE( test_SortedObservationsWithPartials )
+{
+    typedef std::map< LinkEnds, std::pair< Eigen::VectorXd, std::pair< std::vector< double >, LinkEndType > > >
+            SingleObservablePodInputType;
+    typedef std::map< ObservableType, SingleObservablePodInputType > PodInputDataType;
+
+    for( int simulationType = 0; simulationType < 5; simulationType++ )
+    {
+        // Create orbit determination manager and simulate observations
+        PodInputDataType observationsAndTimes;
+        boost::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > > parametersToEstimate;
+        boost::shared_ptr< OrbitDeterminationManager< double, double > > orbitDeterminationManager =
+                createEstimationTestCase< double, double >(
+                    simulationType, observationsAndTimes, parametersToEstimate );
+        int numberOfParameters = parametersToEstimate->getParameterSetSize( );
+
+        for( PodInputDataType::const_iterator observableIterator = observationsAndTimes.begin( );
+             observableIterator != observationsAndTimes.end( ); observableIterator++ )
+        {
+            boost::shared_ptr< ObservationManagerBase< double, double > > observationManager =
+                    orbitDeterminationManager->getObservationManagers( ).at( observableIterator->first );
+
+            for( SingleObservablePodInputType::const_iterator dataIterator = observableIterator->second.begin( );
+                 dataIterator != observableIterator->second.end( ); dataIterator++ )
+            {
+                const std::vector< double >& observationTimes = dataIterator->second.second.first;
+                int numberOfObservations = dataIterator->second.first.rows( );
+
+                // Compute observations and partials for arbitrary times.
+                std::pair< Eigen::VectorXd, Eigen::MatrixXd > observationsWithPartials =
+                        observationManager->computeObservationsWithPartials(
+                            observationTimes, dataIterator->first, dataIterator->second.second.second );
+
+                // Compute observations and partials for sorted times, with offset in (preallocated) output.
+                int startIndex = 3;
+                Eigen::VectorXd sortedObservations = Eigen::VectorXd::Zero( numberOfObservations + startIndex );
+                Eigen::MatrixXd sortedPartials = Eigen::MatrixXd::Zero(
+                            numberOfObservations + startIndex, numberOfParameters );
+                int numberOfSetRows = observationManager->computeSortedObservationsWithPartials(
+                            observationTimes, dataIterator->first, dataIterator->second.second.second,
+                            sortedObservations, sortedPartials, startIndex );
+
+                // Check whether results are equal, and output before start index is untouched.
+                BOOST_CHECK_EQUAL( numberOfSetRows, numberOfObservations );
+                BOOST_CHECK_EQUAL( sortedObservations.segment( 0, startIndex ).norm( ), 0.0 );
+                BOOST_CHECK_EQUAL( sortedPartials.block( 0, 0, startIndex, numberOfParameters ).norm( ), 0.0 );
+                for( int i = 0; i < numberOfObservations; i++ )
+                {
+                    BOOST_CHECK_SMALL(
+                                std::fabs( sortedObservations( i + startIndex ) - observationsWithPartials.first( i ) ),
+                                1.0E-15 * std::max( std::fabs( observationsWithPartials.first( i ) ), 1.0 ) );
+
+                    double partialRowNorm = observationsWithPartials.second.row( i ).norm( );
+                    for( int j = 0; j < numberOfParameters; j++ )
+                    {
+                        BOOST_CHECK_SMALL(
+                                    std::fabs( sortedPartials( i + startIndex, j ) -
+                                               observationsWithPartials.second( i, j ) ),
+                                    1.0E-12 * partialRowNorm );
+                    }
+                }
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
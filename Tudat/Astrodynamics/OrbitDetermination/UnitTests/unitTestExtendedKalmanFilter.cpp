@@ -0,0 +1,165 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <limits>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/OrbitDetermination/extendedKalmanFilter.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/UnitTests/orbitDeterminationTestCases.h"
+
+
+namespace tudat
+{
+namespace unit_tests
+{
+BOOST_AUTO_TEST_SUITE( test_extended_kalman_filter )
+
+//! This test checks whether the extended Kalman filter converges to the true state when processing ideal position data,
+//! starting from a perturbed initial state.
+BOOST_AUTO_TEST_CASE( test_ExtendedKalmanFilterFromPosition )
+{
+    //Load spice kernels.
+    std::string kernelsPath = input_output::getSpiceKernelPath( );
+    spice_interface::loadSpiceKernelInTudat( kernelsPath + "de-403-masses.tpc");
+    spice_interface::loadSpiceKernelInTudat( kernelsPath + "naif0009.tls");
+    spice_interface::loadSpiceKernelInTudat( kernelsPath + "pck00009.tpc");
+    spice_interface::loadSpiceKernelInTudat( kernelsPath + "de421.bsp");
+
+    std::vector< std::string > bodyNames;
+    bodyNames.push_back( "Earth" );
+    bodyNames.push_back( "Mars" );
+    bodyNames.push_back( "Sun" );
+    bodyNames.push_back( "Moon" );
+    bodyNames.push_back( "Jupiter" );
+
+    // Specify initial time
+    double initialEphemerisTime = 1.0E7;
+    double finalEphemerisTime = 1.5E7;
+    double buffer = 10.0 * 3600.0;
+
+    // Create bodies needed in simulation
+    std::map< std::string, boost::shared_ptr< BodySettings > > bodySettings =
+            getDefaultBodySettings( bodyNames, initialEphemerisTime - buffer, finalEphemerisTime + buffer );
+    bodySettings[ "Moon" ]->ephemerisSettings->resetFrameOrigin( "Sun" );
+    NamedBodyMap bodyMap = createBodies( bodySettings );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    // Set accelerations and propagation settings of Earth
+    SelectedAccelerationMap accelerationMap;
+    std::map< std::string, std::vector< boost::shared_ptr< AccelerationSettings > > > accelerationsOfEarth;
+    accelerationsOfEarth[ "Sun" ].push_back( boost::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationsOfEarth[ "Moon" ].push_back( boost::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationsOfEarth[ "Mars" ].push_back( boost::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationsOfEarth[ "Jupiter" ].push_back( boost::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Earth" ] = accelerationsOfEarth;
+
+    std::vector< std::string > bodiesToIntegrate;
+    bodiesToIntegrate.push_back( "Earth" );
+    std::vector< std::string > centralBodies;
+    centralBodies.push_back( "SSB" );
+    std::map< std::string, std::string > centralBodyMap;
+    centralBodyMap[ "Earth" ] = "SSB";
+
+    AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationMap, centralBodyMap );
+
+    // Set initial state of Earth as estimated parameter
+    std::vector< boost::shared_ptr< EstimatableParameterSettings > > parameterNames;
+    parameterNames.push_back( boost::make_shared< InitialTranslationalStateEstimatableParameterSettings< double > >(
+                                  "Earth", propagators::getInitialStateOfBody< double, double >(
+                                      "Earth", "SSB", bodyMap, initialEphemerisTime ), "SSB" ) );
+    boost::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > > parametersToEstimate =
+            createParametersToEstimate< double >( parameterNames, bodyMap );
+
+    boost::shared_ptr< IntegratorSettings< double > > integratorSettings =
+            boost::make_shared< IntegratorSettings< double > >( rungeKutta4, initialEphemerisTime, 900.0 );
+    boost::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            boost::make_shared< TranslationalStatePropagatorSettings< double > >
+            ( centralBodies, accelerationModelMap, bodiesToIntegrate,
+              getInitialStateVectorOfBodiesToEstimate( parametersToEstimate ), finalEphemerisTime );
+
+    // Define position observable of Earth
+    LinkEnds linkEnds;
+    linkEnds[ observed_body ] = std::make_pair( "Earth", "" );
+    observation_models::ObservationSettingsMap observationSettingsMap;
+    observationSettingsMap.insert( std::make_pair( linkEnds, boost::make_shared< ObservationSettings >(
+                                                       position_observable ) ) );
+
+    // Propagate true dynamics and simulate observations
+    OrbitDeterminationManager< double, double > orbitDeterminationManager =
+            OrbitDeterminationManager< double, double >(
+                bodyMap, parametersToEstimate, observationSettingsMap, integratorSettings, propagatorSettings );
+
+    std::vector< double > observationTimes;
+    for( int i = 0; i < 200; i++ )
+    {
+        observationTimes.push_back( initialEphemerisTime + 1.0E4 + static_cast< double >( i ) * 1000.0 );
+    }
+    std::map< ObservableType, std::map< LinkEnds, std::pair< std::vector< double >, LinkEndType > > >
+            measurementSimulationInput;
+    measurementSimulationInput[ position_observable ][ linkEnds ] = std::make_pair( observationTimes, observed_body );
+
+    typedef std::map< LinkEnds, std::pair< Eigen::VectorXd, std::pair< std::vector< double >, LinkEndType > > >
+            SingleObservablePodInputType;
+    std::map< ObservableType, SingleObservablePodInputType > observationsAndTimes =
+            simulateObservations< double, double >(
+                measurementSimulationInput, orbitDeterminationManager.getObservationManagers( ) );
+    Eigen::VectorXd positionObservations = observationsAndTimes[ position_observable ][ linkEnds ].first;
+
+    Eigen::Vector6d finalTrueState =
+            bodyMap.at( "Earth" )->getEphemeris( )->getCartesianState( observationTimes.back( ) );
+
+    // Perturb initial state and create filter
+    Eigen::VectorXd initialStateError = getDefaultInitialParameterPerturbation( ).segment( 0, 6 );
+    parametersToEstimate->resetParameterValues< double >(
+                parametersToEstimate->getFullParameterValues< double >( ) + initialStateError );
+
+    Eigen::MatrixXd initialCovariance = Eigen::MatrixXd::Zero( 6, 6 );
+    initialCovariance.diagonal( ) = initialStateError.cwiseAbs2( );
+    ExtendedKalmanFilter< double, double > extendedKalmanFilter(
+                bodyMap, parametersToEstimate,
+                observation_models::convertUnsortedToSortedObservationSettingsMap( observationSettingsMap ),
+                integratorSettings, propagatorSettings, initialCovariance );
+
+    // Process all observations.
+    Eigen::VectorXd residual;
+    for( unsigned int i = 0; i < observationTimes.size( ); i++ )
+    {
+        residual = extendedKalmanFilter.processObservation(
+                    position_observable, linkEnds, observed_body, observationTimes.at( i ),
+                    positionObservations.segment( 3 * i, 3 ), Eigen::VectorXd::Constant( 3, 1.0 ) );
+    }
+
+    // Check whether filter time and state have converged to true state.
+    BOOST_CHECK_EQUAL( extendedKalmanFilter.getCurrentTime( ), observationTimes.back( ) );
+
+    Eigen::VectorXd finalEstimatedState = extendedKalmanFilter.getCurrentParameterEstimate( );
+    for( unsigned int j = 0; j < 3; j++ )
+    {
+        BOOST_CHECK_SMALL( residual( j ), 1.0 );
+        BOOST_CHECK_SMALL( finalEstimatedState( j ) - finalTrueState( j ), 0.1 );
+        BOOST_CHECK_SMALL( finalEstimatedState( j + 3 ) - finalTrueState( j + 3 ), 1.0E-4 );
+    }
+
+    // Check whether covariance has decreased
+    for( unsigned int j = 0; j < 6; j++ )
+    {
+        BOOST_CHECK( extendedKalmanFilter.getCovarianceMatrix( )( j, j ) < initialCovariance( j, j ) );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+}
+
+}
@@ -0,0 +1,438 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_EXTENDEDKALMANFILTER_H
+#define TUDAT_EXTENDEDKALMANFILTER_H
+
+#include <map>
+#include <vector>
+
+#include <boost/make_shared.hpp>
+
+#include <Eigen/Cholesky>
+
+#include "Tudat/Astrodynamics/ObservationModels/observationManager.h"
+#include "Tudat/Astrodynamics/Propagators/stateTransitionMatrixInterface.h"
+#include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
+#include "Tudat/Mathematics/NumericalIntegrators/reinitializableNumericalIntegrator.h"
+#include "Tudat/SimulationSetup/PropagationSetup/variationalEquationsSolver.h"
+#include "Tudat/SimulationSetup/EstimationSetup/createObservationManager.h"
+
+namespace tudat
+{
+
+namespace simulation_setup
+{
+
+//! Class for recursive orbit determination/parameter estimation with an extended Kalman filter.
+/*!
+ *  Class for recursive orbit determination/parameter estimation with an extended Kalman filter (EKF). The filter state
+ *  consists of the current (i.e. at the current filter time) state of the propagated bodies, and the values of all other
+ *  estimated parameters. Between observation epochs, the equations of motion and variational equations are stepped
+ *  by a single re-initializable numerical integrator, using the DynamicsStateDerivativeModel of the propagation. After
+ *  each measurement update, the integrator is reset to the updated state, with the state transition matrix set to identity
+ *  and the sensitivity matrix to zero, so that the processing time per measurement is independent of the arc length.
+ *  Observations and their partials are computed by the same observation managers as used by the
+ *  OrbitDeterminationManager, with the partials taken w.r.t. the state at the observation epoch.
+ *
+ *  The propagated bodies must have a tabulated ephemeris, which is reset by this class from the most recently propagated
+ *  states (using a fixed number of states), so that the observation models are consistent with the filter state.
+ *  Consequently, the light-time solution should only require the states of the propagated bodies up to the observation
+ *  time (e.g. observations with the propagated body as transmitter should be referenced to the reception time).
+ */
+template< typename ObservationScalarType = double, typename TimeType = double, typename TimeStepType = TimeType >
+class ExtendedKalmanFilter
+{
+public:
+
+    //! Typedef for vector of observations.
+    typedef Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > ObservationVectorType;
+
+    //! Typedef for vector of parameters.
+    typedef Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > ParameterVectorType;
+
+    //! Typedef for the state of the numerical integrator (state transition, sensitivity matrices and state)
+    typedef Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, Eigen::Dynamic > IntegratedStateType;
+
+    //! Constructor
+    /*!
+     *  Constructor, creates the objects required for the propagation of the state and variational equations, and for the
+     *  computation of the observations and their partials.
+     *  \param bodyMap Map of body objects with names of bodies, storing all environment models used in simulation.
+     *  \param parametersToEstimate Container object for all parameters that are to be estimated. The initial states
+     *  in this object define the initial filter state (at the initial time of the integrator settings).
+     *  \param observationSettingsMap Sets of observation model settings per link ends (i.e. transmitter, receiver, etc.)
+     *  per observable type for which measurement data is to be provided.
+     *  \param integratorSettings Settings for numerical integrator (must define a re-initializable integrator).
+     *  \param propagatorSettings Settings for propagator.
+     *  \param initialCovarianceMatrix Covariance matrix of the initial filter state.
+     *  \param processNoiseCovariancePerUnitTime Covariance matrix of the process noise that is added to the filter state
+     *  per unit of time (none if empty).
+     *  \param numberOfStoredStates Number of most recently propagated states that are used to reset the ephemerides of the
+     *  propagated bodies (at least 8).
+     */
+    ExtendedKalmanFilter(
+            const NamedBodyMap& bodyMap,
+            const boost::shared_ptr< estimatable_parameters::EstimatableParameterSet< ObservationScalarType > >
+            parametersToEstimate,
+            const observation_models::SortedObservationSettingsMap& observationSettingsMap,
+            const boost::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings,
+            const boost::shared_ptr< propagators::PropagatorSettings< ObservationScalarType > > propagatorSettings,
+            const Eigen::MatrixXd& initialCovarianceMatrix,
+            const Eigen::MatrixXd& processNoiseCovariancePerUnitTime = Eigen::MatrixXd::Zero( 0, 0 ),
+            const unsigned int numberOfStoredStates = 12 ):
+        parametersToEstimate_( parametersToEstimate ),
+        covarianceMatrix_( initialCovarianceMatrix ),
+        processNoiseCovariancePerUnitTime_( processNoiseCovariancePerUnitTime ),
+        numberOfStoredStates_( numberOfStoredStates )
+    {
+        stateTransitionMatrixSize_ = parametersToEstimate_->getInitialDynamicalStateParameterSize( );
+        parameterVectorSize_ = parametersToEstimate_->getParameterSetSize( );
+
+        // Check input consistency
+        if( stateTransitionMatrixSize_ == 0 )
+        {
+            throw std::runtime_error( "Error when creating extended Kalman filter, no initial states are estimated" );
+        }
+
+        if( ( covarianceMatrix_.rows( ) != parameterVectorSize_ ) || ( covarianceMatrix_.cols( ) != parameterVectorSize_ ) )
+        {
+            throw std::runtime_error( "Error when creating extended Kalman filter, initial covariance size is inconsistent" );
+        }
+
+        if( processNoiseCovariancePerUnitTime_.rows( ) == 0 )
+        {
+            processNoiseCovariancePerUnitTime_ = Eigen::MatrixXd::Zero( parameterVectorSize_, parameterVectorSize_ );
+        }
+        else if( ( processNoiseCovariancePerUnitTime_.rows( ) != parameterVectorSize_ ) ||
+                 ( processNoiseCovariancePerUnitTime_.cols( ) != parameterVectorSize_ ) )
+        {
+            throw std::runtime_error( "Error when creating extended Kalman filter, process noise size is inconsistent" );
+        }
+
+        if( numberOfStoredStates_ < minimumNumberOfStoredStates_ )
+        {
+            throw std::runtime_error( "Error when creating extended Kalman filter, too few states are stored" );
+        }
+
+        // Create objects for propagation of dynamics and variational equations, without propagating.
+        variationalEquationsSolver_ = boost::make_shared< propagators::SingleArcVariationalEquationsSolver
+                < ObservationScalarType, TimeType > >(
+                    bodyMap, integratorSettings, propagatorSettings, parametersToEstimate_, 1,
+                    boost::shared_ptr< numerical_integrators::IntegratorSettings< double > >( ), 1, 0 );
+        dynamicsSimulator_ = variationalEquationsSolver_->getDynamicsSimulator( );
+        dynamicsStateDerivative_ = dynamicsSimulator_->getDynamicsStateDerivative( );
+        dynamicsStateDerivative_->updateStateDerivativeModelSettings( propagatorSettings->getInitialStates( ) );
+        dynamicsStateDerivative_->setPropagationSettings(
+                    std::vector< propagators::IntegratedStateType >( ), 1, 1 );
+
+        // Set initial filter state.
+        currentTime_ = integratorSettings->initialTime_;
+        currentParameterEstimate_ = parametersToEstimate_->template getFullParameterValues< ObservationScalarType >( );
+        storedStateHistory_[ currentTime_ ] = currentParameterEstimate_.segment( 0, stateTransitionMatrixSize_ );
+
+        // Create re-initializable integrator for dynamics and variational equations.
+        boost::shared_ptr< numerical_integrators::NumericalIntegrator<
+                TimeType, IntegratedStateType, IntegratedStateType, TimeStepType > > integrator =
+                numerical_integrators::createIntegrator< TimeType, IntegratedStateType, TimeStepType >(
+                    dynamicsSimulator_->getStateDerivativeFunction( ), getReinitializedIntegratedState( ),
+                    integratorSettings );
+        integrator_ = boost::dynamic_pointer_cast< numerical_integrators::ReinitializableNumericalIntegrator<
+                TimeType, IntegratedStateType, IntegratedStateType, TimeStepType > >( integrator );
+        if( integrator_ == NULL )
+        {
+            throw std::runtime_error( "Error when creating extended Kalman filter, integrator is not re-initializable" );
+        }
+
+        // Create observation managers, with partials w.r.t. current state.
+        stateTransitionAndSensitivityMatrixInterface_ = boost::make_shared<
+                propagators::CurrentEpochCombinedStateTransitionAndSensitivityMatrixInterface >(
+                    stateTransitionMatrixSize_, parameterVectorSize_ );
+        for( observation_models::SortedObservationSettingsMap::const_iterator observablesIterator =
+             observationSettingsMap.begin( ); observablesIterator != observationSettingsMap.end( ); observablesIterator++ )
+        {
+            observationManagers_[ observablesIterator->first ] =
+                    observation_models::createObservationManagerBase< ObservationScalarType, TimeType >(
+                        observablesIterator->first, observablesIterator->second, bodyMap, parametersToEstimate_,
+                        stateTransitionAndSensitivityMatrixInterface_ );
+        }
+    }
+
+    //! Function to propagate the filter state and covariance to a given time.
+    /*!
+     *  Function to propagate the filter state and covariance to a given time (which may not be before the current
+     *  filter time), by stepping the numerical integrator of the dynamics and variational equations. The covariance is
+     *  propagated with the resulting state transition and sensitivity matrices, after which these matrices are reset.
+     *  \param newTime Time to which the filter is to be propagated.
+     */
+    void propagateToTime( const TimeType newTime )
+    {
+        if( newTime < currentTime_ )
+        {
+            throw std::runtime_error( "Error when propagating extended Kalman filter, cannot propagate backwards in time" );
+        }
+        else if( !( currentTime_ < newTime ) )
+        {
+            return;
+        }
+
+        TimeType previousTime = currentTime_;
+        while( currentTime_ < newTime )
+        {
+            // Limit step, so that the final step ends at the requested time, and enough states are stored.
+            TimeStepType remainingTime = static_cast< TimeStepType >( newTime - currentTime_ );
+            TimeStepType stepSize = integrator_->getNextStepSize( );
+            if( storedStateHistory_.size( ) < minimumNumberOfStoredStates_ )
+            {
+                stepSize = std::min( stepSize, remainingTime / static_cast< TimeStepType >(
+                                         minimumNumberOfStoredStates_ - storedStateHistory_.size( ) ) );
+            }
+            stepSize = std::min( stepSize, remainingTime );
+
+            integrator_->performIntegrationStep( stepSize );
+            currentTime_ = integrator_->getCurrentIndependentVariable( );
+
+            // Store propagated state, and remove oldest state if needed
+            storedStateHistory_[ currentTime_ ] = dynamicsStateDerivative_->convertToOutputSolution(
+                        integrator_->getCurrentState( ).col( parameterVectorSize_ ), currentTime_ );
+            if( storedStateHistory_.size( ) > numberOfStoredStates_ )
+            {
+                storedStateHistory_.erase( storedStateHistory_.begin( ) );
+            }
+        }
+
+        // Propagate covariance with state transition and sensitivity matrices since previous reset.
+        IntegratedStateType currentIntegratedState = integrator_->getCurrentState( );
+        Eigen::MatrixXd stateTransitionMatrix = Eigen::MatrixXd::Identity( parameterVectorSize_, parameterVectorSize_ );
+        stateTransitionMatrix.block( 0, 0, stateTransitionMatrixSize_, parameterVectorSize_ ) =
+                currentIntegratedState.block( 0, 0, stateTransitionMatrixSize_, parameterVectorSize_ ).
+                template cast< double >( );
+        covarianceMatrix_ = stateTransitionMatrix * covarianceMatrix_ * stateTransitionMatrix.transpose( ) +
+                processNoiseCovariancePerUnitTime_ * static_cast< double >( currentTime_ - previousTime );
+
+        currentParameterEstimate_.segment( 0, stateTransitionMatrixSize_ ) =
+                storedStateHistory_.rbegin( )->second;
+
+        // Reset state transition and sensitivity matrices, and environment
+        integrator_->modifyCurrentState( getReinitializedIntegratedState( ) );
+        resetEnvironment( );
+    }
+
+    //! Function to process a single group of observations, i.e. of single observable and link ends at a single time.
+    /*!
+     *  Function to process a single group of observations, i.e. of single observable and link ends at a single time,
+     *  propagating the filter to the observation time, and then performing the measurement update of the filter state
+     *  and covariance.
+     *  \param observableType Type of observable that is to be processed
+     *  \param linkEnds Link ends of observation that is to be processed
+     *  \param referenceLinkEnd Link end at which observation time is defined
+     *  \param observationTime Time at which observation is defined (may not be before the current filter time).
+     *  \param observation Value of observation that is to be processed
+     *  \param observationWeights Weights (inverse of variance) of the entries of observation
+     *  \return Pre-fit residual of the observation.
+     */
+    Eigen::VectorXd processObservation(
+            const observation_models::ObservableType observableType,
+            const observation_models::LinkEnds& linkEnds,
+            const observation_models::LinkEndType referenceLinkEnd,
+            const TimeType observationTime,
+            const ObservationVectorType& observation,
+            const Eigen::VectorXd& observationWeights )
+    {
+        if( observationManagers_.count( observableType ) == 0 )
+        {
+            throw std::runtime_error( "Error when processing observation in extended Kalman filter, observable type " +
+                                      boost::lexical_cast< std::string >( observableType ) + " not found" );
+        }
+
+        if( observationWeights.rows( ) != observation.rows( ) )
+        {
+            throw std::runtime_error( "Error when processing observation in extended Kalman filter, "
+                                      "weights size is inconsistent" );
+        }
+
+        // Propagate to observation time.
+        propagateToTime( observationTime );
+
+        if( storedStateHistory_.size( ) < minimumNumberOfStoredStates_ )
+        {
+            throw std::runtime_error( "Error when processing observation in extended Kalman filter, observation time "
+                                      "coincides with initial time" );
+        }
+
+        // Compute predicted observation, and partials w.r.t. current filter state.
+        computedObservation_.resize( observation.rows( ) );
+        observationPartials_.resize( observation.rows( ), parameterVectorSize_ );
+        observationManagers_.at( observableType )->computeSortedObservationsWithPartials(
+                    std::vector< TimeType >( 1, observationTime ), linkEnds, referenceLinkEnd,
+                    computedObservation_, observationPartials_, 0 );
+        Eigen::VectorXd residual = ( observation - computedObservation_ ).template cast< double >( );
+
+        // Compute Kalman gain
+        Eigen::MatrixXd observationCovariance = observationWeights.cwiseInverse( ).asDiagonal( );
+        Eigen::MatrixXd innovationCovariance =
+                observationPartials_ * covarianceMatrix_ * observationPartials_.transpose( ) + observationCovariance;
+        Eigen::MatrixXd kalmanGain = innovationCovariance.ldlt( ).solve(
+                    observationPartials_ * covarianceMatrix_ ).transpose( );
+
+        // Update state and covariance (Joseph form).
+        currentParameterEstimate_ += ( kalmanGain * residual ).template cast< ObservationScalarType >( );
+        Eigen::MatrixXd covarianceReductionMatrix =
+                Eigen::MatrixXd::Identity( parameterVectorSize_, parameterVectorSize_ ) - kalmanGain * observationPartials_;
+        covarianceMatrix_ = covarianceReductionMatrix * covarianceMatrix_ * covarianceReductionMatrix.transpose( ) +
+                kalmanGain * observationCovariance * kalmanGain.transpose( );
+
+        // Reset parameters, state of integrator and environment to new estimate
+        parametersToEstimate_->template resetParameterValues< ObservationScalarType >( currentParameterEstimate_ );
+        storedStateHistory_.rbegin( )->second = currentParameterEstimate_.segment( 0, stateTransitionMatrixSize_ );
+        integrator_->modifyCurrentState( getReinitializedIntegratedState( ) );
+        resetEnvironment( );
+
+        return residual;
+    }
+
+    //! Function to retrieve the current filter time
+    /*!
+     *  Function to retrieve the current filter time
+     *  \return Current filter time
+     */
+    TimeType getCurrentTime( )
+    {
+        return currentTime_;
+    }
+
+    //! Function to retrieve the current estimate of the filter state
+    /*!
+     *  Function to retrieve the current estimate of the filter state, with the initial state entries of the estimated
+     *  parameters replaced by the state at the current filter time.
+     *  \return Current estimate of the filter state
+     */
+    ParameterVectorType getCurrentParameterEstimate( )
+    {
+        return currentParameterEstimate_;
+    }
+
+    //! Function to retrieve the current covariance matrix of the filter state
+    /*!
+     *  Function to retrieve the current covariance matrix of the filter state
+     *  \return Current covariance matrix of the filter state
+     */
+    Eigen::MatrixXd getCovarianceMatrix( )
+    {
+        return covarianceMatrix_;
+    }
+
+    //! Function to retrieve map of all observation managers
+    /*!
+     *  Function to retrieve map of all observation managers, which compute partials w.r.t. the current filter state.
+     *  \return Map of observation managers for all observable types that are processed by the filter.
+     */
+    std::map< observation_models::ObservableType,
+    boost::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > >
+    getObservationManagers( ) const
+    {
+        return observationManagers_;
+    }
+
+protected:
+
+    //! Function to create the state of the integrator from the current estimate, with reset variational equations.
+    /*!
+     *  Function to create the state of the integrator [Phi S x] from the current estimate of the propagated state x,
+     *  with the state transition matrix Phi set to identity and the sensitivity matrix S set to zero.
+     *  \return State of the integrator, with reset variational equations.
+     */
+    IntegratedStateType getReinitializedIntegratedState( )
+    {
+        IntegratedStateType integratedState = IntegratedStateType::Zero(
+                    stateTransitionMatrixSize_, parameterVectorSize_ + 1 );
+        integratedState.block( 0, 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_ ).setIdentity( );
+        integratedState.block( 0, parameterVectorSize_, stateTransitionMatrixSize_, 1 ) =
+                dynamicsStateDerivative_->convertFromOutputSolution(
+                    currentParameterEstimate_.segment( 0, stateTransitionMatrixSize_ ), currentTime_ );
+        return integratedState;
+    }
+
+    //! Function to reset the ephemerides of the propagated bodies from the most recent propagated states.
+    void resetEnvironment( )
+    {
+        if( storedStateHistory_.size( ) >= minimumNumberOfStoredStates_ )
+        {
+            dynamicsSimulator_->manuallySetAndProcessRawNumericalEquationsOfMotionSolution( storedStateHistory_ );
+        }
+    }
+
+    //! Container object for all parameters that are to be estimated
+    boost::shared_ptr< estimatable_parameters::EstimatableParameterSet< ObservationScalarType > > parametersToEstimate_;
+
+    //! Current estimate of the filter state (propagated state at current time, and other parameters).
+    ParameterVectorType currentParameterEstimate_;
+
+    //! Current covariance matrix of the filter state.
+    Eigen::MatrixXd covarianceMatrix_;
+
+    //! Covariance matrix of the process noise that is added to the filter state per unit of time.
+    Eigen::MatrixXd processNoiseCovariancePerUnitTime_;
+
+    //! Current filter time.
+    TimeType currentTime_;
+
+    //! Size of state transition matrix (size of propagated state).
+    int stateTransitionMatrixSize_;
+
+    //! Size of the vector of estimated parameters (size of filter state).
+    int parameterVectorSize_;
+
+    //! Number of most recently propagated states that are used to reset the ephemerides of the propagated bodies.
+    unsigned int numberOfStoredStates_;
+
+    //! Minimum number of states required to reset the ephemerides of the propagated bodies.
+    static const unsigned int minimumNumberOfStoredStates_ = 8;
+
+    //! Most recently propagated states, used to reset the ephemerides of the propagated bodies.
+    std::map< TimeType, Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > storedStateHistory_;
+
+    //! Object used to create the objects for the propagation of dynamics and variational equations
+    boost::shared_ptr< propagators::SingleArcVariationalEquationsSolver< ObservationScalarType, TimeType > >
+    variationalEquationsSolver_;
+
+    //! Object used to propagate dynamics and process the propagated states.
+    boost::shared_ptr< propagators::SingleArcDynamicsSimulator< ObservationScalarType, TimeType > > dynamicsSimulator_;
+
+    //! Object used to compute the derivative of the dynamics and variational equations.
+    boost::shared_ptr< propagators::DynamicsStateDerivativeModel< TimeType, ObservationScalarType > >
+    dynamicsStateDerivative_;
+
+    //! Numerical integrator that is used to step the dynamics and variational equations.
+    boost::shared_ptr< numerical_integrators::ReinitializableNumericalIntegrator<
+    TimeType, IntegratedStateType, IntegratedStateType, TimeStepType > > integrator_;
+
+    //! Object returning state transition/sensitivity matrices w.r.t. current state, used for observation partials.
+    boost::shared_ptr< propagators::CombinedStateTransitionAndSensitivityMatrixInterface >
+    stateTransitionAndSensitivityMatrixInterface_;
+
+    //! List of object that compute the values/partials of the observables
+    std::map< observation_models::ObservableType,
+    boost::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > >
+    observationManagers_;
+
+    //! Pre-declared vector of predicted observations.
+    ObservationVectorType computedObservation_;
+
+    //! Pre-declared matrix of observation partials w.r.t. filter state.
+    Eigen::MatrixXd observationPartials_;
+
+};
+
+}
+
+}
+
+#endif // TUDAT_EXTENDEDKALMANFILTER_H
@@ -13,10 +13,12 @@
 
 #include <algorithm>
 
+#include <boost/bind.hpp>
 #include <boost/make_shared.hpp>
 
 #include "Tudat/InputOutput/basicInputOutput.h"
 #include "Tudat/Mathematics/BasicMathematics/leastSquaresEstimation.h"
+#include "Tudat/Mathematics/BasicMathematics/squareRootInformationFilter.h"
 #include "Tudat/Astrodynamics/ObservationModels/observationManager.h"
 #include "Tudat/Astrodynamics/OrbitDetermination/podInputOutputTypes.h"
 #include "Tudat/SimulationSetup/PropagationSetup/variationalEquationsSolver.h"
@@ -324,8 +326,10 @@ public:
         // Declare variable denoting current index in vector of all observations.
         int startIndex = 0;
 
+        // Initialize vector of computed observations, set directly by observation managers.
+        ObservationVectorType computedObservations = ObservationVectorType::Zero( totalObservationSize );
+
         // Iterate over all observable types in observationsAndTimes
-        std::vector< TimeType > simulationInputTime;
         for( typename PodInputType::const_iterator observablesIterator = observationsAndTimes.begin( );
              observablesIterator != observationsAndTimes.end( ); observablesIterator++ )
         {
@@ -333,23 +337,33 @@ public:
             for( typename SingleObservablePodInputType::const_iterator dataIterator = observablesIterator->second.begin( );
                  dataIterator != observablesIterator->second.end( ); dataIterator++  )
             {
-                simulationInputTime.clear( );
-                simulationInputTime = dataIterator->second.second.first;
+                const std::vector< TimeType >& simulationInputTime = dataIterator->second.second.first;
 
-                // Compute estimated ranges and range partials from current parameter estimate.
-                std::pair< ObservationVectorType, Eigen::MatrixXd > observationsWithPartials;
-                observationsWithPartials = observationManagers_[ observablesIterator->first ]->
-                        computeObservationsWithPartials(
-                            simulationInputTime, dataIterator->first, dataIterator->second.second.second );
+                // Compute estimated observations and partials from current parameter estimate.
+                if( std::is_sorted( simulationInputTime.begin( ), simulationInputTime.end( ) ) )
+                {
+                    // Write observations and partials directly into full vector/matrix.
+                    observationManagers_[ observablesIterator->first ]->computeSortedObservationsWithPartials(
+                                simulationInputTime, dataIterator->first, dataIterator->second.second.second,
+                                computedObservations, residualsAndPartials.second, startIndex );
+                }
+                else
+                {
+                    std::pair< ObservationVectorType, Eigen::MatrixXd > observationsWithPartials =
+                            observationManagers_[ observablesIterator->first ]->computeObservationsWithPartials(
+                                simulationInputTime, dataIterator->first, dataIterator->second.second.second );
+
+                    computedObservations.segment( startIndex, dataIterator->second.first.size( ) ) =
+                            observationsWithPartials.first;
+                    residualsAndPartials.second.block(
+                                startIndex, 0, dataIterator->second.first.size( ), parameterVectorSize ) =
+                            observationsWithPartials.second;
+                }
 
                 // Compute residuals for current link ends and observabel type.
                 residualsAndPartials.first.segment( startIndex, dataIterator->second.first.size( ) ) =
-                        ( dataIterator->second.first - observationsWithPartials.first ).template cast< double >( );
-
-
-                // Set current observation partials in matrix of all partials
-                residualsAndPartials.second.block( startIndex, 0, dataIterator->second.first.size( ), parameterVectorSize ) =
-                        observationsWithPartials.second;
+                        ( dataIterator->second.first - computedObservations.segment(
+                              startIndex, dataIterator->second.first.size( ) ) ).template cast< double >( );
 
                 // Increment current index of observation.
                 startIndex += dataIterator->second.first.size( );
@@ -534,6 +548,437 @@ public:
                     bestInverseNormalizedCovarianceMatrix, bestResidual );
     }
 
+    //! Function to perform parameter estimation from measurement data, processing observations sequentially.
+    /*!
+     *  Function to perform parameter estimation, including orbit determination, i.e. body initial states, from measurement
+     *  data, using a square-root information filter (SRIF). In each iteration, the observations are processed in
+     *  time-ordered chunks of (approximately) numberOfObservationTimesPerChunk observation times. For single-arc dynamics,
+     *  the equations of motion and variational equations are integrated arc-by-arc, with each arc extending up to the
+     *  end of the current chunk, continuing from the end of the previous arc (see
+     *  SingleArcVariationalEquationsSolver::integrateVariationalAndDynamicalEquationsToTime). Consequently, only the
+     *  numerical solution, partials and residuals of a single chunk are kept in memory. Each chunk is added to the upper
+     *  triangular square-root information matrix R and vector z by Householder triangularization. In the absence of
+     *  process noise, the result is equal to that of estimateParameters. Process noise is added to the estimated
+     *  parameters between two subsequent chunks, in which case the parameter estimate refers to the values that apply at
+     *  the final chunk.
+     *  The R and z of the best iteration are retained, so that a subsequent call may continue from the current solution
+     *  (with new measurement data), using it as a priori information, instead of that defined in the podInput.
+     *  \param podInput Object containing all measurement data, associated metadata, including measurement weight, and a priori
+     *  estimate for covariance matrix and parameter adjustment.
+     *  \param numberOfObservationTimesPerChunk Number of observation times that are processed in a single chunk
+     *  (observations at equal times are always processed in the same chunk).
+     *  \param processNoiseVariances Variances of process noise that is added to each of the estimated parameters between
+     *  two subsequent chunks (none if empty).
+     *  \param convergenceChecker Object used to check convergence/termination of algorithm
+     *  \param continueFromPreviousSequentialEstimation Boolean denoting whether the R and z of the previous call of this
+     *  function are used as a priori information (relinearized about the current parameter estimate). If true, the
+     *  a priori covariance in the podInput is not used.
+     *  \param saveResiduals Boolean denoting whether the residuals of all observations are stored in the output (if false,
+     *  only the residuals of the current chunk are kept in memory).
+     *  \param printOutput Boolean denoting whether to print output to th terminal when running the estimation.
+     *  \param arcEndTimeBuffer Time interval beyond the end of each chunk over which the equations of motion are
+     *  integrated in the arc of the chunk (in addition to a fixed number of steps). Should be at least the maximum light
+     *  time of the observations, since the states of the estimated bodies may be required at link end times that differ
+     *  from the observation times by the light time. An error is thrown if the observations of a chunk require states
+     *  outside of the integrated arc.
+     *  \return Object containing estimated parameter value and associateed data, such as residuals. Since the full
+     *  partials matrix is never stored, the information matrix in the output is empty.
+     */
+    boost::shared_ptr< PodOutput< ObservationScalarType > > estimateParametersSequentially(
+            const boost::shared_ptr< PodInput< ObservationScalarType, TimeType > >& podInput,
+            const int numberOfObservationTimesPerChunk = 1000,
+            const Eigen::VectorXd& processNoiseVariances = Eigen::VectorXd::Zero( 0 ),
+            const boost::shared_ptr< EstimationConvergenceChecker > convergenceChecker =
+            boost::make_shared< EstimationConvergenceChecker >( ),
+            const bool continueFromPreviousSequentialEstimation = false,
+            const bool saveResiduals = true,
+            const bool printOutput = 1,
+            const double arcEndTimeBuffer = 0.0 )
+    {
+        using namespace observation_models;
+
+        if( numberOfObservationTimesPerChunk <= 0 )
+        {
+            throw std::runtime_error( "Error when performing sequential estimation, chunk size must be positive" );
+        }
+
+        if( continueFromPreviousSequentialEstimation && ( sequentialSquareRootInformationMatrix_.rows( ) == 0 ) )
+        {
+            throw std::runtime_error(
+                        "Error when performing sequential estimation, no previous sequential estimation to continue from" );
+        }
+
+        // Get size of parameter vector and number of observations
+        int parameterVectorSize = currentParameterEstimate_.size( );
+        int totalNumberOfObservations =
+                getNumberOfObservationsPerObservable( podInput->getObservationsAndTimes( ) ).second;
+
+        if( ( processNoiseVariances.rows( ) != 0 ) && ( processNoiseVariances.rows( ) != parameterVectorSize ) )
+        {
+            throw std::runtime_error( "Error when performing sequential estimation, size of process noise is inconsistent" );
+        }
+
+        // Retrieve time-ordered indices of observation times and weights for each observable and set of link ends, and
+        // concatenated list of all observation times.
+        const PodInputType& observationsAndTimes = podInput->getObservationsAndTimes( );
+        std::vector< std::vector< int > > timeOrderedIndices;
+        std::vector< int > observationSizes;
+        std::vector< int > startIndices;
+        std::vector< const Eigen::VectorXd* > observationWeights;
+        std::vector< TimeType > allObservationTimes;
+        int currentStartIndex = 0;
+        for( typename PodInputType::const_iterator observablesIterator = observationsAndTimes.begin( );
+             observablesIterator != observationsAndTimes.end( ); observablesIterator++ )
+        {
+            for( typename SingleObservablePodInputType::const_iterator dataIterator = observablesIterator->second.begin( );
+                 dataIterator != observablesIterator->second.end( ); dataIterator++  )
+            {
+                const std::vector< TimeType >& currentTimes = dataIterator->second.second.first;
+                std::vector< int > currentIndices;
+                for( unsigned int i = 0; i < currentTimes.size( ); i++ )
+                {
+                    currentIndices.push_back( i );
+                }
+                std::stable_sort( currentIndices.begin( ), currentIndices.end( ),
+                                  boost::bind( &OrbitDeterminationManager::compareObservationTimes,
+                                               boost::cref( currentTimes ), _1, _2 ) );
+                timeOrderedIndices.push_back( currentIndices );
+
+                observationSizes.push_back(
+                            ( currentTimes.size( ) == 0 ) ? 0 : dataIterator->second.first.size( ) / currentTimes.size( ) );
+                startIndices.push_back( currentStartIndex );
+                currentStartIndex += dataIterator->second.first.size( );
+                observationWeights.push_back(
+                            &( podInput->getWeightsMatrixDiagonals( ).at( observablesIterator->first ).at(
+                                   dataIterator->first ) ) );
+
+                allObservationTimes.insert( allObservationTimes.end( ), currentTimes.begin( ), currentTimes.end( ) );
+            }
+        }
+        std::sort( allObservationTimes.begin( ), allObservationTimes.end( ) );
+
+        // Set times at which the chunks end (observations before, but not at, this time are in the chunk).
+        std::vector< TimeType > chunkEndTimes;
+        for( unsigned int i = numberOfObservationTimesPerChunk; i < allObservationTimes.size( );
+             i += numberOfObservationTimesPerChunk )
+        {
+            if( ( chunkEndTimes.size( ) == 0 ) || ( chunkEndTimes.back( ) < allObservationTimes.at( i ) ) )
+            {
+                chunkEndTimes.push_back( allObservationTimes.at( i ) );
+            }
+        }
+        allObservationTimes.clear( );
+
+        // Retrieve object for arc-wise integration of variational equations (if single-arc dynamics are estimated).
+        boost::shared_ptr< propagators::SingleArcVariationalEquationsSolver< ObservationScalarType, TimeType > >
+                arcWiseVariationalEquationsSolver;
+        if( integrateAndEstimateOrbit_ )
+        {
+            arcWiseVariationalEquationsSolver = boost::dynamic_pointer_cast<
+                    propagators::SingleArcVariationalEquationsSolver< ObservationScalarType, TimeType > >(
+                        variationalEquationsSolver_ );
+        }
+
+        // Retrieve a priori information from previous call, if required.
+        Eigen::MatrixXd aPrioriSquareRootInformationMatrix;
+        Eigen::VectorXd aPrioriSquareRootInformationVector;
+        ParameterVectorType aPrioriReferenceParameters;
+        Eigen::VectorXd aPrioriTransformationData;
+        if( continueFromPreviousSequentialEstimation )
+        {
+            aPrioriSquareRootInformationMatrix = sequentialSquareRootInformationMatrix_;
+            aPrioriSquareRootInformationVector = sequentialSquareRootInformationVector_;
+            aPrioriReferenceParameters = sequentialReferenceParameters_;
+            aPrioriTransformationData = sequentialTransformationData_;
+        }
+
+        // Declare variables to be returned (i.e. results from best iteration)
+        double bestResidual = 1.0E100;
+        ParameterVectorType bestParameterEstimate = ParameterVectorType::Zero( parameterVectorSize );
+        Eigen::VectorXd bestTransformationData = Eigen::VectorXd::Zero( parameterVectorSize );
+        Eigen::VectorXd bestResiduals = Eigen::VectorXd::Zero( saveResiduals ? totalNumberOfObservations : 0 );
+        Eigen::MatrixXd bestInverseNormalizedCovarianceMatrix = Eigen::MatrixXd::Zero( parameterVectorSize, parameterVectorSize );
+
+        // Declare residual bookkeeping variables
+        std::vector< double > rmsResidualHistory;
+        double residualRms;
+
+        // Declare variables for chunk-wise computation of observations and partials.
+        Eigen::VectorXd residuals = Eigen::VectorXd::Zero( saveResiduals ? totalNumberOfObservations : 0 );
+        ObservationVectorType chunkComputedObservations;
+        Eigen::MatrixXd chunkPartials;
+        Eigen::VectorXd chunkResiduals, chunkWeights;
+        std::vector< int > chunkResidualIndices;
+        std::vector< TimeType > currentChunkTimes;
+        std::vector< int > currentIndexInTimeOrder;
+
+        // Set current parameter estimate as both previous and current estimate
+        ParameterVectorType newParameterEstimate = currentParameterEstimate_ +
+                podInput->getInitialParameterDeviationEstimate( );
+        ParameterVectorType oldParameterEstimate = currentParameterEstimate_;
+
+        // Iterate until convergence (at least once)
+        int numberOfIterations = 0;
+        do
+        {
+            // Reset parameter estimate, and restart arc-wise integration of equations of motion and variational
+            // equations (or re-integrate them completely if arc-wise integration is not possible).
+            if( arcWiseVariationalEquationsSolver != NULL )
+            {
+                arcWiseVariationalEquationsSolver->resetParameterEstimateForArcWiseIntegration( newParameterEstimate );
+                currentParameterEstimate_ = newParameterEstimate;
+                observationEvaluationCache_->clearSolutions( );
+                simulation_setup::resetCachedBaseFrameStates( bodyMap_ );
+            }
+            else
+            {
+                resetParameterEstimate( newParameterEstimate, true );
+            }
+            oldParameterEstimate = newParameterEstimate;
+
+            if( printOutput )
+            {
+                std::cout<<"Sequentially processing residuals and partials "<<totalNumberOfObservations<<std::endl;
+            }
+
+            // Initialize filter from a priori information of previous call, relinearized about current estimate.
+            boost::shared_ptr< linear_algebra::SquareRootInformationFilter > squareRootInformationFilter;
+            Eigen::VectorXd transformationData;
+            if( continueFromPreviousSequentialEstimation )
+            {
+                transformationData = aPrioriTransformationData;
+                squareRootInformationFilter = boost::make_shared< linear_algebra::SquareRootInformationFilter >(
+                            aPrioriSquareRootInformationMatrix, aPrioriSquareRootInformationVector );
+                squareRootInformationFilter->shiftReferenceParameters(
+                            ( oldParameterEstimate - aPrioriReferenceParameters ).template cast< double >( ).cwiseProduct(
+                                transformationData ) );
+            }
+
+            currentIndexInTimeOrder.assign( timeOrderedIndices.size( ), 0 );
+            double residualSum = 1.0;
+            residualRms = 0.0;
+            int numberOfProcessedChunks = 0;
+
+            // Iterate over all chunks
+            for( unsigned int chunk = 0; chunk <= chunkEndTimes.size( ); chunk++ )
+            {
+                // Integrate equations of motion and variational equations over current chunk
+                if( arcWiseVariationalEquationsSolver != NULL )
+                {
+                    if( chunk < chunkEndTimes.size( ) )
+                    {
+                        arcWiseVariationalEquationsSolver->integrateVariationalAndDynamicalEquationsToTime(
+                                    chunkEndTimes.at( chunk ), 16, arcEndTimeBuffer );
+                    }
+                    else
+                    {
+                        arcWiseVariationalEquationsSolver->integrateRemainingVariationalAndDynamicalEquations( );
+                    }
+                }
+
+                // Determine number of observations in current chunk
+                int numberOfChunkObservations = 0;
+                std::vector< int > numberOfChunkTimes( timeOrderedIndices.size( ), 0 );
+                int dataSetIndex = 0;
+                for( typename PodInputType::const_iterator observablesIterator = observationsAndTimes.begin( );
+                     observablesIterator != observationsAndTimes.end( ); observablesIterator++ )
+                {
+                    for( typename SingleObservablePodInputType::const_iterator dataIterator =
+                         observablesIterator->second.begin( ); dataIterator != observablesIterator->second.end( );
+                         dataIterator++  )
+                    {
+                        const std::vector< TimeType >& currentTimes = dataIterator->second.second.first;
+                        while( ( currentIndexInTimeOrder[ dataSetIndex ] + numberOfChunkTimes[ dataSetIndex ] <
+                                 static_cast< int >( currentTimes.size( ) ) ) &&
+                               ( ( chunk == chunkEndTimes.size( ) ) ||
+                                 ( currentTimes[ timeOrderedIndices[ dataSetIndex ][
+                                   currentIndexInTimeOrder[ dataSetIndex ] + numberOfChunkTimes[ dataSetIndex ] ] ] <
+                                 chunkEndTimes[ chunk ] ) ) )
+                        {
+                            numberOfChunkTimes[ dataSetIndex ]++;
+                        }
+                        numberOfChunkObservations += numberOfChunkTimes[ dataSetIndex ] * observationSizes[ dataSetIndex ];
+                        dataSetIndex++;
+                    }
+                }
+
+                if( numberOfChunkObservations == 0 )
+                {
+                    continue;
+                }
+
+                // Compute observations and partials for current chunk, ordered by observable/link ends, and by time
+                // for each observable/link ends.
+                chunkComputedObservations.resize( numberOfChunkObservations );
+                chunkPartials.resize( numberOfChunkObservations, parameterVectorSize );
+                chunkResiduals.resize( numberOfChunkObservations );
+                chunkWeights.resize( numberOfChunkObservations );
+                chunkResidualIndices.resize( numberOfChunkObservations );
+
+                int chunkIndex = 0;
+                dataSetIndex = 0;
+                for( typename PodInputType::const_iterator observablesIterator = observationsAndTimes.begin( );
+                     observablesIterator != observationsAndTimes.end( ); observablesIterator++ )
+                {
+                    for( typename SingleObservablePodInputType::const_iterator dataIterator =
+                         observablesIterator->second.begin( ); dataIterator != observablesIterator->second.end( );
+                         dataIterator++  )
+                    {
+                        if( numberOfChunkTimes[ dataSetIndex ] > 0 )
+                        {
+                            currentChunkTimes.clear( );
+                            int currentObservationSize = observationSizes[ dataSetIndex ];
+                            for( int i = 0; i < numberOfChunkTimes[ dataSetIndex ]; i++ )
+                            {
+                                int observationIndex = timeOrderedIndices[ dataSetIndex ][
+                                        currentIndexInTimeOrder[ dataSetIndex ] + i ];
+                                currentChunkTimes.push_back( dataIterator->second.second.first[ observationIndex ] );
+                                for( int j = 0; j < currentObservationSize; j++ )
+                                {
+                                    int indexInDataSet = observationIndex * currentObservationSize + j;
+                                    chunkResidualIndices[ chunkIndex + i * currentObservationSize + j ] =
+                                            startIndices[ dataSetIndex ] + indexInDataSet;
+                                    chunkResiduals( chunkIndex + i * currentObservationSize + j ) =
+                                            static_cast< double >( dataIterator->second.first( indexInDataSet ) );
+                                    chunkWeights( chunkIndex + i * currentObservationSize + j ) =
+                                            ( *observationWeights[ dataSetIndex ] )( indexInDataSet );
+                                }
+                            }
+
+                            chunkIndex += observationManagers_[ observablesIterator->first ]->
+                                    computeSortedObservationsWithPartials(
+                                        currentChunkTimes, dataIterator->first, dataIterator->second.second.second,
+                                        chunkComputedObservations, chunkPartials, chunkIndex );
+
+                            // Check whether states of estimated bodies were only required in current arc.
+                            if( arcWiseVariationalEquationsSolver != NULL )
+                            {
+                                std::pair< double, double > statePartialTimeInterval =
+                                        observationManagers_[ observablesIterator->first ]->
+                                        getStatePartialTimeIntervalOfSortedObservations( );
+                                std::pair< double, double > arcInterval =
+                                        arcWiseVariationalEquationsSolver->getCurrentArcSolutionInterval( );
+                                if( ( statePartialTimeInterval.first <= statePartialTimeInterval.second ) &&
+                                        ( ( statePartialTimeInterval.first < arcInterval.first ) ||
+                                          ( statePartialTimeInterval.second > arcInterval.second ) ) )
+                                {
+                                    throw std::runtime_error(
+                                                "Error when performing sequential estimation, observations require states "
+                                                "outside of integrated arc, arc end time buffer should be increased" );
+                                }
+                            }
+                            currentIndexInTimeOrder[ dataSetIndex ] += numberOfChunkTimes[ dataSetIndex ];
+                        }
+                        dataSetIndex++;
+                    }
+                }
+
+                // Compute residuals, and add to residual statistics (and full list of residuals, if required)
+                chunkResiduals -= chunkComputedObservations.template cast< double >( );
+                residualRms += chunkResiduals.cwiseAbs( ).sum( );
+                residualSum += static_cast< double >( numberOfChunkObservations );
+                if( saveResiduals )
+                {
+                    for( int i = 0; i < numberOfChunkObservations; i++ )
+                    {
+                        residuals( chunkResidualIndices[ i ] ) = chunkResiduals( i );
+                    }
+                }
+
+                // Initialize filter, using normalization of partials of first chunk for all chunks.
+                if( squareRootInformationFilter == NULL )
+                {
+                    transformationData = normalizeObservationMatrix( chunkPartials );
+                    for( int i = 0; i < parameterVectorSize; i++ )
+                    {
+                        if( transformationData( i ) == 0.0 )
+                        {
+                            transformationData( i ) = 1.0;
+                            chunkPartials.col( i ).setZero( );
+                        }
+                    }
+
+                    Eigen::MatrixXd normalizedInverseAprioriCovarianceMatrix =
+                            podInput->getInverseOfAprioriCovariance( ).cwiseQuotient(
+                                transformationData * transformationData.transpose( ) );
+                    squareRootInformationFilter = boost::make_shared< linear_algebra::SquareRootInformationFilter >(
+                                normalizedInverseAprioriCovarianceMatrix );
+                }
+                else
+                {
+                    if( ( processNoiseVariances.rows( ) != 0 ) &&
+                            ( ( numberOfProcessedChunks > 0 ) || continueFromPreviousSequentialEstimation ) )
+                    {
+                        squareRootInformationFilter->addProcessNoise(
+                                    processNoiseVariances.cwiseProduct( transformationData.cwiseAbs2( ) ) );
+                    }
+
+                    for( int i = 0; i < parameterVectorSize; i++ )
+                    {
+                        chunkPartials.col( i ) /= transformationData( i );
+                    }
+                }
+
+                // Add current chunk to filter
+                squareRootInformationFilter->processObservations( chunkPartials, chunkResiduals, chunkWeights );
+                numberOfProcessedChunks++;
+            }
+
+            if( numberOfProcessedChunks == 0 )
+            {
+                throw std::runtime_error( "Error when performing sequential estimation, no observations provided" );
+            }
+
+            // Update value of parameter vector
+            ParameterVectorType parameterAddition =
+                    ( squareRootInformationFilter->getParameterAdjustment( ).cwiseQuotient( transformationData ) ).
+                    template cast< ObservationScalarType >( );
+            newParameterEstimate = oldParameterEstimate + parameterAddition;
+
+            if( printOutput )
+            {
+                std::cout<<"Parameter update"<<parameterAddition.transpose( )<<std::endl;
+            }
+
+            // Calculate mean residual for current iteration.
+            residualRms = residualRms / ( residualSum );
+            rmsResidualHistory.push_back( residualRms );
+            if( printOutput )
+            {
+                std::cout<<"Current residual: "<<residualRms<<std::endl;
+            }
+
+            // If current iteration is better than previous one, update 'best' data.
+            if( residualRms < bestResidual )
+            {
+                bestResidual = residualRms;
+                bestParameterEstimate = newParameterEstimate;
+                bestResiduals = residuals;
+                bestTransformationData = transformationData;
+                bestInverseNormalizedCovarianceMatrix = squareRootInformationFilter->getInverseOfCovarianceMatrix( );
+
+                // Retain square-root information system for continuation in subsequent call.
+                sequentialSquareRootInformationMatrix_ = squareRootInformationFilter->getSquareRootInformationMatrix( );
+                sequentialSquareRootInformationVector_ = squareRootInformationFilter->getSquareRootInformationVector( );
+                sequentialReferenceParameters_ = oldParameterEstimate;
+                sequentialTransformationData_ = transformationData;
+            }
+
+            // Increment number of iterations
+            numberOfIterations++;
+
+            // Check for convergence
+        } while( convergenceChecker->isEstimationConverged( numberOfIterations, rmsResidualHistory ) == false );
+
+        std::cout<<"Final residual: "<<bestResidual<<std::endl;
+
+        return boost::make_shared< PodOutput< ObservationScalarType > >(
+                    bestParameterEstimate, bestResiduals, Eigen::MatrixXd::Zero( 0, parameterVectorSize ),
+                    saveResiduals ? Eigen::VectorXd( getConcatenatedWeightsVector( podInput->getWeightsMatrixDiagonals( ) ) ) :
+                                    Eigen::VectorXd::Zero( 0 ),
+                    bestTransformationData, bestInverseNormalizedCovarianceMatrix, bestResidual );
+    }
+
     //! Function to reset the current parameter estimate.
     /*!
      *  Function to reset the current parameter estimate; reintegrates the variational equations and equations of motion with new estimate.
@@ -551,6 +996,10 @@ public:
             parametersToEstimate_->template resetParameterValues< ObservationScalarType>( newParameterEstimate );
         }
         currentParameterEstimate_ = newParameterEstimate;
+
+        // Light-time solutions and memoized states computed with previous estimate are no longer valid.
+        observationEvaluationCache_->clearSolutions( );
+        simulation_setup::resetCachedBaseFrameStates( bodyMap_ );
     }
 
     //! Function to convert from one representation of all measurement data to the other
@@ -681,6 +1130,8 @@ protected:
         using namespace orbit_determination;
         using namespace observation_models;
 
+        bodyMap_ = bodyMap;
+
         // Check if any dynamics is to be estimated
         std::map< propagators::IntegratedStateType, std::vector< std::pair< std::string, std::string > > >
                 initialDynamicalStates =
@@ -720,6 +1171,10 @@ protected:
             throw std::runtime_error( "Error, cannot parse propagator settings without estimating dynamics in OrbitDeterminationManager" );
         }
 
+        // Create cache through which observation models of the same link share light-time solutions.
+        observationEvaluationCache_ =
+                boost::make_shared< ObservationEvaluationCache< ObservationScalarType, TimeType > >( );
+
         // Iterate over all observables and create observation managers.
         for( SortedObservationSettingsMap::const_iterator observablesIterator = observationSettingsMap.begin( );
              observablesIterator != observationSettingsMap.end( ); observablesIterator++ )
@@ -728,13 +1183,30 @@ protected:
             observationManagers_[ observablesIterator->first ] =
                     createObservationManagerBase< ObservationScalarType, TimeType >(
                         observablesIterator->first, observablesIterator->second, bodyMap, parametersToEstimate_,
-                        stateTransitionAndSensitivityMatrixInterface_ );
+                        stateTransitionAndSensitivityMatrixInterface_, observationEvaluationCache_ );
         }
 
         // Set current parameter estimate from body initial states and parameter set.
         currentParameterEstimate_ = parametersToEstimate_->template getFullParameterValues< ObservationScalarType >( );
     }
 
+    //! Function to compare two observation times, used to sort observations in time
+    /*!
+     *  Function to compare two observation times, used to sort observations in time
+     *  \param observationTimes List of observation times
+     *  \param firstIndex Index in observationTimes of first time that is to be compared
+     *  \param secondIndex Index in observationTimes of second time that is to be compared
+     *  \return True if first time is smaller than second time
+     */
+    static bool compareObservationTimes(
+            const std::vector< TimeType >& observationTimes, const int firstIndex, const int secondIndex )
+    {
+        return observationTimes[ firstIndex ] < observationTimes[ secondIndex ];
+    }
+
+    //! Map of body objects with names of bodies, storing all environment models used in simulation.
+    NamedBodyMap bodyMap_;
+
     //! Boolean to denote whether any dynamical parameters are estimated
     bool integrateAndEstimateOrbit_;
 
@@ -756,6 +1228,23 @@ protected:
     boost::shared_ptr< propagators::CombinedStateTransitionAndSensitivityMatrixInterface >
     stateTransitionAndSensitivityMatrixInterface_;
 
+    //! Object through which observation models of the same link share light-time calculators and solutions.
+    boost::shared_ptr< observation_models::ObservationEvaluationCache< ObservationScalarType, TimeType > >
+    observationEvaluationCache_;
+
+    //! Square-root information matrix R (normalized) of the best iteration of the last sequential estimation.
+    Eigen::MatrixXd sequentialSquareRootInformationMatrix_;
+
+    //! Square-root information vector z (normalized) of the best iteration of the last sequential estimation.
+    Eigen::VectorXd sequentialSquareRootInformationVector_;
+
+    //! Parameter values about which the observations were linearized to obtain sequentialSquareRootInformationVector_.
+    ParameterVectorType sequentialReferenceParameters_;
+
+    //! Normalization of the parameters in sequentialSquareRootInformationMatrix_ and
+    //! sequentialSquareRootInformationVector_.
+    Eigen::VectorXd sequentialTransformationData_;
+
 };
 
 
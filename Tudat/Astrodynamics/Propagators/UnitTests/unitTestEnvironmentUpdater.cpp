@@ -594,6 +594,160 @@ BOOST_AUTO_TEST_CASE( test_NonConservativeForceEnvironmentUpdate )
     }
 }
 
+//! Test whether aerodynamic coefficients are updated only when they are used in the propagation.
+BOOST_AUTO_TEST_CASE( test_AerodynamicCoefficientEnvironmentUpdate )
+{
+    double initialTime = 0.0;
+    double finalTime = 20.0;
+
+    using namespace tudat::simulation_setup;
+    using namespace tudat;
+
+    // Load Spice kernels
+    spice_interface::loadSpiceKernelInTudat( input_output::getSpiceKernelPath( ) + "pck00009.tpc" );
+    spice_interface::loadSpiceKernelInTudat( input_output::getSpiceKernelPath( ) + "de-403-masses.tpc" );
+    spice_interface::loadSpiceKernelInTudat( input_output::getSpiceKernelPath( ) + "de421.bsp" );
+
+    // Create bodies
+    std::map< std::string, boost::shared_ptr< BodySettings > > bodySettings;
+    bodySettings[ "Earth" ] = getDefaultSingleBodySettings( "Earth", initialTime - 10.0, finalTime + 10.0 );
+    bodySettings[ "Vehicle" ] = boost::make_shared< BodySettings >( );
+    NamedBodyMap bodyMap = createBodies( bodySettings );
+    bodyMap[ "Vehicle" ]->setAerodynamicCoefficientInterface( getApolloCoefficientInterface( ) );
+    bodyMap[ "Vehicle" ]->setConstantBodyMass( 5.0E3 );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    // Create flight conditions before creating any aerodynamic acceleration.
+    double angleOfAttack = 35.0 * mathematical_constants::PI / 180.0;
+    bodyMap[ "Vehicle" ]->setFlightConditions(
+                createFlightConditions( bodyMap.at( "Vehicle" ), bodyMap.at( "Earth" ), "Vehicle", "Earth",
+                                        boost::lambda::constant( angleOfAttack ),
+                                        boost::lambda::constant( 0.0 ),
+                                        boost::lambda::constant( 0.0 ) ) );
+    boost::shared_ptr< aerodynamics::FlightConditions > vehicleFlightConditions =
+            bodyMap[ "Vehicle" ]->getFlightConditions( );
+    BOOST_CHECK_EQUAL( vehicleFlightConditions->getUpdateAerodynamicCoefficients( ), true );
+
+    // Define propagation settings.
+    std::map< std::string, std::string > centralBodies;
+    centralBodies[ "Vehicle" ] = "Earth";
+    std::vector< std::string > propagatedBodyList;
+    propagatedBodyList.push_back( "Vehicle" );
+    std::vector< std::string > centralBodyList;
+    centralBodyList.push_back( centralBodies[ "Vehicle" ] );
+
+    Eigen::Vector6d initialState = ( Eigen::Vector6d( ) << 6458.0E3, 0.0, 0.0, 0.0, 4.0E3, 0.0 ).finished( );
+    boost::shared_ptr< numerical_integrators::IntegratorSettings< > > integratorSettings =
+            boost::make_shared< numerical_integrators::IntegratorSettings< > >(
+                numerical_integrators::rungeKutta4, initialTime, 1.0 );
+
+    // Create propagation using aerodynamic acceleration with existing flight conditions.
+    SelectedAccelerationMap aerodynamicAccelerationSettingsMap;
+    aerodynamicAccelerationSettingsMap[ "Vehicle" ][ "Earth" ].push_back(
+                boost::make_shared< AccelerationSettings >( central_gravity ) );
+    aerodynamicAccelerationSettingsMap[ "Vehicle" ][ "Earth" ].push_back(
+                boost::make_shared< AccelerationSettings >( aerodynamic ) );
+    AccelerationMap aerodynamicAccelerationsMap = createAccelerationModelsMap(
+                bodyMap, aerodynamicAccelerationSettingsMap, centralBodies );
+    BOOST_CHECK_EQUAL( bodyMap[ "Vehicle" ]->getFlightConditions( ), vehicleFlightConditions );
+
+    std::vector< boost::shared_ptr< SingleDependentVariableSaveSettings > > dependentVariables;
+    dependentVariables.push_back(
+                boost::make_shared< SingleDependentVariableSaveSettings >(
+                    mach_number_dependent_variable, "Vehicle" ) );
+    dependentVariables.push_back(
+                boost::make_shared< BodyAerodynamicAngleVariableSaveSettings >( "Vehicle", angle_of_attack ) );
+    dependentVariables.push_back(
+                boost::make_shared< BodyAerodynamicAngleVariableSaveSettings >( "Vehicle", angle_of_sideslip ) );
+    dependentVariables.push_back(
+                boost::make_shared< SingleDependentVariableSaveSettings >(
+                    airspeed_dependent_variable, "Vehicle" ) );
+    dependentVariables.push_back(
+                boost::make_shared< SingleDependentVariableSaveSettings >(
+                    local_density_dependent_variable, "Vehicle" ) );
+    dependentVariables.push_back(
+                boost::make_shared< SingleAccelerationDependentVariableSaveSettings >(
+                    aerodynamic, "Vehicle", "Earth", 1 ) );
+
+    boost::shared_ptr< PropagatorSettings< double > > aerodynamicPropagatorSettings =
+            boost::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodyList, aerodynamicAccelerationsMap, propagatedBodyList, initialState,
+                boost::make_shared< PropagationTimeTerminationSettings >( finalTime ), cowell,
+                boost::make_shared< DependentVariableSaveSettings >( dependentVariables, false ) );
+    SingleArcDynamicsSimulator< > aerodynamicDynamicsSimulator(
+                bodyMap, integratorSettings, aerodynamicPropagatorSettings, false );
+
+    // Check that coefficients are not updated by propagation that uses only density from flight conditions, and that
+    // the settings of the (shared) flight conditions are not modified.
+    {
+        SelectedAccelerationMap accelerationSettingsMap;
+        accelerationSettingsMap[ "Vehicle" ][ "Earth" ].push_back(
+                    boost::make_shared< AccelerationSettings >( central_gravity ) );
+        AccelerationMap accelerationsMap = createAccelerationModelsMap(
+                    bodyMap, accelerationSettingsMap, centralBodies );
+
+        std::vector< boost::shared_ptr< SingleDependentVariableSaveSettings > > densityDependentVariables;
+        densityDependentVariables.push_back(
+                    boost::make_shared< SingleDependentVariableSaveSettings >(
+                        local_density_dependent_variable, "Vehicle" ) );
+
+        boost::shared_ptr< PropagatorSettings< double > > propagatorSettings =
+                boost::make_shared< TranslationalStatePropagatorSettings< double > >(
+                    centralBodyList, accelerationsMap, propagatedBodyList, initialState,
+                    boost::make_shared< PropagationTimeTerminationSettings >( finalTime ), cowell,
+                    boost::make_shared< DependentVariableSaveSettings >( densityDependentVariables, false ) );
+
+        std::vector< double > coefficientInput;
+        coefficientInput.push_back( 5.0 );
+        coefficientInput.push_back( 0.0 );
+        coefficientInput.push_back( 0.0 );
+        bodyMap[ "Vehicle" ]->getAerodynamicCoefficientInterface( )->updateCurrentCoefficients( coefficientInput );
+        Eigen::Vector3d forceCoefficientsBeforePropagation =
+                bodyMap[ "Vehicle" ]->getAerodynamicCoefficientInterface( )->getCurrentForceCoefficients( );
+
+        SingleArcDynamicsSimulator< > dynamicsSimulator(
+                    bodyMap, integratorSettings, propagatorSettings );
+
+        BOOST_CHECK_EQUAL( ( dynamicsSimulator.getDependentVariableHistory( ).size( ) > 0 ), true );
+        BOOST_CHECK_EQUAL( vehicleFlightConditions->getUpdateAerodynamicCoefficients( ), true );
+        for( unsigned int i = 0; i < 3; i++ )
+        {
+            BOOST_CHECK_EQUAL(
+                        bodyMap[ "Vehicle" ]->getAerodynamicCoefficientInterface( )->getCurrentForceCoefficients( )( i ),
+                        forceCoefficientsBeforePropagation( i ) );
+        }
+    }
+
+    // Check that coefficients are updated for aerodynamic acceleration, after creation of other propagation.
+    {
+        aerodynamicDynamicsSimulator.integrateEquationsOfMotion(
+                    aerodynamicPropagatorSettings->getInitialStates( ) );
+
+        // Compare acceleration with that computed from coefficients at current independent variables.
+        boost::shared_ptr< aerodynamics::AerodynamicCoefficientInterface > coefficientInterface =
+                bodyMap[ "Vehicle" ]->getAerodynamicCoefficientInterface( );
+        std::map< double, Eigen::VectorXd > dependentVariableHistory =
+                aerodynamicDynamicsSimulator.getDependentVariableHistory( );
+        BOOST_CHECK_EQUAL( ( dependentVariableHistory.size( ) > 0 ), true );
+        for( std::map< double, Eigen::VectorXd >::const_iterator variableIterator = dependentVariableHistory.begin( );
+             variableIterator != dependentVariableHistory.end( ); variableIterator++ )
+        {
+            std::vector< double > coefficientInput;
+            coefficientInput.push_back( variableIterator->second( 0 ) );
+            coefficientInput.push_back( variableIterator->second( 1 ) );
+            coefficientInput.push_back( variableIterator->second( 2 ) );
+            coefficientInterface->updateCurrentCoefficients( coefficientInput );
+
+            double expectedAcceleration = 0.5 * variableIterator->second( 4 ) *
+                    variableIterator->second( 3 ) * variableIterator->second( 3 ) *
+                    coefficientInterface->getReferenceArea( ) *
+                    coefficientInterface->getCurrentForceCoefficients( ).norm( ) / 5.0E3;
+            BOOST_CHECK_CLOSE_FRACTION( variableIterator->second( 5 ), expectedAcceleration,
+                                        1.0E-12 );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
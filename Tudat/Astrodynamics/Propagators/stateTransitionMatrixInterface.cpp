@@ -24,25 +24,70 @@ void SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::updateMatrix
 {
     stateTransitionMatrixInterpolator_ = stateTransitionMatrixInterpolator;
     sensitivityMatrixInterpolator_ = sensitivityMatrixInterpolator;
+
+    contiguousStateTransitionMatrixInterpolator_ = boost::dynamic_pointer_cast<
+            interpolators::ContiguousLagrangeInterpolator< double, Eigen::MatrixXd > >( stateTransitionMatrixInterpolator );
+    contiguousSensitivityMatrixInterpolator_ = boost::dynamic_pointer_cast<
+            interpolators::ContiguousLagrangeInterpolator< double, Eigen::MatrixXd > >( sensitivityMatrixInterpolator );
+
+    // Only interpolate directly into combined matrix if sizes of interpolated matrices are consistent.
+    if( contiguousStateTransitionMatrixInterpolator_ != NULL &&
+            ( contiguousStateTransitionMatrixInterpolator_->getNumberOfRows( ) != stateTransitionMatrixSize_ ||
+              contiguousStateTransitionMatrixInterpolator_->getNumberOfColumns( ) != stateTransitionMatrixSize_ ) )
+    {
+        contiguousStateTransitionMatrixInterpolator_.reset( );
+    }
+    if( contiguousSensitivityMatrixInterpolator_ != NULL &&
+            ( contiguousSensitivityMatrixInterpolator_->getNumberOfRows( ) != stateTransitionMatrixSize_ ||
+              contiguousSensitivityMatrixInterpolator_->getNumberOfColumns( ) != sensitivityMatrixSize_ ) )
+    {
+        contiguousSensitivityMatrixInterpolator_.reset( );
+    }
+
+    stateTransitionMatrixCursor_ = interpolators::LookUpCursor( );
+    sensitivityMatrixCursor_ = interpolators::LookUpCursor( );
 }
 
 //! Function to get the concatenated state transition and sensitivity matrix at a given time.
 Eigen::MatrixXd SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::getCombinedStateTransitionAndSensitivityMatrix(
         const double evaluationTime )
 {
-    combinedStateTransitionMatrix_.setZero( );
+    computeFullCombinedStateTransitionAndSensitivityMatrix( evaluationTime, combinedStateTransitionMatrix_ );
+    return combinedStateTransitionMatrix_;
+}
+
+//! Function to compute the concatenated state transition and sensitivity matrix at a given time into an existing matrix.
+void SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::computeFullCombinedStateTransitionAndSensitivityMatrix(
+        const double evaluationTime, Eigen::MatrixXd& combinedMatrix )
+{
+    combinedMatrix.resize( stateTransitionMatrixSize_, stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
+
+    // Interpolate matrices directly into (contiguous) column blocks of combined matrix, if possible.
+    if( contiguousStateTransitionMatrixInterpolator_ != NULL &&
+            ( sensitivityMatrixSize_ == 0 || contiguousSensitivityMatrixInterpolator_ != NULL ) )
+    {
+        contiguousStateTransitionMatrixInterpolator_->interpolate(
+                    evaluationTime, stateTransitionMatrixCursor_, combinedMatrix.data( ) );
+        if( sensitivityMatrixSize_ > 0 )
+        {
+            contiguousSensitivityMatrixInterpolator_->interpolate(
+                        evaluationTime, sensitivityMatrixCursor_,
+                        combinedMatrix.data( ) + stateTransitionMatrixSize_ * stateTransitionMatrixSize_ );
+        }
+        return;
+    }
+
+    combinedMatrix.setZero( );
 
     // Set Phi and S matrices.
-    combinedStateTransitionMatrix_.block( 0, 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_ ) =
+    combinedMatrix.block( 0, 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_ ) =
             stateTransitionMatrixInterpolator_->interpolate( evaluationTime );
 
     if( sensitivityMatrixSize_ > 0 )
     {
-        combinedStateTransitionMatrix_.block( 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_, sensitivityMatrixSize_ ) =
+        combinedMatrix.block( 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_, sensitivityMatrixSize_ ) =
                 sensitivityMatrixInterpolator_->interpolate( evaluationTime );
     }
-
-    return combinedStateTransitionMatrix_;
 }
 
 }
@@ -16,6 +16,7 @@
 
 #include <Eigen/Core>
 
+#include "Tudat/Mathematics/Interpolators/contiguousLagrangeInterpolator.h"
 #include "Tudat/Mathematics/Interpolators/oneDimensionalInterpolator.h"
 
 namespace tudat
@@ -70,6 +71,23 @@ public:
      */
     virtual Eigen::MatrixXd getFullCombinedStateTransitionAndSensitivityMatrix( const double evaluationTime ) = 0;
 
+    //! Function to compute the concatenated state transition and sensitivity matrix at a given time, which includes
+    //! zero values for parameters not active in current arc, into an existing matrix.
+    /*!
+     *  Function to compute the concatenated state transition and sensitivity matrix at a given time, which includes
+     *  zero values for parameters not active in current arc, into an existing matrix. The default implementation
+     *  assigns the output of getFullCombinedStateTransitionAndSensitivityMatrix; derived classes override this function
+     *  to set the matrix without allocating memory, if combinedMatrix already has the correct size.
+     *  \param evaluationTime Time at which to evaluate matrix interpolators
+     *  \param combinedMatrix Concatenated state transition and sensitivity matrices, including inactive parameters at
+     *  evaluationTime (returned by reference, resized if required).
+     */
+    virtual void computeFullCombinedStateTransitionAndSensitivityMatrix(
+            const double evaluationTime, Eigen::MatrixXd& combinedMatrix )
+    {
+        combinedMatrix = getFullCombinedStateTransitionAndSensitivityMatrix( evaluationTime );
+    }
+
     //! Function to get the size of state transition matrix
     /*!
      * Function to get the size of state transition matrix
@@ -130,12 +148,11 @@ public:
             sensitivityMatrixInterpolator,
             const int numberOfInitialDynamicalParameters,
             const int numberOfParameters ):
-        CombinedStateTransitionAndSensitivityMatrixInterface( numberOfInitialDynamicalParameters, numberOfParameters ),
-        stateTransitionMatrixInterpolator_( stateTransitionMatrixInterpolator ),
-        sensitivityMatrixInterpolator_( sensitivityMatrixInterpolator )
+        CombinedStateTransitionAndSensitivityMatrixInterface( numberOfInitialDynamicalParameters, numberOfParameters )
     {
         combinedStateTransitionMatrix_ = Eigen::MatrixXd::Zero(
                         stateTransitionMatrixSize_, stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
+        updateMatrixInterpolators( stateTransitionMatrixInterpolator, sensitivityMatrixInterpolator );
     }
 
     //! Destructor.
@@ -194,6 +211,18 @@ public:
         return getCombinedStateTransitionAndSensitivityMatrix( evaluationTime );
     }
 
+    //! Function to compute the concatenated state transition and sensitivity matrix at a given time into an existing
+    //! matrix.
+    /*!
+     *  Function to compute the concatenated state transition and sensitivity matrix at a given time into an existing
+     *  matrix, interpolating directly into the memory of combinedMatrix if possible.
+     *  \param evaluationTime Time at which to evaluate matrix interpolators
+     *  \param combinedMatrix Concatenated state transition and sensitivity matrices (returned by reference, resized if
+     *  required).
+     */
+    void computeFullCombinedStateTransitionAndSensitivityMatrix(
+            const double evaluationTime, Eigen::MatrixXd& combinedMatrix );
+
     //! Function to get the size of the total parameter vector.
     /*!
      * Function to get the size of the total parameter vector. For single-arc, this is simply the combination of
@@ -218,6 +247,114 @@ private:
     //! Interpolator returning the sensitivity matrix as a function of time.
     boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
     sensitivityMatrixInterpolator_;
+
+    //! Interpolator returning the state transition matrix as a function of time, as contiguous Lagrange interpolator
+    //! (NULL if stateTransitionMatrixInterpolator_ is of a different type).
+    /*!
+     *  Interpolator returning the state transition matrix as a function of time, as contiguous Lagrange interpolator
+     *  (NULL if stateTransitionMatrixInterpolator_ is of a different type). If both this interpolator and
+     *  contiguousSensitivityMatrixInterpolator_ are set, the matrices are interpolated directly into
+     *  combinedStateTransitionMatrix_, without allocating intermediate matrices.
+     */
+    boost::shared_ptr< interpolators::ContiguousLagrangeInterpolator< double, Eigen::MatrixXd > >
+    contiguousStateTransitionMatrixInterpolator_;
+
+    //! Interpolator returning the sensitivity matrix as a function of time, as contiguous Lagrange interpolator
+    //! (NULL if sensitivityMatrixInterpolator_ is of a different type).
+    boost::shared_ptr< interpolators::ContiguousLagrangeInterpolator< double, Eigen::MatrixXd > >
+    contiguousSensitivityMatrixInterpolator_;
+
+    //! Look-up cursor used for interpolating the state transition matrix.
+    interpolators::LookUpCursor stateTransitionMatrixCursor_;
+
+    //! Look-up cursor used for interpolating the sensitivity matrix.
+    interpolators::LookUpCursor sensitivityMatrixCursor_;
+};
+
+//! Interface object returning the state transition and sensitivity matrices w.r.t. the state at the current epoch.
+/*!
+ *  Interface object returning the state transition and sensitivity matrices w.r.t. the state at the current epoch, i.e.
+ *  an identity and zero matrix, respectively, regardless of the evaluation time. This interface is used by recursive
+ *  estimators, for which the observation partials are required w.r.t. the state at the epoch of the observation, instead
+ *  of w.r.t. the initial state.
+ */
+class CurrentEpochCombinedStateTransitionAndSensitivityMatrixInterface:
+        public CombinedStateTransitionAndSensitivityMatrixInterface
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param numberOfInitialDynamicalParameters Size of the estimated initial state vector (and size of the
+     * state transition matrix).
+     * \param numberOfParameters Total number of estimated parameters (initial states and other parameters).
+     */
+    CurrentEpochCombinedStateTransitionAndSensitivityMatrixInterface(
+            const int numberOfInitialDynamicalParameters,
+            const int numberOfParameters ):
+        CombinedStateTransitionAndSensitivityMatrixInterface( numberOfInitialDynamicalParameters, numberOfParameters )
+    {
+        combinedStateTransitionMatrix_ = Eigen::MatrixXd::Zero(
+                        stateTransitionMatrixSize_, stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
+        combinedStateTransitionMatrix_.block( 0, 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_ ).setIdentity( );
+    }
+
+    //! Destructor.
+    ~CurrentEpochCombinedStateTransitionAndSensitivityMatrixInterface( ){ }
+
+    //! Function to get the concatenated state transition and sensitivity matrix at a given time.
+    /*!
+     * Function to get the concatenated state transition and sensitivity matrix at a given time, always equal to
+     * identity matrix concatenated with zero matrix.
+     * \param evaluationTime Time at which to evaluate matrices (unused).
+     * \return Matrix containing identity matrix and zero sensitivity matrix.
+     */
+    Eigen::MatrixXd getCombinedStateTransitionAndSensitivityMatrix( const double evaluationTime )
+    {
+        return combinedStateTransitionMatrix_;
+    }
+
+    //! Function to get the concatenated state transition and sensitivity matrix at a given time.
+    /*!
+     * Function to get the concatenated state transition and sensitivity matrix at a given time, always equal to
+     * identity matrix concatenated with zero matrix.
+     * \param evaluationTime Time at which to evaluate matrices (unused).
+     * \return Matrix containing identity matrix and zero sensitivity matrix.
+     */
+    Eigen::MatrixXd getFullCombinedStateTransitionAndSensitivityMatrix( const double evaluationTime )
+    {
+        return combinedStateTransitionMatrix_;
+    }
+
+    //! Function to compute the concatenated state transition and sensitivity matrix at a given time into an existing
+    //! matrix.
+    /*!
+     * Function to compute the concatenated state transition and sensitivity matrix at a given time into an existing
+     * matrix, always equal to identity matrix concatenated with zero matrix.
+     * \param evaluationTime Time at which to evaluate matrices (unused).
+     * \param combinedMatrix Matrix containing identity matrix and zero sensitivity matrix (returned by reference).
+     */
+    void computeFullCombinedStateTransitionAndSensitivityMatrix(
+            const double evaluationTime, Eigen::MatrixXd& combinedMatrix )
+    {
+        combinedMatrix = combinedStateTransitionMatrix_;
+    }
+
+    //! Function to get the size of the total parameter vector.
+    /*!
+     * Function to get the size of the total parameter vector.
+     * \return Size of the total parameter vector.
+     */
+    int getFullParameterVectorSize( )
+    {
+        return sensitivityMatrixSize_ + stateTransitionMatrixSize_;
+    }
+
+private:
+
+    //! Matrix that is returned when calling getCombinedStateTransitionAndSensitivityMatrix.
+    Eigen::MatrixXd combinedStateTransitionMatrix_;
 };
 
 } // namespace propagators
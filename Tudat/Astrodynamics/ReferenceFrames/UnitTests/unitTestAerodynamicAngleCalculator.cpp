@@ -234,6 +234,115 @@ BOOST_AUTO_TEST_CASE( testAerodynamicAngleCalculator )
     }
 }
 
+//! Function to check whether all rotations from a (possibly cached) angle calculator match those of a new calculator.
+void compareRotationsWithNewCalculator(
+        AerodynamicAngleCalculator& aerodynamicAngleCalculator,
+        const Eigen::Vector6d& testState,
+        const Eigen::Quaterniond& rotationFromCorotatingToInertialFrame,
+        const double angleOfAttack,
+        const double angleOfSideslip,
+        const double bankAngle )
+{
+    AerodynamicAngleCalculator newAerodynamicAngleCalculator(
+                boost::lambda::constant( testState ),
+                boost::lambda::constant( rotationFromCorotatingToInertialFrame ), "", 1,
+                boost::lambda::constant( angleOfAttack ),
+                boost::lambda::constant( angleOfSideslip),
+                boost::lambda::constant( bankAngle ) );
+    newAerodynamicAngleCalculator.update( 0.0, true );
+
+    for( int i = inertial_frame; i <= body_frame; i++ )
+    {
+        for( int j = inertial_frame; j <= body_frame; j++ )
+        {
+            Eigen::Matrix3d rotationMatrix =
+                    aerodynamicAngleCalculator.getRotationQuaternionBetweenFrames(
+                        static_cast< AerodynamicsReferenceFrames >( i ),
+                        static_cast< AerodynamicsReferenceFrames >( j ) ).toRotationMatrix( );
+            Eigen::Matrix3d expectedRotationMatrix =
+                    newAerodynamicAngleCalculator.getRotationQuaternionBetweenFrames(
+                        static_cast< AerodynamicsReferenceFrames >( i ),
+                        static_cast< AerodynamicsReferenceFrames >( j ) ).toRotationMatrix( );
+            for( unsigned int l = 0; l < 3; l++ )
+            {
+                for( unsigned int m = 0; m < 3; m++ )
+                {
+                    BOOST_CHECK_SMALL( std::fabs( rotationMatrix( l, m ) - expectedRotationMatrix( l, m ) ),
+                                       2.0E-15 );
+                }
+            }
+        }
+    }
+}
+
+//! Test whether rotations are correctly retrieved from, and invalidated in, the cache of the angle calculator.
+BOOST_AUTO_TEST_CASE( testAerodynamicAngleCalculatorRotationCache )
+{
+    Eigen::Vector6d testState;
+    testState<<-1656517.23153109, -5790058.28764025, -2440584.88186829,
+            6526.30784888051, -2661.34558272018, 2377.09572383163;
+    Eigen::Quaterniond rotationFromCorotatingToInertialFrame =
+            Eigen::Quaterniond( Eigen::AngleAxisd( 0.3, Eigen::Vector3d::UnitZ( ) ) );
+
+    double angleOfAttack = 1.232;
+    double angleOfSideslip = -0.00322;
+    double bankAngle = 2.323432;
+
+    // Create angle calculator from variables that are modified during test.
+    AerodynamicAngleCalculator aerodynamicAngleCalculator(
+                boost::lambda::var( testState ),
+                boost::lambda::var( rotationFromCorotatingToInertialFrame ), "", 1,
+                boost::lambda::var( angleOfAttack ),
+                boost::lambda::var( angleOfSideslip ),
+                boost::lambda::var( bankAngle ) );
+    aerodynamicAngleCalculator.update( 0.0, false );
+    aerodynamicAngleCalculator.update( 0.0, true );
+
+    // Check that all rotations are correct, and that each rotation is computed only once.
+    compareRotationsWithNewCalculator(
+                aerodynamicAngleCalculator, testState, rotationFromCorotatingToInertialFrame,
+                angleOfAttack, angleOfSideslip, bankAngle );
+    unsigned int numberOfReusedRotations = aerodynamicAngleCalculator.getNumberOfReusedRotations( );
+    compareRotationsWithNewCalculator(
+                aerodynamicAngleCalculator, testState, rotationFromCorotatingToInertialFrame,
+                angleOfAttack, angleOfSideslip, bankAngle );
+    BOOST_CHECK_EQUAL( aerodynamicAngleCalculator.getNumberOfReusedRotations( ), numberOfReusedRotations + 36 );
+
+    // Check that rotations are retained when updating to the same time.
+    aerodynamicAngleCalculator.update( 0.0, false );
+    aerodynamicAngleCalculator.update( 0.0, true );
+    aerodynamicAngleCalculator.resetNumberOfReusedRotations( );
+    compareRotationsWithNewCalculator(
+                aerodynamicAngleCalculator, testState, rotationFromCorotatingToInertialFrame,
+                angleOfAttack, angleOfSideslip, bankAngle );
+    BOOST_CHECK_EQUAL( aerodynamicAngleCalculator.getNumberOfReusedRotations( ), 36 );
+
+    // Check that only rotations depending on bank, attack and sideslip angles are recomputed when updating these
+    // angles only.
+    angleOfAttack = 0.4;
+    bankAngle = -0.3;
+    aerodynamicAngleCalculator.resetDerivedClassTime( );
+    aerodynamicAngleCalculator.update( 0.0, true );
+    aerodynamicAngleCalculator.resetNumberOfReusedRotations( );
+    compareRotationsWithNewCalculator(
+                aerodynamicAngleCalculator, testState, rotationFromCorotatingToInertialFrame,
+                angleOfAttack, angleOfSideslip, bankAngle );
+    BOOST_CHECK( aerodynamicAngleCalculator.getNumberOfReusedRotations( ) >= 16 );
+    BOOST_CHECK( aerodynamicAngleCalculator.getNumberOfReusedRotations( ) < 36 );
+
+    // Check that all rotations are recomputed when updating to new time.
+    testState( 0 ) += 1.0E5;
+    testState( 4 ) -= 1.0E3;
+    rotationFromCorotatingToInertialFrame =
+            Eigen::Quaterniond( Eigen::AngleAxisd( 0.5, Eigen::Vector3d::UnitZ( ) ) );
+    angleOfSideslip = 0.01;
+    aerodynamicAngleCalculator.update( 10.0, true );
+    aerodynamicAngleCalculator.resetNumberOfReusedRotations( );
+    compareRotationsWithNewCalculator(
+                aerodynamicAngleCalculator, testState, rotationFromCorotatingToInertialFrame,
+                angleOfAttack, angleOfSideslip, bankAngle );
+    BOOST_CHECK( aerodynamicAngleCalculator.getNumberOfReusedRotations( ) < 36 );
+}
 
 BOOST_AUTO_TEST_SUITE_END( )
 
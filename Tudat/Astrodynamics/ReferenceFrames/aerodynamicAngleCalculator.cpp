@@ -8,6 +8,7 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <algorithm>
 #include <iostream>
 
 #include <boost/bind.hpp>
@@ -100,9 +101,6 @@ std::string getAerodynamicAngleName( const AerodynamicsReferenceFrameAngles angl
 //! Function to update the orientation angles to the current state.
 void AerodynamicAngleCalculator::update( const double currentTime, const bool updateBodyOrientation )
 {
-    // Clear all current rotation matrices.
-    currentRotationMatrices_.clear( );
-
     // Get current body-fixed state.
     if( !( currentTime == currentTime_ ) )
     {
@@ -131,6 +129,9 @@ void AerodynamicAngleCalculator::update( const double currentTime, const bool up
                     calculateFlightPathAngle( verticalFrameVelocity );
         }
 
+        // Invalidate all current rotation matrices.
+        resetRotationCache( false );
+
         currentTime_ = currentTime;
     }
 
@@ -158,12 +159,17 @@ void AerodynamicAngleCalculator::update( const double currentTime, const bool up
 
         currentBodyAngleTime_ = currentTime;
 
+        // Invalidate current rotation matrices that depend on bank, attack and sideslip angles.
+        resetRotationCache( true );
     }
     else if( !( currentBodyAngleTime_ == currentTime ) )
     {
         currentAerodynamicAngles_[ angle_of_attack ] = 0.0;
         currentAerodynamicAngles_[ angle_of_sideslip ] = 0.0;
         currentAerodynamicAngles_[ bank_angle ] = 0.0;
+
+        // Invalidate current rotation matrices that depend on bank, attack and sideslip angles.
+        resetRotationCache( true );
     }
 }
 
@@ -184,173 +190,176 @@ Eigen::Quaterniond AerodynamicAngleCalculator::getRotationQuaternionBetweenFrame
         throw( "Error in AerodynamicAngleCalculator, instance ends at vertical frame" );
     }
 
-    // Set current frame pair.
-    std::pair< AerodynamicsReferenceFrames, AerodynamicsReferenceFrames > currentRotationPair =
-            std::make_pair( originalFrame, targetFrame );
+    // Retrieve rotation matrix if current rotation is already calculated.
+    int currentFrameIndex = static_cast< int >( originalFrame );
+    int targetFrameIndex = static_cast< int >( targetFrame );
+    if( isRotationComputed_[ getFramePairIndex( currentFrameIndex, targetFrameIndex ) ] )
+    {
+        numberOfReusedRotations_++;
+        return currentRotationMatrices_[ getFramePairIndex( currentFrameIndex, targetFrameIndex ) ];
+    }
 
-    // Calculate rotation matrix if current rotation is not yet calculated.
-    if( currentRotationMatrices_.count( currentRotationPair ) == 0 )
+    // Check if any rotation is needed.
+    if( currentFrameIndex != targetFrameIndex )
     {
-        // Get indices of required frames.
-        int currentFrameIndex = static_cast< int >( originalFrame );
-        int targetFrameIndex = static_cast< int >( targetFrame );
+        // Check 'direction' of transformation through AerodynamicsReferenceFrames list.
+        bool isTargetFrameUp = ( targetFrameIndex > currentFrameIndex );
+        int frameIndexIncrement = ( isTargetFrameUp ? 1 : -1 );
 
-        // Check if any rotation is needed.
-        if( currentFrameIndex != targetFrameIndex )
+        // Start from rotation to intermediate frame closest to target frame, if it is already calculated.
+        for( int intermediateFrameIndex = targetFrameIndex - frameIndexIncrement;
+             intermediateFrameIndex != currentFrameIndex; intermediateFrameIndex -= frameIndexIncrement )
         {
-            // Check 'direction' of transformation through AerodynamicsReferenceFrames list.
-            bool isTargetFrameUp;
-            if( targetFrameIndex > currentFrameIndex )
+            if( isRotationComputed_[ getFramePairIndex( originalFrame, intermediateFrameIndex ) ] )
             {
-                isTargetFrameUp = 1;
-            }
-            else if( targetFrameIndex < currentFrameIndex )
-            {
-                isTargetFrameUp = 0;
-            }
-            else
-            {
-                throw std::runtime_error(
-                            "Error when identifying target frame direction in AerodynamicAngleCalculator." );
-
-            }
-
-            // Add rotation sequence until final frame is reached.
-            while( currentFrameIndex != targetFrameIndex )
-            {
-                switch( currentFrameIndex )
-                {
-                case static_cast< int >( inertial_frame ):
-
-                    if( isTargetFrameUp )
-                    {
-                        rotationToFrame = currentRotationFromCorotatingToInertialFrame_.inverse( ) *
-                                rotationToFrame;
-                    }
-                    else
-                    {
-                        throw std::runtime_error(
-                                    "Error, inertial_frame is end frame in AerodynamicAngleCalculator" );
-                    }
-                    break;
-                case static_cast< int >( corotating_frame ):
-
-                    if( isTargetFrameUp )
-                    {
-                        rotationToFrame =
-                                getRotatingPlanetocentricToLocalVerticalFrameTransformationQuaternion(
-                                    currentAerodynamicAngles_.at( longitude_angle ),
-                                    currentAerodynamicAngles_.at( latitude_angle ) ) *
-                                rotationToFrame;
-                    }
-                    else
-                    {
-                        rotationToFrame = currentRotationFromCorotatingToInertialFrame_ *
-                                rotationToFrame;
-                    }
-                    break;
-                case static_cast< int >( vertical_frame ):
-                    if( isTargetFrameUp )
-                    {
-
-                        rotationToFrame =
-                                getLocalVerticalFrameToTrajectoryTransformationQuaternion(
-                                    currentAerodynamicAngles_.at( flight_path_angle ),
-                                    currentAerodynamicAngles_.at( heading_angle ) ) * rotationToFrame;
-                    }
-                    else
-                    {
-                        rotationToFrame =
-                                getLocalVerticalToRotatingPlanetocentricFrameTransformationQuaternion(
-                                    currentAerodynamicAngles_.at( longitude_angle ),
-                                    currentAerodynamicAngles_.at( latitude_angle ) ) *
-                                rotationToFrame;
-                    }
-                    break;
-                case static_cast< int >( trajectory_frame ):
-                    if( isTargetFrameUp )
-                    {
-                        rotationToFrame =
-                                getTrajectoryToAerodynamicFrameTransformationQuaternion(
-                                    currentAerodynamicAngles_.at( bank_angle ) ) *
-                                rotationToFrame;
-
-                    }
-                    else
-                    {
-                        rotationToFrame =
-                                getTrajectoryToLocalVerticalFrameTransformationQuaternion(
-                                    currentAerodynamicAngles_.at( flight_path_angle ),
-                                    currentAerodynamicAngles_.at( heading_angle ) ) *
-                                rotationToFrame;
-                    }
-                    break;
-                case static_cast< int >( aerodynamic_frame ):
-                    if( isTargetFrameUp )
-                    {
-                        rotationToFrame =
-                                getAirspeedBasedAerodynamicToBodyFrameTransformationQuaternion(
-                                    currentAerodynamicAngles_.at( angle_of_attack ),
-                                    currentAerodynamicAngles_.at( angle_of_sideslip ) ) *
-                                rotationToFrame;
-                    }
-                    else
-                    {
-                        rotationToFrame =
-                                getAerodynamicToTrajectoryFrameTransformationQuaternion(
-                                    currentAerodynamicAngles_.at( bank_angle ) ) *
-                                rotationToFrame;
-                    }
-                    break;
-                case static_cast< int >( body_frame ):
-                    if( isTargetFrameUp )
-                    {
-
-                        throw std::runtime_error(
-                                    "Error, body frame is end frame in AerodynamicAngleCalculator." );
-                    }
-                    else
-                    {
-                        rotationToFrame =
-                                getBodyToAirspeedBasedAerodynamicFrameTransformationQuaternion(
-                                    currentAerodynamicAngles_.at( angle_of_attack ),
-                                    currentAerodynamicAngles_.at( angle_of_sideslip ) ) *
-                                rotationToFrame;
-                    }
-                    break;
-                default:
-                    throw std::runtime_error(
-                                "Error, index " +
-                                boost::lexical_cast< std::string>( currentFrameIndex ) +
-                                "not found in AerodynamicAngleCalculator" );
-
-                }
-
-                // Increment/decrement current frame.
-                if( isTargetFrameUp )
-                {
-                    currentFrameIndex++;
-                }
-                else
-                {
-                    currentFrameIndex--;
-                }
+                rotationToFrame = currentRotationMatrices_[ getFramePairIndex( originalFrame, intermediateFrameIndex ) ];
+                currentFrameIndex = intermediateFrameIndex;
+                break;
             }
         }
 
-        // Set current rotation (as well as inverse).
-        currentRotationMatrices_[ currentRotationPair ] = rotationToFrame;
-        currentRotationMatrices_[ std::make_pair( targetFrame, originalFrame ) ] =
-                rotationToFrame.inverse( );
+        // Add rotation sequence until final frame is reached, setting rotations to intermediate frames (as well as
+        // inverse).
+        while( currentFrameIndex != targetFrameIndex )
+        {
+            rotationToFrame = computeSingleFrameRotation( currentFrameIndex, isTargetFrameUp ) * rotationToFrame;
+            currentFrameIndex += frameIndexIncrement;
+
+            currentRotationMatrices_[ getFramePairIndex( originalFrame, currentFrameIndex ) ] = rotationToFrame;
+            currentRotationMatrices_[ getFramePairIndex( currentFrameIndex, originalFrame ) ] =
+                    rotationToFrame.inverse( );
+            isRotationComputed_[ getFramePairIndex( originalFrame, currentFrameIndex ) ] = true;
+            isRotationComputed_[ getFramePairIndex( currentFrameIndex, originalFrame ) ] = true;
+        }
     }
     else
     {
-        rotationToFrame = currentRotationMatrices_.at( currentRotationPair );
+        currentRotationMatrices_[ getFramePairIndex( currentFrameIndex, targetFrameIndex ) ] = rotationToFrame;
+        isRotationComputed_[ getFramePairIndex( currentFrameIndex, targetFrameIndex ) ] = true;
     }
 
     return rotationToFrame;
 }
 
+//! Function to compute the rotation from a frame to its neighbour in the AerodynamicsReferenceFrames list.
+Eigen::Quaterniond AerodynamicAngleCalculator::computeSingleFrameRotation(
+        const int frame, const bool isTargetFrameUp )
+{
+    Eigen::Quaterniond singleFrameRotation;
+    switch( frame )
+    {
+    case static_cast< int >( inertial_frame ):
+
+        if( isTargetFrameUp )
+        {
+            singleFrameRotation = currentRotationFromCorotatingToInertialFrame_.inverse( );
+        }
+        else
+        {
+            throw std::runtime_error(
+                        "Error, inertial_frame is end frame in AerodynamicAngleCalculator" );
+        }
+        break;
+    case static_cast< int >( corotating_frame ):
+
+        if( isTargetFrameUp )
+        {
+            singleFrameRotation =
+                    getRotatingPlanetocentricToLocalVerticalFrameTransformationQuaternion(
+                        currentAerodynamicAngles_.at( longitude_angle ),
+                        currentAerodynamicAngles_.at( latitude_angle ) );
+        }
+        else
+        {
+            singleFrameRotation = currentRotationFromCorotatingToInertialFrame_;
+        }
+        break;
+    case static_cast< int >( vertical_frame ):
+        if( isTargetFrameUp )
+        {
+            singleFrameRotation =
+                    getLocalVerticalFrameToTrajectoryTransformationQuaternion(
+                        currentAerodynamicAngles_.at( flight_path_angle ),
+                        currentAerodynamicAngles_.at( heading_angle ) );
+        }
+        else
+        {
+            singleFrameRotation =
+                    getLocalVerticalToRotatingPlanetocentricFrameTransformationQuaternion(
+                        currentAerodynamicAngles_.at( longitude_angle ),
+                        currentAerodynamicAngles_.at( latitude_angle ) );
+        }
+        break;
+    case static_cast< int >( trajectory_frame ):
+        if( isTargetFrameUp )
+        {
+            singleFrameRotation =
+                    getTrajectoryToAerodynamicFrameTransformationQuaternion(
+                        currentAerodynamicAngles_.at( bank_angle ) );
+        }
+        else
+        {
+            singleFrameRotation =
+                    getTrajectoryToLocalVerticalFrameTransformationQuaternion(
+                        currentAerodynamicAngles_.at( flight_path_angle ),
+                        currentAerodynamicAngles_.at( heading_angle ) );
+        }
+        break;
+    case static_cast< int >( aerodynamic_frame ):
+        if( isTargetFrameUp )
+        {
+            singleFrameRotation =
+                    getAirspeedBasedAerodynamicToBodyFrameTransformationQuaternion(
+                        currentAerodynamicAngles_.at( angle_of_attack ),
+                        currentAerodynamicAngles_.at( angle_of_sideslip ) );
+        }
+        else
+        {
+            singleFrameRotation =
+                    getAerodynamicToTrajectoryFrameTransformationQuaternion(
+                        currentAerodynamicAngles_.at( bank_angle ) );
+        }
+        break;
+    case static_cast< int >( body_frame ):
+        if( isTargetFrameUp )
+        {
+            throw std::runtime_error(
+                        "Error, body frame is end frame in AerodynamicAngleCalculator." );
+        }
+        else
+        {
+            singleFrameRotation =
+                    getBodyToAirspeedBasedAerodynamicFrameTransformationQuaternion(
+                        currentAerodynamicAngles_.at( angle_of_attack ),
+                        currentAerodynamicAngles_.at( angle_of_sideslip ) );
+        }
+        break;
+    default:
+        throw std::runtime_error(
+                    "Error, index " +
+                    boost::lexical_cast< std::string>( frame ) +
+                    "not found in AerodynamicAngleCalculator" );
+
+    }
+    return singleFrameRotation;
+}
+
+//! Function to invalidate the rotations stored in the cache.
+void AerodynamicAngleCalculator::resetRotationCache( const bool resetBodyAngleDependentRotationsOnly )
+{
+    for( int i = inertial_frame; i <= body_frame; i++ )
+    {
+        for( int j = inertial_frame; j <= body_frame; j++ )
+        {
+            // Only rotations to/from aerodynamic and body frame depend on bank, attack and sideslip angles.
+            if( !resetBodyAngleDependentRotationsOnly || ( ( i != j ) && std::max( i, j ) > trajectory_frame ) )
+            {
+                isRotationComputed_[ getFramePairIndex( i, j ) ] = false;
+            }
+        }
+    }
+}
+
 //! Function to get a single orientation angle.
 double AerodynamicAngleCalculator::getAerodynamicAngle(
         const AerodynamicsReferenceFrameAngles angleId )
@@ -14,6 +14,7 @@
 #include <vector>
 #include <map>
 
+#include <boost/array.hpp>
 #include <boost/function.hpp>
 #include <boost/lambda/lambda.hpp>
 
@@ -117,7 +118,11 @@ public:
         angleOfSideslipFunction_( angleOfSideslipFunction ),
         bankAngleFunction_( bankAngleFunction ),
         angleUpdateFunction_( angleUpdateFunction ),
-        currentBodyAngleTime_( TUDAT_NAN ){ }
+        currentBodyAngleTime_( TUDAT_NAN ),
+        numberOfReusedRotations_( 0 )
+    {
+        isRotationComputed_.assign( false );
+    }
 
     //! Function to get the current rotation from the global (propagation/inertial) to the local (body-fixed) frame.
     /*!
@@ -166,7 +171,9 @@ public:
     //! Function to get the rotation quaternion between two frames
     /*!
      * Function to get the rotation quaternion between two frames. This function uses the values
-     * calculated by the previous call of the update( ) function.
+     * calculated by the previous call of the update( ) function. Each rotation (as well as its inverse and the
+     * rotations to the intermediate frames) is stored upon its first computation, and retrieved from this cache until
+     * the angles on which it depends are modified by the update( ) function.
      * \param originalFrame Id for 'current' frame
      * \param targetFrame Id for frame to which transformation object should transfrom a vector
      * (from originalFrame).
@@ -252,15 +259,69 @@ public:
         currentBodyAngleTime_ = currentTime;
     }
 
+    //! Function to get the number of rotations that were retrieved from the cache, instead of being recomputed.
+    /*!
+     * Function to get the number of calls to getRotationQuaternionBetweenFrames for which the rotation was retrieved
+     * from the cache, instead of being recomputed, since creation of this object or last call to
+     * resetNumberOfReusedRotations.
+     * \return Number of rotations that were retrieved from the cache.
+     */
+    unsigned int getNumberOfReusedRotations( )
+    {
+        return numberOfReusedRotations_;
+    }
+
+    //! Function to reset the number of rotations that were retrieved from the cache to zero.
+    void resetNumberOfReusedRotations( )
+    {
+        numberOfReusedRotations_ = 0;
+    }
+
 private:
 
+    //! Function to get the index of a pair of frames in the currentRotationMatrices_ and isRotationComputed_ arrays.
+    /*!
+     * Function to get the index of a pair of frames in the currentRotationMatrices_ and isRotationComputed_ arrays.
+     * \param originalFrame Frame from which the rotation is performed.
+     * \param targetFrame Frame to which the rotation is performed.
+     * \return Index of frame pair in cache.
+     */
+    static int getFramePairIndex( const int originalFrame, const int targetFrame )
+    {
+        return ( originalFrame - inertial_frame ) * numberOfFrames_ + ( targetFrame - inertial_frame );
+    }
+
+    //! Function to compute the rotation from a frame to its neighbour in the AerodynamicsReferenceFrames list.
+    /*!
+     * Function to compute the rotation from a frame to its neighbour in the AerodynamicsReferenceFrames list, using
+     * the angles calculated by the previous call of the update( ) function.
+     * \param frame Frame from which the rotation is performed.
+     * \param isTargetFrameUp Boolean denoting whether the rotation is to the next (if true) or previous (if false)
+     * frame in the list.
+     * \return Rotation quaternion from frame to its neighbour.
+     */
+    Eigen::Quaterniond computeSingleFrameRotation( const int frame, const bool isTargetFrameUp );
+
+    //! Function to invalidate the rotations stored in the cache.
+    /*!
+     * Function to invalidate the rotations stored in the cache.
+     * \param resetBodyAngleDependentRotationsOnly Boolean denoting whether only the rotations that depend on the
+     * bank, attack and sideslip angles are to be invalidated (if true), or all rotations (if false).
+     */
+    void resetRotationCache( const bool resetBodyAngleDependentRotationsOnly );
+
+    //! Number of frames in the AerodynamicsReferenceFrames list.
+    static const int numberOfFrames_ = body_frame - inertial_frame + 1;
+
     //! Map of current angles, as calculated by previous call to update( ) function.
     std::map< AerodynamicsReferenceFrameAngles, double > currentAerodynamicAngles_;
 
-    //! Map of current transformation quaternions, as calculated since previous call to update( )
-    //! function.
-    std::map< std::pair< AerodynamicsReferenceFrames, AerodynamicsReferenceFrames >,
-    Eigen::Quaterniond > currentRotationMatrices_;
+    //! Current transformation quaternions between all pairs of frames, as calculated since the angles on which they
+    //! depend were last modified (index given by getFramePairIndex).
+    boost::array< Eigen::Quaterniond, numberOfFrames_ * numberOfFrames_ > currentRotationMatrices_;
+
+    //! Booleans denoting whether the entries of currentRotationMatrices_ are up to date.
+    boost::array< bool, numberOfFrames_ * numberOfFrames_ > isRotationComputed_;
 
     //! Current body-fixed state of vehicle, as set by previous call to update( ).
     Eigen::Vector6d currentBodyFixedState_;
@@ -299,6 +360,9 @@ private:
     //! Current time to which the bank, attack and sideslip angles have been updated.
     double currentBodyAngleTime_;
 
+    //! Number of rotations that were retrieved from the cache, instead of being recomputed.
+    unsigned int numberOfReusedRotations_;
+
 };
 
 //! Get a function to transform aerodynamic force from local to propagation frame.
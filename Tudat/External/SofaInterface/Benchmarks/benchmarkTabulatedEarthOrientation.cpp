@@ -0,0 +1,91 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      This program is only built if BUILD_BENCHMARKS is enabled, and is not run as part of the unit tests.
+ *
+ */
+
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+
+#include <boost/filesystem.hpp>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/External/SofaInterface/tabulatedEarthOrientation.h"
+
+//! Benchmark tabulation, evaluation and caching of the CIP position and CIO locator w.r.t. the Sofa series.
+/*!
+ *  Benchmark tabulation (single- and multi-threaded), evaluation and caching of the CIP position and CIO locator
+ *  w.r.t. direct evaluation of the Sofa series, over one year. Usage:
+ *  benchmark_TabulatedEarthOrientation [numberOfThreads]
+ */
+int main( int argc, char* argv[ ] )
+{
+    using namespace tudat;
+    using namespace tudat::sofa_interface;
+
+    unsigned int numberOfThreads = ( argc > 1 ) ? std::atoi( argv[ 1 ] ) : 4;
+
+    double initialTime = 5.0 * physical_constants::JULIAN_YEAR;
+    double finalTime = 6.0 * physical_constants::JULIAN_YEAR;
+    double timeStep = 6.0 * 3600.0;
+
+    // Create tabulated values, using single and multiple threads.
+    std::clock_t startClock = std::clock( );
+    boost::shared_ptr< TabulatedPrecessionNutationCalculator > tabulatedCalculator =
+            createTabulatedPrecessionNutationCalculator( initialTime, finalTime, timeStep, iau_2006, 1 );
+    double tabulationTime = static_cast< double >( std::clock( ) - startClock ) / CLOCKS_PER_SEC;
+
+    // Note that std::clock measures processor time of all threads, so that the wall time is used here.
+    std::time_t startTime = std::time( NULL );
+    createTabulatedPrecessionNutationCalculator( initialTime, finalTime, timeStep, iau_2006, numberOfThreads );
+    double parallelTabulationWallTime = std::difftime( std::time( NULL ), startTime );
+
+    // Compare evaluation time of Sofa series and interpolated values.
+    unsigned int numberOfEvaluations = 0;
+    double directEvaluationTime = 0.0;
+    double interpolatedEvaluationTime = 0.0;
+    double valueSum = 0.0;
+    for( double currentTime = initialTime; currentTime <= finalTime; currentTime += 7777.7 )
+    {
+        startClock = std::clock( );
+        valueSum += getPositionOfCipInGcrs( currentTime, basic_astrodynamics::JULIAN_DAY_ON_J2000, iau_2006 ).second;
+        directEvaluationTime += static_cast< double >( std::clock( ) - startClock ) / CLOCKS_PER_SEC;
+
+        startClock = std::clock( );
+        valueSum -= tabulatedCalculator->getPositionOfCipInGcrs( currentTime ).second;
+        interpolatedEvaluationTime += static_cast< double >( std::clock( ) - startClock ) / CLOCKS_PER_SEC;
+        numberOfEvaluations++;
+    }
+
+    std::cout << "Tabulation of " << tabulatedCalculator->getTabulatedValues( ).size( ) << " values: "
+              << tabulationTime << " s (1 thread), " << parallelTabulationWallTime << " s wall time ("
+              << numberOfThreads << " threads)" << std::endl;
+    std::cout << numberOfEvaluations << " evaluations, Sofa series: " << directEvaluationTime << " s, interpolated: "
+              << interpolatedEvaluationTime << " s (mean CIO locator difference "
+              << valueSum / static_cast< double >( numberOfEvaluations ) << ")" << std::endl;
+
+    // Compare tabulation with reading tabulated values from cache file.
+    boost::filesystem::path cacheDirectory =
+            boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( "tudat_cache_%%%%-%%%%" );
+    createTabulatedPrecessionNutationCalculator(
+                initialTime, finalTime, timeStep, iau_2006, numberOfThreads, cacheDirectory.string( ) );
+
+    startClock = std::clock( );
+    createTabulatedPrecessionNutationCalculator(
+                initialTime, finalTime, timeStep, iau_2006, numberOfThreads, cacheDirectory.string( ) );
+    std::cout << "Reading tabulated values from file: "
+              << static_cast< double >( std::clock( ) - startClock ) / CLOCKS_PER_SEC << " s" << std::endl;
+
+    boost::filesystem::remove_all( cacheDirectory );
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,95 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/External/SofaInterface/tabulatedEarthOrientation.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::sofa_interface;
+
+BOOST_AUTO_TEST_SUITE( test_tabulated_earth_orientation )
+
+//! Test whether tabulated CIP position and CIO locator reproduce Sofa series, and whether they are correctly cached.
+BOOST_AUTO_TEST_CASE( testTabulatedPrecessionNutation )
+{
+    double initialTime = 5.0 * physical_constants::JULIAN_YEAR;
+    double finalTime = 6.0 * physical_constants::JULIAN_YEAR;
+    double timeStep = 6.0 * 3600.0;
+
+    // Create tabulated values, using single and multiple threads.
+    boost::shared_ptr< TabulatedPrecessionNutationCalculator > tabulatedCalculator =
+            createTabulatedPrecessionNutationCalculator( initialTime, finalTime, timeStep, iau_2006, 1 );
+
+    boost::shared_ptr< TabulatedPrecessionNutationCalculator > parallelTabulatedCalculator =
+            createTabulatedPrecessionNutationCalculator( initialTime, finalTime, timeStep, iau_2006, 4 );
+
+    BOOST_CHECK( tabulatedCalculator->getFinalTime( ) >= finalTime );
+    BOOST_CHECK( tabulatedCalculator->getTabulatedValues( ) == parallelTabulatedCalculator->getTabulatedValues( ) );
+
+    // Compare interpolated values with Sofa series at arbitrary times (including tabulated times and boundaries).
+    for( double currentTime = initialTime; currentTime <= finalTime; currentTime += 7777.7 )
+    {
+        std::pair< Eigen::Vector2d, double > directValues = getPositionOfCipInGcrs(
+                    currentTime, basic_astrodynamics::JULIAN_DAY_ON_J2000, iau_2006 );
+        std::pair< Eigen::Vector2d, double > interpolatedValues =
+                tabulatedCalculator->getPositionOfCipInGcrs( currentTime );
+
+        BOOST_CHECK_SMALL( std::fabs( directValues.first.x( ) - interpolatedValues.first.x( ) ), 1.0E-12 );
+        BOOST_CHECK_SMALL( std::fabs( directValues.first.y( ) - interpolatedValues.first.y( ) ), 1.0E-12 );
+        BOOST_CHECK_SMALL( std::fabs( directValues.second - interpolatedValues.second ), 1.0E-12 );
+    }
+
+    // Create tabulated values with cache file, and check that they are identical when read from file.
+    boost::filesystem::path cacheDirectory =
+            boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( "tudat_cache_%%%%-%%%%" );
+    boost::shared_ptr< TabulatedPrecessionNutationCalculator > cachedCalculator =
+            createTabulatedPrecessionNutationCalculator(
+                initialTime, finalTime, timeStep, iau_2006, 4, cacheDirectory.string( ) );
+    BOOST_CHECK( boost::filesystem::exists( cacheDirectory ) );
+    BOOST_CHECK( !boost::filesystem::is_empty( cacheDirectory ) );
+
+    boost::shared_ptr< TabulatedPrecessionNutationCalculator > readCachedCalculator =
+            createTabulatedPrecessionNutationCalculator(
+                initialTime, finalTime, timeStep, iau_2006, 4, cacheDirectory.string( ) );
+
+    BOOST_CHECK( cachedCalculator->getTabulatedValues( ) == tabulatedCalculator->getTabulatedValues( ) );
+    BOOST_CHECK( readCachedCalculator->getTabulatedValues( ) == tabulatedCalculator->getTabulatedValues( ) );
+
+    boost::filesystem::remove_all( cacheDirectory );
+
+    // Check that too large time step is rejected.
+    bool isExceptionCaught = false;
+    try
+    {
+        createTabulatedPrecessionNutationCalculator( initialTime, finalTime, 10.0 * physical_constants::JULIAN_DAY );
+    }
+    catch( std::runtime_error )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,105 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Petit, G. and Luzum, B. (eds.), IERS Conventions (2010), IERS Technical Note 36, 2010.
+ *
+ */
+
+#include <cmath>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/External/SofaInterface/earthOrientation.h"
+#include "Tudat/External/SofaInterface/gcrsToItrsRotationalEphemeris.h"
+#include "Tudat/External/SofaInterface/sofaTimeConversions.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Function to calculate the rotation quaternion from original frame to target frame.
+Eigen::Quaterniond GcrsToItrsRotationalEphemeris::getRotationToTargetFrame( const double secondsSinceEpoch )
+{
+    Eigen::Matrix3d rotationToTargetFrame, rotationToTargetFrameDerivative;
+    computeRotationToTargetFrame( secondsSinceEpoch, rotationToTargetFrame, rotationToTargetFrameDerivative );
+    return Eigen::Quaterniond( rotationToTargetFrame );
+}
+
+//! Function to calculate the derivative of the rotation matrix from original frame to target frame.
+Eigen::Matrix3d GcrsToItrsRotationalEphemeris::getDerivativeOfRotationToTargetFrame( const double secondsSinceEpoch )
+{
+    Eigen::Matrix3d rotationToTargetFrame, rotationToTargetFrameDerivative;
+    computeRotationToTargetFrame( secondsSinceEpoch, rotationToTargetFrame, rotationToTargetFrameDerivative );
+    return rotationToTargetFrameDerivative;
+}
+
+//! Function to calculate the full rotational state at given time
+void GcrsToItrsRotationalEphemeris::getFullRotationalQuantitiesToTargetFrame(
+        Eigen::Quaterniond& currentRotationToLocalFrame,
+        Eigen::Matrix3d& currentRotationToLocalFrameDerivative,
+        Eigen::Vector3d& currentAngularVelocityVectorInGlobalFrame,
+        const double secondsSinceEpoch )
+{
+    Eigen::Matrix3d rotationToTargetFrame;
+    computeRotationToTargetFrame( secondsSinceEpoch, rotationToTargetFrame, currentRotationToLocalFrameDerivative );
+
+    currentRotationToLocalFrame = Eigen::Quaterniond( rotationToTargetFrame );
+    currentAngularVelocityVectorInGlobalFrame = getRotationalVelocityVectorInBaseFrameFromMatrices(
+                rotationToTargetFrame, currentRotationToLocalFrameDerivative.transpose( ) );
+}
+
+//! Function to compute the rotation matrix to the target frame, and its time derivative.
+void GcrsToItrsRotationalEphemeris::computeRotationToTargetFrame(
+        const double secondsSinceEpoch,
+        Eigen::Matrix3d& rotationToTargetFrame,
+        Eigen::Matrix3d& rotationToTargetFrameDerivative )
+{
+    // Compute TT (at geocenter) and UT1 (approximated by UTC).
+    double terrestrialTime = secondsSinceEpoch -
+            sofa_interface::getTDBminusTT( secondsSinceEpoch, Eigen::Vector3d::Zero( ) );
+    double universalTime1 = sofa_interface::convertTTtoUTC( terrestrialTime );
+
+    // Compute rotation from GCRS to CIRS.
+    std::pair< Eigen::Vector2d, double > cipPosition = cipPositionFunction_( terrestrialTime );
+    double celestialToIntermediateMatrix[ 3 ][ 3 ];
+    iauC2ixys( cipPosition.first.x( ), cipPosition.first.y( ), cipPosition.second, celestialToIntermediateMatrix );
+
+    Eigen::Matrix3d rotationToIntermediateFrame;
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            rotationToIntermediateFrame( i, j ) = celestialToIntermediateMatrix[ i ][ j ];
+        }
+    }
+
+    // Compute rotation about CIP by Earth rotation angle, and its derivative (polar motion neglected).
+    double earthRotationAngle = sofa_interface::calculateEarthRotationAngle( universalTime1 );
+    double earthRotationRate = 2.0 * mathematical_constants::PI * 1.00273781191135448 / physical_constants::JULIAN_DAY;
+    double cosineOfAngle = std::cos( earthRotationAngle );
+    double sineOfAngle = std::sin( earthRotationAngle );
+
+    Eigen::Matrix3d earthRotation, earthRotationDerivative;
+    earthRotation << cosineOfAngle, sineOfAngle, 0.0,
+            -sineOfAngle, cosineOfAngle, 0.0,
+            0.0, 0.0, 1.0;
+    earthRotationDerivative << -sineOfAngle, cosineOfAngle, 0.0,
+            -cosineOfAngle, -sineOfAngle, 0.0,
+            0.0, 0.0, 0.0;
+
+    rotationToTargetFrame = earthRotation * rotationToIntermediateFrame;
+    rotationToTargetFrameDerivative = earthRotationRate * earthRotationDerivative * rotationToIntermediateFrame;
+}
+
+} // namespace ephemerides
+
+} // namespace tudat
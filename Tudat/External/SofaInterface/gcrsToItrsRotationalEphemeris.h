@@ -0,0 +1,145 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Petit, G. and Luzum, B. (eds.), IERS Conventions (2010), IERS Technical Note 36, 2010.
+ *
+ */
+
+#ifndef TUDAT_GCRSTOITRSROTATIONALEPHEMERIS_H
+#define TUDAT_GCRSTOITRSROTATIONALEPHEMERIS_H
+
+#include <string>
+#include <utility>
+
+#include <boost/function.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
+#include "Tudat/Astrodynamics/Ephemerides/rotationalEphemeris.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Class to calculate the rotation from the GCRS to the ITRS, using the CIO-based transformation.
+/*!
+ *  Class to calculate the rotation from the GCRS to the ITRS, using the CIO-based transformation (Petit and Luzum,
+ *  2010, chap. 5), in which the position of the CIP and the CIO locator are provided by a function, typically the
+ *  Sofa series directly (sofa_interface::getPositionOfCipInGcrs) or a tabulated precession-nutation calculator
+ *  (sofa_interface::TabulatedPrecessionNutationCalculator). As no Earth orientation parameters are available, polar
+ *  motion and the corrections to the precession-nutation model are neglected, and UT1 is approximated by UTC (so that
+ *  the error of the Earth rotation angle is below 0.9 s of Earth rotation). The time derivative of the rotation
+ *  matrix is computed from the Earth rotation rate only, neglecting the (much slower) variation of the CIP position.
+ */
+class GcrsToItrsRotationalEphemeris : public RotationalEphemeris
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor, sets function providing the CIP position and CIO locator, and the frame identifiers.
+     *  \param cipPositionFunction Function returning the CIP position (X, Y, first) and CIO locator (s, second) as a
+     *  function of TT in seconds since J2000.
+     *  \param baseFrameOrientation Base frame identifier (GCRS).
+     *  \param targetFrameOrientation Target frame identifier (ITRS).
+     */
+    GcrsToItrsRotationalEphemeris(
+            const boost::function< std::pair< Eigen::Vector2d, double >( const double ) > cipPositionFunction,
+            const std::string& baseFrameOrientation = "J2000",
+            const std::string& targetFrameOrientation = "ITRS" ):
+        RotationalEphemeris( baseFrameOrientation, targetFrameOrientation ),
+        cipPositionFunction_( cipPositionFunction ){ }
+
+    //! Destructor
+    ~GcrsToItrsRotationalEphemeris( ){ }
+
+    //! Function to calculate the rotation quaternion from target frame to original frame.
+    /*!
+     *  Function to calculate the rotation quaternion from target frame (ITRS) to original frame (GCRS).
+     *  \param secondsSinceEpoch Seconds since J2000 (TDB) at which ephemeris is to be evaluated.
+     *  \return Rotation from target to original frame at specified time.
+     */
+    Eigen::Quaterniond getRotationToBaseFrame( const double secondsSinceEpoch )
+    {
+        return getRotationToTargetFrame( secondsSinceEpoch ).inverse( );
+    }
+
+    //! Function to calculate the rotation quaternion from original frame to target frame.
+    /*!
+     *  Function to calculate the rotation quaternion from original frame (GCRS) to target frame (ITRS).
+     *  \param secondsSinceEpoch Seconds since J2000 (TDB) at which ephemeris is to be evaluated.
+     *  \return Rotation from original to target frame at specified time.
+     */
+    Eigen::Quaterniond getRotationToTargetFrame( const double secondsSinceEpoch );
+
+    //! Function to calculate the derivative of the rotation matrix from target frame to original frame.
+    /*!
+     *  Function to calculate the derivative of the rotation matrix from target frame to original frame.
+     *  \param secondsSinceEpoch Seconds since J2000 (TDB) at which ephemeris is to be evaluated.
+     *  \return Derivative of rotation from target to original frame at specified time.
+     */
+    Eigen::Matrix3d getDerivativeOfRotationToBaseFrame( const double secondsSinceEpoch )
+    {
+        return getDerivativeOfRotationToTargetFrame( secondsSinceEpoch ).transpose( );
+    }
+
+    //! Function to calculate the derivative of the rotation matrix from original frame to target frame.
+    /*!
+     *  Function to calculate the derivative of the rotation matrix from original frame to target frame.
+     *  \param secondsSinceEpoch Seconds since J2000 (TDB) at which ephemeris is to be evaluated.
+     *  \return Derivative of rotation from original to target frame at specified time.
+     */
+    Eigen::Matrix3d getDerivativeOfRotationToTargetFrame( const double secondsSinceEpoch );
+
+    //! Function to calculate the full rotational state at given time
+    /*!
+     * Function to calculate the full rotational state at given time (rotation matrix, derivative of
+     * rotation matrix and angular velocity vector), evaluating the CIP position only once.
+     * \param currentRotationToLocalFrame Current rotation to local frame (returned by reference)
+     * \param currentRotationToLocalFrameDerivative Current derivative of rotation matrix to local
+     * frame (returned by reference)
+     * \param currentAngularVelocityVectorInGlobalFrame Current angular velocity vector, expressed
+     * in global frame (returned by reference)
+     * \param secondsSinceEpoch Seconds since J2000 (TDB) at which ephemeris is to be evaluated.
+     */
+    void getFullRotationalQuantitiesToTargetFrame(
+            Eigen::Quaterniond& currentRotationToLocalFrame,
+            Eigen::Matrix3d& currentRotationToLocalFrameDerivative,
+            Eigen::Vector3d& currentAngularVelocityVectorInGlobalFrame,
+            const double secondsSinceEpoch );
+
+private:
+
+    //! Function to compute the rotation matrix to the target frame, and its time derivative.
+    /*!
+     *  Function to compute the rotation matrix from the GCRS to the ITRS, and its time derivative.
+     *  \param secondsSinceEpoch Seconds since J2000 (TDB) at which ephemeris is to be evaluated.
+     *  \param rotationToTargetFrame Rotation matrix from GCRS to ITRS (returned by reference).
+     *  \param rotationToTargetFrameDerivative Time derivative of rotation matrix from GCRS to ITRS (returned by
+     *  reference).
+     */
+    void computeRotationToTargetFrame( const double secondsSinceEpoch,
+                                       Eigen::Matrix3d& rotationToTargetFrame,
+                                       Eigen::Matrix3d& rotationToTargetFrameDerivative );
+
+    //! Function returning the CIP position and CIO locator as a function of TT in seconds since J2000.
+    boost::function< std::pair< Eigen::Vector2d, double >( const double ) > cipPositionFunction_;
+};
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_GCRSTOITRSROTATIONALEPHEMERIS_H
@@ -0,0 +1,297 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#include <boost/lexical_cast.hpp>
+#include <boost/make_shared.hpp>
+
+#include "Tudat/External/SofaInterface/tabulatedEarthOrientation.h"
+#include "Tudat/InputOutput/binaryStateHistoryCache.h"
+
+namespace tudat
+{
+
+namespace sofa_interface
+{
+
+//! Denominators of the Lagrange basis polynomials for six equidistant nodes (at 0, 1, ..., 5).
+static const double sixPointLagrangeDenominators[ 6 ] = { -120.0, 24.0, -12.0, 12.0, -24.0, 120.0 };
+
+//! Constructor, sets tabulated values.
+TabulatedPrecessionNutationCalculator::TabulatedPrecessionNutationCalculator(
+        const double initialTime,
+        const double timeStep,
+        const std::vector< Eigen::Vector3d >& tabulatedValues,
+        const IAUConventions precessionNutationTheory,
+        const double referenceJulianDay ):
+    initialTime_( initialTime ), timeStep_( timeStep ), inverseTimeStep_( 1.0 / timeStep ),
+    tabulatedValues_( tabulatedValues ), precessionNutationTheory_( precessionNutationTheory ),
+    referenceJulianDay_( referenceJulianDay )
+{
+    if( !( timeStep_ > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when creating tabulated precession-nutation calculator, time step must be "
+                                  "positive" );
+    }
+
+    if( tabulatedValues_.size( ) < 6 )
+    {
+        throw std::runtime_error( "Error when creating tabulated precession-nutation calculator, at least 6 tabulated "
+                                  "values required, " + boost::lexical_cast< std::string >( tabulatedValues_.size( ) ) +
+                                  " provided" );
+    }
+}
+
+//! Function to retrieve the interpolated CIP position and CIO locator
+std::pair< Eigen::Vector2d, double > TabulatedPrecessionNutationCalculator::getPositionOfCipInGcrs(
+        const double terrestrialTime )
+{
+    // Retrieve index of first interpolation node directly from time, such that the nodes are centered on the requested
+    // time (or the first/last nodes are used near the boundaries).
+    double stepsSinceStart = ( terrestrialTime - initialTime_ ) * inverseTimeStep_;
+    unsigned int lastFirstNodeIndex = tabulatedValues_.size( ) - 6;
+    unsigned int firstNodeIndex = 0;
+    if( stepsSinceStart >= static_cast< double >( lastFirstNodeIndex + 2 ) )
+    {
+        firstNodeIndex = lastFirstNodeIndex;
+    }
+    else if( stepsSinceStart >= 2.0 )
+    {
+        firstNodeIndex = static_cast< unsigned int >( stepsSinceStart ) - 2;
+    }
+
+    // Compute Lagrange basis polynomials, using products of distances to nodes before and after each node.
+    double scaledTime = stepsSinceStart - static_cast< double >( firstNodeIndex );
+    double nodeDistances[ 6 ];
+    for( unsigned int i = 0; i < 6; i++ )
+    {
+        nodeDistances[ i ] = scaledTime - static_cast< double >( i );
+    }
+
+    double productsBefore[ 6 ];
+    double productsAfter[ 6 ];
+    productsBefore[ 0 ] = 1.0;
+    productsAfter[ 5 ] = 1.0;
+    for( unsigned int i = 1; i < 6; i++ )
+    {
+        productsBefore[ i ] = productsBefore[ i - 1 ] * nodeDistances[ i - 1 ];
+        productsAfter[ 5 - i ] = productsAfter[ 6 - i ] * nodeDistances[ 6 - i ];
+    }
+
+    // Interpolate tabulated values.
+    Eigen::Vector3d interpolatedValues = Eigen::Vector3d::Zero( );
+    for( unsigned int i = 0; i < 6; i++ )
+    {
+        interpolatedValues += ( productsBefore[ i ] * productsAfter[ i ] / sixPointLagrangeDenominators[ i ] ) *
+                tabulatedValues_[ firstNodeIndex + i ];
+    }
+
+    return std::make_pair( Eigen::Vector2d( interpolatedValues.segment( 0, 2 ) ), interpolatedValues( 2 ) );
+}
+
+//! Function to compute the CIP position and CIO locator from the Sofa series at a list of times, for a range of indices.
+/*!
+ *  Function to compute the CIP position and CIO locator from the Sofa series at a list of times, for a range of
+ *  indices. This function is called (in parallel) by the computePositionsOfCipInGcrs function.
+ *  \param terrestrialTimes Times in TT in seconds since referenceJulianDay at which values are to be computed.
+ *  \param precessionNutationTheory IAU conventions that are to be used for calculation.
+ *  \param referenceJulianDay Julian day wrt which times are referenced.
+ *  \param startIndex Index of first time in terrestrialTimes at which values are to be computed.
+ *  \param endIndex Index after last time in terrestrialTimes at which values are to be computed.
+ *  \param cipPositions Values of X, Y and s at each of the times (entries startIndex to endIndex are set by this
+ *  function).
+ */
+void computePositionsOfCipInGcrsForIndexRange(
+        const std::vector< double >& terrestrialTimes,
+        const IAUConventions precessionNutationTheory,
+        const double referenceJulianDay,
+        const unsigned int startIndex,
+        const unsigned int endIndex,
+        std::vector< Eigen::Vector3d >& cipPositions )
+{
+    for( unsigned int i = startIndex; i < endIndex; i++ )
+    {
+        std::pair< Eigen::Vector2d, double > cipPosition = sofa_interface::getPositionOfCipInGcrs(
+                    terrestrialTimes[ i ], referenceJulianDay, precessionNutationTheory );
+        cipPositions[ i ] << cipPosition.first, cipPosition.second;
+    }
+}
+
+//! Function to compute the CIP position and CIO locator from the Sofa series at a list of times.
+std::vector< Eigen::Vector3d > computePositionsOfCipInGcrs(
+        const std::vector< double >& terrestrialTimes,
+        const IAUConventions precessionNutationTheory,
+        const double referenceJulianDay,
+        const unsigned int numberOfThreads )
+{
+    std::vector< Eigen::Vector3d > cipPositions( terrestrialTimes.size( ) );
+    if( terrestrialTimes.size( ) == 0 )
+    {
+        return cipPositions;
+    }
+
+    // Compute first value in this thread, so that invalid settings are reported as an exception.
+    computePositionsOfCipInGcrsForIndexRange(
+                terrestrialTimes, precessionNutationTheory, referenceJulianDay, 0, 1, cipPositions );
+
+    // Distribute remaining values over threads, in contiguous blocks (last block computed in this thread).
+    unsigned int numberOfBlocks = std::max( 1u, std::min( numberOfThreads, static_cast< unsigned int >(
+                                                              terrestrialTimes.size( ) - 1 ) ) );
+    unsigned int numberOfRemainingValues = terrestrialTimes.size( ) - 1;
+
+    std::vector< std::thread > threads;
+    for( unsigned int i = 0; i < numberOfBlocks; i++ )
+    {
+        unsigned int startIndex = 1 + ( i * numberOfRemainingValues ) / numberOfBlocks;
+        unsigned int endIndex = 1 + ( ( i + 1 ) * numberOfRemainingValues ) / numberOfBlocks;
+        if( i < numberOfBlocks - 1 )
+        {
+            threads.push_back( std::thread( &computePositionsOfCipInGcrsForIndexRange,
+                                            std::cref( terrestrialTimes ), precessionNutationTheory, referenceJulianDay,
+                                            startIndex, endIndex, std::ref( cipPositions ) ) );
+        }
+        else
+        {
+            computePositionsOfCipInGcrsForIndexRange(
+                        terrestrialTimes, precessionNutationTheory, referenceJulianDay, startIndex, endIndex,
+                        cipPositions );
+        }
+    }
+
+    for( unsigned int i = 0; i < threads.size( ); i++ )
+    {
+        threads.at( i ).join( );
+    }
+
+    return cipPositions;
+}
+
+//! Function to create an object that interpolates tabulated values of the CIP position and CIO locator.
+boost::shared_ptr< TabulatedPrecessionNutationCalculator > createTabulatedPrecessionNutationCalculator(
+        const double initialTime,
+        const double finalTime,
+        const double timeStep,
+        const IAUConventions precessionNutationTheory,
+        const unsigned int numberOfThreads,
+        const std::string& cacheDirectory,
+        const double maximumInterpolationError,
+        const double referenceJulianDay )
+{
+    if( !( finalTime > initialTime ) || !( timeStep > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when creating tabulated precession-nutation calculator, inconsistent time "
+                                  "settings" );
+    }
+
+    // Determine tabulated times, such that the final time is covered and at least 6 values are tabulated.
+    unsigned int numberOfTabulatedValues = std::max(
+                6u, static_cast< unsigned int >( std::ceil( ( finalTime - initialTime ) / timeStep - 1.0E-12 ) ) + 1 );
+    std::vector< double > tabulatedTimes( numberOfTabulatedValues );
+    for( unsigned int i = 0; i < numberOfTabulatedValues; i++ )
+    {
+        tabulatedTimes[ i ] = initialTime + static_cast< double >( i ) * timeStep;
+    }
+
+    // Try to read tabulated values from cache file.
+    std::string cacheKey;
+    std::string cacheFileName;
+    std::vector< Eigen::Vector3d > tabulatedValues;
+    if( cacheDirectory != "" )
+    {
+        std::ostringstream cacheKeyStream;
+        cacheKeyStream.precision( 17 );
+        cacheKeyStream << "precessionNutation;theory=" << precessionNutationTheory
+                       << ";referenceJulianDay=" << referenceJulianDay
+                       << ";initialTime=" << initialTime << ";timeStep=" << timeStep
+                       << ";numberOfValues=" << numberOfTabulatedValues
+                       << ";maximumInterpolationError=" << maximumInterpolationError;
+        cacheKey = cacheKeyStream.str( );
+        cacheFileName = input_output::getBinaryStateHistoryCacheFileName( cacheDirectory, cacheKey );
+
+        std::map< double, Eigen::Vector3d > cachedValues;
+        if( input_output::readStateHistoryFromBinaryCacheFile( cacheFileName, cacheKey, cachedValues ) &&
+                cachedValues.size( ) == numberOfTabulatedValues )
+        {
+            for( std::map< double, Eigen::Vector3d >::const_iterator valueIterator = cachedValues.begin( );
+                 valueIterator != cachedValues.end( ); valueIterator++ )
+            {
+                tabulatedValues.push_back( valueIterator->second );
+            }
+
+            return boost::make_shared< TabulatedPrecessionNutationCalculator >(
+                        initialTime, timeStep, tabulatedValues, precessionNutationTheory, referenceJulianDay );
+        }
+    }
+
+    // Compute tabulated values, and values at check times halfway between tabulated times (for every 16th interval,
+    // and the first and last intervals), in a single (parallel) evaluation.
+    std::vector< double > checkTimes;
+    for( unsigned int i = 0; i < numberOfTabulatedValues - 1; i++ )
+    {
+        if( i % 16 == 0 || i == numberOfTabulatedValues - 2 )
+        {
+            checkTimes.push_back( tabulatedTimes[ i ] + 0.5 * timeStep );
+        }
+    }
+
+    std::vector< double > evaluationTimes = tabulatedTimes;
+    evaluationTimes.insert( evaluationTimes.end( ), checkTimes.begin( ), checkTimes.end( ) );
+    std::vector< Eigen::Vector3d > evaluatedValues = computePositionsOfCipInGcrs(
+                evaluationTimes, precessionNutationTheory, referenceJulianDay, numberOfThreads );
+
+    tabulatedValues.assign( evaluatedValues.begin( ), evaluatedValues.begin( ) + numberOfTabulatedValues );
+    boost::shared_ptr< TabulatedPrecessionNutationCalculator > tabulatedCalculator =
+            boost::make_shared< TabulatedPrecessionNutationCalculator >(
+                initialTime, timeStep, tabulatedValues, precessionNutationTheory, referenceJulianDay );
+
+    // Check interpolation error.
+    double maximumError = 0.0;
+    for( unsigned int i = 0; i < checkTimes.size( ); i++ )
+    {
+        std::pair< Eigen::Vector2d, double > interpolatedValue =
+                tabulatedCalculator->getPositionOfCipInGcrs( checkTimes[ i ] );
+        Eigen::Vector3d checkValue = evaluatedValues[ numberOfTabulatedValues + i ];
+        maximumError = std::max( maximumError, std::max(
+                                     ( interpolatedValue.first - checkValue.segment( 0, 2 ) ).cwiseAbs( ).maxCoeff( ),
+                                     std::fabs( interpolatedValue.second - checkValue( 2 ) ) ) );
+    }
+
+    if( maximumError > maximumInterpolationError )
+    {
+        throw std::runtime_error( "Error when creating tabulated precession-nutation calculator, interpolation error " +
+                                  boost::lexical_cast< std::string >( maximumError ) + " exceeds tolerance " +
+                                  boost::lexical_cast< std::string >( maximumInterpolationError ) +
+                                  ", reduce time step" );
+    }
+
+    // Save tabulated values to cache file.
+    if( cacheDirectory != "" )
+    {
+        std::map< double, Eigen::Vector3d > valuesToCache;
+        for( unsigned int i = 0; i < numberOfTabulatedValues; i++ )
+        {
+            valuesToCache[ tabulatedTimes[ i ] ] = tabulatedValues[ i ];
+        }
+        input_output::writeStateHistoryToBinaryCacheFile( valuesToCache, cacheFileName, cacheKey );
+    }
+
+    return tabulatedCalculator;
+}
+
+} // namespace sofa_interface
+
+} // namespace tudat
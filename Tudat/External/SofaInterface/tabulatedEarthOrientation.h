@@ -0,0 +1,202 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_TABULATEDEARTHORIENTATION_H
+#define TUDAT_TABULATEDEARTHORIENTATION_H
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/External/SofaInterface/earthOrientation.h"
+
+namespace tudat
+{
+
+namespace sofa_interface
+{
+
+//! Class to retrieve the CIP position and CIO locator by interpolating tabulated values from the Sofa series.
+/*!
+ *  Class to retrieve the CIP position (X, Y) and CIO locator (s) by interpolating values that are tabulated at
+ *  equidistant times, computed once from the (computationally expensive) precession-nutation series in Sofa (see
+ *  getPositionOfCipInGcrs). The values are interpolated by a 6-point (quintic) Lagrange polynomial, centered on the
+ *  requested time where possible. As the tabulated times are equidistant, the nodes of the interpolation are found
+ *  directly (without any search), and objects of this class have no mutable state, so that they may be used from
+ *  multiple threads. Objects of this class are typically created by the createTabulatedPrecessionNutationCalculator
+ *  function. Note that the Earth rotation angle is a linear function of UT1, which is directly evaluated by the
+ *  calculateEarthRotationAngle function at negligible cost, and is therefore not tabulated.
+ */
+class TabulatedPrecessionNutationCalculator
+{
+public:
+
+    //! Constructor, sets tabulated values.
+    /*!
+     *  Constructor, sets tabulated values.
+     *  \param initialTime Time (TT in seconds since referenceJulianDay) of the first tabulated value.
+     *  \param timeStep Time between subsequent tabulated values.
+     *  \param tabulatedValues Tabulated values of X, Y and s (in that order) at equidistant times, starting at
+     *  initialTime. At least 6 values are required.
+     *  \param precessionNutationTheory IAU conventions from which the tabulated values were computed.
+     *  \param referenceJulianDay Julian day wrt which times are referenced.
+     */
+    TabulatedPrecessionNutationCalculator(
+            const double initialTime,
+            const double timeStep,
+            const std::vector< Eigen::Vector3d >& tabulatedValues,
+            const IAUConventions precessionNutationTheory,
+            const double referenceJulianDay = basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+
+    //! Function to retrieve the interpolated CIP position and CIO locator
+    /*!
+     *  Function to retrieve the interpolated CIP position and CIO locator, with the same output as the
+     *  getPositionOfCipInGcrs function. Times outside the range of the tabulated values are extrapolated from the first
+     *  or last six tabulated values.
+     *  \param terrestrialTime Time in TT in seconds since reference julian day.
+     *  \return Pair of first: Vector of entries X, Y (in that order) CIP values and second: CIO locator.
+     */
+    std::pair< Eigen::Vector2d, double > getPositionOfCipInGcrs( const double terrestrialTime );
+
+    //! Function to return the time of the first tabulated value.
+    /*!
+     *  Function to return the time of the first tabulated value.
+     *  \return Time of the first tabulated value.
+     */
+    double getInitialTime( )
+    {
+        return initialTime_;
+    }
+
+    //! Function to return the time of the last tabulated value.
+    /*!
+     *  Function to return the time of the last tabulated value.
+     *  \return Time of the last tabulated value.
+     */
+    double getFinalTime( )
+    {
+        return initialTime_ + timeStep_ * static_cast< double >( tabulatedValues_.size( ) - 1 );
+    }
+
+    //! Function to return the time between subsequent tabulated values.
+    /*!
+     *  Function to return the time between subsequent tabulated values.
+     *  \return Time between subsequent tabulated values.
+     */
+    double getTimeStep( )
+    {
+        return timeStep_;
+    }
+
+    //! Function to return the tabulated values of X, Y and s.
+    /*!
+     *  Function to return the tabulated values of X, Y and s.
+     *  \return Tabulated values of X, Y and s.
+     */
+    const std::vector< Eigen::Vector3d >& getTabulatedValues( )
+    {
+        return tabulatedValues_;
+    }
+
+    //! Function to return the IAU conventions from which the tabulated values were computed.
+    /*!
+     *  Function to return the IAU conventions from which the tabulated values were computed.
+     *  \return IAU conventions from which the tabulated values were computed.
+     */
+    IAUConventions getPrecessionNutationTheory( )
+    {
+        return precessionNutationTheory_;
+    }
+
+    //! Function to return the Julian day wrt which times are referenced.
+    /*!
+     *  Function to return the Julian day wrt which times are referenced.
+     *  \return Julian day wrt which times are referenced.
+     */
+    double getReferenceJulianDay( )
+    {
+        return referenceJulianDay_;
+    }
+
+private:
+
+    //! Time of the first tabulated value.
+    double initialTime_;
+
+    //! Time between subsequent tabulated values.
+    double timeStep_;
+
+    //! Inverse of time between subsequent tabulated values (pre-computed for efficiency).
+    double inverseTimeStep_;
+
+    //! Tabulated values of X, Y and s.
+    std::vector< Eigen::Vector3d > tabulatedValues_;
+
+    //! IAU conventions from which the tabulated values were computed.
+    IAUConventions precessionNutationTheory_;
+
+    //! Julian day wrt which times are referenced.
+    double referenceJulianDay_;
+};
+
+//! Function to compute the CIP position and CIO locator from the Sofa series at a list of times.
+/*!
+ *  Function to compute the CIP position and CIO locator from the Sofa series (see getPositionOfCipInGcrs) at a list of
+ *  times, optionally distributing the computations over multiple threads.
+ *  \param terrestrialTimes Times in TT in seconds since referenceJulianDay at which values are to be computed.
+ *  \param precessionNutationTheory IAU conventions that are to be used for calculation.
+ *  \param referenceJulianDay Julian day wrt which times are referenced.
+ *  \param numberOfThreads Number of threads over which the computations are distributed.
+ *  \return Values of X, Y and s (in that order) at each of the requested times.
+ */
+std::vector< Eigen::Vector3d > computePositionsOfCipInGcrs(
+        const std::vector< double >& terrestrialTimes,
+        const IAUConventions precessionNutationTheory,
+        const double referenceJulianDay,
+        const unsigned int numberOfThreads = 1 );
+
+//! Function to create an object that interpolates tabulated values of the CIP position and CIO locator.
+/*!
+ *  Function to create an object that interpolates tabulated values of the CIP position and CIO locator, computed from
+ *  the Sofa series at equidistant times. After tabulation, the interpolation error is checked by comparison with the
+ *  Sofa series halfway between the tabulated times (for a subset of the intervals, including the first and last), and
+ *  an error is thrown if the maximum interpolation error exceeds the given tolerance. If a cache directory is given, the
+ *  tabulated values are saved to a binary file in that directory, from which they are read when this function is
+ *  called with identical settings, skipping the series evaluations entirely.
+ *  \param initialTime Start time (TT in seconds since referenceJulianDay) of the tabulated values.
+ *  \param finalTime End time (TT in seconds since referenceJulianDay) of the tabulated values (rounded up to an integer
+ *  number of time steps).
+ *  \param timeStep Time between subsequent tabulated values.
+ *  \param precessionNutationTheory IAU conventions that are to be used for calculation.
+ *  \param numberOfThreads Number of threads over which the series evaluations are distributed.
+ *  \param cacheDirectory Directory in which binary file with tabulated values is to be stored (none if empty).
+ *  \param maximumInterpolationError Maximum allowed interpolation error of X, Y and s.
+ *  \param referenceJulianDay Julian day wrt which times are referenced.
+ *  \return Object that interpolates tabulated values of the CIP position and CIO locator.
+ */
+boost::shared_ptr< TabulatedPrecessionNutationCalculator > createTabulatedPrecessionNutationCalculator(
+        const double initialTime,
+        const double finalTime,
+        const double timeStep = 6.0 * 3600.0,
+        const IAUConventions precessionNutationTheory = iau_2006,
+        const unsigned int numberOfThreads = 1,
+        const std::string& cacheDirectory = "",
+        const double maximumInterpolationError = 1.0E-12,
+        const double referenceJulianDay = basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+
+} // namespace sofa_interface
+
+} // namespace tudat
+
+#endif // TUDAT_TABULATEDEARTHORIENTATION_H
@@ -24,6 +24,7 @@
 #ifndef TUDAT_SPICE_INTERFACE_H
 #define TUDAT_SPICE_INTERFACE_H
 
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -43,6 +44,19 @@ namespace tudat
 namespace spice_interface
 {
 
+//! Function to retrieve the mutex by which all calls to Spice are serialized.
+/*!
+ *  Function to retrieve the mutex by which all calls to Spice are serialized. The Spice library is not thread-safe (it
+ *  uses global state for, for instance, the kernel pool, file handles and error status). All functions in this file
+ *  lock this mutex before calling Spice, so that they may be safely called from multiple threads (at the expense of
+ *  these calls being executed sequentially). Any code calling Spice directly should also lock this mutex. A recursive
+ *  mutex is used, so that the functions in this file may call each other. For lock-free access to ephemerides from
+ *  multiple threads, Spice data may be presampled into an immutable ephemeris, see
+ *  DirectSpiceEphemerisSettings::setPresampledThreadSafeAccess.
+ *  \return Mutex by which all calls to Spice are serialized.
+ */
+std::recursive_mutex& getSpiceMutex( );
+
 //! Convert a Julian date to ephemeris time (equivalent to TDB in Spice).
 /*!
  * Function to convert a Julian date to ephemeris time, which is equivalent to barycentric
@@ -252,6 +266,14 @@ void loadSpiceKernelInTudat( const std::string& fileName );
  */
 int getTotalCountOfKernelsLoaded( );
 
+//! Get the file names of all loaded Spice kernels.
+/*!
+ * This function returns the file names of all Spice kernels that are loaded into the kernel pool, in the order in which
+ * they were loaded. Wrapper for the ktotal_c and kdata_c functions.
+ * \return File names of all loaded Spice kernels.
+ */
+std::vector< std::string > getLoadedSpiceKernels( );
+
 //! Clear all Spice kernels.
 /*!
  * This function removes all Spice kernels from the kernel pool. Wrapper for the kclear_c function.
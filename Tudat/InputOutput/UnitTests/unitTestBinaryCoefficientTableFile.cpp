@@ -0,0 +1,166 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/InputOutput/basicInputOutput.h"
+#include "Tudat/InputOutput/binaryCoefficientTableFile.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_binary_coefficient_table_file )
+
+//! Test whether coefficient table is correctly written to and read from binary file.
+BOOST_AUTO_TEST_CASE( testBinaryCoefficientTableFile )
+{
+    using namespace input_output;
+
+    // Create three-dimensional table in Fortran storage order with non-zero index bases.
+    std::vector< std::vector< double > > independentVariables( 3 );
+    for( int i = 0; i < 5; i++ )
+    {
+        independentVariables[ 0 ].push_back( 0.5 * i * i );
+    }
+    for( int i = 0; i < 4; i++ )
+    {
+        independentVariables[ 1 ].push_back( -2.0 + 1.3 * i );
+    }
+    for( int i = 0; i < 7; i++ )
+    {
+        independentVariables[ 2 ].push_back( 0.1 * i );
+    }
+
+    boost::multi_array< Eigen::Vector6d, 3 > coefficients(
+                boost::extents[ 5 ][ 4 ][ 7 ], boost::fortran_storage_order( ) );
+    coefficients.reindex( 1 );
+    for( int i = 1; i <= 5; i++ )
+    {
+        for( int j = 1; j <= 4; j++ )
+        {
+            for( int k = 1; k <= 7; k++ )
+            {
+                coefficients[ i ][ j ][ k ] = Eigen::Vector6d::Random( );
+            }
+        }
+    }
+
+    boost::filesystem::path tableDirectory =
+            boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( "tudat_tables_%%%%-%%%%" );
+    std::string fileName = ( tableDirectory / "coefficients.bin" ).string( );
+    writeCoefficientTableToBinaryFile< 3, 6 >( coefficients, independentVariables, fileName );
+
+    // Check that table is reproduced exactly.
+    {
+        MappedBinaryCoefficientTable< 3, 6 > coefficientTable( fileName );
+        BOOST_CHECK( coefficientTable.getIndependentVariables( ) == independentVariables );
+        for( int i = 0; i < 5; i++ )
+        {
+            for( int j = 0; j < 4; j++ )
+            {
+                for( int k = 0; k < 7; k++ )
+                {
+                    BOOST_CHECK( coefficientTable.getCoefficients( )[ i ][ j ][ k ] ==
+                                 coefficients[ i + 1 ][ j + 1 ][ k + 1 ] );
+                }
+            }
+        }
+    }
+
+    // Check that interpolator from mapped file is identical to interpolator from original table, also after the
+    // table object used to create it has gone out of scope.
+    boost::shared_ptr< interpolators::MultiLinearInterpolator< double, Eigen::Vector6d, 3 > > mappedInterpolator =
+            createMultiLinearInterpolatorFromBinaryFile< 3, 6 >( fileName );
+    interpolators::MultiLinearInterpolator< double, Eigen::Vector6d, 3 > originalInterpolator(
+                independentVariables, coefficients );
+    for( int testIndex = 0; testIndex < 100; testIndex++ )
+    {
+        std::vector< double > testPoint;
+        testPoint.push_back( -0.5 + 0.091 * testIndex );
+        testPoint.push_back( -2.5 + 0.047 * testIndex );
+        testPoint.push_back( 0.0071 * testIndex );
+        BOOST_CHECK( mappedInterpolator->interpolate( testPoint ) == originalInterpolator.interpolate( testPoint ) );
+    }
+
+    // Check that inconsistent table dimensions and a truncated file are rejected.
+    bool isExceptionCaught = false;
+    try
+    {
+        MappedBinaryCoefficientTable< 3, 3 > inconsistentTable( fileName );
+    }
+    catch( std::runtime_error )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+
+    std::string truncatedFileName = ( tableDirectory / "truncated.bin" ).string( );
+    boost::filesystem::copy_file( fileName, truncatedFileName );
+    boost::filesystem::resize_file( truncatedFileName, boost::filesystem::file_size( fileName ) - 8 );
+    isExceptionCaught = false;
+    try
+    {
+        MappedBinaryCoefficientTable< 3, 6 > truncatedTable( truncatedFileName );
+    }
+    catch( std::runtime_error )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+
+    mappedInterpolator.reset( );
+    boost::filesystem::remove_all( tableDirectory );
+}
+
+//! Test whether aerodynamic coefficient text files are correctly converted to binary file.
+BOOST_AUTO_TEST_CASE( testAerodynamicCoefficientFileConversion )
+{
+    using namespace input_output;
+
+    std::map< int, std::string > fileNames;
+    fileNames[ 0 ] = getTudatRootPath( ) + "/Astrodynamics/Aerodynamics/UnitTests/aurora_CD.txt";
+    fileNames[ 2 ] = getTudatRootPath( ) + "/Astrodynamics/Aerodynamics/UnitTests/aurora_CL.txt";
+
+    boost::filesystem::path tableDirectory =
+            boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( "tudat_tables_%%%%-%%%%" );
+    std::string fileName = ( tableDirectory / "aurora.bin" ).string( );
+    convertAerodynamicCoefficientFilesToBinaryFile< 2 >( fileNames, fileName );
+
+    std::pair< boost::multi_array< Eigen::Vector3d, 2 >, std::vector< std::vector< double > > > textCoefficients =
+            readAerodynamicCoefficients< 2 >( fileNames );
+    {
+        MappedBinaryCoefficientTable< 2, 3 > coefficientTable( fileName );
+        BOOST_CHECK( coefficientTable.getIndependentVariables( ) == textCoefficients.second );
+        BOOST_CHECK( coefficientTable.getCoefficients( ) == textCoefficients.first );
+    }
+
+    boost::filesystem::remove_all( tableDirectory );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,79 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <map>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/InputOutput/binaryStateHistoryCache.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_binary_state_history_cache )
+
+//! Test whether state history is correctly written to and read from binary cache file.
+BOOST_AUTO_TEST_CASE( testBinaryStateHistoryCache )
+{
+    using namespace input_output;
+
+    // Create state histories
+    std::map< double, Eigen::Vector6d > stateHistory;
+    std::map< double, Eigen::Matrix< long double, 6, 1 > > longStateHistory;
+    for( int i = 0; i < 1000; i++ )
+    {
+        stateHistory[ 0.1 * static_cast< double >( i ) - 3.0 ] = Eigen::Vector6d::Random( );
+        longStateHistory[ 0.1 * static_cast< double >( i ) - 3.0 ] =
+                stateHistory[ 0.1 * static_cast< double >( i ) - 3.0 ].cast< long double >( ) / 3.0L;
+    }
+
+    boost::filesystem::path cacheDirectory =
+            boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( "tudat_cache_%%%%-%%%%" );
+    std::string cacheKey = "body=Earth;origin=SSB";
+    std::string fileName = getBinaryStateHistoryCacheFileName( cacheDirectory.string( ), cacheKey );
+    std::string longFileName = getBinaryStateHistoryCacheFileName( cacheDirectory.string( ), cacheKey + ";long" );
+
+    // Check that no file is read before creation
+    std::map< double, Eigen::Vector6d > readStateHistory;
+    BOOST_CHECK( !readStateHistoryFromBinaryCacheFile( fileName, cacheKey, readStateHistory ) );
+
+    writeStateHistoryToBinaryCacheFile( stateHistory, fileName, cacheKey );
+    writeStateHistoryToBinaryCacheFile( longStateHistory, longFileName, cacheKey + ";long" );
+
+    // Check that file is not read for different key or data type
+    BOOST_CHECK( !readStateHistoryFromBinaryCacheFile( fileName, cacheKey + ";other", readStateHistory ) );
+    BOOST_CHECK( !readStateHistoryFromBinaryCacheFile( fileName, "body=Mars;origin=SSB", readStateHistory ) );
+    std::map< double, Eigen::Matrix< long double, 6, 1 > > readLongStateHistory;
+    BOOST_CHECK( !readStateHistoryFromBinaryCacheFile( fileName, cacheKey, readLongStateHistory ) );
+    BOOST_CHECK_EQUAL( readStateHistory.size( ), 0 );
+
+    // Read files and compare with original data (bit-wise equal)
+    BOOST_CHECK( readStateHistoryFromBinaryCacheFile( fileName, cacheKey, readStateHistory ) );
+    BOOST_CHECK( readStateHistoryFromBinaryCacheFile( longFileName, cacheKey + ";long", readLongStateHistory ) );
+    BOOST_CHECK( readStateHistory == stateHistory );
+    BOOST_CHECK( readLongStateHistory == longStateHistory );
+
+    boost::filesystem::remove_all( cacheDirectory );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
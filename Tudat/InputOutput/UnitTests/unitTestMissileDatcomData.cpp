@@ -18,14 +18,17 @@
 #include <limits>
 #include <string>
 
+#include <boost/filesystem.hpp>
 #include <boost/test/floating_point_comparison.hpp>
 #include <boost/test/unit_test.hpp>
 #include <boost/lexical_cast.hpp>
 
+#include "Tudat/Astrodynamics/BasicAstrodynamics/unitConversions.h"
 #include "Tudat/Basics/testMacros.h"
 #include "Tudat/InputOutput/matrixTextFileReader.h"
 
 #include "Tudat/InputOutput/basicInputOutput.h"
+#include "Tudat/InputOutput/binaryCoefficientTableFile.h"
 #include "Tudat/InputOutput/missileDatcomData.h"
 
 namespace tudat
@@ -88,6 +91,64 @@ BOOST_AUTO_TEST_CASE( testMissileDatcomData )
     }
 }
 
+//! Test writing of static coefficients to binary coefficient table files.
+BOOST_AUTO_TEST_CASE( testMissileDatcomDataBinaryFiles )
+{
+    using namespace input_output;
+
+    // Read and process data file.
+    std::string fileLocation = getTudatRootPath( )
+            + "InputOutput/UnitTests/inputForBenchMarkMissileDatcomData.dat";
+    MissileDatcomData myMissileDatcomData( fileLocation );
+
+    // Write binary files, and map them into memory.
+    boost::filesystem::path outputDirectory =
+            boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( "tudat_datcom_%%%%-%%%%" );
+    std::string forceCoefficientFile = ( outputDirectory / "forceCoefficients.bin" ).string( );
+    std::string momentCoefficientFile = ( outputDirectory / "momentCoefficients.bin" ).string( );
+    myMissileDatcomData.writeCoefficientsToBinaryFiles( forceCoefficientFile, momentCoefficientFile );
+
+    BOOST_CHECK_EQUAL( getNumberOfDimensionsInBinaryCoefficientTableFile( forceCoefficientFile ), 2u );
+    MappedBinaryCoefficientTable< 2, 3 > forceCoefficientTable( forceCoefficientFile );
+    MappedBinaryCoefficientTable< 2, 3 > momentCoefficientTable( momentCoefficientFile );
+
+    // Check independent variables and coefficients.
+    std::vector< double > machNumbers = myMissileDatcomData.getMachNumbers( );
+    std::vector< double > anglesOfAttack = myMissileDatcomData.getAngleOfAttacks( );
+    BOOST_CHECK( forceCoefficientTable.getIndependentVariables( )[ 0 ] == machNumbers );
+    BOOST_CHECK_EQUAL( forceCoefficientTable.getIndependentVariables( )[ 1 ].size( ), anglesOfAttack.size( ) );
+    for ( unsigned int j = 0; j < anglesOfAttack.size( ); j++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( forceCoefficientTable.getIndependentVariables( )[ 1 ][ j ],
+                                    unit_conversions::convertDegreesToRadians( anglesOfAttack[ j ] ),
+                                    std::numeric_limits< double >::epsilon( ) );
+    }
+
+    for ( unsigned int i = 0; i < machNumbers.size( ); i++ )
+    {
+        for ( unsigned int j = 0; j < anglesOfAttack.size( ); j++ )
+        {
+            Eigen::Vector3d forceCoefficients = forceCoefficientTable.getCoefficients( )[ i ][ j ];
+            Eigen::Vector3d momentCoefficients = momentCoefficientTable.getCoefficients( )[ i ][ j ];
+
+            BOOST_CHECK_EQUAL( forceCoefficients( 0 ),
+                               myMissileDatcomData.getStaticCoefficient( i, j, MissileDatcomData::ca ) );
+            BOOST_CHECK_EQUAL( forceCoefficients( 1 ),
+                               -myMissileDatcomData.getStaticCoefficient( i, j, MissileDatcomData::cy ) );
+            BOOST_CHECK_EQUAL( forceCoefficients( 2 ),
+                               myMissileDatcomData.getStaticCoefficient( i, j, MissileDatcomData::cn ) );
+            BOOST_CHECK_EQUAL( momentCoefficients( 0 ),
+                               myMissileDatcomData.getStaticCoefficient( i, j, MissileDatcomData::cll ) );
+            BOOST_CHECK_EQUAL( momentCoefficients( 1 ),
+                               myMissileDatcomData.getStaticCoefficient( i, j, MissileDatcomData::cm ) );
+            BOOST_CHECK_EQUAL( momentCoefficients( 2 ),
+                               myMissileDatcomData.getStaticCoefficient( i, j, MissileDatcomData::cln ) );
+        }
+    }
+
+    boost::filesystem::remove_all( outputDirectory );
+}
+
 } // namespace unit_tests
 } // namespace tudat
 
@@ -8,6 +8,9 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#ifndef TUDAT_AERODYNAMICCOEFFICIENTREADER_H
+#define TUDAT_AERODYNAMICCOEFFICIENTREADER_H
+
 #include <map>
 #include <iostream>
 
@@ -220,3 +223,5 @@ readAerodynamicCoefficients( const std::map< int, std::string >& fileNames )
 }
 
 }
+
+#endif // TUDAT_AERODYNAMICCOEFFICIENTREADER_H
@@ -0,0 +1,429 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_BINARYCOEFFICIENTTABLEFILE_H
+#define TUDAT_BINARYCOEFFICIENTTABLEFILE_H
+
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/array.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/multi_array.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/InputOutput/aerodynamicCoefficientReader.h"
+#include "Tudat/Mathematics/Interpolators/createInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/multiLinearInterpolator.h"
+
+namespace tudat
+{
+
+namespace input_output
+{
+
+//! Identifier at start of each binary coefficient table file.
+static const char binaryCoefficientTableIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'B', 'C', 'T' };
+
+//! Version of binary coefficient table file format.
+static const boost::uint32_t binaryCoefficientTableVersion = 1;
+
+//! Header of binary coefficient table file.
+/*!
+ *  Header of binary coefficient table file. The header is followed by the number of data points of each independent
+ *  variable (as 64-bit unsigned integers) and the data points of all independent variables (as doubles). After padding
+ *  with zeros up to a multiple of 64 bytes, the coefficients are stored as one contiguous block, in C storage order
+ *  (last independent variable varying fastest), with the entries of each coefficient vector stored contiguously. All
+ *  data are stored in the native byte order of the machine that wrote the file.
+ */
+struct BinaryCoefficientTableHeader
+{
+    //! Identifier of file type (equal to binaryCoefficientTableIdentifier).
+    char identifier[ 8 ];
+
+    //! Version of file format.
+    boost::uint32_t version;
+
+    //! Number of independent variables of the table.
+    boost::uint32_t numberOfDimensions;
+
+    //! Number of entries in each coefficient vector.
+    boost::uint32_t numberOfCoefficients;
+
+    //! Size (in bytes) of a single coefficient entry.
+    boost::uint32_t coefficientEntrySize;
+};
+
+//! Function to compute number of bytes before start of the coefficient data in a binary coefficient table file
+/*!
+ *  Function to compute number of bytes before start of the coefficient data in a binary coefficient table file.
+ *  \param numberOfDimensions Number of independent variables of the table.
+ *  \param totalNumberOfDataPoints Sum of the number of data points of all independent variables.
+ *  \return Number of bytes before start of the coefficient data.
+ */
+inline boost::uint64_t getBinaryCoefficientTableDataOffset( const boost::uint64_t numberOfDimensions,
+                                                            const boost::uint64_t totalNumberOfDataPoints )
+{
+    boost::uint64_t unpaddedOffset = sizeof( BinaryCoefficientTableHeader ) +
+            numberOfDimensions * sizeof( boost::uint64_t ) + totalNumberOfDataPoints * sizeof( double );
+    return 64 * ( ( unpaddedOffset + 63 ) / 64 );
+}
+
+//! Function to retrieve the number of independent variables of the table in a binary coefficient table file.
+/*!
+ *  Function to retrieve the number of independent variables of the table in a binary coefficient table file, as
+ *  written by writeCoefficientTableToBinaryFile, from its header. An exception is thrown if the file cannot be read, or
+ *  if it is not a binary coefficient table file of the current version.
+ *  \param fileName Name of binary coefficient table file.
+ *  \return Number of independent variables of the table in the file.
+ */
+inline unsigned int getNumberOfDimensionsInBinaryCoefficientTableFile( const std::string& fileName )
+{
+    BinaryCoefficientTableHeader header;
+    std::ifstream inputStream( fileName.c_str( ), std::ios::binary );
+    inputStream.read( reinterpret_cast< char* >( &header ), sizeof( BinaryCoefficientTableHeader ) );
+    if( !inputStream.good( ) ||
+            std::memcmp( header.identifier, binaryCoefficientTableIdentifier, 8 ) != 0 ||
+            header.version != binaryCoefficientTableVersion )
+    {
+        throw std::runtime_error( "Error when reading binary coefficient table, file " + fileName +
+                                  " could not be read or is not a binary coefficient table file" );
+    }
+    return header.numberOfDimensions;
+}
+
+//! Function to write a table of coefficients to a binary file.
+/*!
+ *  Function to write a table of coefficients, defined on a grid of independent variables, to a binary file, that can be
+ *  memory-mapped when reading it by the MappedBinaryCoefficientTable class. The coefficients may be provided in any
+ *  storage order and with any index bases. The file is first written to a temporary file, which is then renamed, so
+ *  that other processes never read a partially written file.
+ *  \param coefficients Multi-array of coefficients at each point of the grid of independent variables.
+ *  \param independentVariables Data points of each of the independent variables of the coefficients.
+ *  \param fileName Name of file to which coefficients are to be written.
+ */
+template< unsigned int NumberOfDimensions, int NumberOfCoefficients >
+void writeCoefficientTableToBinaryFile(
+        const boost::multi_array< Eigen::Matrix< double, NumberOfCoefficients, 1 >,
+        static_cast< size_t >( NumberOfDimensions ) >& coefficients,
+        const std::vector< std::vector< double > >& independentVariables,
+        const std::string& fileName )
+{
+    typedef Eigen::Matrix< double, NumberOfCoefficients, 1 > CoefficientType;
+
+    // Check consistency of input.
+    if( independentVariables.size( ) != NumberOfDimensions )
+    {
+        throw std::runtime_error( "Error when writing binary coefficient table, number of independent variables is inconsistent" );
+    }
+
+    boost::array< boost::uint64_t, NumberOfDimensions > numberOfDataPoints;
+    boost::uint64_t totalNumberOfDataPoints = 0;
+    for( unsigned int i = 0; i < NumberOfDimensions; i++ )
+    {
+        if( independentVariables.at( i ).size( ) != coefficients.shape( )[ i ] )
+        {
+            throw std::runtime_error( "Error when writing binary coefficient table, size of coefficients and independent variables is inconsistent" );
+        }
+        numberOfDataPoints[ i ] = independentVariables.at( i ).size( );
+        totalNumberOfDataPoints += numberOfDataPoints[ i ];
+    }
+
+    // Copy coefficients to C storage order with zero index bases.
+    boost::multi_array< CoefficientType, static_cast< size_t >( NumberOfDimensions ) > orderedCoefficients(
+                std::vector< size_t >( coefficients.shape( ), coefficients.shape( ) + NumberOfDimensions ) );
+    orderedCoefficients = coefficients;
+
+    // Create directory, if needed.
+    boost::filesystem::path filePath( fileName );
+    if( filePath.has_parent_path( ) )
+    {
+        boost::filesystem::create_directories( filePath.parent_path( ) );
+    }
+
+    // Set header
+    BinaryCoefficientTableHeader header;
+    std::memcpy( header.identifier, binaryCoefficientTableIdentifier, 8 );
+    header.version = binaryCoefficientTableVersion;
+    header.numberOfDimensions = NumberOfDimensions;
+    header.numberOfCoefficients = NumberOfCoefficients;
+    header.coefficientEntrySize = sizeof( double );
+
+    // Write file to temporary location.
+    boost::filesystem::path temporaryFilePath = filePath;
+    temporaryFilePath += boost::filesystem::unique_path( ".%%%%-%%%%-%%%%.tmp" );
+    {
+        std::ofstream outputStream( temporaryFilePath.string( ).c_str( ), std::ios::binary | std::ios::trunc );
+        if( !outputStream.good( ) )
+        {
+            throw std::runtime_error( "Error when writing binary coefficient table, could not open file " +
+                                      temporaryFilePath.string( ) );
+        }
+
+        outputStream.write( reinterpret_cast< const char* >( &header ), sizeof( BinaryCoefficientTableHeader ) );
+        outputStream.write( reinterpret_cast< const char* >( numberOfDataPoints.data( ) ),
+                            NumberOfDimensions * sizeof( boost::uint64_t ) );
+        for( unsigned int i = 0; i < NumberOfDimensions; i++ )
+        {
+            outputStream.write( reinterpret_cast< const char* >( independentVariables.at( i ).data( ) ),
+                                numberOfDataPoints[ i ] * sizeof( double ) );
+        }
+
+        std::string padding( getBinaryCoefficientTableDataOffset( NumberOfDimensions, totalNumberOfDataPoints ) -
+                             sizeof( BinaryCoefficientTableHeader ) - NumberOfDimensions * sizeof( boost::uint64_t ) -
+                             totalNumberOfDataPoints * sizeof( double ), '\0' );
+        outputStream.write( padding.c_str( ), padding.size( ) );
+
+        const CoefficientType* coefficientData = orderedCoefficients.data( );
+        for( size_t i = 0; i < orderedCoefficients.num_elements( ); i++ )
+        {
+            outputStream.write( reinterpret_cast< const char* >( coefficientData[ i ].data( ) ),
+                                NumberOfCoefficients * sizeof( double ) );
+        }
+
+        if( !outputStream.good( ) )
+        {
+            throw std::runtime_error( "Error when writing binary coefficient table file " +
+                                      temporaryFilePath.string( ) );
+        }
+    }
+
+    // Move file to final location
+    boost::filesystem::rename( temporaryFilePath, filePath );
+}
+
+//! Class providing read-only access to a memory-mapped binary coefficient table file.
+/*!
+ *  Class providing read-only access to a memory-mapped binary coefficient table file, as written by
+ *  writeCoefficientTableToBinaryFile. The coefficients are not copied from the file, but are accessed directly in the
+ *  mapped memory (which is shared by all processes mapping the same file), so that the file remains mapped as long as
+ *  the object exists.
+ */
+template< unsigned int NumberOfDimensions, int NumberOfCoefficients >
+class MappedBinaryCoefficientTable
+{
+public:
+
+    //! Typedef for a single coefficient vector.
+    typedef Eigen::Matrix< double, NumberOfCoefficients, 1 > CoefficientType;
+
+    //! Constructor, maps the file into memory and checks its contents.
+    /*!
+     *  Constructor, maps the file into memory and checks its contents. An exception is thrown if the file does not
+     *  exist, or if its contents are not consistent with the template arguments of the class.
+     *  \param fileName Name of binary coefficient table file.
+     */
+    MappedBinaryCoefficientTable( const std::string& fileName )
+    {
+        // Coefficients are read directly from mapped memory, so they must be stored without padding.
+        static_assert( sizeof( CoefficientType ) == NumberOfCoefficients * sizeof( double ),
+                       "Error, coefficient type is not stored contiguously" );
+
+        if( !boost::filesystem::exists( fileName ) ||
+                boost::filesystem::file_size( fileName ) < sizeof( BinaryCoefficientTableHeader ) +
+                NumberOfDimensions * sizeof( boost::uint64_t ) )
+        {
+            throw std::runtime_error( "Error when reading binary coefficient table, file " + fileName +
+                                      " does not exist or is too small" );
+        }
+
+        // Map file into memory
+        fileMapping_ = boost::interprocess::file_mapping( fileName.c_str( ), boost::interprocess::read_only );
+        mappedRegion_ = boost::interprocess::mapped_region( fileMapping_, boost::interprocess::read_only );
+        const char* fileData = static_cast< const char* >( mappedRegion_.get_address( ) );
+        boost::uint64_t fileSize = mappedRegion_.get_size( );
+
+        // Check consistency of header with requested data.
+        BinaryCoefficientTableHeader header;
+        std::memcpy( &header, fileData, sizeof( BinaryCoefficientTableHeader ) );
+        if( std::memcmp( header.identifier, binaryCoefficientTableIdentifier, 8 ) != 0 ||
+                header.version != binaryCoefficientTableVersion ||
+                header.numberOfDimensions != NumberOfDimensions ||
+                header.numberOfCoefficients != NumberOfCoefficients ||
+                header.coefficientEntrySize != sizeof( double ) )
+        {
+            throw std::runtime_error( "Error when reading binary coefficient table, header of file " + fileName +
+                                      " is inconsistent with requested table" );
+        }
+
+        // Retrieve number of data points per independent variable, and check file size.
+        boost::array< boost::uint64_t, NumberOfDimensions > numberOfDataPoints;
+        std::memcpy( numberOfDataPoints.data( ), fileData + sizeof( BinaryCoefficientTableHeader ),
+                     NumberOfDimensions * sizeof( boost::uint64_t ) );
+
+        boost::uint64_t totalNumberOfDataPoints = 0;
+        boost::uint64_t numberOfTableEntries = 1;
+        for( unsigned int i = 0; i < NumberOfDimensions; i++ )
+        {
+            totalNumberOfDataPoints += numberOfDataPoints[ i ];
+            numberOfTableEntries *= numberOfDataPoints[ i ];
+        }
+
+        boost::uint64_t dataOffset = getBinaryCoefficientTableDataOffset( NumberOfDimensions, totalNumberOfDataPoints );
+        if( numberOfTableEntries == 0 ||
+                fileSize != dataOffset + numberOfTableEntries * sizeof( CoefficientType ) )
+        {
+            throw std::runtime_error( "Error when reading binary coefficient table, size of file " + fileName +
+                                      " is inconsistent with its header" );
+        }
+
+        // Retrieve independent variables, and set coefficients to refer directly to mapped memory.
+        const double* independentVariableData = reinterpret_cast< const double* >(
+                    fileData + sizeof( BinaryCoefficientTableHeader ) + NumberOfDimensions * sizeof( boost::uint64_t ) );
+        independentVariables_.resize( NumberOfDimensions );
+        for( unsigned int i = 0; i < NumberOfDimensions; i++ )
+        {
+            independentVariables_[ i ].assign( independentVariableData,
+                                               independentVariableData + numberOfDataPoints[ i ] );
+            independentVariableData += numberOfDataPoints[ i ];
+        }
+
+        coefficients_ = boost::make_shared< boost::const_multi_array_ref<
+                CoefficientType, static_cast< size_t >( NumberOfDimensions ) > >(
+                    reinterpret_cast< const CoefficientType* >( fileData + dataOffset ),
+                    std::vector< size_t >( numberOfDataPoints.begin( ), numberOfDataPoints.end( ) ) );
+    }
+
+    //! Function to retrieve the data points of each of the independent variables of the coefficients.
+    /*!
+     *  Function to retrieve the data points of each of the independent variables of the coefficients.
+     *  \return Data points of each of the independent variables of the coefficients.
+     */
+    const std::vector< std::vector< double > >& getIndependentVariables( ) const
+    {
+        return independentVariables_;
+    }
+
+    //! Function to retrieve the coefficients, referring directly to the mapped memory.
+    /*!
+     *  Function to retrieve the coefficients, referring directly to the mapped memory. The returned reference is only
+     *  valid as long as this object exists.
+     *  \return Multi-array reference to coefficients in mapped memory.
+     */
+    const boost::const_multi_array_ref< CoefficientType, static_cast< size_t >( NumberOfDimensions ) >&
+    getCoefficients( ) const
+    {
+        return *coefficients_;
+    }
+
+private:
+
+    //! Mapping of the binary coefficient table file.
+    boost::interprocess::file_mapping fileMapping_;
+
+    //! Mapped region containing the complete binary coefficient table file.
+    boost::interprocess::mapped_region mappedRegion_;
+
+    //! Data points of each of the independent variables of the coefficients.
+    std::vector< std::vector< double > > independentVariables_;
+
+    //! Multi-array reference to coefficients in mappedRegion_.
+    boost::shared_ptr< boost::const_multi_array_ref< CoefficientType, static_cast< size_t >( NumberOfDimensions ) > >
+    coefficients_;
+};
+
+//! Function to create a multi-linear interpolator directly from a memory-mapped binary coefficient table file.
+/*!
+ *  Function to create a multi-linear interpolator directly from a memory-mapped binary coefficient table file, as
+ *  written by writeCoefficientTableToBinaryFile. The coefficients are not copied, but interpolated directly from the
+ *  mapped memory, which remains mapped as long as the interpolator (or a copy of it) exists.
+ *  \param fileName Name of binary coefficient table file.
+ *  \param selectedLookupScheme Lookup scheme to use in the interpolator.
+ *  \return Multi-linear interpolator of the coefficients in the file.
+ */
+template< unsigned int NumberOfDimensions, int NumberOfCoefficients >
+boost::shared_ptr< interpolators::MultiLinearInterpolator<
+double, Eigen::Matrix< double, NumberOfCoefficients, 1 >, NumberOfDimensions > >
+createMultiLinearInterpolatorFromBinaryFile(
+        const std::string& fileName,
+        const interpolators::AvailableLookupScheme selectedLookupScheme = interpolators::huntingAlgorithm )
+{
+    boost::shared_ptr< MappedBinaryCoefficientTable< NumberOfDimensions, NumberOfCoefficients > > coefficientTable =
+            boost::make_shared< MappedBinaryCoefficientTable< NumberOfDimensions, NumberOfCoefficients > >( fileName );
+
+    return boost::make_shared< interpolators::MultiLinearInterpolator<
+            double, Eigen::Matrix< double, NumberOfCoefficients, 1 >, NumberOfDimensions > >(
+                coefficientTable->getIndependentVariables( ), coefficientTable->getCoefficients( ),
+                coefficientTable, selectedLookupScheme );
+}
+
+//! Function to create an interpolator of the coefficients in a memory-mapped binary coefficient table.
+/*!
+ *  Function to create an interpolator of the coefficients in a memory-mapped binary coefficient table. For
+ *  (multi-)linear interpolation, the coefficients are not copied, but interpolated directly from the mapped memory,
+ *  which remains mapped as long as the interpolator (or a copy of it) exists. Other interpolators (see
+ *  createMultiDimensionalInterpolator) are created from a copy of the coefficients.
+ *  \param coefficientTable Memory-mapped binary coefficient table.
+ *  \param interpolatorSettings Settings that are to be used to create the interpolator.
+ *  \return Interpolator of the coefficients in the table.
+ */
+template< unsigned int NumberOfDimensions, int NumberOfCoefficients >
+boost::shared_ptr< interpolators::Interpolator< double, Eigen::Matrix< double, NumberOfCoefficients, 1 > > >
+createInterpolatorFromBinaryCoefficientTable(
+        const boost::shared_ptr< MappedBinaryCoefficientTable< NumberOfDimensions, NumberOfCoefficients > >
+        coefficientTable,
+        const boost::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings )
+{
+    typedef Eigen::Matrix< double, NumberOfCoefficients, 1 > CoefficientType;
+
+    if( interpolatorSettings->getInterpolatorType( ) == interpolators::linear_interpolator )
+    {
+        return boost::make_shared< interpolators::MultiLinearInterpolator<
+                double, CoefficientType, NumberOfDimensions > >(
+                    coefficientTable->getIndependentVariables( ), coefficientTable->getCoefficients( ),
+                    coefficientTable, interpolatorSettings->getSelectedLookupScheme( ) );
+    }
+    else
+    {
+        return interpolators::createMultiDimensionalInterpolator< double, CoefficientType, NumberOfDimensions >(
+                    coefficientTable->getIndependentVariables( ),
+                    boost::multi_array< CoefficientType, static_cast< size_t >( NumberOfDimensions ) >(
+                        coefficientTable->getCoefficients( ) ), interpolatorSettings );
+    }
+}
+
+//! Function to convert a set of aerodynamic coefficient text files to a single binary coefficient table file.
+/*!
+ *  Function to convert a set of aerodynamic coefficient text files (as read by readAerodynamicCoefficients) to a single
+ *  binary coefficient table file, from which the coefficients can subsequently be loaded without parsing, using
+ *  simulation_setup::readTabulatedAerodynamicCoefficientsFromBinaryFiles.
+ *  \param fileNames Map of text file names, with the key required to be 0, 1 and/or 2, denoting the x-, y- and z-
+ *  components of the aerodynamic coefficients (see readAerodynamicCoefficients).
+ *  \param binaryFileName Name of binary coefficient table file that is to be written.
+ */
+template< unsigned int NumberOfDimensions >
+void convertAerodynamicCoefficientFilesToBinaryFile(
+        const std::map< int, std::string >& fileNames,
+        const std::string& binaryFileName )
+{
+    std::pair< boost::multi_array< Eigen::Vector3d, static_cast< size_t >( NumberOfDimensions ) >,
+            std::vector< std::vector< double > > > coefficients =
+            readAerodynamicCoefficients< NumberOfDimensions >( fileNames );
+
+    writeCoefficientTableToBinaryFile< NumberOfDimensions, 3 >(
+                coefficients.first, coefficients.second, binaryFileName );
+}
+
+} // namespace input_output
+
+} // namespace tudat
+
+#endif // TUDAT_BINARYCOEFFICIENTTABLEFILE_H
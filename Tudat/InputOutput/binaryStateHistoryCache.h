@@ -0,0 +1,259 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_BINARYSTATEHISTORYCACHE_H
+#define TUDAT_BINARYSTATEHISTORYCACHE_H
+
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/functional/hash.hpp>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace input_output
+{
+
+//! Identifier at start of each binary state history cache file.
+static const char binaryStateHistoryCacheIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'B', 'S', 'H' };
+
+//! Version of binary state history cache file format.
+static const boost::uint32_t binaryStateHistoryCacheVersion = 1;
+
+//! Header of binary state history cache file.
+/*!
+ *  Header of binary state history cache file. The header is followed by the key of the file (as characters), padded
+ *  with zeros up to a multiple of 16 bytes, after which the times and the states are stored contiguously.
+ */
+struct BinaryStateHistoryCacheHeader
+{
+    //! Identifier of file type (equal to binaryStateHistoryCacheIdentifier).
+    char identifier[ 8 ];
+
+    //! Version of file format.
+    boost::uint32_t version;
+
+    //! Size (in bytes) of a single time entry.
+    boost::uint32_t timeSize;
+
+    //! Size (in bytes) of a single state entry.
+    boost::uint32_t stateEntrySize;
+
+    //! Number of entries in each state.
+    boost::uint32_t stateSize;
+
+    //! Number of characters in key of file.
+    boost::uint64_t keyLength;
+
+    //! Number of times (and states) in file.
+    boost::uint64_t numberOfStates;
+};
+
+//! Function to compute number of bytes before start of the time data in a binary state history cache file
+/*!
+ *  Function to compute number of bytes before start of the time data in a binary state history cache file.
+ *  \param keyLength Number of characters in key of file.
+ *  \return Number of bytes before start of the time data.
+ */
+inline boost::uint64_t getBinaryStateHistoryCacheDataOffset( const boost::uint64_t keyLength )
+{
+    boost::uint64_t unpaddedOffset = sizeof( BinaryStateHistoryCacheHeader ) + keyLength;
+    return 16 * ( ( unpaddedOffset + 15 ) / 16 );
+}
+
+//! Function to get the name of the binary state history cache file for a given key.
+/*!
+ *  Function to get the name of the binary state history cache file for a given key, in which the file name is
+ *  constructed from a hash of the key. Note that the key is also stored in the file, so that hash collisions are
+ *  detected when reading the file.
+ *  \param cacheDirectory Directory in which cache files are stored.
+ *  \param cacheKey Key that uniquely identifies the contents of the file.
+ *  \return Name of binary state history cache file.
+ */
+inline std::string getBinaryStateHistoryCacheFileName( const std::string& cacheDirectory, const std::string& cacheKey )
+{
+    std::ostringstream fileNameStream;
+    fileNameStream << "stateHistory_" << std::hex << boost::hash< std::string >( )( cacheKey ) << ".bin";
+    return ( boost::filesystem::path( cacheDirectory ) / fileNameStream.str( ) ).string( );
+}
+
+//! Function to write a state history to a binary cache file.
+/*!
+ *  Function to write a state history to a binary cache file, that can be read by the
+ *  readStateHistoryFromBinaryCacheFile function. The file is first written to a temporary file, which is then renamed,
+ *  so that other processes never read a partially written file.
+ *  \param stateHistory State history that is to be written to file.
+ *  \param fileName Name of file to which state history is to be written.
+ *  \param cacheKey Key that uniquely identifies the contents of the file.
+ */
+template< typename TimeType, typename StateScalarType, int StateSize >
+void writeStateHistoryToBinaryCacheFile(
+        const std::map< TimeType, Eigen::Matrix< StateScalarType, StateSize, 1 > >& stateHistory,
+        const std::string& fileName,
+        const std::string& cacheKey )
+{
+    typedef Eigen::Matrix< StateScalarType, StateSize, 1 > StateType;
+
+    // Create directory, if needed.
+    boost::filesystem::path filePath( fileName );
+    if( filePath.has_parent_path( ) )
+    {
+        boost::filesystem::create_directories( filePath.parent_path( ) );
+    }
+
+    // Set header
+    BinaryStateHistoryCacheHeader header;
+    std::memcpy( header.identifier, binaryStateHistoryCacheIdentifier, 8 );
+    header.version = binaryStateHistoryCacheVersion;
+    header.timeSize = sizeof( TimeType );
+    header.stateEntrySize = sizeof( StateScalarType );
+    header.stateSize = StateSize;
+    header.keyLength = cacheKey.size( );
+    header.numberOfStates = stateHistory.size( );
+
+    // Write file to temporary location.
+    boost::filesystem::path temporaryFilePath = filePath;
+    temporaryFilePath += boost::filesystem::unique_path( ".%%%%-%%%%-%%%%.tmp" );
+    {
+        std::ofstream outputStream( temporaryFilePath.string( ).c_str( ), std::ios::binary | std::ios::trunc );
+        if( !outputStream.good( ) )
+        {
+            throw std::runtime_error( "Error when writing binary state history cache, could not open file " +
+                                      temporaryFilePath.string( ) );
+        }
+
+        outputStream.write( reinterpret_cast< const char* >( &header ), sizeof( BinaryStateHistoryCacheHeader ) );
+        outputStream.write( cacheKey.c_str( ), cacheKey.size( ) );
+
+        std::string padding( getBinaryStateHistoryCacheDataOffset( header.keyLength ) -
+                             sizeof( BinaryStateHistoryCacheHeader ) - header.keyLength, '\0' );
+        outputStream.write( padding.c_str( ), padding.size( ) );
+
+        for( typename std::map< TimeType, StateType >::const_iterator stateIterator = stateHistory.begin( );
+             stateIterator != stateHistory.end( ); stateIterator++ )
+        {
+            outputStream.write( reinterpret_cast< const char* >( &( stateIterator->first ) ), sizeof( TimeType ) );
+        }
+        for( typename std::map< TimeType, StateType >::const_iterator stateIterator = stateHistory.begin( );
+             stateIterator != stateHistory.end( ); stateIterator++ )
+        {
+            outputStream.write( reinterpret_cast< const char* >( stateIterator->second.data( ) ),
+                                StateSize * sizeof( StateScalarType ) );
+        }
+
+        if( !outputStream.good( ) )
+        {
+            throw std::runtime_error( "Error when writing binary state history cache file " +
+                                      temporaryFilePath.string( ) );
+        }
+    }
+
+    // Move file to final location
+    boost::filesystem::rename( temporaryFilePath, filePath );
+}
+
+//! Function to read a state history from a binary cache file.
+/*!
+ *  Function to read a state history from a binary cache file, as written by writeStateHistoryToBinaryCacheFile. The
+ *  times and states are each read as a single contiguous block, without any parsing. If the file does not exist, or
+ *  its contents are not consistent with the requested key and data types, false is returned and the state history is
+ *  not modified.
+ *  \param fileName Name of file from which state history is to be read.
+ *  \param cacheKey Key that uniquely identifies the contents of the file.
+ *  \param stateHistory State history read from file (returned by reference).
+ *  \return True if the state history was successfully read from the file.
+ */
+template< typename TimeType, typename StateScalarType, int StateSize >
+bool readStateHistoryFromBinaryCacheFile(
+        const std::string& fileName,
+        const std::string& cacheKey,
+        std::map< TimeType, Eigen::Matrix< StateScalarType, StateSize, 1 > >& stateHistory )
+{
+    typedef Eigen::Matrix< StateScalarType, StateSize, 1 > StateType;
+
+    if( !boost::filesystem::exists( fileName ) ||
+            boost::filesystem::file_size( fileName ) < sizeof( BinaryStateHistoryCacheHeader ) )
+    {
+        return false;
+    }
+    boost::uint64_t fileSize = boost::filesystem::file_size( fileName );
+
+    std::ifstream inputStream( fileName.c_str( ), std::ios::binary );
+    if( !inputStream.good( ) )
+    {
+        return false;
+    }
+
+    // Check consistency of header with requested data.
+    BinaryStateHistoryCacheHeader header;
+    inputStream.read( reinterpret_cast< char* >( &header ), sizeof( BinaryStateHistoryCacheHeader ) );
+    if( !inputStream.good( ) ||
+            std::memcmp( header.identifier, binaryStateHistoryCacheIdentifier, 8 ) != 0 ||
+            header.version != binaryStateHistoryCacheVersion ||
+            header.timeSize != sizeof( TimeType ) ||
+            header.stateEntrySize != sizeof( StateScalarType ) ||
+            header.stateSize != StateSize ||
+            header.keyLength != cacheKey.size( ) )
+    {
+        return false;
+    }
+
+    boost::uint64_t dataOffset = getBinaryStateHistoryCacheDataOffset( header.keyLength );
+    if( fileSize != dataOffset + header.numberOfStates * ( sizeof( TimeType ) + StateSize * sizeof( StateScalarType ) ) )
+    {
+        return false;
+    }
+
+    std::string fileKey( header.keyLength, '\0' );
+    inputStream.read( &fileKey[ 0 ], header.keyLength );
+    if( !inputStream.good( ) || fileKey != cacheKey )
+    {
+        return false;
+    }
+
+    // Read times and states, each as a single block.
+    std::vector< TimeType > times( header.numberOfStates );
+    std::vector< StateScalarType > states( header.numberOfStates * StateSize );
+    inputStream.seekg( dataOffset );
+    inputStream.read( reinterpret_cast< char* >( times.data( ) ), header.numberOfStates * sizeof( TimeType ) );
+    inputStream.read( reinterpret_cast< char* >( states.data( ) ),
+                      header.numberOfStates * StateSize * sizeof( StateScalarType ) );
+    if( !inputStream.good( ) )
+    {
+        return false;
+    }
+
+    // Set state history (times are sorted, so each entry is inserted at the end of the map).
+    stateHistory.clear( );
+    for( boost::uint64_t i = 0; i < header.numberOfStates; i++ )
+    {
+        stateHistory.insert( stateHistory.end( ), std::make_pair(
+                                 times[ i ], StateType( Eigen::Map< const StateType >( states.data( ) + i * StateSize ) ) ) );
+    }
+
+    return true;
+}
+
+} // namespace input_output
+
+} // namespace tudat
+
+#endif // TUDAT_BINARYSTATEHISTORYCACHE_H
@@ -22,6 +22,7 @@
 #include "Tudat/InputOutput/missileDatcomData.h"
 #include "Tudat/InputOutput/missileDatcomReader.h"
 #include "Tudat/InputOutput/basicInputOutput.h"
+#include "Tudat/InputOutput/binaryCoefficientTableFile.h"
 
 namespace tudat
 {
@@ -223,5 +224,42 @@ void MissileDatcomData::writeCoefficientsToFile( const std::string& fileNameBase
     }
 }
 
+//! Write the static force and moment coefficients to binary coefficient table files.
+void MissileDatcomData::writeCoefficientsToBinaryFiles( const std::string& forceCoefficientFileName,
+                                                        const std::string& momentCoefficientFileName )
+{
+    // Set independent variables (Mach number and angle of attack in radians).
+    std::vector< std::vector< double > > independentVariables( 2 );
+    independentVariables[ 0 ] = machNumber_;
+    for ( unsigned int i = 0; i < angleOfAttack_.size( ); i++ )
+    {
+        independentVariables[ 1 ].push_back( convertDegreesToRadians( angleOfAttack_[ i ] ) );
+    }
+
+    // Set body-frame coefficients, in negative axis direction for force coefficients (CA is positive aft, CN is
+    // positive upward and CY is positive to the right).
+    boost::multi_array< Eigen::Vector3d, 2 > forceCoefficients(
+                boost::extents[ machNumber_.size( ) ][ angleOfAttack_.size( ) ] );
+    boost::multi_array< Eigen::Vector3d, 2 > momentCoefficients(
+                boost::extents[ machNumber_.size( ) ][ angleOfAttack_.size( ) ] );
+    for ( unsigned int i = 0; i < machNumber_.size( ); i++ )
+    {
+        for ( unsigned int j = 0; j < angleOfAttack_.size( ); j++ )
+        {
+            forceCoefficients[ i ][ j ] = Eigen::Vector3d( staticCoefficients_[ i ][ j ][ ca ],
+                                                           -staticCoefficients_[ i ][ j ][ cy ],
+                                                           staticCoefficients_[ i ][ j ][ cn ] );
+            momentCoefficients[ i ][ j ] = Eigen::Vector3d( staticCoefficients_[ i ][ j ][ cll ],
+                                                            staticCoefficients_[ i ][ j ][ cm ],
+                                                            staticCoefficients_[ i ][ j ][ cln ] );
+        }
+    }
+
+    writeCoefficientTableToBinaryFile< 2, 3 >(
+                forceCoefficients, independentVariables, forceCoefficientFileName );
+    writeCoefficientTableToBinaryFile< 2, 3 >(
+                momentCoefficients, independentVariables, momentCoefficientFileName );
+}
+
 } // namespace input_output
 } // namespace tudat
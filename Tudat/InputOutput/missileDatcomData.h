@@ -158,6 +158,20 @@ public:
             const int basePrecision = std::numeric_limits< double >::digits10,
             const int exponentWidth = 2 );
 
+    //! Write the static force and moment coefficients to binary coefficient table files.
+    /*!
+     * Writes the static force and moment coefficients to binary coefficient table files (see
+     * writeCoefficientTableToBinaryFile), as a function of Mach number and angle of attack (in radians), at the
+     * sideslip angle of the Missile Datcom output. These files can be loaded directly as tabulated aerodynamic
+     * coefficients (see simulation_setup::readTabulatedAerodynamicCoefficientsFromBinaryFiles), with the coefficients
+     * defined in the body frame and in negative axis direction. The force coefficients are stored as (CA, -CY, CN),
+     * the moment coefficients as (CLL, CM, CLN).
+     * \param forceCoefficientFileName Name of binary file to which force coefficients are to be written.
+     * \param momentCoefficientFileName Name of binary file to which moment coefficients are to be written.
+     */
+    void writeCoefficientsToBinaryFiles( const std::string& forceCoefficientFileName,
+                                         const std::string& momentCoefficientFileName );
+
 private:    
 
     //! Convert the MissileDatcomData.
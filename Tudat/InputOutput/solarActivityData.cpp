@@ -115,15 +115,17 @@ SolarActivityDataMap readSolarActivityData( std::string filePath )
     int numberOfLines = parsedDataVector->size( );
     SolarActivityDataMap dataMap;
     double julianDate = TUDAT_NAN;
+    SolarActivityDataPtr currentSolarActivityData;
 
     // Save each line to datamap
     for(int i = 0 ; i < numberOfLines ; i++ ){
+        currentSolarActivityData = solarActivityExtractor.extract( parsedDataVector->at( i ) );
         julianDate = tudat::basic_astrodynamics::convertCalendarDateToJulianDay(
-                    solarActivityExtractor.extract( parsedDataVector->at( i ) )->year,
-                    solarActivityExtractor.extract( parsedDataVector->at( i ) )->month,
-                    solarActivityExtractor.extract( parsedDataVector->at( i ) )->day,
+                    currentSolarActivityData->year,
+                    currentSolarActivityData->month,
+                    currentSolarActivityData->day,
                     0, 0, 0.0 ) ;
-        dataMap[ julianDate ] = solarActivityExtractor.extract( parsedDataVector->at( i ) ) ;
+        dataMap[ julianDate ] = currentSolarActivityData ;
     }
 
     return dataMap;
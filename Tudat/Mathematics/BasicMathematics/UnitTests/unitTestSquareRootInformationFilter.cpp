@@ -0,0 +1,173 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/LU>
+
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Mathematics/BasicMathematics/leastSquaresEstimation.h"
+#include "Tudat/Mathematics/BasicMathematics/squareRootInformationFilter.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_square_root_information_filter )
+
+//! Test whether sequential square-root information filter reproduces batch least squares solution.
+BOOST_AUTO_TEST_CASE( testSquareRootInformationFilterWithoutProcessNoise )
+{
+    using namespace linear_algebra;
+
+    // Create (reproducible) test problem.
+    std::srand( 42 );
+    int numberOfParameters = 5;
+    int numberOfObservations = 200;
+    Eigen::MatrixXd informationMatrix = Eigen::MatrixXd::Random( numberOfObservations, numberOfParameters );
+    Eigen::VectorXd trueParameters = Eigen::VectorXd::Random( numberOfParameters );
+    Eigen::VectorXd observationResiduals = informationMatrix * trueParameters +
+            1.0E-3 * Eigen::VectorXd::Random( numberOfObservations );
+    Eigen::VectorXd weights = ( Eigen::VectorXd::Random( numberOfObservations ).array( ) + 2.0 ).matrix( );
+    Eigen::MatrixXd inverseAprioriCovariance = 0.1 * Eigen::MatrixXd::Identity( numberOfParameters, numberOfParameters );
+    inverseAprioriCovariance( 1, 2 ) = inverseAprioriCovariance( 2, 1 ) = 0.05;
+
+    // Compute batch solution
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > batchSolution = performLeastSquaresAdjustmentFromInformationMatrix(
+                informationMatrix, observationResiduals, weights, inverseAprioriCovariance );
+
+    // Compute sequential solution, processing observations in (unequal) blocks.
+    SquareRootInformationFilter sequentialFilter( inverseAprioriCovariance );
+    int blockSize = 7;
+    for( int i = 0; i < numberOfObservations; i += blockSize )
+    {
+        int currentBlockSize = std::min( blockSize, numberOfObservations - i );
+        sequentialFilter.processObservations( informationMatrix.block( i, 0, currentBlockSize, numberOfParameters ),
+                                              observationResiduals.segment( i, currentBlockSize ),
+                                              weights.segment( i, currentBlockSize ) );
+    }
+
+    // Compare solution, inverse covariance and residuals
+    Eigen::VectorXd sequentialParameters = sequentialFilter.getParameterAdjustment( );
+    Eigen::MatrixXd sequentialInverseCovariance = sequentialFilter.getInverseOfCovarianceMatrix( );
+    for( int i = 0; i < numberOfParameters; i++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( sequentialParameters( i ), batchSolution.first( i ), 1.0E-12 );
+    }
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( sequentialInverseCovariance, batchSolution.second, 1.0E-12 );
+
+    Eigen::VectorXd postFitResiduals = observationResiduals - informationMatrix * batchSolution.first;
+    double expectedSumOfSquares = postFitResiduals.dot( weights.cwiseProduct( postFitResiduals ) ) +
+            batchSolution.first.dot( inverseAprioriCovariance * batchSolution.first );
+    BOOST_CHECK_CLOSE_FRACTION( sequentialFilter.getResidualSumOfSquares( ), expectedSumOfSquares, 1.0E-10 );
+}
+
+//! Test whether filter may be continued from a previous square-root information system, and relinearized.
+BOOST_AUTO_TEST_CASE( testSquareRootInformationFilterContinuation )
+{
+    using namespace linear_algebra;
+
+    std::srand( 44 );
+    int numberOfParameters = 4;
+    int numberOfObservations = 60;
+    Eigen::MatrixXd informationMatrix = Eigen::MatrixXd::Random( numberOfObservations, numberOfParameters );
+    Eigen::VectorXd trueParameters = Eigen::VectorXd::Random( numberOfParameters );
+    Eigen::VectorXd observationResiduals = informationMatrix * trueParameters +
+            1.0E-3 * Eigen::VectorXd::Random( numberOfObservations );
+    Eigen::VectorXd weights = Eigen::VectorXd::Constant( numberOfObservations, 2.0 );
+
+    // Compute batch solution
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > batchSolution = performLeastSquaresAdjustmentFromInformationMatrix(
+                informationMatrix, observationResiduals, weights,
+                Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters ) );
+
+    // Process first half of observations, and continue from its square-root information system in a new filter.
+    int numberOfFirstObservations = numberOfObservations / 2;
+    int numberOfSecondObservations = numberOfObservations - numberOfFirstObservations;
+    SquareRootInformationFilter firstFilter( Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters ) );
+    firstFilter.processObservations( informationMatrix.topRows( numberOfFirstObservations ),
+                                     observationResiduals.head( numberOfFirstObservations ),
+                                     weights.head( numberOfFirstObservations ) );
+
+    SquareRootInformationFilter continuedFilter(
+                firstFilter.getSquareRootInformationMatrix( ), firstFilter.getSquareRootInformationVector( ) );
+    continuedFilter.processObservations( informationMatrix.bottomRows( numberOfSecondObservations ),
+                                         observationResiduals.tail( numberOfSecondObservations ),
+                                         weights.tail( numberOfSecondObservations ) );
+    for( int i = 0; i < numberOfParameters; i++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( continuedFilter.getParameterAdjustment( )( i ), batchSolution.first( i ), 1.0E-12 );
+    }
+
+    // Relinearize first half of observations about shifted reference, and process second half w.r.t. this reference.
+    Eigen::VectorXd referenceShift = Eigen::VectorXd::Random( numberOfParameters );
+    firstFilter.shiftReferenceParameters( referenceShift );
+    firstFilter.processObservations(
+                informationMatrix.bottomRows( numberOfSecondObservations ),
+                observationResiduals.tail( numberOfSecondObservations ) -
+                informationMatrix.bottomRows( numberOfSecondObservations ) * referenceShift,
+                weights.tail( numberOfSecondObservations ) );
+    for( int i = 0; i < numberOfParameters; i++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( firstFilter.getParameterAdjustment( )( i ) + referenceShift( i ),
+                                    batchSolution.first( i ), 1.0E-12 );
+    }
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( firstFilter.getInverseOfCovarianceMatrix( ), batchSolution.second, 1.0E-12 );
+}
+
+//! Test whether process noise in square-root information filter is added consistently with covariance propagation.
+BOOST_AUTO_TEST_CASE( testSquareRootInformationFilterProcessNoise )
+{
+    using namespace linear_algebra;
+
+    std::srand( 43 );
+    int numberOfParameters = 4;
+    int numberOfObservations = 20;
+    Eigen::MatrixXd informationMatrix = Eigen::MatrixXd::Random( numberOfObservations, numberOfParameters );
+    Eigen::VectorXd observationResiduals = Eigen::VectorXd::Random( numberOfObservations );
+    Eigen::VectorXd weights = Eigen::VectorXd::Constant( numberOfObservations, 4.0 );
+
+    SquareRootInformationFilter sequentialFilter(
+                Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters ) );
+    sequentialFilter.processObservations( informationMatrix, observationResiduals, weights );
+
+    Eigen::VectorXd parametersBeforeNoise = sequentialFilter.getParameterAdjustment( );
+    Eigen::MatrixXd covarianceBeforeNoise = sequentialFilter.getInverseOfCovarianceMatrix( ).inverse( );
+
+    // Add noise to all but one parameter
+    Eigen::VectorXd processNoiseVariances = Eigen::VectorXd::Zero( numberOfParameters );
+    processNoiseVariances << 0.1, 0.0, 0.3, 0.02;
+    sequentialFilter.addProcessNoise( processNoiseVariances );
+
+    // Estimate should not change, covariance should be increased by process noise.
+    Eigen::VectorXd parametersAfterNoise = sequentialFilter.getParameterAdjustment( );
+    Eigen::MatrixXd covarianceAfterNoise = sequentialFilter.getInverseOfCovarianceMatrix( ).inverse( );
+    Eigen::MatrixXd expectedCovarianceAfterNoise = covarianceBeforeNoise;
+    expectedCovarianceAfterNoise.diagonal( ) += processNoiseVariances;
+
+    for( int i = 0; i < numberOfParameters; i++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( parametersAfterNoise( i ), parametersBeforeNoise( i ), 1.0E-12 );
+    }
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( covarianceAfterNoise, expectedCovarianceAfterNoise, 1.0E-12 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,201 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include <Eigen/Cholesky>
+#include <Eigen/QR>
+
+#include "Tudat/Mathematics/BasicMathematics/squareRootInformationFilter.h"
+
+namespace tudat
+{
+
+namespace linear_algebra
+{
+
+//! Constructor
+SquareRootInformationFilter::SquareRootInformationFilter( const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix ):
+    numberOfParameters_( inverseOfAPrioriCovarianceMatrix.rows( ) ), residualSumOfSquares_( 0.0 )
+{
+    if( inverseOfAPrioriCovarianceMatrix.rows( ) != inverseOfAPrioriCovarianceMatrix.cols( ) )
+    {
+        throw std::runtime_error( "Error when creating square-root information filter, a priori information is not square" );
+    }
+
+    // Decompose a priori information as P^T L D L^T P, so that R^T R = inverseOfAPrioriCovarianceMatrix for
+    // R = D^(1/2) L^T P.
+    Eigen::LDLT< Eigen::MatrixXd > aPrioriDecomposition( inverseOfAPrioriCovarianceMatrix );
+    Eigen::MatrixXd aPrioriSquareRootInformation =
+            aPrioriDecomposition.vectorD( ).cwiseMax( 0.0 ).cwiseSqrt( ).asDiagonal( ) *
+            Eigen::MatrixXd( aPrioriDecomposition.matrixU( ) );
+    aPrioriSquareRootInformation = aPrioriSquareRootInformation * aPrioriDecomposition.transpositionsP( );
+
+    // Set R to upper triangular form, with z equal to zero.
+    augmentedSystem_ = Eigen::MatrixXd::Zero( numberOfParameters_, numberOfParameters_ + 1 );
+    augmentedSystem_.leftCols( numberOfParameters_ ) = aPrioriSquareRootInformation;
+    triangularizeSystem( augmentedSystem_ );
+}
+
+//! Constructor
+SquareRootInformationFilter::SquareRootInformationFilter( const Eigen::MatrixXd& squareRootInformationMatrix,
+                                                          const Eigen::VectorXd& squareRootInformationVector ):
+    numberOfParameters_( squareRootInformationMatrix.rows( ) ), residualSumOfSquares_( 0.0 )
+{
+    if( ( squareRootInformationMatrix.rows( ) != squareRootInformationMatrix.cols( ) ) ||
+            ( squareRootInformationVector.rows( ) != numberOfParameters_ ) )
+    {
+        throw std::runtime_error( "Error when creating square-root information filter, size of square-root information "
+                                  "system is inconsistent" );
+    }
+
+    // Set [R z], enforcing upper triangular form of R.
+    squareRootInformationSystem_.resize( numberOfParameters_, numberOfParameters_ + 1 );
+    squareRootInformationSystem_.leftCols( numberOfParameters_ ) =
+            squareRootInformationMatrix.triangularView< Eigen::Upper >( );
+    squareRootInformationSystem_.col( numberOfParameters_ ) = squareRootInformationVector;
+}
+
+//! Function to process a block of observations.
+void SquareRootInformationFilter::processObservations(
+        const Eigen::MatrixXd& informationMatrix,
+        const Eigen::VectorXd& observationResiduals,
+        const Eigen::VectorXd& diagonalOfWeightMatrix )
+{
+    int numberOfObservations = informationMatrix.rows( );
+    if( informationMatrix.cols( ) != numberOfParameters_ )
+    {
+        throw std::runtime_error( "Error when processing observations in square-root information filter, "
+                                  "number of parameters is inconsistent" );
+    }
+    if( ( observationResiduals.rows( ) != numberOfObservations ) ||
+            ( diagonalOfWeightMatrix.rows( ) != numberOfObservations ) )
+    {
+        throw std::runtime_error( "Error when processing observations in square-root information filter, "
+                                  "number of observations is inconsistent" );
+    }
+
+    // Stack current square-root information system and whitened observations as [ R z; W^(1/2)H W^(1/2)y ]
+    augmentedSystem_.resize( numberOfParameters_ + numberOfObservations, numberOfParameters_ + 1 );
+    augmentedSystem_.topRows( numberOfParameters_ ) = squareRootInformationSystem_;
+    for( int i = 0; i < numberOfObservations; i++ )
+    {
+        double squareRootOfWeight = std::sqrt( diagonalOfWeightMatrix( i ) );
+        augmentedSystem_.block( numberOfParameters_ + i, 0, 1, numberOfParameters_ ) =
+                squareRootOfWeight * informationMatrix.row( i );
+        augmentedSystem_( numberOfParameters_ + i, numberOfParameters_ ) = squareRootOfWeight * observationResiduals( i );
+    }
+
+    triangularizeSystem( augmentedSystem_ );
+}
+
+//! Function to add process noise to the parameters.
+void SquareRootInformationFilter::addProcessNoise( const Eigen::VectorXd& processNoiseVariances )
+{
+    if( processNoiseVariances.rows( ) != numberOfParameters_ )
+    {
+        throw std::runtime_error( "Error when adding process noise in square-root information filter, "
+                                  "number of parameters is inconsistent" );
+    }
+
+    // Retrieve parameters to which noise is to be added.
+    std::vector< int > noisyParameterIndices;
+    for( int i = 0; i < numberOfParameters_; i++ )
+    {
+        if( processNoiseVariances( i ) < 0.0 )
+        {
+            throw std::runtime_error( "Error when adding process noise in square-root information filter, "
+                                      "variance is negative" );
+        }
+        else if( processNoiseVariances( i ) > 0.0 )
+        {
+            noisyParameterIndices.push_back( i );
+        }
+    }
+
+    int numberOfNoiseParameters = noisyParameterIndices.size( );
+    if( numberOfNoiseParameters == 0 )
+    {
+        return;
+    }
+
+    // Set up system in terms of [ w, x_new ], with R x_old = R ( x_new - w ) = z and w having square-root information
+    // diagonal( 1 / sigma ). Triangularization gives the square-root information system of x_new in lower-right block.
+    augmentedSystem_.setZero( numberOfNoiseParameters + numberOfParameters_,
+                              numberOfNoiseParameters + numberOfParameters_ + 1 );
+    for( int i = 0; i < numberOfNoiseParameters; i++ )
+    {
+        augmentedSystem_( i, i ) = 1.0 / std::sqrt( processNoiseVariances( noisyParameterIndices.at( i ) ) );
+        augmentedSystem_.block( numberOfNoiseParameters, i, numberOfParameters_, 1 ) =
+                -squareRootInformationSystem_.col( noisyParameterIndices.at( i ) );
+    }
+    augmentedSystem_.block( numberOfNoiseParameters, numberOfNoiseParameters,
+                            numberOfParameters_, numberOfParameters_ + 1 ) = squareRootInformationSystem_;
+
+    triangularizeSystem( augmentedSystem_ );
+}
+
+//! Function to shift the reference values of the parameters w.r.t. which the adjustment is estimated.
+void SquareRootInformationFilter::shiftReferenceParameters( const Eigen::VectorXd& referenceParameterShift )
+{
+    if( referenceParameterShift.rows( ) != numberOfParameters_ )
+    {
+        throw std::runtime_error( "Error when shifting reference parameters in square-root information filter, "
+                                  "number of parameters is inconsistent" );
+    }
+
+    squareRootInformationSystem_.col( numberOfParameters_ ) -=
+            squareRootInformationSystem_.leftCols( numberOfParameters_ ).triangularView< Eigen::Upper >( ) *
+            referenceParameterShift;
+}
+
+//! Function to retrieve the current estimate of the parameter adjustment.
+Eigen::VectorXd SquareRootInformationFilter::getParameterAdjustment( ) const
+{
+    return squareRootInformationSystem_.leftCols( numberOfParameters_ ).triangularView< Eigen::Upper >( ).solve(
+                squareRootInformationSystem_.col( numberOfParameters_ ) );
+}
+
+//! Function to retrieve the inverse of the covariance matrix of the current estimate.
+Eigen::MatrixXd SquareRootInformationFilter::getInverseOfCovarianceMatrix( ) const
+{
+    Eigen::MatrixXd squareRootInformationMatrix = getSquareRootInformationMatrix( );
+    return squareRootInformationMatrix.transpose( ) * squareRootInformationMatrix;
+}
+
+//! Function to triangularize the matrix, and set the square-root information system from its lower-right block.
+void SquareRootInformationFilter::triangularizeSystem( const Eigen::MatrixXd& matrixToTriangularize )
+{
+    int numberOfLeadingColumns = matrixToTriangularize.cols( ) - ( numberOfParameters_ + 1 );
+
+    Eigen::HouseholderQR< Eigen::MatrixXd > householderDecomposition( matrixToTriangularize );
+    const Eigen::MatrixXd& triangularizedMatrix = householderDecomposition.matrixQR( );
+
+    // Retrieve updated [R z] (entries below diagonal contain Householder vectors, and are discarded)
+    squareRootInformationSystem_ = triangularizedMatrix.block(
+                numberOfLeadingColumns, numberOfLeadingColumns,
+                numberOfParameters_, numberOfParameters_ + 1 ).triangularView< Eigen::Upper >( );
+
+    // Add norm of the part of the right-hand side that cannot be fit (if any) to sum of squares of residuals.
+    if( triangularizedMatrix.rows( ) > numberOfLeadingColumns + numberOfParameters_ )
+    {
+        residualSumOfSquares_ += triangularizedMatrix(
+                    numberOfLeadingColumns + numberOfParameters_, numberOfLeadingColumns + numberOfParameters_ ) *
+                triangularizedMatrix(
+                    numberOfLeadingColumns + numberOfParameters_, numberOfLeadingColumns + numberOfParameters_ );
+    }
+}
+
+} // namespace linear_algebra
+
+} // namespace tudat
@@ -0,0 +1,172 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_SQUAREROOTINFORMATIONFILTER_H
+#define TUDAT_SQUAREROOTINFORMATIONFILTER_H
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace linear_algebra
+{
+
+//! Class for the sequential solution of a (weighted) least squares problem with a square-root information filter.
+/*!
+ *  Class for the sequential solution of a (weighted) least squares problem with a square-root information filter (SRIF).
+ *  The filter stores an upper triangular square-root information matrix R and vector z, such that the current estimate
+ *  x of the parameter adjustment solves R x = z, and R^T R is the inverse of the covariance matrix. Blocks of
+ *  observations are added to the filter by Householder triangularization of the stacked system [ R z; H y ], so that
+ *  the memory required by the filter is independent of the total number of observations. In the absence of process
+ *  noise, the solution after processing all observations is equal to that of the batch least squares solution.
+ *  Process noise on the parameters (which are otherwise taken as constant) can be added between blocks of observations.
+ */
+class SquareRootInformationFilter
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor, initializes the square-root information matrix from the a priori information.
+     *  \param inverseOfAPrioriCovarianceMatrix Inverse of a priori covariance matrix (may be zero, and must be
+     *  positive semi-definite).
+     */
+    SquareRootInformationFilter( const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix );
+
+    //! Constructor
+    /*!
+     *  Constructor, initializes the filter from an existing square-root information matrix and vector, e.g. as retrieved
+     *  from another filter, so that the processing of observations may be continued from a previous state.
+     *  \param squareRootInformationMatrix Upper triangular square-root information matrix R.
+     *  \param squareRootInformationVector Square-root information vector z.
+     */
+    SquareRootInformationFilter( const Eigen::MatrixXd& squareRootInformationMatrix,
+                                 const Eigen::VectorXd& squareRootInformationVector );
+
+    //! Function to process a block of observations.
+    /*!
+     *  Function to process a block of observations, updating the square-root information matrix and vector by
+     *  Householder triangularization.
+     *  \param informationMatrix Matrix containing partial derivatives of observations (rows) w.r.t. estimated parameters
+     *  (columns)
+     *  \param observationResiduals Difference between measured and simulated observations
+     *  \param diagonalOfWeightMatrix Diagonal of observation weights matrix (assumes all weights to be uncorrelated)
+     */
+    void processObservations(
+            const Eigen::MatrixXd& informationMatrix,
+            const Eigen::VectorXd& observationResiduals,
+            const Eigen::VectorXd& diagonalOfWeightMatrix );
+
+    //! Function to add process noise to the parameters.
+    /*!
+     *  Function to add (uncorrelated) process noise to the parameters, so that the parameters after the call are modelled
+     *  as x_new = x_old + w, with w a zero-mean random vector with the given variances. Parameters for which the variance
+     *  is zero are left unchanged.
+     *  \param processNoiseVariances Variance of the process noise on each of the parameters.
+     */
+    void addProcessNoise( const Eigen::VectorXd& processNoiseVariances );
+
+    //! Function to shift the reference values of the parameters w.r.t. which the adjustment is estimated.
+    /*!
+     *  Function to shift the reference values of the parameters w.r.t. which the adjustment is estimated, as required
+     *  when the observations are linearized about updated parameter values. After this call, the adjustment is estimated
+     *  w.r.t. the old reference values plus the given shift (i.e. z is replaced by z - R * shift), while the
+     *  square-root information matrix is unchanged.
+     *  \param referenceParameterShift Change in the reference values of the parameters.
+     */
+    void shiftReferenceParameters( const Eigen::VectorXd& referenceParameterShift );
+
+    //! Function to retrieve the current estimate of the parameter adjustment.
+    /*!
+     *  Function to retrieve the current estimate of the parameter adjustment, obtained by back substitution from
+     *  R x = z.
+     *  \return Current estimate of the parameter adjustment.
+     */
+    Eigen::VectorXd getParameterAdjustment( ) const;
+
+    //! Function to retrieve the inverse of the covariance matrix of the current estimate.
+    /*!
+     *  Function to retrieve the inverse of the covariance matrix of the current estimate, computed as R^T R.
+     *  \return Inverse of the covariance matrix of the current estimate.
+     */
+    Eigen::MatrixXd getInverseOfCovarianceMatrix( ) const;
+
+    //! Function to retrieve the current (upper triangular) square-root information matrix.
+    /*!
+     *  Function to retrieve the current (upper triangular) square-root information matrix.
+     *  \return Current square-root information matrix.
+     */
+    Eigen::MatrixXd getSquareRootInformationMatrix( ) const
+    {
+        return squareRootInformationSystem_.leftCols( numberOfParameters_ );
+    }
+
+    //! Function to retrieve the current square-root information vector.
+    /*!
+     *  Function to retrieve the current square-root information vector.
+     *  \return Current square-root information vector.
+     */
+    Eigen::VectorXd getSquareRootInformationVector( ) const
+    {
+        return squareRootInformationSystem_.col( numberOfParameters_ );
+    }
+
+    //! Function to retrieve the weighted sum of squares of the post-fit residuals of all processed observations.
+    /*!
+     *  Function to retrieve the weighted sum of squares of the post-fit residuals of all processed observations.
+     *  \return Weighted sum of squares of the post-fit residuals.
+     */
+    double getResidualSumOfSquares( ) const
+    {
+        return residualSumOfSquares_;
+    }
+
+    //! Function to retrieve the number of parameters in the filter.
+    /*!
+     *  Function to retrieve the number of parameters in the filter.
+     *  \return Number of parameters in the filter.
+     */
+    int getNumberOfParameters( ) const
+    {
+        return numberOfParameters_;
+    }
+
+protected:
+
+    //! Function to triangularize the matrix, and set the square-root information system from its lower-right block.
+    /*!
+     *  Function to triangularize the matrix by Householder transformations, and set the square-root information system
+     *  (i.e. [R z]) from its lower-right block, and update the residual sum of squares from the remaining rows.
+     *  \param matrixToTriangularize Matrix that is to be triangularized, of which the last numberOfParameters_ + 1
+     *  columns are the (updated) columns of R and z.
+     */
+    void triangularizeSystem( const Eigen::MatrixXd& matrixToTriangularize );
+
+    //! Number of parameters in the filter.
+    int numberOfParameters_;
+
+    //! Current square-root information matrix R and vector z, concatenated as [R z]
+    Eigen::MatrixXd squareRootInformationSystem_;
+
+    //! Pre-allocated matrix that is triangularized when processing observations.
+    Eigen::MatrixXd augmentedSystem_;
+
+    //! Weighted sum of squares of the post-fit residuals of all processed observations.
+    double residualSumOfSquares_;
+
+};
+
+} // namespace linear_algebra
+
+} // namespace tudat
+
+#endif // TUDAT_SQUAREROOTINFORMATIONFILTER_H
@@ -0,0 +1,193 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <map>
+#include <vector>
+
+#include <boost/make_shared.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Mathematics/Interpolators/cartesianStateHermiteInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/createInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+//! Function to compute a (non-Keplerian) analytical Cartesian state, used as reference for interpolation.
+Eigen::Vector6d getAnalyticalState( const double time )
+{
+    const double radius = 7.0E6;
+    const double frequency = 1.0E-3;
+    const double outOfPlaneAmplitude = 1.0E5;
+
+    Eigen::Vector6d state;
+    state << radius * std::cos( frequency * time ),
+            radius * std::sin( frequency * time ),
+            outOfPlaneAmplitude * std::sin( 2.0 * frequency * time ),
+            -radius * frequency * std::sin( frequency * time ),
+            radius * frequency * std::cos( frequency * time ),
+            2.0 * outOfPlaneAmplitude * frequency * std::cos( 2.0 * frequency * time );
+    return state;
+}
+
+//! Function to compute the acceleration associated with getAnalyticalState.
+Eigen::Vector3d getAnalyticalAcceleration( const double time )
+{
+    const double radius = 7.0E6;
+    const double frequency = 1.0E-3;
+    const double outOfPlaneAmplitude = 1.0E5;
+
+    return ( Eigen::Vector3d( ) << -radius * frequency * frequency * std::cos( frequency * time ),
+             -radius * frequency * frequency * std::sin( frequency * time ),
+             -4.0 * outOfPlaneAmplitude * frequency * frequency * std::sin( 2.0 * frequency * time ) ).finished( );
+}
+
+//! Function to compute the maximum position and velocity interpolation errors over the (inner part of the) domain
+template< typename InterpolatorType >
+std::pair< double, double > getMaximumInterpolationErrors(
+        InterpolatorType& interpolator, const double startTime, const double endTime )
+{
+    double maximumPositionError = 0.0, maximumVelocityError = 0.0;
+    for( double currentTime = startTime; currentTime < endTime; currentTime += 7.3 )
+    {
+        Eigen::Vector6d stateError = interpolator.interpolate( currentTime ) - getAnalyticalState( currentTime );
+        maximumPositionError = std::max( maximumPositionError, stateError.segment( 0, 3 ).cwiseAbs( ).maxCoeff( ) );
+        maximumVelocityError = std::max( maximumVelocityError, stateError.segment( 3, 3 ).cwiseAbs( ).maxCoeff( ) );
+    }
+    return std::make_pair( maximumPositionError, maximumVelocityError );
+}
+
+BOOST_AUTO_TEST_SUITE( test_cartesian_state_hermite_interpolator )
+
+//! Test Hermite interpolation of Cartesian states, with and without accelerations.
+BOOST_AUTO_TEST_CASE( testCartesianStateHermiteInterpolator )
+{
+    using namespace interpolators;
+
+    // Create tabulated states at three different step sizes.
+    std::vector< double > stepSizes;
+    stepSizes.push_back( 60.0 );
+    stepSizes.push_back( 180.0 );
+    stepSizes.push_back( 480.0 );
+
+    std::vector< std::vector< double > > times( 3 );
+    std::vector< std::vector< Eigen::Vector6d > > states( 3 );
+    std::vector< std::vector< Eigen::Vector3d > > accelerations( 3 );
+    std::vector< std::map< double, Eigen::Vector6d > > stateMaps( 3 );
+    for( unsigned int i = 0; i < stepSizes.size( ); i++ )
+    {
+        for( double currentTime = 0.0; currentTime <= 2.0E4; currentTime += stepSizes.at( i ) )
+        {
+            times.at( i ).push_back( currentTime );
+            states.at( i ).push_back( getAnalyticalState( currentTime ) );
+            accelerations.at( i ).push_back( getAnalyticalAcceleration( currentTime ) );
+            stateMaps.at( i )[ currentTime ] = states.at( i ).back( );
+        }
+    }
+
+    // Create Lagrange interpolator (current default for tabulated ephemerides) at smallest step size, and Hermite
+    // interpolators at larger step sizes.
+    LagrangeInterpolator< double, Eigen::Vector6d > lagrangeInterpolator( times.at( 0 ), states.at( 0 ), 6 );
+    CartesianStateHermiteInterpolator< double, double > velocityHermiteInterpolator(
+                times.at( 1 ), states.at( 1 ), 4 );
+    CartesianStateHermiteInterpolator< double, double > accelerationHermiteInterpolator(
+                times.at( 2 ), states.at( 2 ), 4, huntingAlgorithm, accelerations.at( 2 ) );
+    BOOST_CHECK_EQUAL( velocityHermiteInterpolator.getUseAccelerations( ), false );
+    BOOST_CHECK_EQUAL( accelerationHermiteInterpolator.getUseAccelerations( ), true );
+
+    // Check that Hermite interpolators, with 3 and 8 times larger step sizes, are more accurate than Lagrange
+    // interpolator (away from boundaries, where Lagrange interpolator reverts to cubic spline).
+    std::pair< double, double > lagrangeErrors = getMaximumInterpolationErrors( lagrangeInterpolator, 1.0E3, 1.9E4 );
+    std::pair< double, double > velocityHermiteErrors =
+            getMaximumInterpolationErrors( velocityHermiteInterpolator, 1.0E3, 1.9E4 );
+    std::pair< double, double > accelerationHermiteErrors =
+            getMaximumInterpolationErrors( accelerationHermiteInterpolator, 1.0E3, 1.9E4 );
+
+    BOOST_CHECK_SMALL( lagrangeErrors.first, 1.0E-2 );
+    BOOST_CHECK( velocityHermiteErrors.first < lagrangeErrors.first );
+    BOOST_CHECK( accelerationHermiteErrors.first < lagrangeErrors.first );
+    BOOST_CHECK_SMALL( velocityHermiteErrors.second, 1.0E-5 );
+    BOOST_CHECK_SMALL( accelerationHermiteErrors.second, 1.0E-5 );
+
+    // Check errors near boundaries of domain
+    BOOST_CHECK_SMALL( getMaximumInterpolationErrors(
+                           velocityHermiteInterpolator, 0.0, times.at( 1 ).back( ) ).first, 1.0E-2 );
+    BOOST_CHECK_SMALL( getMaximumInterpolationErrors(
+                           accelerationHermiteInterpolator, 0.0, times.at( 2 ).back( ) ).first, 1.0E-2 );
+
+    // Check that nodes are reproduced.
+    for( unsigned int i = 0; i < times.at( 2 ).size( ); i++ )
+    {
+        Eigen::Vector6d stateDifference =
+                accelerationHermiteInterpolator.interpolate( times.at( 2 ).at( i ) ) - states.at( 2 ).at( i );
+        BOOST_CHECK_SMALL( stateDifference.segment( 0, 3 ).norm( ), 1.0E-8 );
+        BOOST_CHECK_SMALL( stateDifference.segment( 3, 3 ).norm( ), 1.0E-11 );
+    }
+
+    // Check that velocity is derivative of interpolated position.
+    for( double currentTime = 10.0; currentTime < 2.0E4; currentTime += 977.0 )
+    {
+        double timeStep = 1.0E-2;
+        Eigen::Vector3d numericalVelocity =
+                ( velocityHermiteInterpolator.interpolate( currentTime + timeStep ).segment( 0, 3 ) -
+                  velocityHermiteInterpolator.interpolate( currentTime - timeStep ).segment( 0, 3 ) ) /
+                ( 2.0 * timeStep );
+        BOOST_CHECK_SMALL( ( numericalVelocity - velocityHermiteInterpolator.interpolate( currentTime ).segment( 3, 3 ) ).
+                           norm( ), 1.0E-5 );
+    }
+
+    // Check that interpolator created from settings is identical.
+    std::vector< Eigen::Vector6d > stateDerivatives;
+    for( unsigned int i = 0; i < times.at( 2 ).size( ); i++ )
+    {
+        stateDerivatives.push_back(
+                    ( Eigen::Vector6d( ) << states.at( 2 ).at( i ).segment( 3, 3 ),
+                      accelerations.at( 2 ).at( i ) ).finished( ) );
+    }
+    boost::shared_ptr< OneDimensionalInterpolator< double, Eigen::Vector6d > > createdInterpolator =
+            createOneDimensionalInterpolator(
+                stateMaps.at( 2 ), boost::make_shared< CartesianStateHermiteInterpolatorSettings >( 4 ),
+                stateDerivatives );
+    for( double currentTime = 0.0; currentTime < 2.0E4; currentTime += 133.0 )
+    {
+        BOOST_CHECK( createdInterpolator->interpolate( currentTime ) ==
+                     accelerationHermiteInterpolator.interpolate( currentTime ) );
+    }
+
+    // Check that Hermite interpolator cannot be created for non-state data.
+    std::map< double, double > scalarMap;
+    scalarMap[ 0.0 ] = 0.0;
+    scalarMap[ 1.0 ] = 1.0;
+    bool isExceptionCaught = false;
+    try
+    {
+        createOneDimensionalInterpolator(
+                    scalarMap, boost::make_shared< CartesianStateHermiteInterpolatorSettings >( 2 ) );
+    }
+    catch( std::runtime_error )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
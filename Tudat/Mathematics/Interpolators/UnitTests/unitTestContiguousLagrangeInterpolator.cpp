@@ -0,0 +1,129 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Mathematics/Interpolators/contiguousLagrangeInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_contiguous_lagrange_interpolator )
+
+//! Test whether contiguous Lagrange interpolator reproduces results of regular Lagrange interpolator.
+BOOST_AUTO_TEST_CASE( testContiguousLagrangeInterpolator )
+{
+    // Create matrix- and vector-valued data on non-equidistant grid.
+    std::vector< double > independentValues;
+    std::vector< Eigen::MatrixXd > matrixValues;
+    std::vector< Eigen::Vector6d > vectorValues;
+    for( int i = 0; i < 200; i++ )
+    {
+        independentValues.push_back( 60.0 * i + 0.05 * i * i );
+
+        Eigen::MatrixXd currentMatrix = Eigen::MatrixXd( 6, 9 );
+        for( int j = 0; j < currentMatrix.rows( ); j++ )
+        {
+            for( int k = 0; k < currentMatrix.cols( ); k++ )
+            {
+                currentMatrix( j, k ) = std::sin( independentValues.back( ) / 1000.0 * ( 1 + j ) + k );
+            }
+        }
+        matrixValues.push_back( currentMatrix );
+        vectorValues.push_back( currentMatrix.col( 0 ) );
+    }
+
+    for( unsigned int numberOfStages = 4; numberOfStages <= 10; numberOfStages += 2 )
+    {
+        interpolators::LagrangeInterpolator< double, Eigen::MatrixXd > matrixInterpolator(
+                    independentValues, matrixValues, numberOfStages );
+        interpolators::ContiguousLagrangeInterpolator< double, Eigen::MatrixXd > contiguousMatrixInterpolator(
+                    independentValues, matrixValues, numberOfStages );
+        interpolators::LagrangeInterpolator< double, Eigen::Vector6d > vectorInterpolator(
+                    independentValues, vectorValues, numberOfStages );
+        interpolators::ContiguousLagrangeInterpolator< double, Eigen::Vector6d > contiguousVectorInterpolator(
+                    independentValues, vectorValues, numberOfStages );
+
+        // Check interpolated values throughout domain (including boundary regions and nodes).
+        double tolerance = 1.0E-13;
+        interpolators::LookUpCursor cursor;
+        Eigen::MatrixXd interpolatedMatrix;
+        Eigen::MatrixXd concatenatedMatrix = Eigen::MatrixXd::Zero( 6, 12 );
+        for( int i = 0; i < 4000; i++ )
+        {
+            double currentValue = -10.0 + 3.2 * i;
+            if( i % 20 == 0 )
+            {
+                currentValue = independentValues.at( i / 20 );
+            }
+
+            BOOST_CHECK_SMALL( ( contiguousMatrixInterpolator.interpolate( currentValue ) -
+                                 matrixInterpolator.interpolate( currentValue ) ).cwiseAbs( ).maxCoeff( ),
+                               tolerance );
+            BOOST_CHECK_SMALL( ( contiguousVectorInterpolator.interpolate( currentValue ) -
+                                 vectorInterpolator.interpolate( currentValue ) ).cwiseAbs( ).maxCoeff( ),
+                               tolerance );
+
+            contiguousMatrixInterpolator.interpolate( currentValue, cursor, interpolatedMatrix );
+            BOOST_CHECK( interpolatedMatrix == contiguousMatrixInterpolator.interpolate( currentValue ) );
+
+            // Check interpolation directly into a block of contiguous columns of a larger matrix.
+            contiguousMatrixInterpolator.interpolate( currentValue, cursor, concatenatedMatrix.data( ) + 3 * 6 );
+            BOOST_CHECK( concatenatedMatrix.block( 0, 3, 6, 9 ) == interpolatedMatrix );
+            BOOST_CHECK( concatenatedMatrix.block( 0, 0, 6, 3 ) == Eigen::MatrixXd::Zero( 6, 3 ) );
+        }
+
+        // Check that nodes are reproduced exactly.
+        for( unsigned int i = 0; i < independentValues.size( ); i++ )
+        {
+            BOOST_CHECK( contiguousMatrixInterpolator.interpolate( independentValues.at( i ) ) ==
+                         matrixValues.at( i ) );
+        }
+
+        // Check that dependent values are correctly retrieved from contiguous storage.
+        std::vector< Eigen::MatrixXd > retrievedMatrixValues = contiguousMatrixInterpolator.getDependentValues( );
+        BOOST_CHECK_EQUAL( retrievedMatrixValues.size( ), matrixValues.size( ) );
+        for( unsigned int i = 0; i < matrixValues.size( ); i++ )
+        {
+            BOOST_CHECK( retrievedMatrixValues.at( i ) == matrixValues.at( i ) );
+        }
+    }
+
+    // Check that boundary handling without interpolation throws exception.
+    interpolators::ContiguousLagrangeInterpolator< double, Eigen::Vector6d > noBoundaryInterpolator(
+                independentValues, vectorValues, 8, interpolators::huntingAlgorithm,
+                interpolators::lagrange_no_boundary_interpolation );
+    bool isExceptionCaught = false;
+    try
+    {
+        noBoundaryInterpolator.interpolate( independentValues.at( 1 ) );
+    }
+    catch( std::runtime_error )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,300 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include <boost/make_shared.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Mathematics/Interpolators/contiguousLagrangeInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/cubicSplineInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/hermiteCubicSplineInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/linearInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/lookupScheme.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+//! Function to check whether a nearest lower neighbour index is correct
+template< typename IndependentVariableType >
+bool isNearestLowerNeighbourCorrect( const int index,
+                                     const IndependentVariableType valueToLookup,
+                                     const std::vector< IndependentVariableType >& independentValues )
+{
+    int maximumIndex = static_cast< int >( independentValues.size( ) ) - 2;
+    if( index < 0 || index > maximumIndex )
+    {
+        return false;
+    }
+    else if( valueToLookup < independentValues[ 0 ] )
+    {
+        return ( index == 0 );
+    }
+    else if( valueToLookup > independentValues[ maximumIndex + 1 ] )
+    {
+        return ( index == maximumIndex );
+    }
+    else
+    {
+        return basic_mathematics::isIndependentVariableInInterval( index, valueToLookup, independentValues );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE( test_lookup_schemes )
+
+//! Test whether the equidistant lookup scheme returns correct indices for equidistant and non-equidistant grids.
+BOOST_AUTO_TEST_CASE( testEquidistantLookupScheme )
+{
+    // Create equidistant grid (with rounding errors in grid values), and non-equidistant grid.
+    std::vector< double > equidistantGrid;
+    std::vector< double > nonEquidistantGrid;
+    std::vector< Time > equidistantTimeGrid;
+    double currentValue = 1.0E8;
+    for( int i = 0; i < 1000; i++ )
+    {
+        equidistantGrid.push_back( currentValue );
+        nonEquidistantGrid.push_back( 1.0E8 + 60.0 * i + 0.01 * i * i );
+        equidistantTimeGrid.push_back( Time( 1000, 60.0L * static_cast< long double >( i ) ) );
+        currentValue += 60.0;
+    }
+
+    interpolators::EquidistantLookupScheme< double > equidistantLookupScheme( equidistantGrid );
+    interpolators::EquidistantLookupScheme< double > nonEquidistantLookupScheme( nonEquidistantGrid );
+    interpolators::EquidistantLookupScheme< Time > equidistantTimeLookupScheme( equidistantTimeGrid );
+
+    BOOST_CHECK_EQUAL( equidistantLookupScheme.getIsGridEquidistant( ), true );
+    BOOST_CHECK_EQUAL( nonEquidistantLookupScheme.getIsGridEquidistant( ), false );
+    BOOST_CHECK_EQUAL( equidistantTimeLookupScheme.getIsGridEquidistant( ), true );
+
+    // Check indices for random values (including values outside of grid), and exactly at grid points.
+    boost::random::mt19937 randomGenerator( 42 );
+    boost::random::uniform_real_distribution< double > randomOffset( -1000.0, 61000.0 );
+    for( int i = 0; i < 10000; i++ )
+    {
+        double valueToLookup = 1.0E8 + randomOffset( randomGenerator );
+        if( i % 10 == 0 )
+        {
+            valueToLookup = equidistantGrid.at( ( i / 10 ) % equidistantGrid.size( ) );
+        }
+
+        BOOST_CHECK( isNearestLowerNeighbourCorrect(
+                         equidistantLookupScheme.findNearestLowerNeighbour( valueToLookup ),
+                         valueToLookup, equidistantGrid ) );
+        BOOST_CHECK( isNearestLowerNeighbourCorrect(
+                         nonEquidistantLookupScheme.findNearestLowerNeighbour( valueToLookup ),
+                         valueToLookup, nonEquidistantGrid ) );
+
+        Time timeToLookup = Time( 1000, static_cast< long double >( valueToLookup - 1.0E8 ) );
+        BOOST_CHECK( isNearestLowerNeighbourCorrect(
+                         equidistantTimeLookupScheme.findNearestLowerNeighbour( timeToLookup ),
+                         timeToLookup, equidistantTimeGrid ) );
+    }
+
+    // Check that interpolation results are identical to those using hunting algorithm.
+    std::map< double, double > dataMap;
+    for( unsigned int i = 0; i < equidistantGrid.size( ); i++ )
+    {
+        dataMap[ equidistantGrid.at( i ) ] = std::sin( static_cast< double >( i ) / 10.0 );
+    }
+    interpolators::LinearInterpolatorDouble huntingInterpolator( dataMap, interpolators::huntingAlgorithm );
+    interpolators::LinearInterpolatorDouble equidistantInterpolator( dataMap, interpolators::equidistantLookup );
+    for( int i = 0; i < 1000; i++ )
+    {
+        double valueToLookup = 1.0E8 + randomOffset( randomGenerator );
+        BOOST_CHECK_EQUAL( huntingInterpolator.interpolate( valueToLookup ),
+                           equidistantInterpolator.interpolate( valueToLookup ) );
+    }
+}
+
+//! Function to interpolate at a list of values, using a cursor owned by this function.
+void interpolateWithCursor(
+        const boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, double > > interpolator,
+        const std::vector< double >& valuesToLookup, std::vector< double >& interpolatedValues )
+{
+    interpolators::LookUpCursor cursor;
+    interpolatedValues.resize( valuesToLookup.size( ) );
+    for( unsigned int i = 0; i < valuesToLookup.size( ); i++ )
+    {
+        interpolatedValues[ i ] = interpolator->interpolate( valuesToLookup.at( i ), cursor );
+    }
+}
+
+//! Test whether interpolation using caller-owned cursors is identical to regular interpolation, also when used from
+//! multiple threads.
+BOOST_AUTO_TEST_CASE( testInterpolationWithCursors )
+{
+    // Create data on non-equidistant grid.
+    std::vector< double > independentValues;
+    std::vector< double > dependentValues;
+    std::vector< double > derivativeValues;
+    for( int i = 0; i < 500; i++ )
+    {
+        independentValues.push_back( 10.0 * i + 0.001 * i * i );
+        dependentValues.push_back( std::sin( independentValues.back( ) / 100.0 ) );
+        derivativeValues.push_back( std::cos( independentValues.back( ) / 100.0 ) / 100.0 );
+    }
+
+    std::vector< boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, double > > > interpolatorList;
+    interpolatorList.push_back( boost::make_shared< interpolators::LinearInterpolator< double, double > >(
+                                    independentValues, dependentValues ) );
+    interpolatorList.push_back( boost::make_shared< interpolators::CubicSplineInterpolator< double, double > >(
+                                    independentValues, dependentValues ) );
+    interpolatorList.push_back( boost::make_shared< interpolators::HermiteCubicSplineInterpolator< double, double > >(
+                                    independentValues, dependentValues, derivativeValues ) );
+    interpolatorList.push_back( boost::make_shared< interpolators::LagrangeInterpolator< double, double > >(
+                                    independentValues, dependentValues, 8 ) );
+    interpolatorList.push_back( boost::make_shared< interpolators::LagrangeInterpolator< double, double > >(
+                                    independentValues, dependentValues, 8, interpolators::binarySearch ) );
+
+    // Create two interleaved sequences of values (forward and backward through domain, including boundaries).
+    std::vector< double > forwardValues, backwardValues;
+    for( int i = 0; i < 2000; i++ )
+    {
+        forwardValues.push_back( -10.0 + 3.1 * i );
+        backwardValues.push_back( 6300.0 - 3.3 * i );
+    }
+
+    for( unsigned int i = 0; i < interpolatorList.size( ); i++ )
+    {
+        // Compute reference values
+        std::vector< double > forwardReferenceValues, backwardReferenceValues;
+        for( unsigned int j = 0; j < forwardValues.size( ); j++ )
+        {
+            forwardReferenceValues.push_back( interpolatorList.at( i )->interpolate( forwardValues.at( j ) ) );
+        }
+        for( unsigned int j = 0; j < backwardValues.size( ); j++ )
+        {
+            backwardReferenceValues.push_back( interpolatorList.at( i )->interpolate( backwardValues.at( j ) ) );
+        }
+
+        // Compute interleaved values, using a cursor for each sequence
+        interpolators::LookUpCursor forwardCursor, backwardCursor;
+        for( unsigned int j = 0; j < forwardValues.size( ); j++ )
+        {
+            BOOST_CHECK_EQUAL( interpolatorList.at( i )->interpolate( forwardValues.at( j ), forwardCursor ),
+                               forwardReferenceValues.at( j ) );
+            BOOST_CHECK_EQUAL( interpolatorList.at( i )->interpolate( backwardValues.at( j ), backwardCursor ),
+                               backwardReferenceValues.at( j ) );
+        }
+
+        // Compute values concurrently in two threads.
+        std::vector< double > forwardThreadValues, backwardThreadValues;
+        std::thread forwardThread( interpolateWithCursor, interpolatorList.at( i ),
+                                   std::cref( forwardValues ), std::ref( forwardThreadValues ) );
+        std::thread backwardThread( interpolateWithCursor, interpolatorList.at( i ),
+                                    std::cref( backwardValues ), std::ref( backwardThreadValues ) );
+        forwardThread.join( );
+        backwardThread.join( );
+
+        BOOST_CHECK( forwardThreadValues == forwardReferenceValues );
+        BOOST_CHECK( backwardThreadValues == backwardReferenceValues );
+    }
+}
+
+//! Test whether interpolation at multiple values (sorted and unsorted, single- and multi-threaded) is identical to
+//! regular interpolation.
+BOOST_AUTO_TEST_CASE( testInterpolationAtMultipleValues )
+{
+    // Create data on non-equidistant grid.
+    std::vector< double > independentValues;
+    std::vector< double > dependentValues;
+    std::vector< double > derivativeValues;
+    std::vector< Eigen::Vector3d > vectorDependentValues;
+    for( int i = 0; i < 500; i++ )
+    {
+        independentValues.push_back( 10.0 * i + 0.001 * i * i );
+        dependentValues.push_back( std::sin( independentValues.back( ) / 100.0 ) );
+        derivativeValues.push_back( std::cos( independentValues.back( ) / 100.0 ) / 100.0 );
+        vectorDependentValues.push_back( Eigen::Vector3d::Constant( dependentValues.back( ) ) );
+    }
+
+    std::vector< boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, double > > > interpolatorList;
+    interpolatorList.push_back( boost::make_shared< interpolators::LinearInterpolator< double, double > >(
+                                    independentValues, dependentValues ) );
+    interpolatorList.push_back( boost::make_shared< interpolators::CubicSplineInterpolator< double, double > >(
+                                    independentValues, dependentValues ) );
+    interpolatorList.push_back( boost::make_shared< interpolators::HermiteCubicSplineInterpolator< double, double > >(
+                                    independentValues, dependentValues, derivativeValues ) );
+    interpolatorList.push_back( boost::make_shared< interpolators::LagrangeInterpolator< double, double > >(
+                                    independentValues, dependentValues, 8, interpolators::equidistantLookup ) );
+    interpolators::ContiguousLagrangeInterpolator< double, Eigen::Vector3d > vectorInterpolator(
+                independentValues, vectorDependentValues, 8 );
+
+    // Create sorted and unsorted values (including values outside of domain).
+    std::vector< double > sortedValues, unsortedValues;
+    boost::random::mt19937 randomGenerator( 42 );
+    boost::random::uniform_real_distribution< double > randomValue( -10.0, 5300.0 );
+    for( int i = 0; i < 5000; i++ )
+    {
+        sortedValues.push_back( -10.0 + 1.062 * i );
+        unsortedValues.push_back( randomValue( randomGenerator ) );
+    }
+
+    std::vector< double > interpolatedValues;
+    std::vector< Eigen::Vector3d > vectorInterpolatedValues;
+    for( unsigned int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads += 3 )
+    {
+        for( unsigned int i = 0; i < interpolatorList.size( ); i++ )
+        {
+            interpolatorList.at( i )->interpolateMultipleValues( sortedValues, interpolatedValues, numberOfThreads );
+            BOOST_CHECK_EQUAL( interpolatedValues.size( ), sortedValues.size( ) );
+            for( unsigned int j = 0; j < sortedValues.size( ); j++ )
+            {
+                BOOST_CHECK_EQUAL( interpolatedValues.at( j ),
+                                   interpolatorList.at( i )->interpolate( sortedValues.at( j ) ) );
+            }
+
+            interpolatorList.at( i )->interpolateMultipleValues( unsortedValues, interpolatedValues, numberOfThreads );
+            BOOST_CHECK_EQUAL( interpolatedValues.size( ), unsortedValues.size( ) );
+            for( unsigned int j = 0; j < unsortedValues.size( ); j++ )
+            {
+                BOOST_CHECK_EQUAL( interpolatedValues.at( j ),
+                                   interpolatorList.at( i )->interpolate( unsortedValues.at( j ) ) );
+            }
+        }
+
+        vectorInterpolator.interpolateMultipleValues( unsortedValues, vectorInterpolatedValues, numberOfThreads );
+        for( unsigned int j = 0; j < unsortedValues.size( ); j++ )
+        {
+            BOOST_CHECK( vectorInterpolatedValues.at( j ) == vectorInterpolator.interpolate( unsortedValues.at( j ) ) );
+        }
+    }
+
+    // Check that exceptions in any of the threads are reported.
+    interpolators::LagrangeInterpolator< double, double > noBoundaryInterpolator(
+                independentValues, dependentValues, 8, interpolators::huntingAlgorithm,
+                interpolators::lagrange_no_boundary_interpolation );
+    bool isExceptionCaught = false;
+    try
+    {
+        noBoundaryInterpolator.interpolateMultipleValues( sortedValues, interpolatedValues, 4 );
+    }
+    catch( std::runtime_error )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
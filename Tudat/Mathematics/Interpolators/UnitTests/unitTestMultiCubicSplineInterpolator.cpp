@@ -0,0 +1,218 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <vector>
+
+#include <boost/multi_array.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/Interpolators/cubicSplineInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/multiCubicSplineInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/multiLinearInterpolator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+//! Function that is used to generate tabulated data for the tests.
+Eigen::Vector3d getTestFunctionValue( const double x, const double y, const double z )
+{
+    return ( Eigen::Vector3d( ) << std::sin( x ) * std::cos( 0.5 * y ) + z * z,
+             std::exp( -0.1 * x * y ) + 0.1 * z,
+             x * y * z ).finished( );
+}
+
+BOOST_AUTO_TEST_SUITE( test_multi_cubic_spline_interpolator )
+
+//! Test whether multi-cubic spline interpolator reproduces result of successive one-dimensional cubic splines.
+BOOST_AUTO_TEST_CASE( testMultiCubicSplineInterpolator )
+{
+    // Create non-equidistant three-dimensional grid, with tabulated data
+    std::vector< std::vector< double > > independentValues( 3 );
+    for( int i = 0; i < 9; i++ )
+    {
+        independentValues[ 0 ].push_back( 0.4 * i + 0.02 * i * i );
+    }
+    for( int i = 0; i < 6; i++ )
+    {
+        independentValues[ 1 ].push_back( -1.0 + 0.7 * i );
+    }
+    for( int i = 0; i < 4; i++ )
+    {
+        independentValues[ 2 ].push_back( 0.3 * i * i );
+    }
+
+    boost::multi_array< Eigen::Vector3d, 3 > dependentData( boost::extents[ 9 ][ 6 ][ 4 ] );
+    for( int i = 0; i < 9; i++ )
+    {
+        for( int j = 0; j < 6; j++ )
+        {
+            for( int k = 0; k < 4; k++ )
+            {
+                dependentData[ i ][ j ][ k ] = getTestFunctionValue(
+                            independentValues[ 0 ][ i ], independentValues[ 1 ][ j ], independentValues[ 2 ][ k ] );
+            }
+        }
+    }
+
+    interpolators::MultiCubicSplineInterpolator< double, Eigen::Vector3d, 3 > cubicSplineInterpolator(
+                independentValues, dependentData );
+    interpolators::MultiLinearInterpolator< double, Eigen::Vector3d, 3 > linearInterpolator(
+                independentValues, dependentData );
+    BOOST_CHECK_EQUAL( cubicSplineInterpolator.getNumberOfDimensions( ), 3 );
+
+    // Check that grid points are reproduced.
+    for( int i = 0; i < 9; i++ )
+    {
+        for( int j = 0; j < 6; j++ )
+        {
+            for( int k = 0; k < 4; k++ )
+            {
+                std::vector< double > gridPoint;
+                gridPoint.push_back( independentValues[ 0 ][ i ] );
+                gridPoint.push_back( independentValues[ 1 ][ j ] );
+                gridPoint.push_back( independentValues[ 2 ][ k ] );
+                BOOST_CHECK_SMALL( ( cubicSplineInterpolator.interpolate( gridPoint ) -
+                                     dependentData[ i ][ j ][ k ] ).cwiseAbs( ).maxCoeff( ), 1.0E-13 );
+            }
+        }
+    }
+
+    // Compare to tensor product of one-dimensional cubic splines, computed by successive one-dimensional
+    // interpolation (first along z, then y, then x), and check that it is more accurate than multi-linear
+    // interpolation.
+    double maximumCubicSplineError = 0.0, maximumLinearError = 0.0;
+    for( int testIndex = 0; testIndex < 200; testIndex++ )
+    {
+        std::vector< double > testPoint;
+        testPoint.push_back( std::fmod( 0.0137 * testIndex * testIndex, 4.8 ) );
+        testPoint.push_back( -1.0 + std::fmod( 0.731 * testIndex, 3.5 ) );
+        testPoint.push_back( std::fmod( 0.0519 * testIndex, 2.7 ) );
+
+        std::vector< Eigen::Vector3d > valuesAlongX;
+        for( int i = 0; i < 9; i++ )
+        {
+            std::vector< Eigen::Vector3d > valuesAlongY;
+            for( int j = 0; j < 6; j++ )
+            {
+                std::vector< Eigen::Vector3d > valuesAlongZ;
+                for( int k = 0; k < 4; k++ )
+                {
+                    valuesAlongZ.push_back( dependentData[ i ][ j ][ k ] );
+                }
+                valuesAlongY.push_back( interpolators::CubicSplineInterpolator< double, Eigen::Vector3d >(
+                                            independentValues[ 2 ], valuesAlongZ ).interpolate( testPoint[ 2 ] ) );
+            }
+            valuesAlongX.push_back( interpolators::CubicSplineInterpolator< double, Eigen::Vector3d >(
+                                        independentValues[ 1 ], valuesAlongY ).interpolate( testPoint[ 1 ] ) );
+        }
+        Eigen::Vector3d expectedValue = interpolators::CubicSplineInterpolator< double, Eigen::Vector3d >(
+                    independentValues[ 0 ], valuesAlongX ).interpolate( testPoint[ 0 ] );
+
+        Eigen::Vector3d interpolatedValue = cubicSplineInterpolator.interpolate( testPoint );
+        BOOST_CHECK_SMALL( ( interpolatedValue - expectedValue ).cwiseAbs( ).maxCoeff( ), 1.0E-12 );
+
+        Eigen::Vector3d trueValue = getTestFunctionValue( testPoint[ 0 ], testPoint[ 1 ], testPoint[ 2 ] );
+        maximumCubicSplineError = std::max(
+                    maximumCubicSplineError, ( interpolatedValue - trueValue ).cwiseAbs( ).maxCoeff( ) );
+        maximumLinearError = std::max(
+                    maximumLinearError, ( linearInterpolator.interpolate( testPoint ) - trueValue ).cwiseAbs( ).maxCoeff( ) );
+    }
+    BOOST_CHECK( maximumCubicSplineError < maximumLinearError );
+
+    // Check that first derivative is continuous when crossing grid cell boundaries (contrary to multi-linear
+    // interpolation).
+    double stepSize = 1.0E-6;
+    for( int i = 1; i < 8; i++ )
+    {
+        boost::array< double, 3 > centralPoint = { { independentValues[ 0 ][ i ], 0.13, 0.77 } };
+        boost::array< double, 3 > lowerPoint = centralPoint, upperPoint = centralPoint;
+        lowerPoint[ 0 ] -= stepSize;
+        upperPoint[ 0 ] += stepSize;
+
+        Eigen::Vector3d leftDerivative = ( cubicSplineInterpolator.interpolate( centralPoint ) -
+                                           cubicSplineInterpolator.interpolate( lowerPoint ) ) / stepSize;
+        Eigen::Vector3d rightDerivative = ( cubicSplineInterpolator.interpolate( upperPoint ) -
+                                            cubicSplineInterpolator.interpolate( centralPoint ) ) / stepSize;
+        BOOST_CHECK_SMALL( ( leftDerivative - rightDerivative ).cwiseAbs( ).maxCoeff( ), 1.0E-4 );
+    }
+}
+
+//! Test whether multi-cubic spline interpolator is independent of storage order and index bases of input data.
+BOOST_AUTO_TEST_CASE( testMultiCubicSplineInterpolatorStorageOrder )
+{
+    std::vector< std::vector< double > > independentValues( 2 );
+    for( int i = 0; i < 5; i++ )
+    {
+        independentValues[ 0 ].push_back( static_cast< double >( i * i ) );
+    }
+    for( int i = 0; i < 7; i++ )
+    {
+        independentValues[ 1 ].push_back( 0.5 * i );
+    }
+
+    boost::multi_array< double, 2 > cOrderData( boost::extents[ 5 ][ 7 ] );
+    boost::multi_array< double, 2 > fortranOrderData( boost::extents[ 5 ][ 7 ], boost::fortran_storage_order( ) );
+    for( int i = 0; i < 5; i++ )
+    {
+        for( int j = 0; j < 7; j++ )
+        {
+            cOrderData[ i ][ j ] = std::cos( 0.3 * independentValues[ 0 ][ i ] ) * independentValues[ 1 ][ j ];
+            fortranOrderData[ i ][ j ] = cOrderData[ i ][ j ];
+        }
+    }
+    boost::multi_array< double, 2 > reindexedData = cOrderData;
+    reindexedData.reindex( 1 );
+
+    interpolators::MultiCubicSplineInterpolator< double, double, 2 > cOrderInterpolator(
+                independentValues, cOrderData );
+    interpolators::MultiCubicSplineInterpolator< double, double, 2 > fortranOrderInterpolator(
+                independentValues, fortranOrderData, interpolators::binarySearch );
+    interpolators::MultiCubicSplineInterpolator< double, double, 2 > reindexedInterpolator(
+                independentValues, reindexedData, interpolators::equidistantLookup );
+
+    for( int i = 0; i < 100; i++ )
+    {
+        boost::array< double, 2 > testPoint = { { -1.0 + 0.17 * i, 3.2 - 0.037 * i } };
+        BOOST_CHECK_EQUAL( cOrderInterpolator.interpolate( testPoint ),
+                           fortranOrderInterpolator.interpolate( testPoint ) );
+        BOOST_CHECK_EQUAL( cOrderInterpolator.interpolate( testPoint ),
+                           reindexedInterpolator.interpolate( testPoint ) );
+    }
+
+    // Check that a grid with a single point in one of the dimensions is rejected.
+    std::vector< std::vector< double > > invalidIndependentValues = independentValues;
+    invalidIndependentValues[ 0 ].resize( 1 );
+    boost::multi_array< double, 2 > invalidData( boost::extents[ 1 ][ 7 ] );
+    bool isExceptionCaught = false;
+    try
+    {
+        interpolators::MultiCubicSplineInterpolator< double, double, 2 > invalidInterpolator(
+                    invalidIndependentValues, invalidData );
+    }
+    catch( std::runtime_error )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
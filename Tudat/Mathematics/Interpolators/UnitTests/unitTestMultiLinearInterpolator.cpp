@@ -11,9 +11,12 @@
 
 #define BOOST_TEST_MAIN
 
+#include <boost/array.hpp>
 #include <boost/test/unit_test.hpp>
 #include <boost/multi_array.hpp>
 
+#include <Eigen/Core>
+
 #include <limits>
 #include <vector>
 #include <cmath>
@@ -149,6 +152,94 @@ BOOST_AUTO_TEST_CASE( test4Dimensions )
                                 std::numeric_limits< double >::epsilon( ) );
 }
 
+// Test 3: Comparison of interpolation with fixed-size array input, non-default storage order and index bases, and
+// vector-valued dependent variables, to manually computed multi-linear interpolation.
+BOOST_AUTO_TEST_CASE( testStorageOrderAndArrayInput )
+{
+    // Create non-equidistant independent variables.
+    std::vector< std::vector< double > > independentValues;
+    independentValues.resize( 3 );
+    for ( int i = 0; i < 7; i++ )
+    {
+        independentValues[ 0 ].push_back( 0.1 * i + 0.01 * i * i );
+        independentValues[ 1 ].push_back( -2.0 + 0.5 * i );
+    }
+    for ( int i = 0; i < 4; i++ )
+    {
+        independentValues[ 2 ].push_back( 100.0 * std::pow( 2.0, i ) );
+    }
+
+    // Create dependent variables with Fortran storage order and non-zero index bases.
+    boost::multi_array< Eigen::Vector3d, 3 > dependentValues(
+                boost::extents[ 7 ][ 7 ][ 4 ], boost::fortran_storage_order( ) );
+    boost::array< boost::multi_array< Eigen::Vector3d, 3 >::index, 3 > indexBases = { { 1, -3, 2 } };
+    dependentValues.reindex( indexBases );
+    for ( int i = 0; i < 7; i++ )
+    {
+        for ( int j = 0; j < 7; j++ )
+        {
+            for ( int k = 0; k < 4; k++ )
+            {
+                dependentValues[ i + 1 ][ j - 3 ][ k + 2 ] =
+                        Eigen::Vector3d( std::sin( independentValues[ 0 ][ i ] ) * independentValues[ 1 ][ j ],
+                                         std::cos( independentValues[ 1 ][ j ] ) + independentValues[ 2 ][ k ],
+                                         independentValues[ 0 ][ i ] * independentValues[ 2 ][ k ] );
+            }
+        }
+    }
+
+    interpolators::MultiLinearInterpolator< double, Eigen::Vector3d, 3 > interpolator(
+            independentValues, dependentValues );
+
+    std::vector< double > targetValue( 3 );
+    boost::array< double, 3 > targetArray;
+    for ( int testCase = 0; testCase < 100; testCase++ )
+    {
+        targetValue[ 0 ] = 0.007 * testCase;
+        targetValue[ 1 ] = -2.0 + 0.029 * testCase;
+        targetValue[ 2 ] = 100.0 + 6.5 * testCase;
+        std::copy( targetValue.begin( ), targetValue.end( ), targetArray.begin( ) );
+
+        // Compute interpolated value manually from weights of all 8 surrounding grid points.
+        boost::array< int, 3 > lowerIndices;
+        boost::array< double, 3 > upperFractions;
+        for ( int i = 0; i < 3; i++ )
+        {
+            lowerIndices[ i ] = 0;
+            while( lowerIndices[ i ] < static_cast< int >( independentValues[ i ].size( ) ) - 2 &&
+                   independentValues[ i ][ lowerIndices[ i ] + 1 ] < targetValue[ i ] )
+            {
+                lowerIndices[ i ]++;
+            }
+            upperFractions[ i ] = ( targetValue[ i ] - independentValues[ i ][ lowerIndices[ i ] ] ) /
+                    ( independentValues[ i ][ lowerIndices[ i ] + 1 ] - independentValues[ i ][ lowerIndices[ i ] ] );
+        }
+
+        Eigen::Vector3d expectedValue = Eigen::Vector3d::Zero( );
+        for ( int corner = 0; corner < 8; corner++ )
+        {
+            double weight = 1.0;
+            boost::array< int, 3 > cornerIndices;
+            for ( int i = 0; i < 3; i++ )
+            {
+                bool isUpper = ( ( corner >> i ) & 1 );
+                cornerIndices[ i ] = lowerIndices[ i ] + ( isUpper ? 1 : 0 );
+                weight *= ( isUpper ? upperFractions[ i ] : ( 1.0 - upperFractions[ i ] ) );
+            }
+            expectedValue += weight * dependentValues[ cornerIndices[ 0 ] + 1 ][ cornerIndices[ 1 ] - 3 ]
+                    [ cornerIndices[ 2 ] + 2 ];
+        }
+
+        // Compare to interpolated values, and compare vector and array input.
+        Eigen::Vector3d interpolatedValue = interpolator.interpolate( targetArray );
+        for ( int i = 0; i < 3; i++ )
+        {
+            BOOST_CHECK_CLOSE_FRACTION( expectedValue( i ), interpolatedValue( i ), 1.0E-14 );
+        }
+        BOOST_CHECK( interpolator.interpolate( targetValue ) == interpolatedValue );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
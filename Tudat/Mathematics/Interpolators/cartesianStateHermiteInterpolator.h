@@ -0,0 +1,311 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Burden, R.L. and Faires, J.D., Numerical Analysis, 9th edition, Brooks/Cole, 2011 (Section 3.4).
+ *
+ */
+
+#ifndef TUDAT_CARTESIANSTATEHERMITEINTERPOLATOR_H
+#define TUDAT_CARTESIANSTATEHERMITEINTERPOLATOR_H
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/Interpolators/oneDimensionalInterpolator.h"
+
+namespace tudat
+{
+
+namespace interpolators
+{
+
+//! Class to perform Hermite interpolation of Cartesian states, using the velocity as derivative of the position.
+/*!
+ *  Class to perform Hermite interpolation of Cartesian states (position and velocity). Contrary to the interpolation
+ *  of the full state vector with e.g. a Lagrange interpolator, in which the position and velocity are interpolated
+ *  independently, this class uses the velocity (and, if provided, the acceleration) at each node as the derivative(s)
+ *  of the position. The position is interpolated by the polynomial that matches the position, velocity (and
+ *  acceleration) at numberOfNodes nodes centered on the interval in which the requested independent variable lies
+ *  (shifted inwards at the edges of the domain), which is of degree 2 * numberOfNodes - 1 (3 * numberOfNodes - 1 if
+ *  accelerations are provided). The interpolated velocity is the derivative of this polynomial, so that the
+ *  interpolated position and velocity are consistent. The polynomial is stored in Newton form (with divided
+ *  differences over repeated nodes, see Burden and Faires, 2011), the coefficients of which are pre-computed for each
+ *  stencil of nodes. Compared to Lagrange interpolation of the state, this allows a significantly larger step size in
+ *  the tabulated data for the same interpolation accuracy.
+ *  \tparam IndependentVariableType Type of independent variable (time).
+ *  \tparam StateScalarType Type of entries of the Cartesian state.
+ *  \tparam ScalarType Type used for differences of independent variable values.
+ */
+template< typename IndependentVariableType, typename StateScalarType,
+          typename ScalarType = IndependentVariableType >
+class CartesianStateHermiteInterpolator :
+        public OneDimensionalInterpolator< IndependentVariableType, Eigen::Matrix< StateScalarType, 6, 1 > >
+{
+public:
+
+    //! Typedef for Cartesian state.
+    typedef Eigen::Matrix< StateScalarType, 6, 1 > StateType;
+
+    //! Typedef for Cartesian position/velocity/acceleration vector.
+    typedef Eigen::Matrix< StateScalarType, 3, 1 > VectorType;
+
+    //! Using statements to prevent having to put 'this' everywhere in the code.
+    using OneDimensionalInterpolator< IndependentVariableType, StateType >::dependentValues_;
+    using OneDimensionalInterpolator< IndependentVariableType, StateType >::independentValues_;
+    using OneDimensionalInterpolator< IndependentVariableType, StateType >::lookUpScheme_;
+    using OneDimensionalInterpolator< IndependentVariableType, StateType >::interpolate;
+
+    //! Constructor from vectors of independent variables, states and (optionally) accelerations.
+    /*!
+     *  Constructor from vectors of independent variables, states and (optionally) accelerations.
+     *  \param independentValues Vector of values of independent variables that are used, must be sorted in ascending
+     *  order.
+     *  \param stateValues Vector of Cartesian states at independent variables.
+     *  \param numberOfNodes Number of nodes used for each interpolating polynomial.
+     *  \param selectedLookupScheme Identifier of lookupscheme from enum. This algorithm is used to find the nearest
+     *  lower data point in the independent variables when requesting interpolation.
+     *  \param accelerationValues Vector of Cartesian accelerations at independent variables (empty by default,
+     *  in which case only position and velocity are used).
+     */
+    CartesianStateHermiteInterpolator(
+            const std::vector< IndependentVariableType >& independentValues,
+            const std::vector< StateType >& stateValues,
+            const int numberOfNodes = 4,
+            const AvailableLookupScheme selectedLookupScheme = huntingAlgorithm,
+            const std::vector< VectorType >& accelerationValues = std::vector< VectorType >( ) ):
+        numberOfNodes_( numberOfNodes )
+    {
+        independentValues_ = independentValues;
+        dependentValues_ = stateValues;
+
+        initializeInterpolator( accelerationValues, selectedLookupScheme );
+    }
+
+    //! Constructor from map of states and (optionally) vector of accelerations.
+    /*!
+     *  Constructor from map of states and (optionally) vector of accelerations.
+     *  \param dataMap Map containing independent variables as key and Cartesian states as value.
+     *  \param numberOfNodes Number of nodes used for each interpolating polynomial.
+     *  \param selectedLookupScheme Identifier of lookupscheme from enum. This algorithm is used to find the nearest
+     *  lower data point in the independent variables when requesting interpolation.
+     *  \param accelerationValues Vector of Cartesian accelerations at independent variables, in the same order as the
+     *  entries of dataMap (empty by default, in which case only position and velocity are used).
+     */
+    CartesianStateHermiteInterpolator(
+            const std::map< IndependentVariableType, StateType >& dataMap,
+            const int numberOfNodes = 4,
+            const AvailableLookupScheme selectedLookupScheme = huntingAlgorithm,
+            const std::vector< VectorType >& accelerationValues = std::vector< VectorType >( ) ):
+        numberOfNodes_( numberOfNodes )
+    {
+        for( typename std::map< IndependentVariableType, StateType >::const_iterator mapIterator = dataMap.begin( );
+             mapIterator != dataMap.end( ); mapIterator++ )
+        {
+            independentValues_.push_back( mapIterator->first );
+            dependentValues_.push_back( mapIterator->second );
+        }
+
+        initializeInterpolator( accelerationValues, selectedLookupScheme );
+    }
+
+    //! Destructor.
+    ~CartesianStateHermiteInterpolator( ){ }
+
+    //! Function interpolates state at given independent variable value.
+    /*!
+     *  Function interpolates state at given independent variable value, using a look-up cursor owned by the caller.
+     *  The position is evaluated from the Hermite polynomial, the velocity from its derivative.
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation is to take place.
+     *  \param cursor Look-up cursor owned by the caller, storing the result of the caller's previous look-up.
+     *  \return Interpolated Cartesian state.
+     */
+    StateType interpolate( const IndependentVariableType targetIndependentVariableValue,
+                           LookUpCursor& cursor ) const
+    {
+        // Determine first node of stencil.
+        int firstNode = lookUpScheme_->findNearestLowerNeighbour( targetIndependentVariableValue, cursor ) -
+                ( numberOfNodes_ - 1 ) / 2;
+        firstNode = std::max( 0, std::min( firstNode, numberOfStencils_ - 1 ) );
+
+        // Evaluate polynomial and its derivative in Newton form, using Horner's scheme.
+        const int firstCoefficient = firstNode * numberOfCoefficientsPerStencil_;
+        VectorType position = newtonCoefficients_.col( firstCoefficient + numberOfCoefficientsPerStencil_ - 1 );
+        VectorType velocity = VectorType::Zero( );
+        StateScalarType currentDifference;
+        for( int k = numberOfCoefficientsPerStencil_ - 2; k >= 0; k-- )
+        {
+            currentDifference = static_cast< StateScalarType >( static_cast< ScalarType >(
+                        targetIndependentVariableValue - independentValues_[ firstNode + k / nodeMultiplicity_ ] ) );
+            velocity = velocity * currentDifference + position;
+            position = position * currentDifference + newtonCoefficients_.col( firstCoefficient + k );
+        }
+
+        StateType interpolatedState;
+        interpolatedState << position, velocity;
+        return interpolatedState;
+    }
+
+    //! Function to return the number of nodes used for each interpolating polynomial.
+    /*!
+     *  Function to return the number of nodes used for each interpolating polynomial.
+     *  \return Number of nodes used for each interpolating polynomial.
+     */
+    int getNumberOfNodes( )
+    {
+        return numberOfNodes_;
+    }
+
+    //! Function to return whether accelerations are used in the interpolation.
+    /*!
+     *  Function to return whether accelerations are used in the interpolation.
+     *  \return True if accelerations are used in the interpolation.
+     */
+    bool getUseAccelerations( )
+    {
+        return ( nodeMultiplicity_ == 3 );
+    }
+
+protected:
+
+    //! Function to perform interpolation at a sequence of values of the independent variable.
+    /*!
+     * Function to perform interpolation at a sequence of values of the independent variable, calling the
+     * interpolate function of this class directly for each value (see
+     * OneDimensionalInterpolator::interpolateSequence).
+     * \param independentVariableValues Pointer to first value of independent variable at which interpolation is to
+     * take place.
+     * \param numberOfValues Number of values at which interpolation is to take place.
+     * \param interpolatedValues Pointer to first interpolated value of dependent variable (returned by reference).
+     * \param cursor Look-up cursor owned by the caller, storing the result of the caller's previous look-up.
+     */
+    void interpolateSequence( const IndependentVariableType* independentVariableValues,
+                              const unsigned int numberOfValues,
+                              StateType* interpolatedValues,
+                              LookUpCursor& cursor ) const
+    {
+        for( unsigned int i = 0; i < numberOfValues; i++ )
+        {
+            interpolatedValues[ i ] = CartesianStateHermiteInterpolator::interpolate( independentVariableValues[ i ], cursor );
+        }
+    }
+
+private:
+
+    //! Function to check input, and compute the coefficients of the polynomials in Newton form.
+    /*!
+     *  Function to check input, and compute the coefficients of the polynomials in Newton form, for each stencil.
+     *  \param accelerationValues Vector of Cartesian accelerations at independent variables (may be empty).
+     *  \param selectedLookupScheme Identifier of lookupscheme from enum.
+     */
+    void initializeInterpolator( const std::vector< VectorType >& accelerationValues,
+                                 const AvailableLookupScheme selectedLookupScheme )
+    {
+        // Check consistency of input data.
+        const int numberOfIndependentValues = static_cast< int >( independentValues_.size( ) );
+        if( static_cast< int >( dependentValues_.size( ) ) != numberOfIndependentValues )
+        {
+            throw std::runtime_error(
+                        "Error: indep. and dep. variables incompatible in Cartesian state Hermite interpolator." );
+        }
+        if( accelerationValues.size( ) != 0 &&
+                static_cast< int >( accelerationValues.size( ) ) != numberOfIndependentValues )
+        {
+            throw std::runtime_error(
+                        "Error: accelerations incompatible in Cartesian state Hermite interpolator." );
+        }
+        if( numberOfNodes_ < 2 || numberOfNodes_ > numberOfIndependentValues )
+        {
+            throw std::runtime_error(
+                        "Error: Insufficient data points for Cartesian state Hermite interpolator." );
+        }
+        if( !std::is_sorted( independentValues_.begin( ), independentValues_.end( ) ) )
+        {
+            throw std::runtime_error( "Error when making Cartesian state Hermite interpolator, input vector with independent variables should be in ascending order" );
+        }
+
+        nodeMultiplicity_ = ( accelerationValues.size( ) > 0 ) ? 3 : 2;
+        numberOfCoefficientsPerStencil_ = nodeMultiplicity_ * numberOfNodes_;
+        numberOfStencils_ = numberOfIndependentValues - numberOfNodes_ + 1;
+
+        // Compute divided differences for each stencil, with each node repeated nodeMultiplicity_ times.
+        newtonCoefficients_.resize( 3, numberOfCoefficientsPerStencil_ * numberOfStencils_ );
+        for( int i = 0; i < numberOfStencils_; i++ )
+        {
+            const int firstCoefficient = i * numberOfCoefficientsPerStencil_;
+            for( int k = 0; k < numberOfCoefficientsPerStencil_; k++ )
+            {
+                newtonCoefficients_.col( firstCoefficient + k ) =
+                        dependentValues_[ i + k / nodeMultiplicity_ ].segment( 0, 3 );
+            }
+
+            for( int j = 1; j < numberOfCoefficientsPerStencil_; j++ )
+            {
+                for( int k = numberOfCoefficientsPerStencil_ - 1; k >= j; k-- )
+                {
+                    int currentNode = i + k / nodeMultiplicity_;
+                    int previousNode = i + ( k - j ) / nodeMultiplicity_;
+
+                    // For repeated nodes, divided difference is given by (scaled) derivative.
+                    if( currentNode == previousNode )
+                    {
+                        if( j == 1 )
+                        {
+                            newtonCoefficients_.col( firstCoefficient + k ) =
+                                    dependentValues_[ currentNode ].segment( 3, 3 );
+                        }
+                        else
+                        {
+                            newtonCoefficients_.col( firstCoefficient + k ) =
+                                    accelerationValues[ currentNode ] / static_cast< StateScalarType >( 2 );
+                        }
+                    }
+                    else
+                    {
+                        newtonCoefficients_.col( firstCoefficient + k ) =
+                                ( newtonCoefficients_.col( firstCoefficient + k ) -
+                                  newtonCoefficients_.col( firstCoefficient + k - 1 ) ) /
+                                static_cast< StateScalarType >( static_cast< ScalarType >(
+                                        independentValues_[ currentNode ] - independentValues_[ previousNode ] ) );
+                    }
+                }
+            }
+        }
+
+        // Create lookup scheme.
+        this->makeLookupScheme( selectedLookupScheme );
+    }
+
+    //! Number of nodes used for each interpolating polynomial.
+    int numberOfNodes_;
+
+    //! Number of times each node is repeated in divided differences (2 for position/velocity, 3 if accelerations
+    //! are used).
+    int nodeMultiplicity_;
+
+    //! Number of Newton coefficients for each stencil of nodes.
+    int numberOfCoefficientsPerStencil_;
+
+    //! Number of stencils of nodes (i.e. number of independent values minus numberOfNodes_, plus one).
+    int numberOfStencils_;
+
+    //! Coefficients of Newton form of polynomials, stored consecutively (numberOfCoefficientsPerStencil_ columns)
+    //! per stencil.
+    Eigen::Matrix< StateScalarType, 3, Eigen::Dynamic > newtonCoefficients_;
+};
+
+} // namespace interpolators
+
+} // namespace tudat
+
+#endif // TUDAT_CARTESIANSTATEHERMITEINTERPOLATOR_H
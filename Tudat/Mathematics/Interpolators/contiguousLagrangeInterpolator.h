@@ -0,0 +1,476 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Berrut, J.-P. and Trefethen, L.N., Barycentric Lagrange Interpolation, SIAM Review 46(3), 2004.
+ *
+ */
+
+#ifndef TUDAT_CONTIGUOUSLAGRANGEINTERPOLATOR_H
+#define TUDAT_CONTIGUOUSLAGRANGEINTERPOLATOR_H
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/lexical_cast.hpp>
+#include <boost/make_shared.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/Interpolators/cubicSplineInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/oneDimensionalInterpolator.h"
+
+namespace tudat
+{
+
+namespace interpolators
+{
+
+//! Class to perform Lagrange polynomial interpolation of Eigen vectors/matrices, stored in contiguous memory.
+/*!
+ *  Class to perform Lagrange polynomial interpolation of Eigen vectors/matrices, producing the same interpolant as the
+ *  LagrangeInterpolator class (including the handling of the domain boundaries). Contrary to the LagrangeInterpolator,
+ *  the dependent variables are not stored as a vector of (separately allocated) Eigen objects, but as the columns of a
+ *  single column-major matrix, and the interpolants are evaluated in barycentric form (Berrut and Trefethen, 2004),
+ *  using weights that are pre-computed for each interval (also stored contiguously). An interpolation inside the domain
+ *  then consists of the computation of numberOfStages coefficients (stored on the stack), followed by a single
+ *  matrix-vector product, without any heap allocation (other than that of the returned object, which may be avoided
+ *  by using the interpolate function with an output argument). This class is designed for interpolation of large
+ *  matrices, such as state transition and sensitivity matrices.
+ *  \tparam IndependentVariableType Type of independent variable.
+ *  \tparam DependentVariableType Type of dependent variable, must be an Eigen::Matrix (fixed or dynamic size).
+ *  \tparam ScalarType Type used for computation of interpolation coefficients.
+ */
+template< typename IndependentVariableType, typename DependentVariableType,
+          typename ScalarType = IndependentVariableType >
+class ContiguousLagrangeInterpolator : public OneDimensionalInterpolator< IndependentVariableType,
+        DependentVariableType >
+{
+public:
+
+    //! Using statements to prevent having to put 'this' everywhere in the code.
+    using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::independentValues_;
+    using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::lookUpScheme_;
+    using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::interpolate;
+
+    //! Type of entries of dependent variables.
+    typedef typename DependentVariableType::Scalar DependentScalarType;
+
+    //! Maximum number of stages (i.e. number of data points used for a single interpolant).
+    enum { maximumNumberOfStages = 20 };
+
+    //! Constructor from vectors of independent/dependent data.
+    /*!
+     *  This constructor initializes the interpolator from two vectors containing the independent
+     *  variables and dependent variables. A look-up scheme can be provided to override the
+     *  given default.
+     *  \param independentVariables Vector of values of independent variables that are used, must be
+     *  sorted in ascending order.
+     *  \param dependentVariables Vector of values of dependent variables that are used (all of equal size).
+     *  \param numberOfStages Number of data points that are used to calculate the interpolating
+     *  polynomial (must be even, and not larger than maximumNumberOfStages).
+     *  \param selectedLookupScheme Identifier of lookupscheme from enum. This algorithm is used
+     *  to find the nearest lower data point in the independent variables when requesting
+     *  interpolation.
+     *  \param boundaryHandling Method by which the boundaries of the domain are handled.
+     */
+    ContiguousLagrangeInterpolator( const std::vector< IndependentVariableType >& independentVariables,
+                                    const std::vector< DependentVariableType >& dependentVariables,
+                                    const int numberOfStages,
+                                    const AvailableLookupScheme selectedLookupScheme = huntingAlgorithm,
+                                    const LagrangeInterpolatorBoundaryHandling boundaryHandling =
+            lagrange_cubic_spline_boundary_interpolation ):
+        numberOfStages_( numberOfStages ), boundaryHandling_( boundaryHandling )
+    {
+        initializeInterpolator( independentVariables, dependentVariables, selectedLookupScheme );
+    }
+
+    //! Constructor from map of independent/dependent data.
+    /*!
+     *  This constructor initializes the interpolator from a map containing independent variables
+     *  as key and dependent variables as value. A look-up scheme can be provided to override the
+     *  given default.
+     *  \param dataMap Map containing independent variables as key and dependent variables as
+     *  value (all of equal size).
+     *  \param numberOfStages Number of data points that are used to calculate the interpolating
+     *  polynomial (must be even, and not larger than maximumNumberOfStages).
+     *  \param selectedLookupScheme Identifier of lookupscheme from enum. This algorithm is used
+     *  to find the nearest lower data point in the independent variables when requesting
+     *  interpolation.
+     *  \param boundaryHandling Method by which the boundaries of the domain are handled.
+     */
+    ContiguousLagrangeInterpolator(
+            const std::map< IndependentVariableType, DependentVariableType >& dataMap,
+            const int numberOfStages,
+            const AvailableLookupScheme selectedLookupScheme = huntingAlgorithm,
+            const LagrangeInterpolatorBoundaryHandling boundaryHandling =
+            lagrange_cubic_spline_boundary_interpolation ):
+        numberOfStages_( numberOfStages ), boundaryHandling_( boundaryHandling )
+    {
+        std::vector< IndependentVariableType > independentVariables;
+        std::vector< DependentVariableType > dependentVariables;
+        for( typename std::map< IndependentVariableType, DependentVariableType >::const_iterator
+             mapIterator = dataMap.begin( ); mapIterator != dataMap.end( ); mapIterator++ )
+        {
+            independentVariables.push_back( mapIterator->first );
+            dependentVariables.push_back( mapIterator->second );
+        }
+
+        initializeInterpolator( independentVariables, dependentVariables, selectedLookupScheme );
+    }
+
+    //! Destructor.
+    ~ContiguousLagrangeInterpolator( ){ }
+
+    //! Function interpolates dependent variable value at given independent variable value.
+    /*!
+     *  Function interpolates dependent variable value at given independent variable value, using a look-up cursor
+     *  owned by the caller (see LagrangeInterpolator::interpolate for details on the interpolant).
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation
+     *  is to take place.
+     *  \param cursor Look-up cursor owned by the caller, storing the result of the caller's previous look-up.
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolate(
+            const IndependentVariableType targetIndependentVariableValue, LookUpCursor& cursor ) const
+    {
+        DependentVariableType interpolatedValue;
+        interpolate( targetIndependentVariableValue, cursor, interpolatedValue );
+        return interpolatedValue;
+    }
+
+    //! Function interpolates dependent variable value at given independent variable value, into existing object.
+    /*!
+     *  Function interpolates dependent variable value at given independent variable value, using a look-up cursor
+     *  owned by the caller, and writing the result into an existing object. If this object already has the correct
+     *  size, no heap allocation is performed (unless the value is requested in the boundary region of the domain).
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation
+     *  is to take place.
+     *  \param cursor Look-up cursor owned by the caller, storing the result of the caller's previous look-up.
+     *  \param interpolatedValue Interpolated value of dependent variable (returned by reference).
+     */
+    void interpolate( const IndependentVariableType targetIndependentVariableValue, LookUpCursor& cursor,
+                      DependentVariableType& interpolatedValue ) const
+    {
+        interpolatedValue.resize( numberOfRows_, numberOfColumns_ );
+        interpolate( targetIndependentVariableValue, cursor, interpolatedValue.data( ) );
+    }
+
+    //! Function interpolates dependent variable value at given independent variable value, into existing memory.
+    /*!
+     *  Function interpolates dependent variable value at given independent variable value, using a look-up cursor
+     *  owned by the caller, and writing the entries of the result (in column-major order) into existing memory, e.g.
+     *  a contiguous block of a larger matrix. No heap allocation is performed, unless the value is requested in the
+     *  boundary region of the domain.
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation
+     *  is to take place.
+     *  \param cursor Look-up cursor owned by the caller, storing the result of the caller's previous look-up.
+     *  \param interpolatedValueData Pointer to the memory to which the (number of rows times number of columns)
+     *  entries of the interpolated value are written.
+     */
+    void interpolate( const IndependentVariableType targetIndependentVariableValue, LookUpCursor& cursor,
+                      DependentScalarType* interpolatedValueData ) const
+    {
+        Eigen::Map< Eigen::Matrix< DependentScalarType, Eigen::Dynamic, 1 > > interpolatedValueVector(
+                    interpolatedValueData, numberOfRows_ * numberOfColumns_ );
+
+        // Find interpolation interval
+        int lowerEntry = lookUpScheme_->findNearestLowerNeighbour( targetIndependentVariableValue, cursor );
+
+        // Check if requested interval is inside region in which centered lagrange interpolation
+        // can be used.
+        if( lowerEntry < offsetEntries_ )
+        {
+            if( boundaryHandling_ == lagrange_no_boundary_interpolation )
+            {
+                throw std::runtime_error(
+                            "Error: Lagrange interpolator below allowed bounds." );
+            }
+
+            LookUpCursor boundaryCursor;
+            DependentVariableType boundaryValue =
+                    beginInterpolator_->interpolate( targetIndependentVariableValue, boundaryCursor );
+            interpolatedValueVector = Eigen::Map< const Eigen::Matrix< DependentScalarType, Eigen::Dynamic, 1 > >(
+                        boundaryValue.data( ), numberOfRows_ * numberOfColumns_ );
+        }
+        else if( lowerEntry >= numberOfIndependentValues_ - offsetEntries_ - 1 )
+        {
+            if( boundaryHandling_ == lagrange_no_boundary_interpolation )
+            {
+                throw std::runtime_error(
+                            "Error: Lagrange interpolator above allowed bounds." );
+            }
+
+            LookUpCursor boundaryCursor;
+            DependentVariableType boundaryValue =
+                    endInterpolator_->interpolate( targetIndependentVariableValue, boundaryCursor );
+            interpolatedValueVector = Eigen::Map< const Eigen::Matrix< DependentScalarType, Eigen::Dynamic, 1 > >(
+                        boundaryValue.data( ), numberOfRows_ * numberOfColumns_ );
+        }
+        else
+        {
+            // Compute differences w.r.t. nodes of interpolant, and check whether requested value is equal to a node.
+            int firstNode = lowerEntry - offsetEntries_;
+            ScalarType independentVariableDifferences[ maximumNumberOfStages ];
+            ScalarType nodeProduct = mathematical_constants::getFloatingInteger< ScalarType >( 1 );
+            int coincidingNode = -1;
+            for( int i = 0; i < numberOfStages_; i++ )
+            {
+                independentVariableDifferences[ i ] = static_cast< ScalarType >(
+                            targetIndependentVariableValue - independentValues_[ firstNode + i ] );
+                if( independentVariableDifferences[ i ] == mathematical_constants::getFloatingInteger< ScalarType >( 0 ) )
+                {
+                    coincidingNode = i;
+                }
+                nodeProduct *= independentVariableDifferences[ i ];
+            }
+
+            if( coincidingNode >= 0 )
+            {
+                interpolatedValueVector = dependentValueBuffer_.col( firstNode + coincidingNode );
+            }
+            else
+            {
+                // Compute coefficients of barycentric interpolant, and evaluate as matrix-vector product.
+                Eigen::Matrix< DependentScalarType, Eigen::Dynamic, 1, 0, maximumNumberOfStages, 1 > coefficients(
+                            numberOfStages_ );
+                for( int i = 0; i < numberOfStages_; i++ )
+                {
+                    coefficients( i ) = static_cast< DependentScalarType >(
+                                nodeProduct * barycentricWeights_( i, lowerEntry ) /
+                                independentVariableDifferences[ i ] );
+                }
+                interpolatedValueVector.noalias( ) =
+                        dependentValueBuffer_.middleCols( firstNode, numberOfStages_ ) * coefficients;
+            }
+        }
+    }
+
+    //! Function to return the number of rows of the dependent variables.
+    /*!
+     *  Function to return the number of rows of the dependent variables.
+     *  \return Number of rows of the dependent variables.
+     */
+    int getNumberOfRows( ) const
+    {
+        return numberOfRows_;
+    }
+
+    //! Function to return the number of columns of the dependent variables.
+    /*!
+     *  Function to return the number of columns of the dependent variables.
+     *  \return Number of columns of the dependent variables.
+     */
+    int getNumberOfColumns( ) const
+    {
+        return numberOfColumns_;
+    }
+
+    //! Function to return the vector with dependent variables used by the interpolator.
+    /*!
+     *  Function to return the vector with dependent variables used by the interpolator, reconstructed from the
+     *  contiguous storage.
+     *  \return Dependent variables used by the interpolator.
+     */
+    std::vector< DependentVariableType > getDependentValues( )
+    {
+        std::vector< DependentVariableType > dependentValues( numberOfIndependentValues_ );
+        for( int i = 0; i < numberOfIndependentValues_; i++ )
+        {
+            dependentValues[ i ].resize( numberOfRows_, numberOfColumns_ );
+            Eigen::Map< Eigen::Matrix< DependentScalarType, Eigen::Dynamic, 1 > >(
+                        dependentValues[ i ].data( ), numberOfRows_ * numberOfColumns_ ) =
+                    dependentValueBuffer_.col( i );
+        }
+        return dependentValues;
+    }
+
+protected:
+
+    //! Function to perform interpolation at a sequence of values of the independent variable.
+    /*!
+     * Function to perform interpolation at a sequence of values of the independent variable (see
+     * OneDimensionalInterpolator::interpolateSequence), writing each result directly into the output, so that no
+     * heap allocation is performed for output entries that already have the correct size.
+     * \param independentVariableValues Pointer to first value of independent variable at which interpolation is to
+     * take place.
+     * \param numberOfValues Number of values at which interpolation is to take place.
+     * \param interpolatedValues Pointer to first interpolated value of dependent variable (returned by reference).
+     * \param cursor Look-up cursor owned by the caller, storing the result of the caller's previous look-up.
+     */
+    void interpolateSequence( const IndependentVariableType* independentVariableValues,
+                              const unsigned int numberOfValues,
+                              DependentVariableType* interpolatedValues,
+                              LookUpCursor& cursor ) const
+    {
+        for( unsigned int i = 0; i < numberOfValues; i++ )
+        {
+            interpolate( independentVariableValues[ i ], cursor, interpolatedValues[ i ] );
+        }
+    }
+
+private:
+
+    //! Function to check input, and initialize the contiguous storage, barycentric weights and boundary interpolators.
+    /*!
+     *  Function to check input, and initialize the contiguous storage, barycentric weights and boundary interpolators.
+     *  \param independentVariables Vector of values of independent variables that are used.
+     *  \param dependentVariables Vector of values of dependent variables that are used.
+     *  \param selectedLookupScheme Identifier of lookupscheme from enum.
+     */
+    void initializeInterpolator( const std::vector< IndependentVariableType >& independentVariables,
+                                 const std::vector< DependentVariableType >& dependentVariables,
+                                 const AvailableLookupScheme selectedLookupScheme )
+    {
+        // Check validity of requested number of stages.
+        if( numberOfStages_ % 2 != 0 )
+        {
+            throw std::runtime_error(
+                        "Error, Lagrange interp. only implemented for even number of stages." );
+        }
+        if( numberOfStages_ < 2 || numberOfStages_ > maximumNumberOfStages )
+        {
+            throw std::runtime_error(
+                        "Error, contiguous Lagrange interpolator number of stages must be between 2 and " +
+                        boost::lexical_cast< std::string >( maximumNumberOfStages ) );
+        }
+        offsetEntries_ = numberOfStages_ / 2 - 1;
+
+        // Check consistency of input data.
+        numberOfIndependentValues_ = static_cast< int >( independentVariables.size( ) );
+        if( static_cast< int >( dependentVariables.size( ) ) != numberOfIndependentValues_ )
+        {
+            throw std::runtime_error(
+                        "Error: indep. and dep. variables incompatible in Lagrange interpolator." );
+        }
+        if( numberOfIndependentValues_ < numberOfStages_ )
+        {
+            throw std::runtime_error(
+                        "Error: Insufficient data points for contiguous Lagrange interpolator." );
+        }
+        if( !std::is_sorted( independentVariables.begin( ), independentVariables.end( ) ) )
+        {
+            throw std::runtime_error( "Error when making lagrange interpolator, input vector with independent variables should be in ascending order" );
+        }
+
+        // Store dependent variables as columns of single matrix.
+        independentValues_ = independentVariables;
+        numberOfRows_ = dependentVariables.at( 0 ).rows( );
+        numberOfColumns_ = dependentVariables.at( 0 ).cols( );
+        dependentValueBuffer_.resize( numberOfRows_ * numberOfColumns_, numberOfIndependentValues_ );
+        for( int i = 0; i < numberOfIndependentValues_; i++ )
+        {
+            if( dependentVariables.at( i ).rows( ) != numberOfRows_ ||
+                    dependentVariables.at( i ).cols( ) != numberOfColumns_ )
+            {
+                throw std::runtime_error(
+                            "Error: dependent variables of contiguous Lagrange interpolator have inconsistent size." );
+            }
+            dependentValueBuffer_.col( i ) = Eigen::Map< const Eigen::Matrix< DependentScalarType, Eigen::Dynamic, 1 > >(
+                        dependentVariables.at( i ).data( ), numberOfRows_ * numberOfColumns_ );
+        }
+
+        // Create lookup scheme from independent variable values.
+        this->makeLookupScheme( selectedLookupScheme );
+
+        // Calculate barycentric weights for each interval.
+        barycentricWeights_.setZero( numberOfStages_, numberOfIndependentValues_ );
+        for( int i = offsetEntries_; i < numberOfIndependentValues_ - offsetEntries_ - 1; i++ )
+        {
+            int firstNode = i - offsetEntries_;
+            for( int j = 0; j < numberOfStages_; j++ )
+            {
+                ScalarType currentDenominator = mathematical_constants::getFloatingInteger< ScalarType >( 1 );
+                for( int k = 0; k < numberOfStages_; k++ )
+                {
+                    if( k != j )
+                    {
+                        currentDenominator *= static_cast< ScalarType >(
+                                    independentValues_[ firstNode + j ] - independentValues_[ firstNode + k ] );
+                    }
+                }
+                barycentricWeights_( j, i ) = mathematical_constants::getFloatingInteger< ScalarType >( 1 ) /
+                        currentDenominator;
+            }
+        }
+
+        // Create interpolators for boundaries of domain (identical to LagrangeInterpolator).
+        if( boundaryHandling_ == lagrange_cubic_spline_boundary_interpolation && numberOfStages_ > 2 )
+        {
+            // Ensure sufficient data points for spline.
+            int cubicSplineInputSize = offsetEntries_;
+            if( cubicSplineInputSize < 3 )
+            {
+                cubicSplineInputSize = 3;
+            }
+
+            // Set input maps for interpolators
+            std::map< IndependentVariableType, DependentVariableType > startMap;
+            for( int i = 0; i <= cubicSplineInputSize; i++ )
+            {
+                startMap[ independentVariables[ i ] ] = dependentVariables[ i ];
+            }
+            std::map< IndependentVariableType, DependentVariableType > endMap;
+            for( int i = numberOfIndependentValues_ - cubicSplineInputSize - 1;
+                 i < numberOfIndependentValues_; i++ )
+            {
+                endMap[ independentVariables[ i ] ] = dependentVariables[ i ];
+            }
+
+            // Create cubic spline interpolators
+            beginInterpolator_ = boost::make_shared< CubicSplineInterpolator
+                    < IndependentVariableType, DependentVariableType, ScalarType > >( startMap );
+            endInterpolator_ = boost::make_shared< CubicSplineInterpolator
+                    < IndependentVariableType, DependentVariableType, ScalarType > >( endMap );
+        }
+    }
+
+    //! Dependent variables, with each column containing the entries of a single dependent variable.
+    Eigen::Matrix< DependentScalarType, Eigen::Dynamic, Eigen::Dynamic > dependentValueBuffer_;
+
+    //! Barycentric weights of interpolant nodes (rows), for each interval in which interpolant is centered (columns).
+    Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic > barycentricWeights_;
+
+    //! Number of rows of dependent variables.
+    int numberOfRows_;
+
+    //! Number of columns of dependent variables.
+    int numberOfColumns_;
+
+    //! Number of stages of interpolator
+    int numberOfStages_;
+
+    //! Number of entries at edges of domain where Lagrange interpolation is not used directly.
+    int offsetEntries_;
+
+    //! Size of (in)dependent variable vector
+    int numberOfIndependentValues_;
+
+    //! Interpolator to be used at beginning of domain.
+    boost::shared_ptr< OneDimensionalInterpolator
+    < IndependentVariableType, DependentVariableType > > beginInterpolator_;
+
+    //! Interpolator to be used at end of domain.
+    boost::shared_ptr< OneDimensionalInterpolator
+    < IndependentVariableType, DependentVariableType > > endInterpolator_;
+
+    //! Method to be used for handling boundaries of the interpolation domain.
+    LagrangeInterpolatorBoundaryHandling boundaryHandling_;
+
+};
+
+} // namespace interpolators
+
+} // namespace tudat
+
+#endif // TUDAT_CONTIGUOUSLAGRANGEINTERPOLATOR_H
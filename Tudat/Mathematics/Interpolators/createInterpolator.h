@@ -11,14 +11,19 @@
 #ifndef TUDAT_CREATEINTERPOLATOR_H
 #define TUDAT_CREATEINTERPOLATOR_H
 
+#include <boost/bind.hpp>
+#include <boost/function.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/lexical_cast.hpp>
 
+#include "Tudat/Mathematics/Interpolators/cartesianStateHermiteInterpolator.h"
 #include "Tudat/Mathematics/Interpolators/linearInterpolator.h"
 #include "Tudat/Mathematics/Interpolators/cubicSplineInterpolator.h"
 #include "Tudat/Mathematics/Interpolators/hermiteCubicSplineInterpolator.h"
 #include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/multiCubicSplineInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/multiLinearInterpolator.h"
 
 namespace tudat
 {
@@ -32,7 +37,8 @@ enum OneDimensionalInterpolatorTypes
     linear_interpolator = 1,
     cubic_spline_interpolator = 2,
     lagrange_interpolator = 3,
-    hermite_spline_interpolator = 4
+    hermite_spline_interpolator = 4,
+    cartesian_state_hermite_interpolator = 5
 };
 
 //! Base class for providing settings for creating an interpolator.
@@ -159,6 +165,122 @@ protected:
 
 };
 
+//! Class for providing settings to creating a Hermite interpolator of Cartesian states.
+/*!
+ *  Class for providing settings to creating a Hermite interpolator of Cartesian states (see
+ *  CartesianStateHermiteInterpolator), which uses the velocity (and, if provided, the acceleration) as derivative of the
+ *  position. Only applicable to dependent variables of type Eigen::Matrix< StateScalarType, 6, 1 >.
+ */
+class CartesianStateHermiteInterpolatorSettings: public InterpolatorSettings
+{
+public:
+
+    //! Constructor.
+    /*!
+     * Constructor.
+     * \param numberOfNodes Number of nodes used for each interpolating polynomial.
+     * \param useLongDoubleTimeStep Boolean denoting whether time step is to be a long double,
+     * time step is a double if false.
+     * \param selectedLookupScheme Selected type of lookup scheme for independent variables.
+     */
+    CartesianStateHermiteInterpolatorSettings(
+            const int numberOfNodes = 4,
+            const bool useLongDoubleTimeStep = 0,
+            const AvailableLookupScheme selectedLookupScheme = huntingAlgorithm ):
+        InterpolatorSettings( cartesian_state_hermite_interpolator, selectedLookupScheme, useLongDoubleTimeStep ),
+        numberOfNodes_( numberOfNodes )
+    { }
+
+    //! Destructor
+    ~CartesianStateHermiteInterpolatorSettings( ){ }
+
+    //! Function to get the number of nodes used for each interpolating polynomial.
+    /*!
+     * Function to get the number of nodes used for each interpolating polynomial.
+     * \return Number of nodes used for each interpolating polynomial.
+     */
+    int getNumberOfNodes( )
+    {
+        return numberOfNodes_;
+    }
+
+protected:
+
+    //! Number of nodes used for each interpolating polynomial.
+    int numberOfNodes_;
+
+};
+
+//! Class to create a Hermite interpolator of Cartesian states, for general dependent variable type.
+/*!
+ *  Class to create a Hermite interpolator of Cartesian states, for general dependent variable type. This class only
+ *  throws an exception, a Hermite interpolator can only be created for Cartesian states (see specialization below).
+ */
+template< typename IndependentVariableType, typename DependentVariableType >
+struct CartesianStateHermiteInterpolatorCreator
+{
+    //! Function to create a Hermite interpolator of Cartesian states (throws exception for general type).
+    static boost::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > >
+    createInterpolator(
+            const std::map< IndependentVariableType, DependentVariableType >& dataToInterpolate,
+            const boost::shared_ptr< CartesianStateHermiteInterpolatorSettings > interpolatorSettings,
+            const std::vector< DependentVariableType >& firstDerivativeOfDependentVariables )
+    {
+        throw std::runtime_error(
+                    "Error, Cartesian state Hermite interpolator can only be created for Cartesian states" );
+    }
+};
+
+//! Class to create a Hermite interpolator of Cartesian states.
+template< typename IndependentVariableType, typename StateScalarType >
+struct CartesianStateHermiteInterpolatorCreator< IndependentVariableType, Eigen::Matrix< StateScalarType, 6, 1 > >
+{
+    //! Function to create a Hermite interpolator of Cartesian states.
+    /*!
+     *  Function to create a Hermite interpolator of Cartesian states.
+     *  \param dataToInterpolate Map providing states that are to be interpolated (key = independent variables)
+     *  \param interpolatorSettings Settings that are to be used to create interpolator
+     *  \param firstDerivativeOfDependentVariables Derivatives of the states (velocity and acceleration), of which the
+     *  accelerations are used in the interpolation. If empty, only positions and velocities are used.
+     *  \return Hermite interpolator of Cartesian states.
+     */
+    static boost::shared_ptr< OneDimensionalInterpolator<
+    IndependentVariableType, Eigen::Matrix< StateScalarType, 6, 1 > > > createInterpolator(
+            const std::map< IndependentVariableType, Eigen::Matrix< StateScalarType, 6, 1 > >& dataToInterpolate,
+            const boost::shared_ptr< CartesianStateHermiteInterpolatorSettings > interpolatorSettings,
+            const std::vector< Eigen::Matrix< StateScalarType, 6, 1 > >& firstDerivativeOfDependentVariables )
+    {
+        // Retrieve accelerations from state derivatives
+        std::vector< Eigen::Matrix< StateScalarType, 3, 1 > > accelerations;
+        if( firstDerivativeOfDependentVariables.size( ) > 0 )
+        {
+            if( firstDerivativeOfDependentVariables.size( ) != dataToInterpolate.size( ) )
+            {
+                throw std::runtime_error( "Error when creating Cartesian state Hermite interpolator, derivative size is inconsistent" );
+            }
+            for( unsigned int i = 0; i < firstDerivativeOfDependentVariables.size( ); i++ )
+            {
+                accelerations.push_back( firstDerivativeOfDependentVariables.at( i ).segment( 3, 3 ) );
+            }
+        }
+
+        // Create Hermite interpolator with requested time step type
+        if( !interpolatorSettings->getUseLongDoubleTimeStep( ) )
+        {
+            return boost::make_shared< CartesianStateHermiteInterpolator
+                    < IndependentVariableType, StateScalarType, double > >(
+                        dataToInterpolate, interpolatorSettings->getNumberOfNodes( ),
+                        interpolatorSettings->getSelectedLookupScheme( ), accelerations );
+        }
+        else
+        {
+            return boost::make_shared< CartesianStateHermiteInterpolator
+                    < IndependentVariableType, StateScalarType, long double > >(
+                        dataToInterpolate, interpolatorSettings->getNumberOfNodes( ),
+                        interpolatorSettings->getSelectedLookupScheme( ), accelerations );
+        }
+    }
+};
 
 //! Function to create an interpolator
 /*!
@@ -169,15 +291,16 @@ protected:
  *  \param interpolatorSettings Settings that are to be used to create interpolator
  *  \param firstDerivativeOfDependentVariables First derivative of dependent variables w.r.t. independent variable at
  *  independent variables values in values of dataToInterpolate. By default, this vector is empty, it only needs to
- *  be supplied if the selected interpolator requires this data (e.g. Hermite spline).
+ *  be supplied if the selected interpolator requires this data (e.g. Hermite spline). For the Cartesian state Hermite
+ *  interpolator, it may be supplied to provide the accelerations (as derivatives of the velocities).
  *  \return Interpolator created from dataToInterpolate using interpolatorSettings.
  */
 template< typename IndependentVariableType, typename DependentVariableType >
 boost::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > >
 createOneDimensionalInterpolator(
-        const std::map< IndependentVariableType, DependentVariableType > dataToInterpolate,
+        const std::map< IndependentVariableType, DependentVariableType >& dataToInterpolate,
         const boost::shared_ptr< InterpolatorSettings > interpolatorSettings,
-        const std::vector< DependentVariableType > firstDerivativeOfDependentVariables =
+        const std::vector< DependentVariableType >& firstDerivativeOfDependentVariables =
         std::vector< DependentVariableType >( ) )
 {
     boost::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > >
@@ -251,7 +374,23 @@ createOneDimensionalInterpolator(
                     interpolatorSettings->getSelectedLookupScheme( ) );
         break;
     }
-
+    case cartesian_state_hermite_interpolator:
+    {
+        // Check consistency of input
+        boost::shared_ptr< CartesianStateHermiteInterpolatorSettings > hermiteInterpolatorSettings =
+                boost::dynamic_pointer_cast< CartesianStateHermiteInterpolatorSettings >( interpolatorSettings );
+        if( hermiteInterpolatorSettings != NULL )
+        {
+            createdInterpolator = CartesianStateHermiteInterpolatorCreator<
+                    IndependentVariableType, DependentVariableType >::createInterpolator(
+                        dataToInterpolate, hermiteInterpolatorSettings, firstDerivativeOfDependentVariables );
+        }
+        else
+        {
+            throw std::runtime_error( "Error, did not recognize Cartesian state Hermite interpolator settings" );
+        }
+        break;
+    }
     default:
         throw std::runtime_error(
                     "Error when making interpolator, function cannot be used to create interplator of type " +
@@ -261,6 +400,118 @@ createOneDimensionalInterpolator(
     return createdInterpolator;
 }
 
+//! Function to create a multi-dimensional interpolator
+/*!
+ *  Function to create a multi-dimensional interpolator from tabulated data on a hyper-rectangular grid, as well as
+ *  the settings that are to be used to create the interpolator. The interpolator type in the settings is used to
+ *  select the type of interpolation in all dimensions: linear_interpolator results in a MultiLinearInterpolator,
+ *  cubic_spline_interpolator in a (tensor-product) MultiCubicSplineInterpolator. Other types are not supported.
+ *  \param independentValues Vector of vectors containing data points of independent variables, each sorted in
+ *  ascending order.
+ *  \param dependentData Multi-dimensional array of dependent data at each point of hyper-rectangular grid formed by
+ *  independent variable points.
+ *  \param interpolatorSettings Settings that are to be used to create interpolator
+ *  \return Interpolator created from independentValues and dependentData using interpolatorSettings.
+ */
+template< typename IndependentVariableType, typename DependentVariableType, int NumberOfDimensions >
+boost::shared_ptr< Interpolator< IndependentVariableType, DependentVariableType > >
+createMultiDimensionalInterpolator(
+        const std::vector< std::vector< IndependentVariableType > > independentValues,
+        const boost::multi_array< DependentVariableType, static_cast< size_t >( NumberOfDimensions ) > dependentData,
+        const boost::shared_ptr< InterpolatorSettings > interpolatorSettings )
+{
+    boost::shared_ptr< Interpolator< IndependentVariableType, DependentVariableType > > createdInterpolator;
+
+    // Check type of interpolator.
+    switch( interpolatorSettings->getInterpolatorType( ) )
+    {
+    case linear_interpolator:
+        createdInterpolator = boost::make_shared< MultiLinearInterpolator
+                < IndependentVariableType, DependentVariableType, NumberOfDimensions > >(
+                    independentValues, dependentData, interpolatorSettings->getSelectedLookupScheme( ) );
+        break;
+    case cubic_spline_interpolator:
+        createdInterpolator = boost::make_shared< MultiCubicSplineInterpolator
+                < IndependentVariableType, DependentVariableType, NumberOfDimensions > >(
+                    independentValues, dependentData, interpolatorSettings->getSelectedLookupScheme( ) );
+        break;
+    default:
+        throw std::runtime_error(
+                    "Error when making multi-dimensional interpolator, function cannot be used to create interplator of type " +
+                    boost::lexical_cast< std::string >(
+                        interpolatorSettings->getInterpolatorType( ) ) );
+    }
+    return createdInterpolator;
+}
+
+//! Function to perform multi-dimensional interpolation through the fixed-size array interface of an interpolator.
+/*!
+ *  Function to perform multi-dimensional interpolation through the fixed-size array interface of an interpolator
+ *  (e.g. MultiLinearInterpolator or MultiCubicSplineInterpolator), copying the independent variables from the input
+ *  vector into a fixed-size array, and calling the (non-virtual) array overload of the interpolate function directly.
+ *  \param interpolator Interpolator that is to be evaluated.
+ *  \param independentValuesToInterpolate Values of independent variables at which the value of the dependent
+ *  variable is to be determined (size must be at least NumberOfDimensions).
+ *  \return Interpolated value of dependent variable.
+ */
+template< typename MultiDimensionalInterpolatorType, typename IndependentVariableType, typename DependentVariableType,
+          int NumberOfDimensions >
+DependentVariableType interpolateWithFixedSizeInput(
+        const boost::shared_ptr< MultiDimensionalInterpolatorType > interpolator,
+        const std::vector< IndependentVariableType >& independentValuesToInterpolate )
+{
+    boost::array< IndependentVariableType, NumberOfDimensions > independentValueArray;
+    for( int i = 0; i < NumberOfDimensions; i++ )
+    {
+        independentValueArray[ i ] = independentValuesToInterpolate[ i ];
+    }
+    return interpolator->interpolate( independentValueArray );
+}
+
+//! Function to create a function that evaluates a multi-dimensional interpolator.
+/*!
+ *  Function to create a function that evaluates a multi-dimensional interpolator, as created by
+ *  createMultiDimensionalInterpolator, with the independent variables as a vector. If the interpolator is a
+ *  MultiLinearInterpolator or MultiCubicSplineInterpolator, the returned function calls its fixed-size array
+ *  interface directly (see interpolateWithFixedSizeInput), so that no virtual call through the Interpolator base
+ *  class is made. Otherwise, the Interpolator::interpolate function is used.
+ *  \param interpolator Interpolator that is to be evaluated by the returned function.
+ *  \return Function returning the interpolated value of the dependent variable as a function of the independent
+ *  variables.
+ */
+template< typename IndependentVariableType, typename DependentVariableType, int NumberOfDimensions >
+boost::function< DependentVariableType( const std::vector< IndependentVariableType >& ) >
+createMultiDimensionalInterpolationFunction(
+        const boost::shared_ptr< Interpolator< IndependentVariableType, DependentVariableType > > interpolator )
+{
+    typedef MultiLinearInterpolator< IndependentVariableType, DependentVariableType, NumberOfDimensions >
+            MultiLinearInterpolatorType;
+    typedef MultiCubicSplineInterpolator< IndependentVariableType, DependentVariableType, NumberOfDimensions >
+            MultiCubicSplineInterpolatorType;
+
+    boost::function< DependentVariableType( const std::vector< IndependentVariableType >& ) > interpolationFunction;
+    if( boost::dynamic_pointer_cast< MultiLinearInterpolatorType >( interpolator ) != NULL )
+    {
+        interpolationFunction = boost::bind(
+                    &interpolateWithFixedSizeInput< MultiLinearInterpolatorType, IndependentVariableType,
+                    DependentVariableType, NumberOfDimensions >,
+                    boost::dynamic_pointer_cast< MultiLinearInterpolatorType >( interpolator ), _1 );
+    }
+    else if( boost::dynamic_pointer_cast< MultiCubicSplineInterpolatorType >( interpolator ) != NULL )
+    {
+        interpolationFunction = boost::bind(
+                    &interpolateWithFixedSizeInput< MultiCubicSplineInterpolatorType, IndependentVariableType,
+                    DependentVariableType, NumberOfDimensions >,
+                    boost::dynamic_pointer_cast< MultiCubicSplineInterpolatorType >( interpolator ), _1 );
+    }
+    else
+    {
+        interpolationFunction = boost::bind(
+                    &Interpolator< IndependentVariableType, DependentVariableType >::interpolate, interpolator, _1 );
+    }
+    return interpolationFunction;
+}
+
 } // namespace interpolators
 
 } // namespace tudat
@@ -214,7 +214,7 @@ public:
     ~CubicSplineInterpolator( ){ }
 
     // Statement required to prevent hiding of base class functions.
-    using Interpolator< IndependentVariableType, DependentVariableType >::interpolate;
+    using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::interpolate;
 
     //! Interpolate.
     /*!
@@ -222,17 +222,18 @@ public:
      * yield an interpolated value of the dependent variable.
      * \param targetIndependentVariableValue Target independent variable value at which point
      * the interpolation is performed.
+     * \param cursor Look-up cursor owned by the caller, storing the result of the caller's previous look-up.
      * \return Interpolated dependent variable value.
      */
     DependentVariableType interpolate(
-            const IndependentVariableType targetIndependentVariableValue )
+            const IndependentVariableType targetIndependentVariableValue, LookUpCursor& cursor ) const
     {
         using std::pow;
 
         // Determine the lower entry in the table corresponding to the target independent variable
         // value.
         int lowerEntry_ = lookUpScheme_->findNearestLowerNeighbour(
-                    targetIndependentVariableValue );
+                    targetIndependentVariableValue, cursor );
 
         // Get independent variable values bounding interval in which requested value lies.
         IndependentVariableType lowerValue, upperValue;
@@ -260,6 +261,28 @@ public:
 
 protected:
 
+    //! Function to perform interpolation at a sequence of values of the independent variable.
+    /*!
+     * Function to perform interpolation at a sequence of values of the independent variable, calling the
+     * interpolate function of this class directly for each value (see
+     * OneDimensionalInterpolator::interpolateSequence).
+     * \param independentVariableValues Pointer to first value of independent variable at which interpolation is to
+     * take place.
+     * \param numberOfValues Number of values at which interpolation is to take place.
+     * \param interpolatedValues Pointer to first interpolated value of dependent variable (returned by reference).
+     * \param cursor Look-up cursor owned by the caller, storing the result of the caller's previous look-up.
+     */
+    void interpolateSequence( const IndependentVariableType* independentVariableValues,
+                              const unsigned int numberOfValues,
+                              DependentVariableType* interpolatedValues,
+                              LookUpCursor& cursor ) const
+    {
+        for( unsigned int i = 0; i < numberOfValues; i++ )
+        {
+            interpolatedValues[ i ] = CubicSplineInterpolator::interpolate( independentVariableValues[ i ], cursor );
+        }
+    }
+
 private:
 
     //! Calculates the second derivatives of the curve.
@@ -122,13 +122,15 @@ public:
      *  Function interpolates dependent variable value at given independent variable value.
      *  \param targetIndependentVariableValue Value of independent variable at which interpolation
      *  is to take place.
+     *  \param cursor Look-up cursor owned by the caller, storing the result of the caller's previous look-up.
      *  \return Interpolated value of interpolated dependent variable.
      */
-    DependentVariableType interpolate( const IndependentVariableType targetIndependentVariableValue )
+    DependentVariableType interpolate( const IndependentVariableType targetIndependentVariableValue,
+                                       LookUpCursor& cursor ) const
     {
         // Determine the lower entry in the table corresponding to the target independent variable value.
         int lowerEntry_ = lookUpScheme_->findNearestLowerNeighbour(
-                    targetIndependentVariableValue );
+                    targetIndependentVariableValue, cursor );
 
         // Compute Hermite spline
         IndependentVariableType factor = ( targetIndependentVariableValue - independentValues_[ lowerEntry_ ] )
@@ -144,6 +146,28 @@ public:
 
 protected:
 
+    //! Function to perform interpolation at a sequence of values of the independent variable.
+    /*!
+     * Function to perform interpolation at a sequence of values of the independent variable, calling the
+     * interpolate function of this class directly for each value (see
+     * OneDimensionalInterpolator::interpolateSequence).
+     * \param independentVariableValues Pointer to first value of independent variable at which interpolation is to
+     * take place.
+     * \param numberOfValues Number of values at which interpolation is to take place.
+     * \param interpolatedValues Pointer to first interpolated value of dependent variable (returned by reference).
+     * \param cursor Look-up cursor owned by the caller, storing the result of the caller's previous look-up.
+     */
+    void interpolateSequence( const IndependentVariableType* independentVariableValues,
+                              const unsigned int numberOfValues,
+                              DependentVariableType* interpolatedValues,
+                              LookUpCursor& cursor ) const
+    {
+        for( unsigned int i = 0; i < numberOfValues; i++ )
+        {
+            interpolatedValues[ i ] = HermiteCubicSplineInterpolator::interpolate( independentVariableValues[ i ], cursor );
+        }
+    }
+
     //! Compute coefficients of the splines
     void computeCoefficients( )
     {
@@ -128,9 +128,6 @@ public:
         // interpolation call.
         initializeDenominators( );
         initializeBoundaryInterpolators( selectedLookupScheme );
-
-        // Pre-allocate cache vector for computational efficiency.
-        independentVariableDifferenceCache.resize( 2 * offsetEntries_ + 2 );
     }
 
     //! Constructor from map of independent/dependent data.
@@ -193,8 +190,6 @@ public:
         //interpolation call.
         initializeDenominators( );
         initializeBoundaryInterpolators( selectedLookupScheme );
-
-        independentVariableDifferenceCache.resize( 2 * offsetEntries_ + 2 );
     }
 
     //! Destructor.
@@ -211,12 +206,15 @@ public:
      *  are used for determining the center (in case of a non-equispaced grid). If the required
      *  interpolating polynimial goes beyond the independent variable bondaries,
      *  a cubic spline with natural boundary conditions is used.
+     *  The interpolator is not modified by this function, so that it may be called concurrently from
+     *  multiple threads, provided each thread uses its own cursor.
      *  \param targetIndependentVariableValue Value of independent variable at which interpolation
      *  is to take place.
+     *  \param cursor Look-up cursor owned by the caller, storing the result of the caller's previous look-up.
      *  \return Interpolated value of dependent variable.
      */
     DependentVariableType interpolate(
-            const IndependentVariableType targetIndependentVariableValue )
+            const IndependentVariableType targetIndependentVariableValue, LookUpCursor& cursor ) const
     {
         using std::pow;
 
@@ -226,7 +224,7 @@ public:
 
         // Find interpolation interval
         int lowerEntry = lookUpScheme_->findNearestLowerNeighbour(
-                    targetIndependentVariableValue );
+                    targetIndependentVariableValue, cursor );
 
         // Check if requested interval is inside region in which centered lagrange interpolation
         // can be used.
@@ -239,8 +237,9 @@ public:
             }
             else if( numberOfStages_ > 2 )
             {
+                LookUpCursor boundaryCursor;
                 interpolatedValue = beginInterpolator_->interpolate(
-                            targetIndependentVariableValue );
+                            targetIndependentVariableValue, boundaryCursor );
             }
         }
         else if( lowerEntry >= numberOfIndependentValues_ - offsetEntries_ - 1 )
@@ -252,8 +251,9 @@ public:
             }
             else if( numberOfStages_ > 2 )
             {
+                LookUpCursor boundaryCursor;
                 interpolatedValue = endInterpolator_->interpolate(
-                            targetIndependentVariableValue );
+                            targetIndependentVariableValue, boundaryCursor );
             }
         }
         else
@@ -277,27 +277,24 @@ public:
             }
             else
             {
-                // Set up repeated numerator and cache of independent variable values from which
-                // interpolant is created.
+                // Set up repeated numerator from which interpolant is created.
                 int j = 0;
                 for( int i = 0; i <= 2 * offsetEntries_ + 1; i++ )
                 {
                     j = i + lowerEntry - offsetEntries_;
-                    independentVariableDifferenceCache[ i ] =
-                            static_cast< ScalarType >(
+                    repeatedNumerator *= static_cast< ScalarType >(
                                 targetIndependentVariableValue - independentValues_[ j ] );
 
-                    repeatedNumerator *= independentVariableDifferenceCache[ i ];
-
                 }
 
-                // Evaluate interpolating polynomial at requested data point.
+                // Evaluate interpolating polynomial at requested data point (independent variable differences are
+                // recomputed, instead of stored in a member cache, so that this function does not modify the object).
                 for( int i = 0; i <=  2 *offsetEntries_ + 1; i++ )
                 {
                     j = i + lowerEntry - offsetEntries_;
                     interpolatedValue += dependentValues_[ j ]  *
                             ( repeatedNumerator /
-                              ( independentVariableDifferenceCache[ i ] *
+                              ( static_cast< ScalarType >( targetIndependentVariableValue - independentValues_[ j ] ) *
                                 denominators[ lowerEntry ][ j - lowerEntry + offsetEntries_ ] ) );
                 }
             }
@@ -309,6 +306,28 @@ public:
 
 protected:
 
+    //! Function to perform interpolation at a sequence of values of the independent variable.
+    /*!
+     * Function to perform interpolation at a sequence of values of the independent variable, calling the
+     * interpolate function of this class directly for each value (see
+     * OneDimensionalInterpolator::interpolateSequence).
+     * \param independentVariableValues Pointer to first value of independent variable at which interpolation is to
+     * take place.
+     * \param numberOfValues Number of values at which interpolation is to take place.
+     * \param interpolatedValues Pointer to first interpolated value of dependent variable (returned by reference).
+     * \param cursor Look-up cursor owned by the caller, storing the result of the caller's previous look-up.
+     */
+    void interpolateSequence( const IndependentVariableType* independentVariableValues,
+                              const unsigned int numberOfValues,
+                              DependentVariableType* interpolatedValues,
+                              LookUpCursor& cursor ) const
+    {
+        for( unsigned int i = 0; i < numberOfValues; i++ )
+        {
+            interpolatedValues[ i ] = LagrangeInterpolator::interpolate( independentVariableValues[ i ], cursor );
+        }
+    }
+
 private:
 
     //! Function called at initialization which pre-computes the denominators of the
@@ -432,8 +451,6 @@ private:
      */
     int offsetEntries_;
 
-    std::vector< ScalarType > independentVariableDifferenceCache;
-
     //! Interpolator to be used at beginning of domain.
     boost::shared_ptr< OneDimensionalInterpolator
     < IndependentVariableType, DependentVariableType > > beginInterpolator_;
@@ -54,7 +54,7 @@ public:
     independentValues_;
     using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::
     lookUpScheme_;
-    using Interpolator< IndependentVariableType, DependentVariableType >::interpolate;
+    using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::interpolate;
 
     //! Constructor from map of independent/dependent data.
     /*!
@@ -140,16 +140,19 @@ public:
 
     //! Function interpolates dependent variable value at given independent variable value.
     /*!
-     * Function interpolates dependent variable value at given independent variable value.
+     * Function interpolates dependent variable value at given independent variable value, using a look-up cursor
+     * owned by the caller.
      * \param independentVariableValue Value of independent variable at which interpolation
      *          is to take place.
+     * \param cursor Look-up cursor owned by the caller, storing the result of the caller's previous look-up.
      * \return Interpolated value of dependent variable.
      */
-    DependentVariableType interpolate( const IndependentVariableType independentVariableValue )
+    DependentVariableType interpolate( const IndependentVariableType independentVariableValue,
+                                       LookUpCursor& cursor ) const
     {
         // Lookup nearest lower index.
         int newNearestLowerIndex = lookUpScheme_->findNearestLowerNeighbour(
-                    independentVariableValue );
+                    independentVariableValue, cursor );
 
         // Perform linear interpolation.
         DependentVariableType interpolatedValue = dependentValues_[ newNearestLowerIndex ] +
@@ -161,6 +164,30 @@ public:
 
         return interpolatedValue;
     }
+
+protected:
+
+    //! Function to perform interpolation at a sequence of values of the independent variable.
+    /*!
+     * Function to perform interpolation at a sequence of values of the independent variable, calling the
+     * interpolate function of this class directly for each value (see
+     * OneDimensionalInterpolator::interpolateSequence).
+     * \param independentVariableValues Pointer to first value of independent variable at which interpolation is to
+     * take place.
+     * \param numberOfValues Number of values at which interpolation is to take place.
+     * \param interpolatedValues Pointer to first interpolated value of dependent variable (returned by reference).
+     * \param cursor Look-up cursor owned by the caller, storing the result of the caller's previous look-up.
+     */
+    void interpolateSequence( const IndependentVariableType* independentVariableValues,
+                              const unsigned int numberOfValues,
+                              DependentVariableType* interpolatedValues,
+                              LookUpCursor& cursor ) const
+    {
+        for( unsigned int i = 0; i < numberOfValues; i++ )
+        {
+            interpolatedValues[ i ] = LinearInterpolator::interpolate( independentVariableValues[ i ], cursor );
+        }
+    }
 };
 
 //! Typedef for linear interpolator with (in)dependent variable = double.
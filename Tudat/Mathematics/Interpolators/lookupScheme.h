@@ -12,10 +12,13 @@
 #ifndef TUDAT_LOOK_UP_SCHEME_H
 #define TUDAT_LOOK_UP_SCHEME_H
 
+#include <cmath>
+#include <stdexcept>
 #include <vector>
 
 #include <boost/shared_ptr.hpp>
 
+#include "Tudat/Basics/timeType.h"
 #include "Tudat/Mathematics/BasicMathematics/nearestNeighbourSearch.h"
 
 namespace tudat
@@ -30,9 +33,88 @@ namespace interpolators
 enum AvailableLookupScheme
 {
     huntingAlgorithm,
-    binarySearch
+    binarySearch,
+    equidistantLookup
 };
 
+//! Cursor for nearest left neighbour searches.
+/*!
+ *  Cursor for nearest left neighbour searches, storing the result of the previous search so that subsequent searches
+ *  can start from it (see findNearestLeftNeighbourUsingCursor). By passing a cursor owned by the caller to the
+ *  (const) LookUpScheme::findNearestLowerNeighbour function, a single look-up scheme (and the interpolator using it)
+ *  can be safely used by multiple threads, or by interleaved sequences of requests, each with its own cursor.
+ */
+class LookUpCursor
+{
+public:
+
+    //! Constructor, initializes cursor to state in which no search has been performed.
+    LookUpCursor( ):
+        isFirstLookupDone_( false ), previousNearestLowerIndex_( 0 ){ }
+
+    //! Function to reset the cursor to state in which no search has been performed.
+    void reset( )
+    {
+        isFirstLookupDone_ = false;
+        previousNearestLowerIndex_ = 0;
+    }
+
+    //! Boolean to denote whether a lookup has been done with this cursor.
+    bool isFirstLookupDone_;
+
+    //! Nearest left index found during previous lookup with this cursor.
+    int previousNearestLowerIndex_;
+};
+
+//! Function to find the nearest left neighbour of a value, starting from the previous result stored in a cursor.
+/*!
+ * Function to find the nearest left neighbour of a value, starting from the previous result stored in a cursor. If no
+ * search has been performed with the cursor (or its index is not valid for the given vector), a binary search is used.
+ * Otherwise, the previous interval is checked, and a hunting algorithm is used if the value is not in it. The result
+ * is stored in the cursor.
+ * \param valueToLookup Value of which nearest neighbour is to be determined.
+ * \param independentVariableValues Vector of independent variable values, sorted in ascending order.
+ * \param cursor Cursor storing the result of the previous search (modified by this function).
+ * \return Index of entry in independentVariableValues vector which is nearest lower neighbour to valueToLookup.
+ */
+template< typename IndependentVariableType >
+int findNearestLeftNeighbourUsingCursor(
+        const IndependentVariableType valueToLookup,
+        const std::vector< IndependentVariableType >& independentVariableValues,
+        LookUpCursor& cursor )
+{
+    // Initialize return value.
+    int newNearestLowerIndex = 0;
+
+    // If this is first call of function with this cursor, use binary search.
+    if ( !cursor.isFirstLookupDone_ || cursor.previousNearestLowerIndex_ < 0 ||
+         cursor.previousNearestLowerIndex_ > static_cast< int >( independentVariableValues.size( ) ) - 2 )
+    {
+        newNearestLowerIndex = basic_mathematics::computeNearestLeftNeighborUsingBinarySearch
+                < IndependentVariableType >( independentVariableValues, valueToLookup );
+        cursor.isFirstLookupDone_ = true;
+    }
+
+    // If requested value is in same interval, return same value as previous time.
+    else if ( basic_mathematics::isIndependentVariableInInterval< IndependentVariableType >
+              ( cursor.previousNearestLowerIndex_,  valueToLookup, independentVariableValues ) )
+    {
+        newNearestLowerIndex = cursor.previousNearestLowerIndex_;
+    }
+
+    // Otherwise, perform hunting algorithm.
+    else
+    {
+        newNearestLowerIndex = basic_mathematics::findNearestLeftNeighbourUsingHuntingAlgorithm<
+                IndependentVariableType >( valueToLookup, cursor.previousNearestLowerIndex_, independentVariableValues );
+    }
+
+    // Set calculated value for use in next call.
+    cursor.previousNearestLowerIndex_ = newNearestLowerIndex;
+
+    return newNearestLowerIndex;
+}
+
 //! Look-up scheme class for nearest left neighbour search.
 /*!
  * Look-up scheme class for nearest left neighbour search,
@@ -69,6 +151,19 @@ public:
      */
     virtual int findNearestLowerNeighbour( const IndependentVariableType valueToLookup ) = 0;
 
+    //! Find nearest left neighbour, using a cursor owned by the caller.
+    /*!
+     * Function finds nearest left neighbour of given value in independentVariableValues_, using (and updating) a
+     * cursor owned by the caller, instead of any state stored in this object. This function does not modify the
+     * look-up scheme, and may be called concurrently from multiple threads (each with its own cursor).
+     * \param valueToLookup Value of which nearest neaighbour is to be determined.
+     * \param cursor Cursor storing the result of the previous search by the caller.
+     * \return Index of entry in independentVariableValues_ vector which is nearest lower neighbour
+     * to valueToLookup.
+     */
+    virtual int findNearestLowerNeighbour( const IndependentVariableType valueToLookup,
+                                           LookUpCursor& cursor ) const = 0;
+
 protected:
 
     //! Vector of independent variable values in which lookup is to be performed.
@@ -98,9 +193,7 @@ public:
      */
     HuntingAlgorithmLookupScheme( const std::vector< IndependentVariableType >&
                                   independentVariableValues )
-        : LookUpScheme< IndependentVariableType >( independentVariableValues ),
-          isFirstLookupDone( 0 ),
-          previousNearestLowerIndex_( 0 )
+        : LookUpScheme< IndependentVariableType >( independentVariableValues )
     { }
 
     //! Default destructor
@@ -119,55 +212,30 @@ public:
      */
     int findNearestLowerNeighbour( const IndependentVariableType valueToLookup )
     {
-        // Initialize return value.
-        int newNearestLowerIndex = 0;
-
-        // If this is first call of function, use binary search.
-        if ( !isFirstLookupDone )
-        {
-            newNearestLowerIndex = basic_mathematics::computeNearestLeftNeighborUsingBinarySearch
-                    < IndependentVariableType >( independentVariableValues_, valueToLookup );
-            isFirstLookupDone = 1;
-        }
-
-        else
-        {
-            // If requested value is in same interval, return same value as previous time.
-            if ( basic_mathematics::isIndependentVariableInInterval< IndependentVariableType >
-                 ( previousNearestLowerIndex_,  valueToLookup, independentVariableValues_ ) )
-            {
-                newNearestLowerIndex = previousNearestLowerIndex_;
-            }
-
-            // Otherwise, perform hunting algorithm.
-            else
-            {
-                newNearestLowerIndex =
-                        basic_mathematics::findNearestLeftNeighbourUsingHuntingAlgorithm<
-                        IndependentVariableType >
-                        (  valueToLookup, previousNearestLowerIndex_, independentVariableValues_ );
-            }
-        }
-
-        // Set calculated value for use in next call.
-        previousNearestLowerIndex_ = newNearestLowerIndex;
-
-        return newNearestLowerIndex;
+        return findNearestLeftNeighbourUsingCursor( valueToLookup, independentVariableValues_, cursor_ );
     }
 
-private:
-
-    //! Boolean to denote whether a lookup has been done.
+    //! Find nearest left neighbour, using a cursor owned by the caller.
     /*!
-     * Boolean to denote whether a lookup has been done.
+     * Function finds nearest left neighbour of given value in independentVariableValues_, using a hunting algorithm
+     * starting from the result of the previous call with the same cursor.
+     * \param valueToLookup Value of which nearest neighbour is to be determined.
+     * \param cursor Cursor storing the result of the previous search by the caller.
+     * \return Index of entry in independentVariableValues_ vector which is nearest lower neighbour
+     * to valueToLookup.
      */
-    bool isFirstLookupDone;
+    int findNearestLowerNeighbour( const IndependentVariableType valueToLookup, LookUpCursor& cursor ) const
+    {
+        return findNearestLeftNeighbourUsingCursor( valueToLookup, independentVariableValues_, cursor );
+    }
 
-    //! Nearest left index during previous call.
+private:
+
+    //! Cursor used for calls without a cursor provided by the caller.
     /*!
-     * Nearest left index during previous call
+     * Cursor used for calls without a cursor provided by the caller.
      */
-    int previousNearestLowerIndex_;
+    LookUpCursor cursor_;
 };
 
 //! Look-up scheme class for nearest left neighbour search using binary search algorithm.
@@ -211,6 +279,205 @@ public:
         return basic_mathematics::computeNearestLeftNeighborUsingBinarySearch
                 < IndependentVariableType >( independentVariableValues_, valueToLookup );
     }
+
+    //! Find nearest left neighbour (cursor is not used by binary search).
+    /*!
+     * Function finds nearest left neighbour of given value in independentVariableValues_. The cursor is not used or
+     * modified by the binary search.
+     * \param valueToLookup Value of which nearest neaighbour is to be determined.
+     * \param cursor Cursor storing the result of the previous search by the caller (unused).
+     * \return Index of entry in independentVariableValues_ vector which is nearest lower neighbour
+     * to valueToLookup.
+     */
+    int findNearestLowerNeighbour( const IndependentVariableType valueToLookup, LookUpCursor& cursor ) const
+    {
+        return basic_mathematics::computeNearestLeftNeighborUsingBinarySearch
+                < IndependentVariableType >( independentVariableValues_, valueToLookup );
+    }
+};
+
+//! Function to convert an independent variable value to a long double.
+/*!
+ * Function to convert an independent variable value to a long double, used by the equidistant lookup scheme to
+ * compute the (floating point) index of a value in the grid.
+ * \param independentVariableValue Value that is to be converted.
+ * \return Value converted to long double.
+ */
+template< typename IndependentVariableType >
+long double convertIndependentVariableToLongDouble( const IndependentVariableType independentVariableValue )
+{
+    return static_cast< long double >( independentVariableValue );
+}
+
+//! Function to convert an independent variable value to a long double (specialization for Time).
+/*!
+ * Function to convert an independent variable value to a long double (specialization for Time).
+ * \param independentVariableValue Value that is to be converted.
+ * \return Value converted to long double.
+ */
+inline long double convertIndependentVariableToLongDouble( const Time& independentVariableValue )
+{
+    return independentVariableValue.getSeconds< long double >( );
+}
+
+//! Look-up scheme class for nearest left neighbour search in an equidistant grid.
+/*!
+ * Look-up scheme class for nearest left neighbour search in an equidistant grid. If the grid is equidistant (checked
+ * upon construction), the nearest left neighbour is computed directly from the grid step, and only corrected using a
+ * hunting algorithm if rounding errors place the value in an adjacent interval. As such, the computational cost of a
+ * lookup is O(1), independent of the size of the grid and of the sequence of requested values. If the grid is not
+ * equidistant, the scheme is identical to the HuntingAlgorithmLookupScheme.
+ * \tparam IndependentVariableType Type of entries of vector in which lookup is to be performed.
+ */
+template< typename IndependentVariableType >
+class EquidistantLookupScheme: public LookUpScheme< IndependentVariableType >
+{
+public:
+
+    using LookUpScheme< IndependentVariableType >::independentVariableValues_;
+
+    //! Constructor, used to set data vector.
+    /*!
+     * Constructor, used to set data vector, and check whether the grid is equidistant.
+     * \param independentVariableValues vector of independent variable values in which to perform
+     * lookup procedure.
+     * \param relativeTolerance Maximum deviation of grid values from an equidistant grid (relative to the grid step)
+     * for which the grid is considered to be equidistant.
+     */
+    EquidistantLookupScheme( const std::vector< IndependentVariableType >& independentVariableValues,
+                             const long double relativeTolerance = 1.0E-6 )
+        : LookUpScheme< IndependentVariableType >( independentVariableValues ),
+          isGridEquidistant_( false ), gridStep_( 0.0L )
+    {
+        int numberOfValues = static_cast< int >( independentVariableValues_.size( ) );
+        if( numberOfValues >= 2 )
+        {
+            gridStep_ = convertIndependentVariableToLongDouble(
+                        independentVariableValues_[ numberOfValues - 1 ] - independentVariableValues_[ 0 ] ) /
+                    static_cast< long double >( numberOfValues - 1 );
+
+            // Check deviation of each grid value from equidistant grid.
+            if( gridStep_ > 0.0L )
+            {
+                isGridEquidistant_ = true;
+                for( int i = 1; i < numberOfValues - 1; i++ )
+                {
+                    if( std::fabs( convertIndependentVariableToLongDouble(
+                                       independentVariableValues_[ i ] - independentVariableValues_[ 0 ] ) -
+                                   static_cast< long double >( i ) * gridStep_ ) > relativeTolerance * gridStep_ )
+                    {
+                        isGridEquidistant_ = false;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    //! Default destructor
+    /*!
+     *  Default destructor
+     */
+    ~EquidistantLookupScheme( ){ }
+
+    //! Find nearest left neighbour.
+    /*!
+     * Function finds nearest left neighbour of given value in independentVariableValues_. If the grid is equidistant,
+     * the index is computed from the grid step, otherwise a hunting algorithm is used (starting from the result of the
+     * previous call).
+     * \param valueToLookup Value of which nearest neighbour is to be determined.
+     * \return Index of entry in independentVariableValues_ vector which is nearest lower neighbour
+     * to valueToLookup.
+     */
+    int findNearestLowerNeighbour( const IndependentVariableType valueToLookup )
+    {
+        return findNearestLowerNeighbour( valueToLookup, cursor_ );
+    }
+
+    //! Find nearest left neighbour, using a cursor owned by the caller.
+    /*!
+     * Function finds nearest left neighbour of given value in independentVariableValues_. If the grid is equidistant,
+     * the index is computed from the grid step (and the cursor is not used), otherwise a hunting algorithm is used,
+     * starting from the result of the previous call with the same cursor.
+     * \param valueToLookup Value of which nearest neighbour is to be determined.
+     * \param cursor Cursor storing the result of the previous search by the caller.
+     * \return Index of entry in independentVariableValues_ vector which is nearest lower neighbour
+     * to valueToLookup.
+     */
+    int findNearestLowerNeighbour( const IndependentVariableType valueToLookup, LookUpCursor& cursor ) const
+    {
+        int newNearestLowerIndex = 0;
+
+        if( isGridEquidistant_ )
+        {
+            if( !( valueToLookup == valueToLookup ) )
+            {
+                throw std::runtime_error( "Error in equidistant nearest left neighbour search, input is NaN" );
+            }
+
+            // Compute index from grid step, and limit to range of grid.
+            int maximumIndex = static_cast< int >( independentVariableValues_.size( ) ) - 2;
+            long double indexEstimate = convertIndependentVariableToLongDouble(
+                        valueToLookup - independentVariableValues_[ 0 ] ) / gridStep_;
+            if( indexEstimate <= 0.0L )
+            {
+                newNearestLowerIndex = 0;
+            }
+            else if( indexEstimate >= static_cast< long double >( maximumIndex ) )
+            {
+                newNearestLowerIndex = maximumIndex;
+            }
+            else
+            {
+                newNearestLowerIndex = static_cast< int >( indexEstimate );
+            }
+
+            // Correct index if value is not in computed interval (due to rounding errors or small grid deviations)
+            if( !basic_mathematics::isIndependentVariableInInterval< IndependentVariableType >
+                    ( newNearestLowerIndex, valueToLookup, independentVariableValues_ ) )
+            {
+                newNearestLowerIndex = basic_mathematics::findNearestLeftNeighbourUsingHuntingAlgorithm<
+                        IndependentVariableType >( valueToLookup, newNearestLowerIndex, independentVariableValues_ );
+            }
+        }
+        else
+        {
+            newNearestLowerIndex = findNearestLeftNeighbourUsingCursor(
+                        valueToLookup, independentVariableValues_, cursor );
+        }
+
+        return newNearestLowerIndex;
+    }
+
+    //! Function to return whether the grid is equidistant
+    /*!
+     * Function to return whether the grid is equidistant (i.e. whether the O(1) lookup is used)
+     * \return True if the grid is equidistant
+     */
+    bool getIsGridEquidistant( )
+    {
+        return isGridEquidistant_;
+    }
+
+private:
+
+    //! Boolean to denote whether the grid is equidistant.
+    /*!
+     * Boolean to denote whether the grid is equidistant.
+     */
+    bool isGridEquidistant_;
+
+    //! Step size of grid (only meaningful if isGridEquidistant_ is true).
+    /*!
+     * Step size of grid (only meaningful if isGridEquidistant_ is true).
+     */
+    long double gridStep_;
+
+    //! Cursor used for calls without a cursor provided by the caller (only used if grid is not equidistant).
+    /*!
+     * Cursor used for calls without a cursor provided by the caller (only used if grid is not equidistant).
+     */
+    LookUpCursor cursor_;
 };
 
 //! Typedef for shared-pointer to LookUpScheme object with double-type entries.
@@ -224,6 +491,10 @@ HuntingAlgorithmLookupSchemeDoublePointer;
 typedef boost::shared_ptr< BinarySearchLookupScheme< double > >
 BinarySearchLookupSchemeDoublePointer;
 
+//! Typedef for shared-pointer to EquidistantLookupScheme object with double-type entries.
+typedef boost::shared_ptr< EquidistantLookupScheme< double > >
+EquidistantLookupSchemeDoublePointer;
+
 } // namespace interpolators
 } // namespace tudat
 
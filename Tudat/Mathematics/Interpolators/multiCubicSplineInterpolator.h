@@ -0,0 +1,491 @@
+/*    Copyright (c) 2010-2017, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      de Boor, C. A Practical Guide to Splines, Revised Edition, Springer, 2001.
+ *
+ */
+
+#ifndef TUDAT_MULTI_CUBIC_SPLINE_INTERPOLATOR_H
+#define TUDAT_MULTI_CUBIC_SPLINE_INTERPOLATOR_H
+
+#include <vector>
+
+#include <boost/array.hpp>
+#include <boost/multi_array.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include "Tudat/Mathematics/Interpolators/lookupScheme.h"
+#include "Tudat/Mathematics/Interpolators/interpolator.h"
+
+namespace tudat
+{
+namespace interpolators
+{
+
+//! Function to compute the first derivatives at the nodes of a natural cubic spline.
+/*!
+ * Function to compute the first derivatives at the nodes of a natural cubic spline (i.e. zero second derivative at
+ * the boundaries) through a set of data points. The second derivatives at the nodes are obtained by solving the
+ * tridiagonal system of spline continuity conditions, from which the first derivatives are computed.
+ * \param independentValues Values of independent variable (sorted in ascending order, at least two values).
+ * \param dependentValues Values of dependent variable at independentValues.
+ * \param firstDerivatives First derivatives of spline at independentValues (returned by reference).
+ */
+template< typename IndependentVariableType, typename DependentVariableType >
+void computeNaturalCubicSplineNodeDerivatives(
+        const std::vector< IndependentVariableType >& independentValues,
+        const std::vector< DependentVariableType >& dependentValues,
+        std::vector< DependentVariableType >& firstDerivatives )
+{
+    const int numberOfNodes = static_cast< int >( independentValues.size( ) );
+
+    // Compute interval sizes and slopes of secants.
+    std::vector< IndependentVariableType > intervalSizes( numberOfNodes - 1 );
+    std::vector< DependentVariableType > secantSlopes( numberOfNodes - 1 );
+    for( int i = 0; i < numberOfNodes - 1; i++ )
+    {
+        intervalSizes[ i ] = independentValues[ i + 1 ] - independentValues[ i ];
+        secantSlopes[ i ] = ( dependentValues[ i + 1 ] - dependentValues[ i ] ) / intervalSizes[ i ];
+    }
+
+    // Solve tridiagonal system for second derivatives at interior nodes (Thomas algorithm), second derivatives at
+    // boundary nodes are zero.
+    std::vector< DependentVariableType > secondDerivatives(
+                numberOfNodes, dependentValues[ 0 ] - dependentValues[ 0 ] );
+    std::vector< IndependentVariableType > modifiedUpperDiagonal( numberOfNodes, IndependentVariableType( 0.0 ) );
+    IndependentVariableType currentDenominator;
+    for( int i = 1; i < numberOfNodes - 1; i++ )
+    {
+        currentDenominator = 2.0 * ( intervalSizes[ i - 1 ] + intervalSizes[ i ] ) -
+                intervalSizes[ i - 1 ] * modifiedUpperDiagonal[ i - 1 ];
+        modifiedUpperDiagonal[ i ] = intervalSizes[ i ] / currentDenominator;
+        secondDerivatives[ i ] = ( 6.0 * ( secantSlopes[ i ] - secantSlopes[ i - 1 ] ) -
+                                   intervalSizes[ i - 1 ] * secondDerivatives[ i - 1 ] ) / currentDenominator;
+    }
+    for( int i = numberOfNodes - 3; i > 0; i-- )
+    {
+        secondDerivatives[ i ] -= modifiedUpperDiagonal[ i ] * secondDerivatives[ i + 1 ];
+    }
+
+    // Compute first derivatives from second derivatives.
+    firstDerivatives.resize( numberOfNodes );
+    for( int i = 0; i < numberOfNodes - 1; i++ )
+    {
+        firstDerivatives[ i ] = secantSlopes[ i ] - intervalSizes[ i ] / 6.0 *
+                ( 2.0 * secondDerivatives[ i ] + secondDerivatives[ i + 1 ] );
+    }
+    firstDerivatives[ numberOfNodes - 1 ] = secantSlopes[ numberOfNodes - 2 ] + intervalSizes[ numberOfNodes - 2 ] /
+            6.0 * ( secondDerivatives[ numberOfNodes - 2 ] + 2.0 * secondDerivatives[ numberOfNodes - 1 ] );
+}
+
+//! Struct to perform the step in a single dimension of the tensor-product cubic spline interpolation process.
+/*!
+ * Struct to perform the step in a single dimension of the tensor-product cubic spline interpolation process, in
+ * which the contributions of the values and partial derivatives w.r.t. the current dimension at the lower and upper
+ * grid points are computed by the step in the next dimension, and weighted by the cubic Hermite basis functions.
+ * Since the current dimension is a template argument, the complete process (with 4^{NumberOfDimensions}
+ * retrievals of pre-computed node values) is unrolled at compile time (see MultiLinearInterpolationStep).
+ * \tparam IndependentVariableType Type for independent variables.
+ * \tparam DependentVariableType Type for dependent variable.
+ * \tparam CurrentDimension Dimension in which this interpolation step is to be performed.
+ * \tparam NumberOfDimensions Number of independent variables.
+ * \tparam IsFinalDimension Boolean denoting whether CurrentDimension is the final dimension (in which case the
+ * pre-computed node values are retrieved, see specialization below).
+ */
+template< typename IndependentVariableType, typename DependentVariableType, int CurrentDimension,
+          int NumberOfDimensions, bool IsFinalDimension = ( CurrentDimension == NumberOfDimensions - 1 ) >
+struct MultiCubicSplineInterpolationStep
+{
+    //! Function to perform the step in a single dimension of the tensor-product cubic spline interpolation process.
+    /*!
+     * Function to perform the step in a single dimension of the tensor-product cubic spline interpolation process.
+     * \param nodeData Pointer to pre-computed node values (values and all mixed partial derivatives).
+     * \param currentOffset Offset in nodeData, as determined by previous dimensions.
+     * \param lowerOffsets Offsets in nodeData of nearest lower grid point, in each dimension separately.
+     * \param strides Strides in nodeData of each dimension.
+     * \param basisFunctionValues Values of the four cubic Hermite basis functions (lower value, upper value, lower
+     * derivative, upper derivative), in each dimension.
+     * \return Interpolated value in current (and subsequent) dimensions.
+     */
+    static DependentVariableType interpolate(
+            const DependentVariableType* nodeData,
+            const int currentOffset,
+            const boost::array< int, NumberOfDimensions >& lowerOffsets,
+            const boost::array< int, NumberOfDimensions >& strides,
+            const boost::array< boost::array< IndependentVariableType, 4 >, NumberOfDimensions >& basisFunctionValues )
+    {
+        typedef MultiCubicSplineInterpolationStep< IndependentVariableType, DependentVariableType,
+                CurrentDimension + 1, NumberOfDimensions > NextInterpolationStep;
+
+        const int lowerOffset = currentOffset + lowerOffsets[ CurrentDimension ];
+        const int upperOffset = lowerOffset + strides[ CurrentDimension ];
+        const int derivativeOffset = 1 << CurrentDimension;
+        return basisFunctionValues[ CurrentDimension ][ 0 ] * NextInterpolationStep::interpolate(
+                    nodeData, lowerOffset, lowerOffsets, strides, basisFunctionValues ) +
+                basisFunctionValues[ CurrentDimension ][ 1 ] * NextInterpolationStep::interpolate(
+                    nodeData, upperOffset, lowerOffsets, strides, basisFunctionValues ) +
+                basisFunctionValues[ CurrentDimension ][ 2 ] * NextInterpolationStep::interpolate(
+                    nodeData, lowerOffset + derivativeOffset, lowerOffsets, strides, basisFunctionValues ) +
+                basisFunctionValues[ CurrentDimension ][ 3 ] * NextInterpolationStep::interpolate(
+                    nodeData, upperOffset + derivativeOffset, lowerOffsets, strides, basisFunctionValues );
+    }
+};
+
+//! Struct to perform the step in the final dimension of the tensor-product cubic spline interpolation process.
+/*!
+ * Struct to perform the step in the final dimension of the tensor-product cubic spline interpolation process, in
+ * which the pre-computed node values are retrieved.
+ */
+template< typename IndependentVariableType, typename DependentVariableType, int CurrentDimension,
+          int NumberOfDimensions >
+struct MultiCubicSplineInterpolationStep< IndependentVariableType, DependentVariableType, CurrentDimension,
+        NumberOfDimensions, true >
+{
+    //! Function to perform the step in the final dimension of the tensor-product cubic spline interpolation process.
+    /*!
+     * Function to perform the step in the final dimension of the tensor-product cubic spline interpolation process.
+     * \param nodeData Pointer to pre-computed node values (values and all mixed partial derivatives).
+     * \param currentOffset Offset in nodeData, as determined by previous dimensions.
+     * \param lowerOffsets Offsets in nodeData of nearest lower grid point, in each dimension separately.
+     * \param strides Strides in nodeData of each dimension.
+     * \param basisFunctionValues Values of the four cubic Hermite basis functions (lower value, upper value, lower
+     * derivative, upper derivative), in each dimension.
+     * \return Interpolated value in final dimension.
+     */
+    static DependentVariableType interpolate(
+            const DependentVariableType* nodeData,
+            const int currentOffset,
+            const boost::array< int, NumberOfDimensions >& lowerOffsets,
+            const boost::array< int, NumberOfDimensions >& strides,
+            const boost::array< boost::array< IndependentVariableType, 4 >, NumberOfDimensions >& basisFunctionValues )
+    {
+        const int lowerOffset = currentOffset + lowerOffsets[ CurrentDimension ];
+        const int upperOffset = lowerOffset + strides[ CurrentDimension ];
+        const int derivativeOffset = 1 << CurrentDimension;
+        return basisFunctionValues[ CurrentDimension ][ 0 ] * nodeData[ lowerOffset ] +
+                basisFunctionValues[ CurrentDimension ][ 1 ] * nodeData[ upperOffset ] +
+                basisFunctionValues[ CurrentDimension ][ 2 ] * nodeData[ lowerOffset + derivativeOffset ] +
+                basisFunctionValues[ CurrentDimension ][ 3 ] * nodeData[ upperOffset + derivativeOffset ];
+    }
+};
+
+//! Class for performing tensor-product cubic spline interpolation for arbitrary number of independent variables.
+/*!
+ * Class for performing tensor-product (natural) cubic spline interpolation for arbitrary number of independent
+ * variables. Contrary to the MultiLinearInterpolator, the interpolant is continuous in its first and second
+ * derivatives w.r.t. all independent variables, also when crossing grid cell boundaries.
+ * Upon construction, the value and all 2^{NumberOfDimensions} (mixed) partial derivatives of the interpolant (each
+ * with at most first derivatives w.r.t. each independent variable) are pre-computed at each grid point, by
+ * successively applying one-dimensional natural cubic spline fits along each dimension (de Boor, 2001). These are
+ * stored contiguously per grid point, so that the interpolation reduces to an evaluation of the tensor product of
+ * cubic Hermite polynomials in the grid cell containing the independent variables, unrolled at compile time (see
+ * MultiCubicSplineInterpolationStep). Outside of the grid, the polynomials of the outermost grid cell are
+ * extrapolated. Note that the types (i.e. double, float) of all independent variables must be the same.
+ * \tparam IndependentVariableType Type for independent variables.
+ * \tparam DependentVariableType Type for dependent variable.
+ * \tparam NumberOfDimensions Number of independent variables.
+ */
+template< typename IndependentVariableType, typename DependentVariableType,
+          int NumberOfDimensions >
+class MultiCubicSplineInterpolator: public Interpolator< IndependentVariableType,
+        DependentVariableType >
+{
+public:
+
+    //! Constructor taking independent and dependent variable data.
+    /*!
+     * \param independentValues Vector of vectors containing data points of independent variables,
+     *  each must be sorted in ascending order, and contain at least two data points.
+     * \param dependentData Multi-dimensional array of dependent data at each point of
+     *          hyper-rectangular grid formed by independent variable points.
+     *  \param selectedLookupScheme Identifier of lookupscheme from enum. This algorithm is used
+     *          to find the nearest lower data point in the independent variables when requesting
+     *          interpolation.
+     */
+    MultiCubicSplineInterpolator( const std::vector< std::vector< IndependentVariableType > >
+                                  independentValues,
+                                  const boost::multi_array< DependentVariableType,
+                                  static_cast< size_t >( NumberOfDimensions )> dependentData,
+                                  const AvailableLookupScheme selectedLookupScheme = huntingAlgorithm )
+        : independentValues_( independentValues )
+    {
+        // Check consistency of template arguments and input variables.
+        if ( independentValues.size( ) != NumberOfDimensions )
+        {
+            throw std::runtime_error( "Error: dimension of independent value vector provided to constructor incompatible with template parameter " );
+        }
+
+        // Check consistency of input data of dependent and independent data.
+        for ( int i = 0; i < NumberOfDimensions; i++ )
+        {
+            if ( independentValues[ i ].size( ) != dependentData.shape( )[ i ] )
+            {
+                std::string errorMessage = "Warning: number of data points in dimension" +
+                        boost::lexical_cast< std::string >( i ) + "of independent and dependent data incompatible";
+                throw std::runtime_error( errorMessage );
+            }
+
+            if( independentValues[ i ].size( ) < 2 )
+            {
+                throw std::runtime_error( "Error: at least two data points required in each dimension of multi-cubic spline interpolator" );
+            }
+        }
+
+        makeLookupSchemes( selectedLookupScheme );
+
+        // Pre-compute reciprocal of grid spacing in each dimension.
+        inverseIntervalSizes_.resize( NumberOfDimensions );
+        for( int i = 0; i < NumberOfDimensions; i++ )
+        {
+            for( unsigned int j = 1; j < independentValues_[ i ].size( ); j++ )
+            {
+                inverseIntervalSizes_[ i ].push_back(
+                            1.0 / ( independentValues_[ i ][ j ] - independentValues_[ i ][ j - 1 ] ) );
+            }
+        }
+
+        computeNodeData( dependentData );
+    }
+
+    //! Default destructor
+    /*!
+     *  Default destructor
+     */
+    ~MultiCubicSplineInterpolator( ){ }
+
+    //! Function to perform interpolation.
+    /*!
+     *  This function performs the tensor-product cubic spline interpolation.
+     *  \param independentValuesToInterpolate Vector of values of independent variables at which
+     *  the value of the dependent variable is to be determined.
+     *  \return Interpolated value of dependent variable in all dimensions.
+     */
+    DependentVariableType interpolate(
+            const std::vector< IndependentVariableType >& independentValuesToInterpolate )
+    {
+        boost::array< IndependentVariableType, NumberOfDimensions > independentValueArray;
+        for ( int i = 0; i < NumberOfDimensions; i++ )
+        {
+            independentValueArray[ i ] = independentValuesToInterpolate[ i ];
+        }
+        return interpolate( independentValueArray );
+    }
+
+    //! Function to perform interpolation, with independent variables provided as fixed-size array.
+    /*!
+     *  This function performs the tensor-product cubic spline interpolation, with independent variables provided as
+     *  fixed-size array.
+     *  \param independentValuesToInterpolate Array of values of independent variables at which
+     *  the value of the dependent variable is to be determined.
+     *  \return Interpolated value of dependent variable in all dimensions.
+     */
+    DependentVariableType interpolate(
+            const boost::array< IndependentVariableType, NumberOfDimensions >& independentValuesToInterpolate )
+    {
+        // Determine the nearest lower neighbours, the values of the cubic Hermite basis functions in each dimension
+        // and the offset of nearest lower neighbour in storage of node data.
+        boost::array< int, NumberOfDimensions > lowerOffsets;
+        boost::array< boost::array< IndependentVariableType, 4 >, NumberOfDimensions > basisFunctionValues;
+        int nearestLowerIndex;
+        IndependentVariableType intervalSize, normalizedValue, complementNormalizedValue;
+        for ( int i = 0; i < NumberOfDimensions; i++ )
+        {
+            nearestLowerIndex = lookUpSchemes_[ i ]->findNearestLowerNeighbour(
+                        independentValuesToInterpolate[ i ] );
+            lowerOffsets[ i ] = nearestLowerIndex * strides_[ i ];
+
+            intervalSize = independentValues_[ i ][ nearestLowerIndex + 1 ] -
+                    independentValues_[ i ][ nearestLowerIndex ];
+            normalizedValue = ( independentValuesToInterpolate[ i ] - independentValues_[ i ][ nearestLowerIndex ] ) *
+                    inverseIntervalSizes_[ i ][ nearestLowerIndex ];
+            complementNormalizedValue = 1.0 - normalizedValue;
+
+            basisFunctionValues[ i ][ 0 ] = ( 1.0 + 2.0 * normalizedValue ) *
+                    complementNormalizedValue * complementNormalizedValue;
+            basisFunctionValues[ i ][ 1 ] = normalizedValue * normalizedValue * ( 3.0 - 2.0 * normalizedValue );
+            basisFunctionValues[ i ][ 2 ] = intervalSize * normalizedValue *
+                    complementNormalizedValue * complementNormalizedValue;
+            basisFunctionValues[ i ][ 3 ] = -intervalSize * normalizedValue * normalizedValue *
+                    complementNormalizedValue;
+        }
+
+        // Evaluate and scale node values and derivatives at all 2^n grid edges.
+        return MultiCubicSplineInterpolationStep< IndependentVariableType, DependentVariableType, 0,
+                NumberOfDimensions >::interpolate( &nodeData_[ 0 ], 0, lowerOffsets, strides_, basisFunctionValues );
+    }
+
+    //! Function to return the number of independent variables of the interpolation.
+    /*!
+     *  Function to return the number of independent variables of the interpolation, i.e. size
+     *  that the vector used as input for Interpolator::interpolate should be.
+     *  \return Number of independent variables of the interpolation.
+     */
+    int getNumberOfDimensions( )
+    {
+        return NumberOfDimensions;
+    }
+
+private:
+
+    //! Function to pre-compute the values and (mixed) partial derivatives of the interpolant at the grid points.
+    /*!
+     *  Function to pre-compute the values and (mixed) partial derivatives of the interpolant at the grid points. The
+     *  derivative combination is denoted by an index in which bit i is set if the derivative w.r.t. independent
+     *  variable i is taken. Each combination is computed by a one-dimensional natural cubic spline fit along the
+     *  dimension of its highest set bit, applied to the (previously computed) combination without this bit.
+     *  \param dependentData Multi-dimensional array of dependent data at each point of grid.
+     */
+    void computeNodeData(
+            const boost::multi_array< DependentVariableType, static_cast< size_t >( NumberOfDimensions )>&
+            dependentData )
+    {
+        const int numberOfDerivativeCombinations = 1 << NumberOfDimensions;
+
+        // Compute strides of (row-major) node data storage, in which all derivative combinations of a single grid
+        // point are stored contiguously.
+        int numberOfGridPoints = 1;
+        for( int i = NumberOfDimensions - 1; i >= 0; i-- )
+        {
+            strides_[ i ] = numberOfGridPoints * numberOfDerivativeCombinations;
+            numberOfGridPoints *= static_cast< int >( independentValues_[ i ].size( ) );
+        }
+
+        // Copy dependent data into node data storage.
+        nodeData_.resize( numberOfGridPoints * numberOfDerivativeCombinations );
+        boost::array< typename boost::multi_array< DependentVariableType,
+                static_cast< size_t >( NumberOfDimensions ) >::index, NumberOfDimensions > gridIndices;
+        int remainingIndex;
+        for( int j = 0; j < numberOfGridPoints; j++ )
+        {
+            remainingIndex = j;
+            for( int i = 0; i < NumberOfDimensions; i++ )
+            {
+                gridIndices[ i ] = remainingIndex / ( strides_[ i ] / numberOfDerivativeCombinations ) +
+                        dependentData.index_bases( )[ i ];
+                remainingIndex %= ( strides_[ i ] / numberOfDerivativeCombinations );
+            }
+            nodeData_[ j * numberOfDerivativeCombinations ] = dependentData( gridIndices );
+        }
+
+        // Compute derivative combinations, by spline fits along lines of grid points.
+        std::vector< DependentVariableType > lineValues, lineDerivatives;
+        for( int derivativeCombination = 1; derivativeCombination < numberOfDerivativeCombinations;
+             derivativeCombination++ )
+        {
+            int dimension = NumberOfDimensions - 1;
+            while( !( derivativeCombination & ( 1 << dimension ) ) )
+            {
+                dimension--;
+            }
+            const int sourceCombination = derivativeCombination - ( 1 << dimension );
+
+            const int numberOfLinePoints = static_cast< int >( independentValues_[ dimension ].size( ) );
+            const int lineStride = strides_[ dimension ];
+            const int numberOfInnerPoints = lineStride / numberOfDerivativeCombinations;
+            const int numberOfOuterPoints = numberOfGridPoints / ( numberOfInnerPoints * numberOfLinePoints );
+            lineValues.resize( numberOfLinePoints );
+            for( int outerIndex = 0; outerIndex < numberOfOuterPoints; outerIndex++ )
+            {
+                for( int innerIndex = 0; innerIndex < numberOfInnerPoints; innerIndex++ )
+                {
+                    const int lineStartOffset = outerIndex * numberOfLinePoints * lineStride +
+                            innerIndex * numberOfDerivativeCombinations;
+                    for( int k = 0; k < numberOfLinePoints; k++ )
+                    {
+                        lineValues[ k ] = nodeData_[ lineStartOffset + k * lineStride + sourceCombination ];
+                    }
+                    computeNaturalCubicSplineNodeDerivatives(
+                                independentValues_[ dimension ], lineValues, lineDerivatives );
+                    for( int k = 0; k < numberOfLinePoints; k++ )
+                    {
+                        nodeData_[ lineStartOffset + k * lineStride + derivativeCombination ] = lineDerivatives[ k ];
+                    }
+                }
+            }
+        }
+    }
+
+    //! Make the lookup scheme that is to be used.
+    /*!
+     * This function creates the look up scheme that is to be used in determining the interval of
+     * the independent variable grid where the interpolation is to be performed. It takes the type
+     * of lookup scheme as an enum and constructs the lookup scheme from the independentValues_
+     * that have been set previously.
+     *  \param selectedScheme Type of look-up scheme that is to be used
+     */
+    void makeLookupSchemes( const AvailableLookupScheme selectedScheme )
+    {
+        lookUpSchemes_.resize( NumberOfDimensions );
+        for( int i = 0; i < NumberOfDimensions; i++ )
+        {
+            switch( selectedScheme )
+            {
+            case binarySearch:
+
+                lookUpSchemes_[ i ] = boost::shared_ptr< LookUpScheme< IndependentVariableType > >
+                        ( new BinarySearchLookupScheme< IndependentVariableType >(
+                              independentValues_[ i ] ) );
+                break;
+
+            case huntingAlgorithm:
+
+                lookUpSchemes_[ i ] = boost::shared_ptr< LookUpScheme< IndependentVariableType > >
+                        ( new HuntingAlgorithmLookupScheme< IndependentVariableType >(
+                              independentValues_[ i ] ) );
+                break;
+
+            case equidistantLookup:
+
+                lookUpSchemes_[ i ] = boost::shared_ptr< LookUpScheme< IndependentVariableType > >
+                        ( new EquidistantLookupScheme< IndependentVariableType >(
+                              independentValues_[ i ] ) );
+                break;
+
+            default:
+
+                throw std::runtime_error( "Warning: lookup scheme not found when making scheme for multi-cubic spline interpolator" );
+            }
+        }
+    }
+
+    //! Vector with pointers to look-up scheme.
+    /*!
+     * Pointers to the look-up schemes that is used to determine in which interval the requested
+     * independent variable value falls.
+     */
+    std::vector< boost::shared_ptr< LookUpScheme< IndependentVariableType > > > lookUpSchemes_;
+
+    //! Vector of vectors containing independent variables.
+    /*!
+     * Vector of vectors containing independent variables. The size of the outer vector is equal
+     * to the number of dimensions of the interpolator.
+     */
+    std::vector< std::vector< IndependentVariableType > > independentValues_;
+
+    //! Reciprocals of the sizes of the intervals between the independent variables, in each dimension.
+    std::vector< std::vector< IndependentVariableType > > inverseIntervalSizes_;
+
+    //! Values and (mixed) partial derivatives of interpolant at grid points.
+    /*!
+     * Values and (mixed) partial derivatives of interpolant at grid points, stored in row-major order of grid
+     * points, with the 2^{NumberOfDimensions} derivative combinations (see computeNodeData) of each grid point
+     * stored contiguously.
+     */
+    std::vector< DependentVariableType > nodeData_;
+
+    //! Strides of each dimension in the storage of nodeData_.
+    boost::array< int, NumberOfDimensions > strides_;
+};
+
+} // namespace interpolators
+} // namespace tudat
+
+#endif // TUDAT_MULTI_CUBIC_SPLINE_INTERPOLATOR_H
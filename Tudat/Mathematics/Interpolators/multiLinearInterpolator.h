@@ -34,6 +34,7 @@
 #include <vector>
 
 #include <boost/array.hpp>
+#include <boost/make_shared.hpp>
 #include <boost/multi_array.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/lexical_cast.hpp>
@@ -47,11 +48,98 @@ namespace tudat
 namespace interpolators
 {
 
+//! Struct to perform the step in a single dimension of the multi-linear interpolation process.
+/*!
+ * Struct to perform the step in a single dimension of the multi-linear interpolation process, in which the
+ * contributions of the lower and upper grid points in the current dimension are computed by the step in the next
+ * dimension. Since the current dimension is a template argument, the complete process (with 2^{NumberOfDimensions}
+ * retrievals of dependent variable values) is unrolled at compile time. The dependent variable values are retrieved
+ * directly from the (contiguous) storage of the multi-dimensional array, using pre-computed strides.
+ * \tparam IndependentVariableType Type for independent variables.
+ * \tparam DependentVariableType Type for dependent variable.
+ * \tparam CurrentDimension Dimension in which this interpolation step is to be performed.
+ * \tparam NumberOfDimensions Number of independent variables.
+ * \tparam IsFinalDimension Boolean denoting whether CurrentDimension is the final dimension (in which case the
+ * dependent variable values are retrieved, see specialization below).
+ */
+template< typename IndependentVariableType, typename DependentVariableType, int CurrentDimension,
+          int NumberOfDimensions, bool IsFinalDimension = ( CurrentDimension == NumberOfDimensions - 1 ) >
+struct MultiLinearInterpolationStep
+{
+    //! Function to perform the step in a single dimension of the multi-linear interpolation process.
+    /*!
+     * Function to perform the step in a single dimension of the multi-linear interpolation process.
+     * \param dependentData Pointer to origin of dependent variable data (see boost::multi_array::origin).
+     * \param currentOffset Offset in dependentData of grid point, as determined by previous dimensions.
+     * \param lowerOffsets Offsets in dependentData of nearest lower grid point, in each dimension separately.
+     * \param strides Strides in dependentData of each dimension.
+     * \param lowerFractions Fractions with which the lower grid point contributes, in each dimension.
+     * \param upperFractions Fractions with which the upper grid point contributes, in each dimension.
+     * \return Interpolated value in current (and subsequent) dimensions.
+     */
+    static DependentVariableType interpolate(
+            const DependentVariableType* dependentData,
+            const int currentOffset,
+            const boost::array< int, NumberOfDimensions >& lowerOffsets,
+            const boost::array< int, NumberOfDimensions >& strides,
+            const boost::array< IndependentVariableType, NumberOfDimensions >& lowerFractions,
+            const boost::array< IndependentVariableType, NumberOfDimensions >& upperFractions )
+    {
+        typedef MultiLinearInterpolationStep< IndependentVariableType, DependentVariableType, CurrentDimension + 1,
+                NumberOfDimensions > NextInterpolationStep;
+
+        const int lowerOffset = currentOffset + lowerOffsets[ CurrentDimension ];
+        return upperFractions[ CurrentDimension ] * NextInterpolationStep::interpolate(
+                    dependentData, lowerOffset + strides[ CurrentDimension ], lowerOffsets, strides,
+                    lowerFractions, upperFractions ) +
+                lowerFractions[ CurrentDimension ] * NextInterpolationStep::interpolate(
+                    dependentData, lowerOffset, lowerOffsets, strides, lowerFractions, upperFractions );
+    }
+};
+
+//! Struct to perform the step in the final dimension of the multi-linear interpolation process.
+/*!
+ * Struct to perform the step in the final dimension of the multi-linear interpolation process, in which the
+ * dependent variable values are retrieved.
+ */
+template< typename IndependentVariableType, typename DependentVariableType, int CurrentDimension,
+          int NumberOfDimensions >
+struct MultiLinearInterpolationStep< IndependentVariableType, DependentVariableType, CurrentDimension,
+        NumberOfDimensions, true >
+{
+    //! Function to perform the step in the final dimension of the multi-linear interpolation process.
+    /*!
+     * Function to perform the step in the final dimension of the multi-linear interpolation process.
+     * \param dependentData Pointer to origin of dependent variable data (see boost::multi_array::origin).
+     * \param currentOffset Offset in dependentData of grid point, as determined by previous dimensions.
+     * \param lowerOffsets Offsets in dependentData of nearest lower grid point, in each dimension separately.
+     * \param strides Strides in dependentData of each dimension.
+     * \param lowerFractions Fractions with which the lower grid point contributes, in each dimension.
+     * \param upperFractions Fractions with which the upper grid point contributes, in each dimension.
+     * \return Interpolated value in final dimension.
+     */
+    static DependentVariableType interpolate(
+            const DependentVariableType* dependentData,
+            const int currentOffset,
+            const boost::array< int, NumberOfDimensions >& lowerOffsets,
+            const boost::array< int, NumberOfDimensions >& strides,
+            const boost::array< IndependentVariableType, NumberOfDimensions >& lowerFractions,
+            const boost::array< IndependentVariableType, NumberOfDimensions >& upperFractions )
+    {
+        const int lowerOffset = currentOffset + lowerOffsets[ CurrentDimension ];
+        return upperFractions[ CurrentDimension ] * dependentData[ lowerOffset + strides[ CurrentDimension ] ] +
+                lowerFractions[ CurrentDimension ] * dependentData[ lowerOffset ];
+    }
+};
+
 //! Class for performing multi-linear interpolation for arbitrary number of independent variables.
 /*!
  * Class for performing multi-linear interpolation for arbitrary number of independent variables.
- * Interpolation is calculated recursively over all dimensions of independent variables. Note
- * that the types (i.e. double, float) of all independent variables must be the same.
+ * Interpolation is calculated over all dimensions of independent variables, using a sequence of
+ * steps that is unrolled at compile time (see MultiLinearInterpolationStep), without any heap
+ * allocation. Note that the types (i.e. double, float) of all independent variables must be the same.
+ * The dependent data are either copied into the interpolator at construction, or referenced in external storage
+ * (e.g. a memory-mapped file), which is then kept alive by the interpolator (see second constructor).
  * \tparam IndependentVariableType Type for independent variables.
  * \tparam DependentVariableType Type for dependent variable.
  * \tparam NumberOfDimensions Number of independent variables.
@@ -78,29 +166,42 @@ public:
                              const boost::multi_array< DependentVariableType, static_cast< size_t >( NumberOfDimensions )>
                              dependentData,
                              const AvailableLookupScheme selectedLookupScheme = huntingAlgorithm )
-        : independentValues_( independentValues ),
-          dependentData_( dependentData )
+        : independentValues_( independentValues )
     {
-        // Check consistency of template arguments and input variables.
-        if ( independentValues.size( ) != NumberOfDimensions )
-        {
-            throw std::runtime_error( "Error: dimension of independent value vector provided to constructor incompatible with template parameter " );
-        }
-
-        // Check consistency of input data of dependent and independent data.
-        for ( int i = 0; i < NumberOfDimensions; i++ )
-        {
-            if ( independentValues[ i ].size( ) != dependentData.shape( )[ i ] )
-            {
-                std::string errorMessage = "Warning: number of data points in dimension" +
-                        boost::lexical_cast< std::string >( i ) + "of independent and dependent data incompatible";
-                throw std::runtime_error( errorMessage );
-            }
-        }
+        // Store copy of dependent data (shared by copies of this object).
+        boost::shared_ptr< boost::multi_array< DependentVariableType, static_cast< size_t >( NumberOfDimensions ) > >
+                dependentDataCopy = boost::make_shared<
+                boost::multi_array< DependentVariableType, static_cast< size_t >( NumberOfDimensions ) > >(
+                    dependentData );
+        initialize( *dependentDataCopy, dependentDataCopy, selectedLookupScheme );
+    }
 
-        makeLookupSchemes( selectedLookupScheme );
+    //! Constructor taking independent variable data and a reference to externally stored dependent variable data.
+    /*!
+     * Constructor taking independent variable data and a reference to externally stored dependent variable data, which
+     * is not copied, for instance data in a memory-mapped file (see createMultiLinearInterpolatorFromBinaryFile).
+     * \param independentValues Vector of vectors containing data points of independent variables,
+     *  each must be sorted in ascending order.
+     * \param dependentData Reference to multi-dimensional array of dependent data at each point of
+     *          hyper-rectangular grid formed by independent variable points.
+     * \param dependentDataOwner Object owning the storage of dependentData, which is kept alive as long as this
+     *          interpolator (or a copy of it) exists.
+     *  \param selectedLookupScheme Identifier of lookupscheme from enum. This algorithm is used
+     *          to find the nearest lower data point in the independent variables when requesting
+     *          interpolation.
+     */
+    MultiLinearInterpolator( const std::vector< std::vector< IndependentVariableType > >
+                             independentValues,
+                             const boost::const_multi_array_ref< DependentVariableType,
+                             static_cast< size_t >( NumberOfDimensions ) >& dependentData,
+                             const boost::shared_ptr< const void > dependentDataOwner,
+                             const AvailableLookupScheme selectedLookupScheme = huntingAlgorithm )
+        : independentValues_( independentValues )
+    {
+        initialize( dependentData, dependentDataOwner, selectedLookupScheme );
     }
 
+
     //! Default destructor
     /*!
      *  Default destructor
@@ -117,27 +218,47 @@ public:
     DependentVariableType interpolate(
             const std::vector< IndependentVariableType >& independentValuesToInterpolate )
     {
-        // Determine the nearest lower neighbours.
-        std::vector< int > nearestLowerIndices;
-        nearestLowerIndices.resize( NumberOfDimensions );
-        for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
+        boost::array< IndependentVariableType, NumberOfDimensions > independentValueArray;
+        for ( int i = 0; i < NumberOfDimensions; i++ )
         {
-            nearestLowerIndices[ i ] = lookUpSchemes_[ i ]->findNearestLowerNeighbour(
-                    independentValuesToInterpolate[ i ] );
+            independentValueArray[ i ] = independentValuesToInterpolate[ i ];
         }
+        return interpolate( independentValueArray );
+    }
 
-        // Initialize function evaluation indices to -1 for debugging purposes.
-        boost::array< int, NumberOfDimensions > interpolationIndices;
+    //! Function to perform interpolation, with independent variables provided as fixed-size array.
+    /*!
+     *  This function performs the multilinear interpolation, with independent variables provided as fixed-size array.
+     *  \param independentValuesToInterpolate Array of values of independent variables at which
+     *  the value of the dependent variable is to be determined.
+     *  \return Interpolated value of dependent variable in all dimensions.
+     */
+    DependentVariableType interpolate(
+            const boost::array< IndependentVariableType, NumberOfDimensions >& independentValuesToInterpolate )
+    {
+        // Determine the nearest lower neighbours, the contributions of lower and upper grid point in each
+        // dimension and the offset of nearest lower neighbour in storage of dependent variables.
+        boost::array< int, NumberOfDimensions > lowerOffsets;
+        boost::array< IndependentVariableType, NumberOfDimensions > lowerFractions;
+        boost::array< IndependentVariableType, NumberOfDimensions > upperFractions;
+        int nearestLowerIndex;
         for ( int i = 0; i < NumberOfDimensions; i++ )
         {
-            interpolationIndices[ i ] = -1;
+            nearestLowerIndex = lookUpSchemes_[ i ]->findNearestLowerNeighbour(
+                        independentValuesToInterpolate[ i ] );
+            lowerOffsets[ i ] = nearestLowerIndex * strides_[ i ];
+            upperFractions[ i ] = ( independentValuesToInterpolate[ i ] -
+                                    independentValues_[ i ][ nearestLowerIndex ] ) *
+                    inverseIntervalSizes_[ i ][ nearestLowerIndex ];
+            lowerFractions[ i ] = ( independentValues_[ i ][ nearestLowerIndex + 1 ] -
+                                    independentValuesToInterpolate[ i ] ) *
+                    inverseIntervalSizes_[ i ][ nearestLowerIndex ];
         }
 
-        // Call first step of interpolation, this function calls itself at subsequent independent
-        // variable dimensions to evaluate and properly scale dependent variable table values at
-        // all 2^n grid edges.
-        return performRecursiveInterpolationStep( 0, independentValuesToInterpolate,
-                                                  interpolationIndices, nearestLowerIndices );
+        // Evaluate and scale dependent variable table values at all 2^n grid edges.
+        return MultiLinearInterpolationStep< IndependentVariableType, DependentVariableType, 0, NumberOfDimensions >::
+                interpolate( dependentDataOrigin_, indexBaseOffset_, lowerOffsets, strides_,
+                             lowerFractions, upperFractions );
     }
 
     //! Function to return the number of independent variables of the interpolation.
@@ -154,6 +275,61 @@ public:
 
 private:
 
+    //! Function to check the input data and initialize the interpolator.
+    /*!
+     * Function to check the input data and initialize the interpolator, called by the constructors after setting
+     * independentValues_.
+     * \param dependentData Reference to multi-dimensional array of dependent data at each point of
+     *          hyper-rectangular grid formed by independent variable points.
+     * \param dependentDataOwner Object owning the storage of dependentData.
+     * \param selectedLookupScheme Identifier of lookupscheme from enum.
+     */
+    void initialize( const boost::const_multi_array_ref< DependentVariableType,
+                     static_cast< size_t >( NumberOfDimensions ) >& dependentData,
+                     const boost::shared_ptr< const void > dependentDataOwner,
+                     const AvailableLookupScheme selectedLookupScheme )
+    {
+        // Check consistency of template arguments and input variables.
+        if ( independentValues_.size( ) != NumberOfDimensions )
+        {
+            throw std::runtime_error( "Error: dimension of independent value vector provided to constructor incompatible with template parameter " );
+        }
+
+        // Check consistency of input data of dependent and independent data.
+        for ( int i = 0; i < NumberOfDimensions; i++ )
+        {
+            if ( independentValues_[ i ].size( ) != dependentData.shape( )[ i ] )
+            {
+                std::string errorMessage = "Warning: number of data points in dimension" +
+                        boost::lexical_cast< std::string >( i ) + "of independent and dependent data incompatible";
+                throw std::runtime_error( errorMessage );
+            }
+        }
+
+        makeLookupSchemes( selectedLookupScheme );
+
+        // Pre-compute reciprocal of grid spacing in each dimension.
+        inverseIntervalSizes_.resize( NumberOfDimensions );
+        for( int i = 0; i < NumberOfDimensions; i++ )
+        {
+            for( unsigned int j = 1; j < independentValues_[ i ].size( ); j++ )
+            {
+                inverseIntervalSizes_[ i ].push_back(
+                            1.0 / ( independentValues_[ i ][ j ] - independentValues_[ i ][ j - 1 ] ) );
+            }
+        }
+
+        // Pre-compute strides (and offset due to index bases) in storage of dependent variables.
+        dependentDataOwner_ = dependentDataOwner;
+        dependentDataOrigin_ = dependentData.origin( );
+        indexBaseOffset_ = 0;
+        for( int i = 0; i < NumberOfDimensions; i++ )
+        {
+            strides_[ i ] = static_cast< int >( dependentData.strides( )[ i ] );
+            indexBaseOffset_ += static_cast< int >( dependentData.index_bases( )[ i ] ) * strides_[ i ];
+        }
+    }
+
     //! Make the lookup scheme that is to be used.
     /*!
      * This function creates the look up scheme that is to be used in determining the interval of
@@ -192,85 +368,22 @@ private:
 
             break;
 
-        default:
+        case equidistantLookup:
 
-            throw std::runtime_error( "Warning: lookup scheme not found when making scheme for 1-D interpolator" );
-        }
-    }
+            for( int i = 0; i < NumberOfDimensions; i++ )
+            {
+                // Create equidistant scheme, which computes the index directly if the grid is equidistant.
+                lookUpSchemes_[ i ] = boost::shared_ptr< LookUpScheme< IndependentVariableType > >
+                        ( new EquidistantLookupScheme< IndependentVariableType >(
+                              independentValues_[ i ] ) );
+            }
 
-    //! Perform the step in a single dimension of the interpolation process.
-    /*!
-     * Function calculates single dimension of the interpolation process. Function calls itself if
-     * final dimension not yet reached. Calling this function with currentVariable = 0 will result
-     * in 2^{NumberOfDimensions} number of calls to the function at currentVariable =
-     * NumberOfDimensions -1. As such, the complete series of calls, starting at currentVariable =
-     * 0, retrieves the dependent variable values at all edges of the grid hyper-rectangle and
-     * properly scales them.
-     * \param currentVariable Dimension in which this interpolation step is to be performed.
-     * \param independentValuesToInterpolate Vector of values of independent variables at which
-     *          interpolation is to be performed.
-     * \param currentArrayIndices Array of indices modified at index = currentVariable at each
-     *          call of function. Variable is passed to dependentData in highest step to return
-     *          data for interpolation.
-     * \param nearestLowerIndices Indices in subvectors of independentValues_ vector. That is, the
-     *  n-th entry of nearestLowerIndices represent the nearest lower neighbour in the n-th
-     *  interpolation dimension of the independent variable vectors.
-     * \return Interpolated value in a single dimension
-     */
-    DependentVariableType performRecursiveInterpolationStep(
-            const unsigned int currentVariable,
-            const std::vector< IndependentVariableType >& independentValuesToInterpolate,
-            boost::array< int, NumberOfDimensions > currentArrayIndices,
-            const std::vector< int >& nearestLowerIndices )
-    {
-        IndependentVariableType upperFraction, lowerFraction;
-        DependentVariableType upperContribution, lowerContribution;
-
-        // Calculate fractions of data points above and below independent
-        // variable value to be added to interpolated value.
-        upperFraction = ( independentValuesToInterpolate[ currentVariable ] -
-                          independentValues_[ currentVariable ]
-                          [ nearestLowerIndices[ currentVariable ] ] ) /
-                ( independentValues_[ currentVariable ]
-                  [ nearestLowerIndices[ currentVariable ] + 1 ] -
-                  independentValues_[ currentVariable ]
-                  [ nearestLowerIndices[ currentVariable ] ] );
-        lowerFraction = -( independentValuesToInterpolate[ currentVariable ] -
-                           independentValues_[ currentVariable ]
-                           [ nearestLowerIndices[ currentVariable ] + 1 ] ) /
-                ( independentValues_[ currentVariable ]
-                  [ nearestLowerIndices[ currentVariable ] + 1 ] -
-                  independentValues_[ currentVariable ]
-                  [ nearestLowerIndices[ currentVariable ] ] );
-
-        // If at top dimension, call dependent variable data.
-        if ( currentVariable == NumberOfDimensions - 1 )
-        {
-            currentArrayIndices[ NumberOfDimensions - 1 ] = nearestLowerIndices[ currentVariable ];
-            lowerContribution = dependentData_( currentArrayIndices );
-            currentArrayIndices[ NumberOfDimensions - 1 ] = nearestLowerIndices[ currentVariable ]
-                                                            + 1;
-            upperContribution = dependentData_( currentArrayIndices );
-        }
+            break;
 
-        // If at lower dimension, update currentArrayIndices and call function with
-        // currentVariable++.
-        else
-        {
-            currentArrayIndices[ currentVariable ] = nearestLowerIndices[ currentVariable ];
-            lowerContribution = performRecursiveInterpolationStep(
-                        currentVariable + 1, independentValuesToInterpolate,
-                        currentArrayIndices, nearestLowerIndices );
-            currentArrayIndices[ currentVariable ] = nearestLowerIndices[ currentVariable ] + 1;
-            upperContribution = performRecursiveInterpolationStep(
-                        currentVariable + 1, independentValuesToInterpolate,
-                        currentArrayIndices, nearestLowerIndices );
-        }
+        default:
 
-        // Return interpolated value.
-        DependentVariableType returnValue = upperFraction * upperContribution +
-                                            lowerFraction * lowerContribution;
-        return returnValue;
+            throw std::runtime_error( "Warning: lookup scheme not found when making scheme for 1-D interpolator" );
+        }
     }
 
     //! Vector with pointers to look-up scheme.
@@ -287,12 +400,24 @@ private:
      */
     std::vector< std::vector< IndependentVariableType > > independentValues_;
 
-    //! Multi-dimensional array of dependent data.
+    //! Object owning the storage of the dependent data.
     /*!
-     * Multi-dimensional array of dependent data at each point of hyper-rectangular grid formed by
-     * independent variable points.
+     * Object owning the storage of the multi-dimensional array of dependent data at each point of hyper-rectangular
+     * grid formed by independent variable points (either a copy of the data, or e.g. a memory-mapped file).
      */
-    boost::multi_array< DependentVariableType, static_cast< size_t >( NumberOfDimensions )> dependentData_;
+    boost::shared_ptr< const void > dependentDataOwner_;
+
+    //! Pointer to origin of dependent data (see boost::multi_array::origin).
+    const DependentVariableType* dependentDataOrigin_;
+
+    //! Reciprocals of the sizes of the intervals between the independent variables, in each dimension.
+    std::vector< std::vector< IndependentVariableType > > inverseIntervalSizes_;
+
+    //! Strides of each dimension in the storage of the dependent data.
+    boost::array< int, NumberOfDimensions > strides_;
+
+    //! Offset in storage of the dependent data of entry with all indices equal to the index bases.
+    int indexBaseOffset_;
 };
 
 } // namespace interpolators
@@ -12,7 +12,11 @@
 #ifndef TUDAT_ONE_DIMENSIONAL_INTERPOLATOR_H
 #define TUDAT_ONE_DIMENSIONAL_INTERPOLATOR_H
 
+#include <algorithm>
+#include <exception>
+#include <functional>
 #include <iostream>
+#include <thread>
 #include <vector>
 
 #include <boost/shared_ptr.hpp>
@@ -72,13 +76,98 @@ public:
 
     //! Function to perform interpolation.
     /*!
-     * This function performs the interpolation
+     * This function performs the interpolation, using the look-up cursor stored in this object to find the
+     * interval in which the independent variable value lies. Since the cursor is modified, this function may not be
+     * called concurrently from multiple threads (use the interpolate function with a cursor argument instead).
      * \param independentVariableValue Independent variable value at which the value of the
      *          dependent variable is to be determined.
      * \return Interpolated value of dependent variable.
      */
     virtual DependentVariableType
-            interpolate( const IndependentVariableType independentVariableValue ) = 0;
+            interpolate( const IndependentVariableType independentVariableValue )
+    {
+        return interpolate( independentVariableValue, lookUpCursor_ );
+    }
+
+    //! Function to perform interpolation, using a look-up cursor owned by the caller.
+    /*!
+     * This function performs the interpolation, using a look-up cursor owned by the caller to find the interval in
+     * which the independent variable value lies. The interpolator is not modified by this function, so that it may be
+     * called concurrently from multiple threads, provided each thread uses its own cursor. Similarly, interleaved
+     * sequences of requests (e.g. at two different epochs) can each retain their own lookup locality.
+     * \param independentVariableValue Independent variable value at which the value of the
+     *          dependent variable is to be determined.
+     * \param cursor Look-up cursor owned by the caller, storing the result of the caller's previous look-up.
+     * \return Interpolated value of dependent variable.
+     */
+    virtual DependentVariableType
+            interpolate( const IndependentVariableType independentVariableValue, LookUpCursor& cursor ) const = 0;
+
+    //! Function to perform interpolation at multiple values of the independent variable.
+    /*!
+     * Function to perform interpolation at multiple values of the independent variable, with the results stored
+     * contiguously in the output vector. The values are processed in sequence using a single look-up cursor, so that
+     * for sorted (or nearly sorted) input the interval search reduces to a single forward sweep through the grid of
+     * independent variables. Derived classes evaluate the sequence without virtual dispatch per value (see
+     * interpolateSequence). For large input (in particular unsorted input, for which the look-up has little
+     * locality), the values may be distributed over multiple threads, in contiguous blocks that each use their own
+     * cursor. The interpolator is not modified by this function.
+     * \param independentVariableValues Values of independent variable at which interpolation is to take place.
+     * \param interpolatedValues Interpolated values of dependent variable, in the same order as
+     * independentVariableValues (returned by reference).
+     * \param numberOfThreads Number of threads over which the values are to be distributed (default 1).
+     */
+    void interpolateMultipleValues( const std::vector< IndependentVariableType >& independentVariableValues,
+                                    std::vector< DependentVariableType >& interpolatedValues,
+                                    const unsigned int numberOfThreads = 1 ) const
+    {
+        interpolatedValues.resize( independentVariableValues.size( ) );
+        if( independentVariableValues.size( ) == 0 )
+        {
+            return;
+        }
+
+        // Distribute values over threads, in contiguous blocks (last block computed in this thread).
+        unsigned int numberOfValues = independentVariableValues.size( );
+        unsigned int numberOfBlocks = std::max( 1u, std::min( numberOfThreads, numberOfValues ) );
+
+        std::vector< LookUpCursor > cursors( numberOfBlocks );
+        std::vector< std::exception_ptr > threadExceptions( numberOfBlocks );
+        std::vector< std::thread > threads;
+        for( unsigned int i = 0; i < numberOfBlocks; i++ )
+        {
+            unsigned int startIndex = ( i * numberOfValues ) / numberOfBlocks;
+            unsigned int endIndex = ( ( i + 1 ) * numberOfValues ) / numberOfBlocks;
+            if( i < numberOfBlocks - 1 )
+            {
+                threads.push_back( std::thread(
+                                       &OneDimensionalInterpolator::interpolateSequenceAndStoreException, this,
+                                       &independentVariableValues[ startIndex ], endIndex - startIndex,
+                                       &interpolatedValues[ startIndex ], std::ref( cursors[ i ] ),
+                                       std::ref( threadExceptions[ i ] ) ) );
+            }
+            else
+            {
+                interpolateSequenceAndStoreException(
+                            &independentVariableValues[ startIndex ], endIndex - startIndex,
+                            &interpolatedValues[ startIndex ], cursors[ i ], threadExceptions[ i ] );
+            }
+        }
+
+        for( unsigned int i = 0; i < threads.size( ); i++ )
+        {
+            threads.at( i ).join( );
+        }
+
+        // Report first exception that occured in any of the blocks.
+        for( unsigned int i = 0; i < numberOfBlocks; i++ )
+        {
+            if( threadExceptions.at( i ) )
+            {
+                std::rethrow_exception( threadExceptions.at( i ) );
+            }
+        }
+    }
 
     //! Function to return the number of independent variables of the interpolation.
     /*!
@@ -116,13 +205,63 @@ public:
      *  Function to return the ector with dependent variables used by the interpolator.
      *  \return Dependent variables used by the interpolator.
      */
-    std::vector< DependentVariableType > getDependentValues( )
+    virtual std::vector< DependentVariableType > getDependentValues( )
     {
         return dependentValues_;
     }
 
 protected:
 
+    //! Function to perform interpolation at a sequence of values of the independent variable.
+    /*!
+     * Function to perform interpolation at a sequence of values of the independent variable, using a single look-up
+     * cursor owned by the caller (see interpolateMultipleValues). This base class implementation calls the
+     * (virtual) interpolate function for each value; derived classes override it to evaluate their own interpolate
+     * function directly.
+     * \param independentVariableValues Pointer to first value of independent variable at which interpolation is to
+     * take place.
+     * \param numberOfValues Number of values at which interpolation is to take place.
+     * \param interpolatedValues Pointer to first interpolated value of dependent variable (returned by reference).
+     * \param cursor Look-up cursor owned by the caller, storing the result of the caller's previous look-up.
+     */
+    virtual void interpolateSequence( const IndependentVariableType* independentVariableValues,
+                                      const unsigned int numberOfValues,
+                                      DependentVariableType* interpolatedValues,
+                                      LookUpCursor& cursor ) const
+    {
+        for( unsigned int i = 0; i < numberOfValues; i++ )
+        {
+            interpolatedValues[ i ] = interpolate( independentVariableValues[ i ], cursor );
+        }
+    }
+
+    //! Function to perform interpolation at a sequence of values, storing (rather than throwing) any exception.
+    /*!
+     * Function to perform interpolation at a sequence of values (see interpolateSequence), storing any exception that
+     * occurs, so that it can be reported by the thread calling interpolateMultipleValues.
+     * \param independentVariableValues Pointer to first value of independent variable at which interpolation is to
+     * take place.
+     * \param numberOfValues Number of values at which interpolation is to take place.
+     * \param interpolatedValues Pointer to first interpolated value of dependent variable (returned by reference).
+     * \param cursor Look-up cursor owned by the caller, storing the result of the caller's previous look-up.
+     * \param caughtException Exception that occured during interpolation, if any (returned by reference).
+     */
+    void interpolateSequenceAndStoreException( const IndependentVariableType* independentVariableValues,
+                                               const unsigned int numberOfValues,
+                                               DependentVariableType* interpolatedValues,
+                                               LookUpCursor& cursor,
+                                               std::exception_ptr& caughtException ) const
+    {
+        try
+        {
+            interpolateSequence( independentVariableValues, numberOfValues, interpolatedValues, cursor );
+        }
+        catch( ... )
+        {
+            caughtException = std::current_exception( );
+        }
+    }
+
     //! Make look-up scheme that is to be used.
     /*!
      * This function creates the look-up scheme that is to be used in determining the interval of
@@ -152,6 +291,14 @@ protected:
                       ( independentValues_ ) );
             break;
 
+        case equidistantLookup:
+
+            // Create equidistant scheme, which computes the index directly if the grid is equidistant.
+            lookUpScheme_ = boost::shared_ptr< LookUpScheme< IndependentVariableType > >
+                    ( new EquidistantLookupScheme< IndependentVariableType >
+                      ( independentValues_ ) );
+            break;
+
         default:
             throw std::runtime_error( "Warning: lookup scheme not found when making scheme for 1-D interpolator" );
         }
@@ -164,6 +311,12 @@ protected:
      */
     boost::shared_ptr< LookUpScheme< IndependentVariableType > > lookUpScheme_;
 
+    //! Look-up cursor used by the interpolate function without cursor argument.
+    /*!
+     * Look-up cursor used by the interpolate function without cursor argument.
+     */
+    LookUpCursor lookUpCursor_;
+
     //! Vector with dependent variables.
     /*!
      * Vector with dependent variables.
@@ -75,6 +75,18 @@ void Body::setTemplatedState( const Eigen::Matrix< long double, 6, 1 >& state )
     setLongState( state );
 }
 
+//! Number of times that the ephemeris of any body has been set.
+unsigned int BaseStateInterface::numberOfEphemerisResets_ = 0;
+
+//! Function to reset the memoized states of the ephemeris origins of all bodies
+void resetCachedBaseFrameStates( const NamedBodyMap& bodyMap )
+{
+    for( NamedBodyMap::const_iterator bodyIterator = bodyMap.begin( ); bodyIterator != bodyMap.end( );
+         bodyIterator++ )
+    {
+        bodyIterator->second->getEphemerisFrameToBaseFrame( )->resetCachedStates( );
+    }
+}
 
 } // namespace simulation_setup
 
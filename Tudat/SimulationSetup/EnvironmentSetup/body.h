@@ -76,8 +76,28 @@ public:
     Eigen::Matrix< OutputStateScalarType, 6, 1 > getBaseFrameState(
             const OutputTimeType time );
 
+    //! Function to reset any states memoized by this object
+    /*!
+     *  Function to reset any states memoized by this object, to be called when the ephemerides from which the state
+     *  of baseFrameId_ is computed are modified (default: no states are memoized).
+     */
+    virtual void resetCachedStates( ){ }
+
+    //! Function to signal that the ephemeris of a body has been set
+    /*!
+     *  Function to signal that the ephemeris of a body has been set (called by Body::setEphemeris), so that all states
+     *  memoized by objects of this class are recomputed when next requested.
+     */
+    static void signalEphemerisReset( )
+    {
+        numberOfEphemerisResets_++;
+    }
+
 protected:
 
+    //! Number of times that the ephemeris of any body has been set (see signalEphemerisReset).
+    static unsigned int numberOfEphemerisResets_;
+
     //! Pure virtual function through which the state of baseFrameId_ in the inertial frame can be determined
     /*!
      *  Pure virtual function through which the state of baseFrameId_ in the inertial frame can be determined
@@ -129,16 +149,32 @@ public:
      * Constructor
      * \param baseFrameId Name of frame origin for which inertial state is computed by this class
      * \param stateFunction Function returning frame's inertial state as a function of time.
+     * \param memoizeStates Boolean denoting whether the most recently computed state (for double time, with double
+     * and long double state scalar) is to be memoized (default false).
      */
     BaseStateInterfaceImplementation(
             const std::string baseFrameId,
-            const boost::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > stateFunction ):
+            const boost::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > stateFunction,
+            const bool memoizeStates = false ):
         BaseStateInterface( baseFrameId ),
-        stateFunction_( stateFunction ){ }
+        stateFunction_( stateFunction ), memoizeStates_( memoizeStates )
+    {
+        resetCachedStates( );
+    }
 
     //! Destructor
     ~BaseStateInterfaceImplementation( ){ }
 
+    //! Function to reset the memoized states
+    /*!
+     *  Function to reset the memoized states, so that the state function is evaluated at the next call.
+     */
+    void resetCachedStates( )
+    {
+        cachedDoubleStateTime_ = TUDAT_NAN;
+        cachedLongDoubleStateTime_ = TUDAT_NAN;
+    }
+
 
 protected:
 
@@ -151,7 +187,18 @@ protected:
      */
     Eigen::Matrix< double, 6, 1 > getBaseFrameDoubleState( const double time )
     {
-        return stateFunction_( time ).template cast< double >( );
+        if( !memoizeStates_ )
+        {
+            return stateFunction_( time ).template cast< double >( );
+        }
+        else if( !( time == cachedDoubleStateTime_ ) ||
+                 ( cachedDoubleStateNumberOfEphemerisResets_ != numberOfEphemerisResets_ ) )
+        {
+            cachedDoubleState_ = stateFunction_( time ).template cast< double >( );
+            cachedDoubleStateTime_ = time;
+            cachedDoubleStateNumberOfEphemerisResets_ = numberOfEphemerisResets_;
+        }
+        return cachedDoubleState_;
     }
 
     //! Function through which the state of baseFrameId_ in the inertial frame can be determined
@@ -163,7 +210,18 @@ protected:
      */
     Eigen::Matrix< long double, 6, 1 > getBaseFrameLongDoubleState( const double time )
     {
-        return stateFunction_( time ).template cast< long double >( );
+        if( !memoizeStates_ )
+        {
+            return stateFunction_( time ).template cast< long double >( );
+        }
+        else if( !( time == cachedLongDoubleStateTime_ ) ||
+                 ( cachedLongDoubleStateNumberOfEphemerisResets_ != numberOfEphemerisResets_ ) )
+        {
+            cachedLongDoubleState_ = stateFunction_( time ).template cast< long double >( );
+            cachedLongDoubleStateTime_ = time;
+            cachedLongDoubleStateNumberOfEphemerisResets_ = numberOfEphemerisResets_;
+        }
+        return cachedLongDoubleState_;
     }
 
     //! Function through which the state of baseFrameId_ in the inertial frame can be determined
@@ -194,6 +252,27 @@ private:
 
     //! Function returning frame's inertial state as a function of time.
     boost::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > stateFunction_;
+
+    //! Boolean denoting whether the most recently computed state is to be memoized.
+    bool memoizeStates_;
+
+    //! Time at which cachedDoubleState_ was computed (NaN if not computed).
+    double cachedDoubleStateTime_;
+
+    //! Value of numberOfEphemerisResets_ when cachedDoubleState_ was computed.
+    unsigned int cachedDoubleStateNumberOfEphemerisResets_;
+
+    //! Most recently computed state (with double as state scalar).
+    Eigen::Matrix< double, 6, 1 > cachedDoubleState_;
+
+    //! Time at which cachedLongDoubleState_ was computed (NaN if not computed).
+    double cachedLongDoubleStateTime_;
+
+    //! Value of numberOfEphemerisResets_ when cachedLongDoubleState_ was computed.
+    unsigned int cachedLongDoubleStateNumberOfEphemerisResets_;
+
+    //! Most recently computed state (with long double as state scalar).
+    Eigen::Matrix< long double, 6, 1 > cachedLongDoubleState_;
 };
 
 //! Body class representing the properties of a celestial body (natural or artificial).
@@ -315,6 +394,21 @@ public:
         }
     }
 
+    //! Templated function to compute the state of the body in the global frame from its ephemeris and
+    //! global-to-ephemeris-frame function.
+    /*!
+     * Templated function to compute the state of the body in the global frame from its ephemeris and
+     * global-to-ephemeris-frame function, without setting (or using) the currentState_ / currentLongState_ variables.
+     * \param time Time at which the global state is to be computed.
+     * \return State at requested time
+     */
+    template< typename StateScalarType = double, typename TimeType = double >
+    Eigen::Matrix< StateScalarType, 6, 1 > computeStateInBaseFrameFromEphemeris( const TimeType time )
+    {
+        return bodyEphemeris_->getTemplatedStateFromEphemeris< StateScalarType, TimeType >( time ) +
+                ephemerisFrameToBaseFrame_->getBaseFrameState< TimeType, StateScalarType >( time );
+    }
+
     //! Templated function to get the current state of the body from its ephemeris and
     //! global-to-ephemeris-frame function.
     /*!
@@ -544,12 +638,14 @@ public:
     //! Function to set the ephemeris of the body.
     /*!
      *  Function to set the ephemeris of the body, which is used to represent the (a priori)
-     *  state history of the body.
+     *  state history of the body. Any memoized states of ephemeris origins (see BaseStateInterfaceImplementation)
+     *  are recomputed when next requested.
      *  \param bodyEphemeris New ephemeris of the body.
      */
     void setEphemeris( const boost::shared_ptr< ephemerides::Ephemeris > bodyEphemeris )
     {
         bodyEphemeris_ = bodyEphemeris;
+        BaseStateInterface::signalEphemerisReset( );
     }
 
     //! Function to set the gravity field of the body.
@@ -1069,6 +1165,14 @@ private:
 
 typedef std::unordered_map< std::string, boost::shared_ptr< Body > > NamedBodyMap;
 
+//! Function to reset the memoized states of the ephemeris origins of all bodies
+/*!
+ *  Function to reset the memoized states of the ephemeris origins of all bodies (see setGlobalFrameBodyEphemerides),
+ *  to be called whenever an existing ephemeris object of any of the bodies is modified.
+ *  \param bodyMap List of body objects that constitute the environment.
+ */
+void resetCachedBaseFrameStates( const NamedBodyMap& bodyMap );
+
 template< typename StateScalarType = double, typename TimeType = double >
 Eigen::Matrix< StateScalarType, 3, 1 > getBodyAccelerationInBaseFramefromNumericalDifferentiation(
         const boost::shared_ptr< Body > bodyWithAcceleration,
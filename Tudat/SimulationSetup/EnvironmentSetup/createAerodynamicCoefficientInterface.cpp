@@ -109,6 +109,47 @@ readTabulatedAerodynamicCoefficientsFromFiles(
     return coefficientSettings;
 }
 
+//! Function to create aerodynamic coefficient settings from coefficients stored in binary coefficient table files
+boost::shared_ptr< AerodynamicCoefficientSettings > readTabulatedAerodynamicCoefficientsFromBinaryFiles(
+        const std::string& forceCoefficientFile,
+        const std::string& momentCoefficientFile,
+        const double referenceLength,
+        const double referenceArea,
+        const double lateralReferenceLength,
+        const Eigen::Vector3d& momentReferencePoint,
+        const std::vector< aerodynamics::AerodynamicCoefficientsIndependentVariables > independentVariableNames,
+        const bool areCoefficientsInAerodynamicFrame,
+        const bool areCoefficientsInNegativeAxisDirection )
+{
+    // Retrieve number of independent variables from file.
+    unsigned int numberOfIndependentVariables =
+            input_output::getNumberOfDimensionsInBinaryCoefficientTableFile( forceCoefficientFile );
+
+    // Call approriate file reading function for N independent variables
+    boost::shared_ptr< AerodynamicCoefficientSettings > coefficientSettings;
+    if( numberOfIndependentVariables == 2 )
+    {
+        coefficientSettings = readGivenSizeTabulatedAerodynamicCoefficientsFromBinaryFiles< 2 >(
+                    forceCoefficientFile, momentCoefficientFile, referenceLength, referenceArea, lateralReferenceLength,
+                    momentReferencePoint, independentVariableNames, areCoefficientsInAerodynamicFrame,
+                    areCoefficientsInNegativeAxisDirection );
+    }
+    else if( numberOfIndependentVariables == 3 )
+    {
+        coefficientSettings = readGivenSizeTabulatedAerodynamicCoefficientsFromBinaryFiles< 3 >(
+                    forceCoefficientFile, momentCoefficientFile, referenceLength, referenceArea, lateralReferenceLength,
+                    momentReferencePoint, independentVariableNames, areCoefficientsInAerodynamicFrame,
+                    areCoefficientsInNegativeAxisDirection );
+    }
+    else
+    {
+        throw std::runtime_error( "Error when reading aerodynamic coefficient settings from binary file, found " +
+                                  boost::lexical_cast< std::string >( numberOfIndependentVariables ) +
+                                  " independent variables, 2 or 3 currently supported" );
+    }
+    return coefficientSettings;
+}
+
 //! Function to create an aerodynamic coefficient interface containing constant coefficients.
 boost::shared_ptr< aerodynamics::AerodynamicCoefficientInterface >
 createConstantCoefficientAerodynamicCoefficientInterface(
@@ -18,6 +18,7 @@
 #include "Tudat/Astrodynamics/Aerodynamics/aerodynamicCoefficientInterface.h"
 #include "Tudat/Astrodynamics/Aerodynamics/customAerodynamicCoefficientInterface.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/createAerodynamicControlSurfaces.h"
+#include "Tudat/InputOutput/binaryCoefficientTableFile.h"
 #include "Tudat/Mathematics/Interpolators/multiLinearInterpolator.h"
 #include "Tudat/Mathematics/Interpolators/createInterpolator.h"
 namespace tudat
@@ -328,8 +329,9 @@ private:
 /*!
  *  Object for setting aerodynamic coefficients from a user-defined N-dimensional table (with N>1). The N=1 case has its
  *  own template specialization.
- *  The user must provide the force (and moment) coefficients in boost multi_arrays, and
- *  define the physical meaning of each of the independent variables.
+ *  The user must provide the force (and moment) coefficients in boost multi_arrays, or as memory-mapped binary
+ *  coefficient tables (see input_output::MappedBinaryCoefficientTable), and define the physical meaning of each of the
+ *  independent variables.
  */
 template< unsigned int NumberOfDimensions >
 class TabulatedAerodynamicCoefficientSettings: public AerodynamicCoefficientSettings
@@ -381,7 +383,9 @@ public:
             areCoefficientsInNegativeAxisDirection ),
         independentVariables_( independentVariables ),
         forceCoefficients_( forceCoefficients ),
-        momentCoefficients_( momentCoefficients ){ }
+        momentCoefficients_( momentCoefficients ),
+        interpolationSettings_( boost::make_shared< interpolators::InterpolatorSettings >(
+                                    interpolators::linear_interpolator ) ){ }
 
     //! Constructor, sets properties of aerodynamic force coefficients, zero moment coefficients.
     /*!
@@ -415,7 +419,9 @@ public:
             independentVariableNames, areCoefficientsInAerodynamicFrame,
             areCoefficientsInNegativeAxisDirection ),
         independentVariables_( independentVariables ),
-        forceCoefficients_( forceCoefficients )
+        forceCoefficients_( forceCoefficients ),
+        interpolationSettings_( boost::make_shared< interpolators::InterpolatorSettings >(
+                                    interpolators::linear_interpolator ) )
     {
         std::vector< size_t > sizeVector;
         const size_t* arrayShape = forceCoefficients_.shape( );
@@ -427,6 +433,70 @@ public:
                    momentCoefficients_.data( ) + momentCoefficients_.num_elements( ), Eigen::Vector3d::Zero( ) );
     }
 
+    //! Constructor, sets properties of aerodynamic coefficients from memory-mapped binary coefficient tables.
+    /*!
+     *  Constructor, sets properties of aerodynamic coefficients from memory-mapped binary coefficient tables (see
+     *  input_output::MappedBinaryCoefficientTable). When using (multi-)linear interpolation, the coefficient interface
+     *  interpolates directly from the mapped tables, without copying them.
+     *  \param forceCoefficientTable Memory-mapped table of force coefficients.
+     *  \param momentCoefficientTable Memory-mapped table of moment coefficients. If NULL, the moment coefficients are
+     *  set to zero.
+     *  \param referenceLength Reference length with which aerodynamic moments
+     *  (about x- and z- axes) are non-dimensionalized.
+     *  \param referenceArea Reference area with which aerodynamic forces and moments are
+     *  non-dimensionalized.
+     *  \param lateralReferenceLength Reference length with which aerodynamic moments (about y-axis)
+     *  is non-dimensionalized.
+     *  \param momentReferencePoint Point w.r.t. aerodynamic moment is calculated
+     *  \param independentVariableNames Vector with identifiers the physical meaning of each
+     *  independent variable of the aerodynamic coefficients.
+     *  \param areCoefficientsInAerodynamicFrame Boolean to define whether the aerodynamic
+     *  coefficients are defined in the aerodynamic frame (lift, drag, side force) or in the body
+     *  frame (typically denoted as Cx, Cy, Cz).
+     *  \param areCoefficientsInNegativeAxisDirection Boolean to define whether the aerodynamic
+     *  coefficients are positive along the positive axes of the body or aerodynamic frame
+     *  (see areCoefficientsInAerodynamicFrame). Note that for (lift, drag, side force), the
+     *  coefficients are typically defined in negative direction.
+     */
+    TabulatedAerodynamicCoefficientSettings(
+            const boost::shared_ptr< input_output::MappedBinaryCoefficientTable< NumberOfDimensions, 3 > >
+            forceCoefficientTable,
+            const boost::shared_ptr< input_output::MappedBinaryCoefficientTable< NumberOfDimensions, 3 > >
+            momentCoefficientTable,
+            const double referenceLength,
+            const double referenceArea,
+            const double lateralReferenceLength,
+            const Eigen::Vector3d& momentReferencePoint,
+            const std::vector< aerodynamics::AerodynamicCoefficientsIndependentVariables >
+            independentVariableNames,
+            const bool areCoefficientsInAerodynamicFrame = 1,
+            const bool areCoefficientsInNegativeAxisDirection = 1 ):
+        AerodynamicCoefficientSettings(
+            tabulated_coefficients, referenceLength, referenceArea,
+            lateralReferenceLength, momentReferencePoint,
+            independentVariableNames, areCoefficientsInAerodynamicFrame,
+            areCoefficientsInNegativeAxisDirection ),
+        independentVariables_( forceCoefficientTable->getIndependentVariables( ) ),
+        forceCoefficientTable_( forceCoefficientTable ),
+        momentCoefficientTable_( momentCoefficientTable ),
+        interpolationSettings_( boost::make_shared< interpolators::InterpolatorSettings >(
+                                    interpolators::linear_interpolator ) )
+    {
+        if( momentCoefficientTable_ == NULL )
+        {
+            const size_t* arrayShape = forceCoefficientTable_->getCoefficients( ).shape( );
+            momentCoefficients_.resize( std::vector< size_t >( arrayShape, arrayShape + NumberOfDimensions ) );
+
+            std::fill( momentCoefficients_.data( ),
+                       momentCoefficients_.data( ) + momentCoefficients_.num_elements( ), Eigen::Vector3d::Zero( ) );
+        }
+        else if( !input_output::compareIndependentVariables(
+                     independentVariables_, momentCoefficientTable_->getIndependentVariables( ) ) )
+        {
+            throw std::runtime_error( "Error when creating tabulated aerodynamic coefficient settings, force and moment independent variables are inconsistent" );
+        }
+    }
+
     //! Destructor
     ~TabulatedAerodynamicCoefficientSettings( ){ }
 
@@ -442,24 +512,77 @@ public:
 
     //! Function to return values of force coefficients in table.
     /*!
-     * Function to return values of force coefficients in table.
+     * Function to return values of force coefficients in table (copied from the memory-mapped table, if used).
      * \return Values of force coefficients in table.
      */
     boost::multi_array< Eigen::Vector3d, static_cast< size_t >( NumberOfDimensions ) > getForceCoefficients( )
     {
+        if( forceCoefficientTable_ != NULL )
+        {
+            return boost::multi_array< Eigen::Vector3d, static_cast< size_t >( NumberOfDimensions ) >(
+                        forceCoefficientTable_->getCoefficients( ) );
+        }
         return forceCoefficients_;
     }
 
     //! Function to return values of moment coefficients in table.
     /*!
-     * Function to return values of moment coefficients in table.
+     * Function to return values of moment coefficients in table (copied from the memory-mapped table, if used).
      * \return Values of moment coefficients in table.
      */
     boost::multi_array< Eigen::Vector3d, static_cast< size_t >( NumberOfDimensions ) > getMomentCoefficients( )
     {
+        if( momentCoefficientTable_ != NULL )
+        {
+            return boost::multi_array< Eigen::Vector3d, static_cast< size_t >( NumberOfDimensions ) >(
+                        momentCoefficientTable_->getCoefficients( ) );
+        }
         return momentCoefficients_;
     }
 
+    //! Function to return memory-mapped table of force coefficients.
+    /*!
+     * Function to return memory-mapped table of force coefficients.
+     * \return Memory-mapped table of force coefficients (NULL if coefficients are provided as multi_array).
+     */
+    boost::shared_ptr< input_output::MappedBinaryCoefficientTable< NumberOfDimensions, 3 > > getForceCoefficientTable( )
+    {
+        return forceCoefficientTable_;
+    }
+
+    //! Function to return memory-mapped table of moment coefficients.
+    /*!
+     * Function to return memory-mapped table of moment coefficients.
+     * \return Memory-mapped table of moment coefficients (NULL if coefficients are provided as multi_array).
+     */
+    boost::shared_ptr< input_output::MappedBinaryCoefficientTable< NumberOfDimensions, 3 > > getMomentCoefficientTable( )
+    {
+        return momentCoefficientTable_;
+    }
+
+    //! Function to return settings to be used for creating the multi-dimensional interpolator of data.
+    /*!
+     * Function to return settings to be used for creating the multi-dimensional interpolator of data.
+     * \return Settings to be used for creating the multi-dimensional interpolator of data.
+     */
+    boost::shared_ptr< interpolators::InterpolatorSettings > getInterpolationSettings( )
+    {
+        return interpolationSettings_;
+    }
+
+    //! Function to reset settings to be used for creating the multi-dimensional interpolator of data.
+    /*!
+     * Function to reset settings to be used for creating the multi-dimensional interpolator of data. By default,
+     * multi-linear interpolation is used. Settings of type cubic_spline_interpolator result in tensor-product cubic
+     * spline interpolation, for which the coefficients are continuously differentiable w.r.t. all independent
+     * variables.
+     * \param interpolationSettings Settings to be used for creating the multi-dimensional interpolator of data.
+     */
+    void setInterpolationSettings( const boost::shared_ptr< interpolators::InterpolatorSettings > interpolationSettings )
+    {
+        interpolationSettings_ = interpolationSettings;
+    }
+
 private:
 
     //! Values of indepependent variables at which the coefficients in the tables are defined.
@@ -474,6 +597,15 @@ private:
 
     //! Values of moment coefficients at independent variables defined  by independentVariables_.
     boost::multi_array< Eigen::Vector3d, NumberOfDimensions > momentCoefficients_;
+
+    //! Memory-mapped table of force coefficients (used instead of forceCoefficients_ if not NULL).
+    boost::shared_ptr< input_output::MappedBinaryCoefficientTable< NumberOfDimensions, 3 > > forceCoefficientTable_;
+
+    //! Memory-mapped table of moment coefficients (used instead of momentCoefficients_ if not NULL).
+    boost::shared_ptr< input_output::MappedBinaryCoefficientTable< NumberOfDimensions, 3 > > momentCoefficientTable_;
+
+    //! Settings to be used for creating the multi-dimensional interpolator of data.
+    boost::shared_ptr< interpolators::InterpolatorSettings > interpolationSettings_;
 };
 
 //! Object for setting aerodynamic coefficients from a user-defined 1-dimensional table.
@@ -924,6 +1056,108 @@ readTabulatedAerodynamicCoefficientsFromFiles(
         const bool areCoefficientsInAerodynamicFrame = 1,
         const bool areCoefficientsInNegativeAxisDirection = 1 );
 
+//! Function to create aerodynamic coefficient settings from coefficients stored in binary coefficient table files
+/*!
+ *  Function to create aerodynamic coefficient settings from coefficients stored in binary coefficient table files (as
+ *  written by input_output::writeCoefficientTableToBinaryFile, with 3 coefficients per entry). The files are
+ *  memory-mapped, and for (multi-)linear interpolation the coefficient interface interpolates directly from the mapped
+ *  tables. Note that this function requires the number of independent variables in the coefficient files to be known.
+ *  If this is not the case, the readTabulatedAerodynamicCoefficientsFromBinaryFiles function should be used.
+ *  \param forceCoefficientFile Binary coefficient table file containing the aerodynamic force coefficients
+ *  \param momentCoefficientFile Binary coefficient table file containing the aerodynamic moment coefficients (moment
+ *  coefficients are set to zero if empty)
+ *  \param referenceLength Reference length with which aerodynamic moments
+ *  (about x- and z- axes) are non-dimensionalized.
+ *  \param referenceArea Reference area with which aerodynamic forces and moments are
+ *  non-dimensionalized.
+ *  \param lateralReferenceLength Reference length with which aerodynamic moments (about y-axis)
+ *  is non-dimensionalized.
+ *  \param momentReferencePoint Point w.r.t. aerodynamic moment is calculated
+ *  \param independentVariableNames Physical meaning of the independent variables of the aerodynamic coefficients
+ *  \param areCoefficientsInAerodynamicFrame Boolean to define whether the aerodynamic
+ *  coefficients are defined in the aerodynamic frame (lift, drag, side force) or in the body
+ *  frame (typically denoted as Cx, Cy, Cz).
+ *  \param areCoefficientsInNegativeAxisDirection Boolean to define whether the aerodynamic
+ *  coefficients are positive along the positive axes of the body or aerodynamic frame
+ *  (see areCoefficientsInAerodynamicFrame). Note that for (lift, drag, side force), the
+ *  coefficients are typically defined in negative direction.
+ *  \return Settings for creation of aerodynamic coefficient interface, based on the tables in the files
+ *  and reference data given as input
+ */
+template< unsigned int NumberOfIndependentVariables >
+boost::shared_ptr< AerodynamicCoefficientSettings >
+readGivenSizeTabulatedAerodynamicCoefficientsFromBinaryFiles(
+        const std::string& forceCoefficientFile,
+        const std::string& momentCoefficientFile,
+        const double referenceLength,
+        const double referenceArea,
+        const double lateralReferenceLength,
+        const Eigen::Vector3d& momentReferencePoint,
+        const std::vector< aerodynamics::AerodynamicCoefficientsIndependentVariables > independentVariableNames,
+        const bool areCoefficientsInAerodynamicFrame = 1,
+        const bool areCoefficientsInNegativeAxisDirection = 1 )
+{
+    typedef input_output::MappedBinaryCoefficientTable< NumberOfIndependentVariables, 3 > CoefficientTable;
+
+    // Check input consistency
+    if( independentVariableNames.size( ) != NumberOfIndependentVariables )
+    {
+        throw std::runtime_error( "Error when creating aerodynamic coefficient settings from binary file, input sizes are inconsistent" );
+    }
+
+    // Map coefficient files into memory.
+    boost::shared_ptr< CoefficientTable > forceCoefficientTable =
+            boost::make_shared< CoefficientTable >( forceCoefficientFile );
+    boost::shared_ptr< CoefficientTable > momentCoefficientTable;
+    if( momentCoefficientFile != "" )
+    {
+        momentCoefficientTable = boost::make_shared< CoefficientTable >( momentCoefficientFile );
+    }
+
+    // Create coefficient settings.
+    return boost::make_shared< TabulatedAerodynamicCoefficientSettings< NumberOfIndependentVariables > >(
+                forceCoefficientTable, momentCoefficientTable, referenceLength, referenceArea, lateralReferenceLength,
+                momentReferencePoint, independentVariableNames, areCoefficientsInAerodynamicFrame,
+                areCoefficientsInNegativeAxisDirection );
+}
+
+//! Function to create aerodynamic coefficient settings from coefficients stored in binary coefficient table files
+/*!
+ *  Function to create aerodynamic coefficient settings from coefficients stored in binary coefficient table files (as
+ *  written by input_output::writeCoefficientTableToBinaryFile, with 3 coefficients per entry), with the number of
+ *  independent variables (2 or 3) retrieved from the force coefficient file. See
+ *  readGivenSizeTabulatedAerodynamicCoefficientsFromBinaryFiles.
+ *  \param forceCoefficientFile Binary coefficient table file containing the aerodynamic force coefficients
+ *  \param momentCoefficientFile Binary coefficient table file containing the aerodynamic moment coefficients (moment
+ *  coefficients are set to zero if empty)
+ *  \param referenceLength Reference length with which aerodynamic moments
+ *  (about x- and z- axes) are non-dimensionalized.
+ *  \param referenceArea Reference area with which aerodynamic forces and moments are
+ *  non-dimensionalized.
+ *  \param lateralReferenceLength Reference length with which aerodynamic moments (about y-axis)
+ *  is non-dimensionalized.
+ *  \param momentReferencePoint Point w.r.t. aerodynamic moment is calculated
+ *  \param independentVariableNames Physical meaning of the independent variables of the aerodynamic coefficients
+ *  \param areCoefficientsInAerodynamicFrame Boolean to define whether the aerodynamic
+ *  coefficients are defined in the aerodynamic frame (lift, drag, side force) or in the body
+ *  frame (typically denoted as Cx, Cy, Cz).
+ *  \param areCoefficientsInNegativeAxisDirection Boolean to define whether the aerodynamic
+ *  coefficients are positive along the positive axes of the body or aerodynamic frame
+ *  (see areCoefficientsInAerodynamicFrame). Note that for (lift, drag, side force), the
+ *  coefficients are typically defined in negative direction.
+ *  \return Settings for creation of aerodynamic coefficient interface, based on the tables in the files
+ *  and reference data given as input
+ */
+boost::shared_ptr< AerodynamicCoefficientSettings > readTabulatedAerodynamicCoefficientsFromBinaryFiles(
+        const std::string& forceCoefficientFile,
+        const std::string& momentCoefficientFile,
+        const double referenceLength,
+        const double referenceArea,
+        const double lateralReferenceLength,
+        const Eigen::Vector3d& momentReferencePoint,
+        const std::vector< aerodynamics::AerodynamicCoefficientsIndependentVariables > independentVariableNames,
+        const bool areCoefficientsInAerodynamicFrame = 1,
+        const bool areCoefficientsInNegativeAxisDirection = 1 );
 
 //! Function to create an aerodynamic coefficient interface containing constant coefficients.
 /*!
@@ -983,6 +1217,8 @@ createConstantCoefficientAerodynamicCoefficientInterface(
  *  coefficients are positive along the positive axes of the body or aerodynamic frame
  *  (see areCoefficientsInAerodynamicFrame). Note that for (lift, drag, side force), the
  *  coefficients are typically defined in negative direction.
+ *  \param interpolationSettings Settings to be used for creating the multi-dimensional interpolator of the
+ *  coefficients (multi-linear interpolation by default, see createMultiDimensionalInterpolator).
  *  \return Tabulated aerodynamic coefficient interface pointer.
  */
 template< unsigned int NumberOfDimensions >
@@ -998,7 +1234,9 @@ createTabulatedCoefficientAerodynamicCoefficientInterface(
         const double lateralReferenceLength,
         const Eigen::Vector3d& momentReferencePoint,
         const bool areCoefficientsInAerodynamicFrame = 0,
-        const bool areCoefficientsInNegativeAxisDirection = 1 )
+        const bool areCoefficientsInNegativeAxisDirection = 1,
+        const boost::shared_ptr< interpolators::InterpolatorSettings > interpolationSettings =
+        boost::make_shared< interpolators::InterpolatorSettings >( interpolators::linear_interpolator ) )
 {
     // Check input consistency.
     if( independentVariables.size( ) != NumberOfDimensions )
@@ -1013,25 +1251,19 @@ createTabulatedCoefficientAerodynamicCoefficientInterface(
     }
 
     // Create interpolators for coefficients.
-    boost::shared_ptr< interpolators::MultiLinearInterpolator
-            < double, Eigen::Vector3d, NumberOfDimensions > > forceInterpolator =
-            boost::make_shared< interpolators::MultiLinearInterpolator
-            < double, Eigen::Vector3d, NumberOfDimensions > >(
-                independentVariables, forceCoefficients );
-    boost::shared_ptr< interpolators::MultiLinearInterpolator
-            < double, Eigen::Vector3d, NumberOfDimensions > > momentInterpolator =
-            boost::make_shared< interpolators::MultiLinearInterpolator
-            < double, Eigen::Vector3d, NumberOfDimensions > >(
-                independentVariables, momentCoefficients );
-
-    // Create aerodynamic coefficient interface.
+    boost::shared_ptr< interpolators::Interpolator< double, Eigen::Vector3d > > forceInterpolator =
+            interpolators::createMultiDimensionalInterpolator< double, Eigen::Vector3d, NumberOfDimensions >(
+                independentVariables, forceCoefficients, interpolationSettings );
+    boost::shared_ptr< interpolators::Interpolator< double, Eigen::Vector3d > > momentInterpolator =
+            interpolators::createMultiDimensionalInterpolator< double, Eigen::Vector3d, NumberOfDimensions >(
+                independentVariables, momentCoefficients, interpolationSettings );
+
+    // Create aerodynamic coefficient interface, evaluating the interpolators through their fixed-size array interface.
     return  boost::make_shared< aerodynamics::CustomAerodynamicCoefficientInterface >(
-                boost::bind( &interpolators::MultiLinearInterpolator
-                             < double, Eigen::Vector3d, NumberOfDimensions >::interpolate,
-                             forceInterpolator, _1 ),
-                boost::bind( &interpolators::MultiLinearInterpolator
-                             < double, Eigen::Vector3d, NumberOfDimensions >::interpolate,
-                             momentInterpolator, _1 ),
+                interpolators::createMultiDimensionalInterpolationFunction< double, Eigen::Vector3d, NumberOfDimensions >(
+                    forceInterpolator ),
+                interpolators::createMultiDimensionalInterpolationFunction< double, Eigen::Vector3d, NumberOfDimensions >(
+                    momentInterpolator ),
                 referenceLength, referenceArea, lateralReferenceLength, momentReferencePoint,
                 independentVariableNames,
                 areCoefficientsInAerodynamicFrame, areCoefficientsInNegativeAxisDirection );
@@ -1077,6 +1309,42 @@ createTabulatedCoefficientAerodynamicCoefficientInterface(
                     "Error, expected tabulated aerodynamic coefficients of size " +
                     boost::lexical_cast<  std::string >( NumberOfDimensions ) + "for body " + body );
     }
+    else if( tabulatedCoefficientSettings->getForceCoefficientTable( ) != NULL )
+    {
+        // Create interpolators directly on memory-mapped coefficient tables.
+        boost::shared_ptr< interpolators::Interpolator< double, Eigen::Vector3d > > forceInterpolator =
+                input_output::createInterpolatorFromBinaryCoefficientTable< NumberOfDimensions, 3 >(
+                    tabulatedCoefficientSettings->getForceCoefficientTable( ),
+                    tabulatedCoefficientSettings->getInterpolationSettings( ) );
+        boost::shared_ptr< interpolators::Interpolator< double, Eigen::Vector3d > > momentInterpolator;
+        if( tabulatedCoefficientSettings->getMomentCoefficientTable( ) != NULL )
+        {
+            momentInterpolator = input_output::createInterpolatorFromBinaryCoefficientTable< NumberOfDimensions, 3 >(
+                        tabulatedCoefficientSettings->getMomentCoefficientTable( ),
+                        tabulatedCoefficientSettings->getInterpolationSettings( ) );
+        }
+        else
+        {
+            momentInterpolator =
+                    interpolators::createMultiDimensionalInterpolator< double, Eigen::Vector3d, NumberOfDimensions >(
+                        tabulatedCoefficientSettings->getIndependentVariables( ),
+                        tabulatedCoefficientSettings->getMomentCoefficients( ),
+                        tabulatedCoefficientSettings->getInterpolationSettings( ) );
+        }
+
+        return boost::make_shared< aerodynamics::CustomAerodynamicCoefficientInterface >(
+                    interpolators::createMultiDimensionalInterpolationFunction< double, Eigen::Vector3d, NumberOfDimensions >(
+                        forceInterpolator ),
+                    interpolators::createMultiDimensionalInterpolationFunction< double, Eigen::Vector3d, NumberOfDimensions >(
+                        momentInterpolator ),
+                    tabulatedCoefficientSettings->getReferenceLength( ),
+                    tabulatedCoefficientSettings->getReferenceArea( ),
+                    tabulatedCoefficientSettings->getLateralReferenceLength( ),
+                    tabulatedCoefficientSettings->getMomentReferencePoint( ),
+                    tabulatedCoefficientSettings->getIndependentVariableNames( ),
+                    tabulatedCoefficientSettings->getAreCoefficientsInAerodynamicFrame( ),
+                    tabulatedCoefficientSettings->getAreCoefficientsInNegativeAxisDirection( ) );
+    }
     else
     {
         return createTabulatedCoefficientAerodynamicCoefficientInterface< NumberOfDimensions >(
@@ -1089,7 +1357,8 @@ createTabulatedCoefficientAerodynamicCoefficientInterface(
                     tabulatedCoefficientSettings->getReferenceLength( ),
                     tabulatedCoefficientSettings->getMomentReferencePoint( ),
                     tabulatedCoefficientSettings->getAreCoefficientsInAerodynamicFrame( ),
-                    tabulatedCoefficientSettings->getAreCoefficientsInNegativeAxisDirection( ) );
+                    tabulatedCoefficientSettings->getAreCoefficientsInNegativeAxisDirection( ),
+                    tabulatedCoefficientSettings->getInterpolationSettings( ) );
     }
 }
 
@@ -18,6 +18,7 @@
 
 #include "Tudat/InputOutput/aerodynamicCoefficientReader.h"
 #include "Tudat/Astrodynamics/Aerodynamics/controlSurfaceAerodynamicCoefficientInterface.h"
+#include "Tudat/Mathematics/Interpolators/createInterpolator.h"
 #include "Tudat/Mathematics/Interpolators/multiLinearInterpolator.h"
 
 namespace tudat
@@ -392,13 +393,14 @@ createTabulatedControlSurfaceIncrementAerodynamicCoefficientInterface(
             < double, Eigen::Vector3d, NumberOfDimensions > >(
                 independentVariables, momentCoefficients );
 
-    // Create aerodynamic coefficient interface.
+    // Create aerodynamic coefficient interface, evaluating the interpolators through their fixed-size array interface.
+    typedef interpolators::MultiLinearInterpolator< double, Eigen::Vector3d, NumberOfDimensions > CoefficientInterpolator;
     return  boost::make_shared< aerodynamics::CustomControlSurfaceIncrementAerodynamicInterface >(
-                boost::bind( &interpolators::MultiLinearInterpolator
-                             < double, Eigen::Vector3d, NumberOfDimensions >::interpolate,
+                boost::bind( &interpolators::interpolateWithFixedSizeInput
+                             < CoefficientInterpolator, double, Eigen::Vector3d, NumberOfDimensions >,
                              forceInterpolator, _1 ),
-                boost::bind( &interpolators::MultiLinearInterpolator
-                             < double, Eigen::Vector3d, NumberOfDimensions >::interpolate,
+                boost::bind( &interpolators::interpolateWithFixedSizeInput
+                             < CoefficientInterpolator, double, Eigen::Vector3d, NumberOfDimensions >,
                              momentInterpolator, _1 ),
                 independentVariableNames );
 }
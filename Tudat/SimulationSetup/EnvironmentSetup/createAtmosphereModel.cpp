@@ -17,6 +17,7 @@
 #if USE_NRLMSISE00
 #include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00Atmosphere.h"
 #include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00InputFunctions.h"
+#include "Tudat/Astrodynamics/Aerodynamics/tabulatedNRLMSISE00Atmosphere.h"
 #endif
 #include "Tudat/InputOutput/basicInputOutput.h"
 #include "Tudat/InputOutput/solarActivityData.h"
@@ -88,13 +89,34 @@ boost::shared_ptr< aerodynamics::AtmosphereModel > createAtmosphereModel(
         std::string folder = input_output::getTudatRootPath( ) + "Astrodynamics/Aerodynamics/";
         std::string spaceWeatherFilePath = folder + "sw19571001.txt";
 
-        tudat::input_output::solar_activity::SolarActivityDataMap solarActivityData =
-                tudat::input_output::solar_activity::readSolarActivityData( spaceWeatherFilePath ) ;
+        // Create atmosphere model using day-indexed NRLMISE00 input table
+        boost::shared_ptr< tudat::aerodynamics::NRLMSISE00InputTable > inputTable =
+                tudat::aerodynamics::readNRLMSISE00InputTable( spaceWeatherFilePath );
+        atmosphereModel = boost::make_shared< aerodynamics::NRLMSISE00Atmosphere >( inputTable );
+        break;
+    }
+    case tabulated_nrlmsise00:
+    {
+        // Check whether settings for atmosphere are consistent with its type
+        boost::shared_ptr< TabulatedNRLMSISE00AtmosphereSettings > tabulatedNrlmsiseSettings =
+                boost::dynamic_pointer_cast< TabulatedNRLMSISE00AtmosphereSettings >( atmosphereSettings );
+        if( tabulatedNrlmsiseSettings == NULL )
+        {
+            throw std::runtime_error(
+                        "Error, expected tabulated NRLMSISE00 atmosphere settings for body " + body );
+        }
+
+        std::string folder = input_output::getTudatRootPath( ) + "Astrodynamics/Aerodynamics/";
+        std::string spaceWeatherFilePath = folder + "sw19571001.txt";
 
-        // Create atmosphere model using NRLMISE00 input function
-        boost::function< tudat::aerodynamics::NRLMSISE00Input (double,double,double,double) > inputFunction =
-                boost::bind(&tudat::aerodynamics::nrlmsiseInputFunction,_1,_2,_3,_4, solarActivityData , false , TUDAT_NAN );
-        atmosphereModel = boost::make_shared< aerodynamics::NRLMSISE00Atmosphere >( inputFunction );
+        // Create tabulated atmosphere model, generated from NRLMSISE00 model using day-indexed input table (if
+        // tabulated properties can not be read from file).
+        boost::shared_ptr< tudat::aerodynamics::NRLMSISE00InputTable > inputTable =
+                tudat::aerodynamics::readNRLMSISE00InputTable( spaceWeatherFilePath );
+        atmosphereModel = aerodynamics::createTabulatedNRLMSISE00Atmosphere(
+                    inputTable, tabulatedNrlmsiseSettings->getIndependentVariables( ),
+                    tabulatedNrlmsiseSettings->getTabulatedPropertiesFile( ),
+                    tabulatedNrlmsiseSettings->getInterpolatorSettings( ) );
         break;
     }
 #endif
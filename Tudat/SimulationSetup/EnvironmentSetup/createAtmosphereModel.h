@@ -12,10 +12,13 @@
 #define TUDAT_CREATEATMOSPHEREMODEL_H
 
 #include <string>
+#include <vector>
 
+#include <boost/make_shared.hpp>
 #include <boost/shared_ptr.hpp>
 
 #include "Tudat/Astrodynamics/Aerodynamics/atmosphereModel.h"
+#include "Tudat/Mathematics/Interpolators/createInterpolator.h"
 
 namespace tudat
 {
@@ -32,7 +35,8 @@ enum AtmosphereTypes
 {
     exponential_atmosphere,
     tabulated_atmosphere,
-    nrlmsise00
+    nrlmsise00,
+    tabulated_nrlmsise00
 };
 
 //! Class for providing settings for atmosphere model.
@@ -168,6 +172,74 @@ private:
     std::string atmosphereFile_;
 };
 
+//! AtmosphereSettings for defining an atmosphere interpolated from tabulated NRLMSISE00 properties.
+class TabulatedNRLMSISE00AtmosphereSettings: public AtmosphereSettings
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param altitudes Altitudes [m] at which NRLMSISE00 properties are tabulated.
+     *  \param latitudes Latitudes [rad] at which NRLMSISE00 properties are tabulated.
+     *  \param localSolarTimes Local solar times [hours] at which NRLMSISE00 properties are tabulated (should cover
+     *  the interval [0,24]).
+     *  \param days Days (in Julian days since J2000) at which NRLMSISE00 properties are tabulated.
+     *  \param tabulatedPropertiesFile File from which tabulated properties are read if it contains properties
+     *  tabulated on the same grid from the same solar activity data, and to which they are written otherwise (not used
+     *  if empty).
+     *  \param interpolatorSettings Settings for the multi-dimensional interpolator of the tabulated properties.
+     */
+    TabulatedNRLMSISE00AtmosphereSettings(
+            const std::vector< double >& altitudes,
+            const std::vector< double >& latitudes,
+            const std::vector< double >& localSolarTimes,
+            const std::vector< double >& days,
+            const std::string& tabulatedPropertiesFile = "",
+            const boost::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings =
+            boost::make_shared< interpolators::InterpolatorSettings >( interpolators::linear_interpolator ) ):
+        AtmosphereSettings( tabulated_nrlmsise00 ), tabulatedPropertiesFile_( tabulatedPropertiesFile ),
+        interpolatorSettings_( interpolatorSettings )
+    {
+        independentVariables_.push_back( altitudes );
+        independentVariables_.push_back( latitudes );
+        independentVariables_.push_back( localSolarTimes );
+        independentVariables_.push_back( days );
+    }
+
+    //! Function to return grid points of altitude, latitude, local solar time and day, respectively.
+    /*!
+     *  Function to return grid points of altitude, latitude, local solar time and day, respectively.
+     *  \return Grid points of altitude, latitude, local solar time and day, respectively.
+     */
+    std::vector< std::vector< double > > getIndependentVariables( ){ return independentVariables_; }
+
+    //! Function to return file from/to which tabulated properties are read/written.
+    /*!
+     *  Function to return file from/to which tabulated properties are read/written.
+     *  \return File from/to which tabulated properties are read/written.
+     */
+    std::string getTabulatedPropertiesFile( ){ return tabulatedPropertiesFile_; }
+
+    //! Function to return settings for the multi-dimensional interpolator of the tabulated properties.
+    /*!
+     *  Function to return settings for the multi-dimensional interpolator of the tabulated properties.
+     *  \return Settings for the multi-dimensional interpolator of the tabulated properties.
+     */
+    boost::shared_ptr< interpolators::InterpolatorSettings > getInterpolatorSettings( ){ return interpolatorSettings_; }
+
+private:
+
+    //! Grid points of altitude, latitude, local solar time and day, respectively.
+    std::vector< std::vector< double > > independentVariables_;
+
+    //! File from/to which tabulated properties are read/written.
+    std::string tabulatedPropertiesFile_;
+
+    //! Settings for the multi-dimensional interpolator of the tabulated properties.
+    boost::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings_;
+};
+
 //! Function to create an atmosphere model.
 /*!
  *  Function to create an atmosphere model based on model-specific settings for the atmosphere.
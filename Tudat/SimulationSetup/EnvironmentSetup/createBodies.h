@@ -89,21 +89,31 @@ NamedBodyMap createBodies(
  * sets the ephemerisFrameToBaseFrameFunction_ anf ephemerisFrameToBaseFrameLongFunction_ variables
  * of the Body objects, which provide a time-dependent translation of the global origin to the
  * body's ephemeris origin. In case of an inconsistency in the current and requried frames, this
- * function throws an error.
+ * function throws an error. Optionally, the most recently computed state of each ephemeris origin is
+ * memoized, in an object shared by all bodies with that origin. The memoized states are recomputed
+ * after any call to Body::setEphemeris, but the resetCachedBaseFrameStates function must be called
+ * whenever an existing ephemeris object of any of the bodies is modified (e.g. by
+ * ConstantEphemeris::updateConstantState).
  * \param bodyMap List of body objects that constitute the environment.
  * \param globalFrameOrigin Global reference frame origin.
  * \param globalFrameOrientation Global referencef frame orientation.
+ * \param memoizeBaseFrameStates Boolean denoting whether the states of the ephemeris origins are to be memoized
+ * (default false).
  */
 template< typename StateScalarType = double, typename TimeType = double >
 void setGlobalFrameBodyEphemerides( const NamedBodyMap& bodyMap,
                                     const std::string& globalFrameOrigin,
-                                    const std::string& globalFrameOrientation )
+                                    const std::string& globalFrameOrientation,
+                                    const bool memoizeBaseFrameStates = false )
 {
     using namespace tudat::simulation_setup;
     std::string ephemerisFrameOrigin;
     std::string ephemerisFrameOrientation;
     std::string rotationModelFrame;
 
+    // List of objects memoizing the states of ephemeris origins, shared by all bodies with the same origin.
+    std::map< std::string, boost::shared_ptr< BaseStateInterface > > memoizedBaseStateInterfaces;
+
     // Iterate over all bodies
     for( NamedBodyMap::const_iterator bodyIterator = bodyMap.begin( );
          bodyIterator != bodyMap.end( ); bodyIterator++ )
@@ -127,12 +137,31 @@ void setGlobalFrameBodyEphemerides( const NamedBodyMap& bodyMap,
                 }
                 else
                 {
-                    boost::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > stateFunction =
-                            boost::bind( &Body::getStateInBaseFrameFromEphemeris< StateScalarType, TimeType >,
-                                         bodyMap.at( ephemerisFrameOrigin ), _1 );
-
-                    boost::shared_ptr< BaseStateInterface > baseStateInterface = boost::make_shared< BaseStateInterfaceImplementation< double, double > >(
-                                ephemerisFrameOrigin, stateFunction );
+                    boost::shared_ptr< BaseStateInterface > baseStateInterface;
+                    if( !memoizeBaseFrameStates )
+                    {
+                        boost::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > stateFunction =
+                                boost::bind( &Body::getStateInBaseFrameFromEphemeris< StateScalarType, TimeType >,
+                                             bodyMap.at( ephemerisFrameOrigin ), _1 );
+
+                        baseStateInterface = boost::make_shared< BaseStateInterfaceImplementation< double, double > >(
+                                    ephemerisFrameOrigin, stateFunction );
+                    }
+                    // Compute memoized state of ephemeris origin from current ephemeris of origin body.
+                    else if( memoizedBaseStateInterfaces.count( ephemerisFrameOrigin ) == 0 )
+                    {
+                        boost::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > stateFunction =
+                                boost::bind( &Body::computeStateInBaseFrameFromEphemeris< StateScalarType, TimeType >,
+                                             bodyMap.at( ephemerisFrameOrigin ), _1 );
+
+                        baseStateInterface = boost::make_shared< BaseStateInterfaceImplementation< double, double > >(
+                                    ephemerisFrameOrigin, stateFunction, true );
+                        memoizedBaseStateInterfaces[ ephemerisFrameOrigin ] = baseStateInterface;
+                    }
+                    else
+                    {
+                        baseStateInterface = memoizedBaseStateInterfaces.at( ephemerisFrameOrigin );
+                    }
 
                     bodyIterator->second->setEphemerisFrameToBaseFrame( baseStateInterface );
                 }
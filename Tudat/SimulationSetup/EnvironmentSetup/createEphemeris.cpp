@@ -8,6 +8,11 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <limits>
+#include <sstream>
+
+#include <boost/bind.hpp>
+#include <boost/filesystem.hpp>
 #include <boost/lambda/lambda.hpp>
 #include <boost/lexical_cast.hpp>
 
@@ -15,6 +20,7 @@
 #include "Tudat/External/SpiceInterface/spiceEphemeris.h"
 #endif
 
+#include "Tudat/Astrodynamics/Ephemerides/chebyshevEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/keplerEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/tabulatedEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/approximatePlanetPositions.h"
@@ -31,6 +37,81 @@ namespace simulation_setup
 
 using namespace ephemerides;
 
+#if USE_CSPICE
+//! Function to create the key identifying the data of a tabulated ephemeris created from Spice.
+std::string getTabulatedSpiceEphemerisCacheKey(
+        const std::string& body,
+        const long double initialTime,
+        const long double endTime,
+        const long double timeStep,
+        const std::string& observerName,
+        const std::string& referenceFrameName,
+        const boost::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings )
+{
+    std::ostringstream keyStream;
+    keyStream.precision( std::numeric_limits< long double >::digits10 + 3 );
+
+    // Add body, frame and time settings.
+    keyStream << "body=" << body << ";origin=" << observerName << ";frame=" << referenceFrameName
+              << ";initialTime=" << initialTime << ";endTime=" << endTime << ";timeStep=" << timeStep;
+
+    // Add interpolator settings.
+    if( interpolatorSettings != NULL )
+    {
+        keyStream << ";interpolator=" << interpolatorSettings->getInterpolatorType( )
+                  << "," << interpolatorSettings->getSelectedLookupScheme( )
+                  << "," << interpolatorSettings->getUseLongDoubleTimeStep( );
+        boost::shared_ptr< interpolators::LagrangeInterpolatorSettings > lagrangeInterpolatorSettings =
+                boost::dynamic_pointer_cast< interpolators::LagrangeInterpolatorSettings >( interpolatorSettings );
+        if( lagrangeInterpolatorSettings != NULL )
+        {
+            keyStream << "," << lagrangeInterpolatorSettings->getInterpolatorOrder( )
+                      << "," << lagrangeInterpolatorSettings->getBoundaryHandling( );
+        }
+        boost::shared_ptr< interpolators::CartesianStateHermiteInterpolatorSettings > hermiteInterpolatorSettings =
+                boost::dynamic_pointer_cast< interpolators::CartesianStateHermiteInterpolatorSettings >(
+                    interpolatorSettings );
+        if( hermiteInterpolatorSettings != NULL )
+        {
+            keyStream << "," << hermiteInterpolatorSettings->getNumberOfNodes( );
+        }
+    }
+
+    // Add loaded kernels (with file size and modification time, so that modified kernels are detected).
+    std::vector< std::string > kernelFileNames = spice_interface::getLoadedSpiceKernels( );
+    for( unsigned int i = 0; i < kernelFileNames.size( ); i++ )
+    {
+        keyStream << ";kernel=" << kernelFileNames.at( i );
+        if( boost::filesystem::is_regular_file( kernelFileNames.at( i ) ) )
+        {
+            keyStream << "," << boost::filesystem::file_size( kernelFileNames.at( i ) )
+                      << "," << boost::filesystem::last_write_time( kernelFileNames.at( i ) );
+        }
+    }
+
+    return keyStream.str( );
+}
+
+//! Function to create a piecewise Chebyshev ephemeris using data from Spice.
+boost::shared_ptr< ephemerides::Ephemeris > createChebyshevEphemerisFromSpice(
+        const std::string& body,
+        const double initialTime,
+        const double endTime,
+        const double maximumBlockLength,
+        const unsigned int maximumPolynomialDegree,
+        const double positionTolerance,
+        const double velocityTolerance,
+        const std::string& observerName,
+        const std::string& referenceFrameName )
+{
+    return fitChebyshevEphemeris(
+                boost::bind( &spice_interface::getBodyCartesianStateAtEpoch,
+                             body, observerName, referenceFrameName, "none", _1 ),
+                initialTime, endTime, maximumBlockLength, maximumPolynomialDegree,
+                positionTolerance, velocityTolerance, observerName, referenceFrameName );
+}
+#endif
+
 //! Function to create a ephemeris model.
 boost::shared_ptr< ephemerides::Ephemeris > createBodyEphemeris(
         const boost::shared_ptr< EphemerisSettings > ephemerisSettings,
@@ -63,6 +144,21 @@ boost::shared_ptr< ephemerides::Ephemeris > createBodyEphemeris(
                         directEphemerisSettings->getCorrectForLightTimeAbberation( ),
                         directEphemerisSettings->getConvergeLighTimeAbberation( ),
                         directEphemerisSettings->getFrameOrientation( ) );
+
+            // Presample Spice ephemeris into immutable Chebyshev ephemeris, if required.
+            if( directEphemerisSettings->getUsePresampledThreadSafeAccess( ) )
+            {
+                ephemeris = fitChebyshevEphemeris(
+                            boost::bind( &Ephemeris::getCartesianState, ephemeris, _1 ),
+                            directEphemerisSettings->getPresamplingInitialTime( ),
+                            directEphemerisSettings->getPresamplingFinalTime( ),
+                            directEphemerisSettings->getPresamplingMaximumBlockLength( ),
+                            directEphemerisSettings->getPresamplingMaximumPolynomialDegree( ),
+                            directEphemerisSettings->getPresamplingPositionTolerance( ),
+                            directEphemerisSettings->getPresamplingVelocityTolerance( ),
+                            directEphemerisSettings->getFrameOrigin( ),
+                            directEphemerisSettings->getFrameOrientation( ) );
+            }
         }
         break;
     }
@@ -102,7 +198,8 @@ boost::shared_ptr< ephemerides::Ephemeris > createBodyEphemeris(
                         interpolatedEphemerisSettings->getTimeStep( ),
                         interpolatedEphemerisSettings->getFrameOrigin( ),
                         interpolatedEphemerisSettings->getFrameOrientation( ),
-                        interpolatedEphemerisSettings->getInterpolatorSettings( ) );
+                        interpolatedEphemerisSettings->getInterpolatorSettings( ),
+                        interpolatedEphemerisSettings->getCacheDirectory( ) );
             }
             else
             {
@@ -113,7 +210,8 @@ boost::shared_ptr< ephemerides::Ephemeris > createBodyEphemeris(
                         static_cast< long double >( interpolatedEphemerisSettings->getTimeStep( ) ),
                         interpolatedEphemerisSettings->getFrameOrigin( ),
                         interpolatedEphemerisSettings->getFrameOrientation( ),
-                        interpolatedEphemerisSettings->getInterpolatorSettings( ) );
+                        interpolatedEphemerisSettings->getInterpolatorSettings( ),
+                        interpolatedEphemerisSettings->getCacheDirectory( ) );
             }
         }
         break;
@@ -135,36 +233,71 @@ boost::shared_ptr< ephemerides::Ephemeris > createBodyEphemeris(
             if( !tabulatedEphemerisSettings->getUseLongDoubleStates( ) )
             {
                 ephemeris = boost::make_shared< TabulatedCartesianEphemeris< > >(
-                            boost::make_shared<
-                            interpolators::LagrangeInterpolator< double, Eigen::Vector6d > >
-                            ( tabulatedEphemerisSettings->getBodyStateHistory( ), 6,
-                              interpolators::huntingAlgorithm,
-                              interpolators::lagrange_cubic_spline_boundary_interpolation ),
+                            createTabulatedEphemerisInterpolator< double >( tabulatedEphemerisSettings ),
                             tabulatedEphemerisSettings->getFrameOrigin( ),
                             tabulatedEphemerisSettings->getFrameOrientation( ) );
             }
             else
             {
-                // Cast input history to required type.
-                std::map< double, Eigen::Vector6d > originalStateHistory =
-                        tabulatedEphemerisSettings->getBodyStateHistory( );
-                std::map< double, Eigen::Matrix< long double, 6, 1 > > longStateHistory;
-
-                for( std::map< double, Eigen::Vector6d >::const_iterator stateIterator =
-                     originalStateHistory.begin( ); stateIterator != originalStateHistory.end( ); stateIterator++ )
-                {
-                    longStateHistory[ stateIterator->first ] = stateIterator->second.cast< long double >( );
-                    ephemeris =
-                            boost::make_shared< TabulatedCartesianEphemeris< long double, double > >(
-                                boost::make_shared< interpolators::LagrangeInterpolator<
-                                double, Eigen::Matrix< long double, 6, 1 > > >
-                                ( longStateHistory, 6,
-                                  interpolators::huntingAlgorithm,
-                                  interpolators::lagrange_cubic_spline_boundary_interpolation ),
-                                tabulatedEphemerisSettings->getFrameOrigin( ),
-                                tabulatedEphemerisSettings->getFrameOrientation( ) );
-                }
+                ephemeris = boost::make_shared< TabulatedCartesianEphemeris< long double, double > >(
+                            createTabulatedEphemerisInterpolator< long double >( tabulatedEphemerisSettings ),
+                            tabulatedEphemerisSettings->getFrameOrigin( ),
+                            tabulatedEphemerisSettings->getFrameOrientation( ) );
+            }
+        }
+        break;
+    }
+    case chebyshev_ephemeris:
+    {
+        // Check consistency of type and class.
+        boost::shared_ptr< ChebyshevEphemerisSettings > chebyshevEphemerisSettings =
+                boost::dynamic_pointer_cast< ChebyshevEphemerisSettings >( ephemerisSettings );
+        if( chebyshevEphemerisSettings == NULL )
+        {
+            throw std::runtime_error( "Error, expected Chebyshev ephemeris settings for " + bodyName );
+        }
+        else if( chebyshevEphemerisSettings->getBodyStateHistory( ).size( ) > 0 )
+        {
+            // Fit ephemeris to given state history
+            ephemeris = fitChebyshevEphemerisToStateHistory(
+                        chebyshevEphemerisSettings->getBodyStateHistory( ),
+                        chebyshevEphemerisSettings->getMaximumBlockLength( ),
+                        chebyshevEphemerisSettings->getMaximumPolynomialDegree( ),
+                        chebyshevEphemerisSettings->getPositionTolerance( ),
+                        chebyshevEphemerisSettings->getVelocityTolerance( ),
+                        chebyshevEphemerisSettings->getFrameOrigin( ),
+                        chebyshevEphemerisSettings->getFrameOrientation( ) );
+        }
+        else
+        {
+#if USE_CSPICE
+            // Since only the barycenters of planetary systems are included in the standard DE
+            // ephemerides, append 'Barycenter' to body name.
+            std::string inputName = bodyName;
+            if( bodyName == "Mars" ||
+                    bodyName == "Jupiter"  || bodyName == "Saturn" ||
+                    bodyName == "Uranus" || bodyName == "Neptune" )
+            {
+                inputName += " Barycenter";
+                std::cerr<<"Warning, position of "<<bodyName<<" taken as barycenter of that body's "
+                        <<"planetary system."<<std::endl;
             }
+
+            // Fit ephemeris to Spice data
+            ephemeris = createChebyshevEphemerisFromSpice(
+                        inputName,
+                        chebyshevEphemerisSettings->getInitialTime( ),
+                        chebyshevEphemerisSettings->getFinalTime( ),
+                        chebyshevEphemerisSettings->getMaximumBlockLength( ),
+                        chebyshevEphemerisSettings->getMaximumPolynomialDegree( ),
+                        chebyshevEphemerisSettings->getPositionTolerance( ),
+                        chebyshevEphemerisSettings->getVelocityTolerance( ),
+                        chebyshevEphemerisSettings->getFrameOrigin( ),
+                        chebyshevEphemerisSettings->getFrameOrientation( ) );
+#else
+            throw std::runtime_error( "Error, Chebyshev ephemeris for " + bodyName +
+                                      " requires either a state history or Spice" );
+#endif
         }
         break;
     }
@@ -16,10 +16,13 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include "Tudat/InputOutput/binaryStateHistoryCache.h"
 #include "Tudat/InputOutput/matrixTextFileReader.h"
 #include "Tudat/Astrodynamics/Ephemerides/ephemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/tabulatedEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/chebyshevEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/approximatePlanetPositionsBase.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 #include "Tudat/Mathematics/Interpolators/createInterpolator.h"
 #include "Tudat/External/SpiceInterface/spiceInterface.h"
 
@@ -41,7 +44,8 @@ enum EphemerisType
     tabulated_ephemeris,
     interpolated_spice,
     constant_ephemeris,
-    kepler_ephemeris
+    kepler_ephemeris,
+    chebyshev_ephemeris
 };
 
 //! Class for providing settings for ephemeris model.
@@ -154,7 +158,11 @@ public:
         EphemerisSettings( ephemerisType, frameOrigin, frameOrientation ),
         correctForStellarAbberation_( correctForStellarAbberation ),
         correctForLightTimeAbberation_( correctForLightTimeAbberation ),
-        convergeLighTimeAbberation_( convergeLighTimeAbberation ){ }
+        convergeLighTimeAbberation_( convergeLighTimeAbberation ),
+        usePresampledThreadSafeAccess_( false ),
+        presamplingInitialTime_( TUDAT_NAN ), presamplingFinalTime_( TUDAT_NAN ),
+        presamplingMaximumBlockLength_( TUDAT_NAN ), presamplingMaximumPolynomialDegree_( 0 ),
+        presamplingPositionTolerance_( TUDAT_NAN ), presamplingVelocityTolerance_( TUDAT_NAN ){ }
 
 
     //! Destructor
@@ -183,6 +191,59 @@ public:
      *  calculating light time.
      */
     bool getConvergeLighTimeAbberation( ){ return convergeLighTimeAbberation_; }
+
+    //! Function to set the ephemeris to be presampled from Spice, for lock-free access from multiple threads.
+    /*!
+     *  Function to set the ephemeris to be presampled from Spice, for lock-free access from multiple threads. Since Spice
+     *  is not thread-safe, all calls to Spice are serialized (see spice_interface::getSpiceMutex), which prevents an
+     *  ephemeris linked directly to Spice to be efficiently used from multiple threads. Using this function, the Spice
+     *  states (with the requested aberration corrections) are instead sampled once when creating the ephemeris, and
+     *  fitted by piecewise Chebyshev polynomials (see ephemerides::ChebyshevEphemeris). The resulting ephemeris is
+     *  immutable, and can be evaluated concurrently by any number of threads without locking.
+     *  \param initialTime Start time of the presampled ephemeris.
+     *  \param finalTime End time of the presampled ephemeris.
+     *  \param maximumBlockLength Maximum length of each block in which a single set of polynomials is used.
+     *  \param maximumPolynomialDegree Maximum polynomial degree in each block.
+     *  \param positionTolerance Maximum error of each position component w.r.t. Spice.
+     *  \param velocityTolerance Maximum error of each velocity component w.r.t. Spice.
+     */
+    void setPresampledThreadSafeAccess( const double initialTime,
+                                        const double finalTime,
+                                        const double maximumBlockLength = 4.0 * 86400.0,
+                                        const unsigned int maximumPolynomialDegree = 12,
+                                        const double positionTolerance = 1.0E-2,
+                                        const double velocityTolerance = 1.0E-8 )
+    {
+        usePresampledThreadSafeAccess_ = true;
+        presamplingInitialTime_ = initialTime;
+        presamplingFinalTime_ = finalTime;
+        presamplingMaximumBlockLength_ = maximumBlockLength;
+        presamplingMaximumPolynomialDegree_ = maximumPolynomialDegree;
+        presamplingPositionTolerance_ = positionTolerance;
+        presamplingVelocityTolerance_ = velocityTolerance;
+    }
+
+    //! Returns whether the ephemeris is to be presampled from Spice, for lock-free access from multiple threads.
+    bool getUsePresampledThreadSafeAccess( ){ return usePresampledThreadSafeAccess_; }
+
+    //! Returns start time of the presampled ephemeris.
+    double getPresamplingInitialTime( ){ return presamplingInitialTime_; }
+
+    //! Returns end time of the presampled ephemeris.
+    double getPresamplingFinalTime( ){ return presamplingFinalTime_; }
+
+    //! Returns maximum length of each block of the presampled ephemeris.
+    double getPresamplingMaximumBlockLength( ){ return presamplingMaximumBlockLength_; }
+
+    //! Returns maximum polynomial degree in each block of the presampled ephemeris.
+    unsigned int getPresamplingMaximumPolynomialDegree( ){ return presamplingMaximumPolynomialDegree_; }
+
+    //! Returns maximum error of each position component of the presampled ephemeris.
+    double getPresamplingPositionTolerance( ){ return presamplingPositionTolerance_; }
+
+    //! Returns maximum error of each velocity component of the presampled ephemeris.
+    double getPresamplingVelocityTolerance( ){ return presamplingVelocityTolerance_; }
+
 protected:
 
     //! Boolean whether to correct for stellar abberation in retrieved values of (observed state).
@@ -193,6 +254,27 @@ protected:
 
     //! Boolean whether to use single iteration or max. 3 iterations for calculating light time.
     bool convergeLighTimeAbberation_;
+
+    //! Boolean whether the ephemeris is to be presampled from Spice, for lock-free access from multiple threads.
+    bool usePresampledThreadSafeAccess_;
+
+    //! Start time of the presampled ephemeris.
+    double presamplingInitialTime_;
+
+    //! End time of the presampled ephemeris.
+    double presamplingFinalTime_;
+
+    //! Maximum length of each block of the presampled ephemeris.
+    double presamplingMaximumBlockLength_;
+
+    //! Maximum polynomial degree in each block of the presampled ephemeris.
+    unsigned int presamplingMaximumPolynomialDegree_;
+
+    //! Maximum error of each position component of the presampled ephemeris.
+    double presamplingPositionTolerance_;
+
+    //! Maximum error of each velocity component of the presampled ephemeris.
+    double presamplingVelocityTolerance_;
 };
 
 //! EphemerisSettings derived class for defining settings of a ephemeris interpolated from Spice
@@ -231,7 +313,7 @@ public:
         DirectSpiceEphemerisSettings( frameOrigin, frameOrientation, 0, 0, 0,
                                       interpolated_spice ),
         initialTime_( initialTime ), finalTime_( finalTime ), timeStep_( timeStep ),
-        interpolatorSettings_( interpolatorSettings ), useLongDoubleStates_( 0 ){ }
+        interpolatorSettings_( interpolatorSettings ), useLongDoubleStates_( 0 ), cacheDirectory_( "" ){ }
 
     //! Function to return initial time from which interpolated data from Spice should be created.
     /*!
@@ -275,6 +357,29 @@ public:
         useLongDoubleStates_ = useLongDoubleStates;
     }
 
+    //! Function to return directory in which the data retrieved from Spice is cached (empty if no caching is used).
+    /*!
+     *  Function to return directory in which the data retrieved from Spice is cached (empty if no caching is used).
+     *  \return Directory in which the data retrieved from Spice is cached.
+     */
+    std::string getCacheDirectory( )
+    {
+        return cacheDirectory_;
+    }
+
+    //! Function to set directory in which the data retrieved from Spice is to be cached.
+    /*!
+     *  Function to set directory in which the data retrieved from Spice is to be cached. When set, the data is only
+     *  retrieved from Spice if no cache file exists for the body, frame, time interval, interpolator settings and
+     *  loaded Spice kernels (see createTabulatedEphemerisFromSpice).
+     *  \param cacheDirectory Directory in which the data retrieved from Spice is to be cached (empty if no caching is
+     *  to be used).
+     */
+    void setCacheDirectory( const std::string& cacheDirectory )
+    {
+        cacheDirectory_ = cacheDirectory;
+    }
+
 private:
 
     //! Initial time from which interpolated data from Spice should be created.
@@ -290,6 +395,9 @@ private:
     boost::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings_;
 
     bool useLongDoubleStates_;
+
+    //! Directory in which the data retrieved from Spice is cached (empty if no caching is used).
+    std::string cacheDirectory_;
 };
 
 //! EphemerisSettings derived class for defining settings of an approximate ephemeris for major
@@ -547,6 +655,52 @@ public:
         useLongDoubleStates_ = useLongDoubleStates;
     }
 
+    //! Function returning settings to be used for the state interpolation.
+    /*!
+     *  Function returning settings to be used for the state interpolation (NULL if default 6th order Lagrange
+     *  interpolator is to be used).
+     *  \return Settings to be used for the state interpolation.
+     */
+    boost::shared_ptr< interpolators::InterpolatorSettings > getInterpolatorSettings( )
+    {
+        return interpolatorSettings_;
+    }
+
+    //! Function to set settings to be used for the state interpolation.
+    /*!
+     *  Function to set settings to be used for the state interpolation. For instance, by using
+     *  CartesianStateHermiteInterpolatorSettings, the velocity (and acceleration, if an acceleration history is set)
+     *  are used as derivatives of the position, allowing a larger step size in the state history for the same
+     *  accuracy.
+     *  \param interpolatorSettings Settings to be used for the state interpolation.
+     */
+    void setInterpolatorSettings( const boost::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings )
+    {
+        interpolatorSettings_ = interpolatorSettings;
+    }
+
+    //! Function returning data map of accelerations at the epochs of the state history.
+    /*!
+     *  Function returning data map of accelerations at the epochs of the state history (empty if not set).
+     *  \return Data map of accelerations at the epochs of the state history.
+     */
+    std::map< double, Eigen::Vector3d > getBodyAccelerationHistory( )
+    {
+        return bodyAccelerationHistory_;
+    }
+
+    //! Function to set data map of accelerations at the epochs of the state history.
+    /*!
+     *  Function to set data map of accelerations at the epochs of the state history (for instance from the dependent
+     *  variables of a numerical propagation), used as derivatives of the velocities by interpolators that require
+     *  them (see setInterpolatorSettings).
+     *  \param bodyAccelerationHistory Data map of accelerations at the epochs of the state history.
+     */
+    void setBodyAccelerationHistory( const std::map< double, Eigen::Vector3d >& bodyAccelerationHistory )
+    {
+        bodyAccelerationHistory_ = bodyAccelerationHistory;
+    }
+
 private:
 
     //! Data map defining discrete data from which an ephemeris is to be created.
@@ -557,10 +711,151 @@ private:
     std::map< double, Eigen::Vector6d > bodyStateHistory_;
 
     bool useLongDoubleStates_;
+
+    //! Settings to be used for the state interpolation (NULL if default Lagrange interpolator is to be used).
+    boost::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings_;
+
+    //! Data map of accelerations at the epochs of the state history (empty if not used).
+    std::map< double, Eigen::Vector3d > bodyAccelerationHistory_;
+};
+
+//! EphemerisSettings derived class for defining settings of an ephemeris consisting of piecewise Chebyshev polynomials.
+/*!
+ *  EphemerisSettings derived class for defining settings of an ephemeris consisting of piecewise Chebyshev polynomials
+ *  (see ChebyshevEphemeris class), fitted to a required tolerance. Compared to the interpolated_spice and
+ *  tabulated_ephemeris settings, the resulting ephemeris typically requires much less memory for long time intervals,
+ *  and does not require a search for the interval in which the requested time lies. The polynomials are fitted either
+ *  to states retrieved from Spice (if no state history is provided), or to a given state history (for instance
+ *  resulting from a numerical propagation).
+ */
+class ChebyshevEphemerisSettings: public EphemerisSettings
+{
+public:
+
+    //! Constructor for fitting the polynomials to data from Spice.
+    /*!
+     *  Constructor for fitting the polynomials to data from Spice.
+     *  \param initialTime Start time of the ephemeris.
+     *  \param finalTime End time of the ephemeris.
+     *  \param maximumBlockLength Maximum length of each block in which a single set of polynomials is used.
+     *  \param maximumPolynomialDegree Maximum polynomial degree in each block.
+     *  \param positionTolerance Maximum error of each position component.
+     *  \param velocityTolerance Maximum error of each velocity component.
+     *  \param frameOrigin Name of body relative to which the ephemeris is to be calculated
+     *  (optional "SSB" by default).
+     *  \param frameOrientation Orientatioan of the reference frame in which the epehemeris is to be
+     *  calculated (optional "ECLIPJ2000" by default).
+     */
+    ChebyshevEphemerisSettings( const double initialTime,
+                                const double finalTime,
+                                const double maximumBlockLength = 4.0 * 86400.0,
+                                const unsigned int maximumPolynomialDegree = 12,
+                                const double positionTolerance = 1.0E-2,
+                                const double velocityTolerance = 1.0E-8,
+                                const std::string& frameOrigin = "SSB",
+                                const std::string& frameOrientation = "ECLIPJ2000" ):
+        EphemerisSettings( chebyshev_ephemeris, frameOrigin, frameOrientation ),
+        initialTime_( initialTime ), finalTime_( finalTime ), maximumBlockLength_( maximumBlockLength ),
+        maximumPolynomialDegree_( maximumPolynomialDegree ), positionTolerance_( positionTolerance ),
+        velocityTolerance_( velocityTolerance ){ }
+
+    //! Constructor for fitting the polynomials to a given state history.
+    /*!
+     *  Constructor for fitting the polynomials to a given state history.
+     *  \param bodyStateHistory Data map (time as key, Cartesian state as values) to which the polynomials are to be
+     *  fitted.
+     *  \param maximumBlockLength Maximum length of each block in which a single set of polynomials is used.
+     *  \param maximumPolynomialDegree Maximum polynomial degree in each block.
+     *  \param positionTolerance Maximum error of each position component.
+     *  \param velocityTolerance Maximum error of each velocity component.
+     *  \param frameOrigin Name of body relative to which the ephemeris is to be calculated
+     *  (optional "SSB" by default).
+     *  \param frameOrientation Orientatioan of the reference frame in which the epehemeris is to be
+     *  calculated (optional "ECLIPJ2000" by default).
+     */
+    ChebyshevEphemerisSettings( const std::map< double, Eigen::Vector6d >& bodyStateHistory,
+                                const double maximumBlockLength = 4.0 * 86400.0,
+                                const unsigned int maximumPolynomialDegree = 12,
+                                const double positionTolerance = 1.0E-2,
+                                const double velocityTolerance = 1.0E-8,
+                                const std::string& frameOrigin = "SSB",
+                                const std::string& frameOrientation = "ECLIPJ2000" ):
+        EphemerisSettings( chebyshev_ephemeris, frameOrigin, frameOrientation ),
+        initialTime_( TUDAT_NAN ), finalTime_( TUDAT_NAN ), maximumBlockLength_( maximumBlockLength ),
+        maximumPolynomialDegree_( maximumPolynomialDegree ), positionTolerance_( positionTolerance ),
+        velocityTolerance_( velocityTolerance ), bodyStateHistory_( bodyStateHistory ){ }
+
+    //! Function to return start time of the ephemeris (NaN if fitted to state history).
+    double getInitialTime( ){ return initialTime_; }
+
+    //! Function to return end time of the ephemeris (NaN if fitted to state history).
+    double getFinalTime( ){ return finalTime_; }
+
+    //! Function to return maximum length of each block in which a single set of polynomials is used.
+    double getMaximumBlockLength( ){ return maximumBlockLength_; }
+
+    //! Function to return maximum polynomial degree in each block.
+    unsigned int getMaximumPolynomialDegree( ){ return maximumPolynomialDegree_; }
+
+    //! Function to return maximum error of each position component.
+    double getPositionTolerance( ){ return positionTolerance_; }
+
+    //! Function to return maximum error of each velocity component.
+    double getVelocityTolerance( ){ return velocityTolerance_; }
+
+    //! Function to return state history to which polynomials are to be fitted (empty if fitted to Spice data).
+    std::map< double, Eigen::Vector6d > getBodyStateHistory( ){ return bodyStateHistory_; }
+
+private:
+
+    //! Start time of the ephemeris (NaN if fitted to state history).
+    double initialTime_;
+
+    //! End time of the ephemeris (NaN if fitted to state history).
+    double finalTime_;
+
+    //! Maximum length of each block in which a single set of polynomials is used.
+    double maximumBlockLength_;
+
+    //! Maximum polynomial degree in each block.
+    unsigned int maximumPolynomialDegree_;
+
+    //! Maximum error of each position component.
+    double positionTolerance_;
+
+    //! Maximum error of each velocity component.
+    double velocityTolerance_;
+
+    //! State history to which polynomials are to be fitted (empty if fitted to Spice data).
+    std::map< double, Eigen::Vector6d > bodyStateHistory_;
 };
 
 #if USE_CSPICE
 
+//! Function to create the key identifying the data of a tabulated ephemeris created from Spice.
+/*!
+ *  Function to create the key identifying the data of a tabulated ephemeris created from Spice, used for caching the
+ *  data retrieved from Spice. The key contains the body, frame origin and orientation, time interval and step,
+ *  interpolator settings, as well as the file name, size and modification time of all loaded Spice kernels.
+ * \param body Name of body for which ephemeris data is to be retrieved.
+ * \param initialTime Initial time from which interpolated data from Spice should be created.
+ * \param endTime Final time from which interpolated data from Spice should be created.
+ * \param timeStep Time step with which interpolated data from Spice should be created.
+ * \param observerName Name of body relative to which the ephemeris is to be calculated.
+ * \param referenceFrameName Orientatioan of the reference frame in which the epehemeris is to be
+ *          calculated.
+ * \param interpolatorSettings Settings to be used for the state interpolation.
+ * \return Key identifying the data of a tabulated ephemeris created from Spice.
+ */
+std::string getTabulatedSpiceEphemerisCacheKey(
+        const std::string& body,
+        const long double initialTime,
+        const long double endTime,
+        const long double timeStep,
+        const std::string& observerName,
+        const std::string& referenceFrameName,
+        const boost::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings );
+
 //! Function to create a tabulated ephemeris using data from Spice.
 /*!
  *  Function to create a tabulated ephemeris using data from Spice.
@@ -576,6 +871,11 @@ private:
  * \param observerName Name of body relative to which the ephemeris is to be calculated.
  * \param referenceFrameName Orientatioan of the reference frame in which the epehemeris is to be
  *          calculated.
+ * \param interpolatorSettings Settings to be used for the state interpolation. By default, the equidistant lookup
+ * scheme is used, since the data is retrieved from Spice on an equidistant grid.
+ * \param cacheDirectory Directory in which the data retrieved from Spice is cached (no caching if empty). If a cache
+ * file for the same input (see getTabulatedSpiceEphemerisCacheKey) exists in this directory, the data is read from
+ * it. Otherwise, the data retrieved from Spice is written to a new cache file.
  * \return Tabulated ephemeris using data from Spice.
  */
 template< typename StateScalarType = double, typename TimeType = double >
@@ -587,20 +887,41 @@ boost::shared_ptr< ephemerides::Ephemeris > createTabulatedEphemerisFromSpice(
         const std::string& observerName,
         const std::string& referenceFrameName,
         boost::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings =
-        boost::make_shared< interpolators::LagrangeInterpolatorSettings >( 8 ) )
+        boost::make_shared< interpolators::LagrangeInterpolatorSettings >( 8, 0, interpolators::equidistantLookup ),
+        const std::string& cacheDirectory = "" )
 {
     using namespace interpolators;
 
     std::map< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > > timeHistoryOfState;
 
-    // Calculate state from spice at given time intervals and store in timeHistoryOfState.
-    TimeType currentTime = initialTime;
-    while( currentTime < endTime )
+    // Check if data is available from cache.
+    std::string cacheKey, cacheFileName;
+    bool isDataCached = false;
+    if( cacheDirectory != "" )
+    {
+        cacheKey = getTabulatedSpiceEphemerisCacheKey(
+                    body, static_cast< long double >( initialTime ), static_cast< long double >( endTime ),
+                    static_cast< long double >( timeStep ), observerName, referenceFrameName, interpolatorSettings );
+        cacheFileName = input_output::getBinaryStateHistoryCacheFileName( cacheDirectory, cacheKey );
+        isDataCached = input_output::readStateHistoryFromBinaryCacheFile( cacheFileName, cacheKey, timeHistoryOfState );
+    }
+
+    if( !isDataCached )
     {
-        timeHistoryOfState[ currentTime ] = spice_interface::getBodyCartesianStateAtEpoch(
-                    body, observerName, referenceFrameName, "none", static_cast< double >( currentTime ) ).
-                template cast< StateScalarType >( );
-        currentTime += timeStep;
+        // Calculate state from spice at given time intervals and store in timeHistoryOfState.
+        TimeType currentTime = initialTime;
+        while( currentTime < endTime )
+        {
+            timeHistoryOfState[ currentTime ] = spice_interface::getBodyCartesianStateAtEpoch(
+                        body, observerName, referenceFrameName, "none", static_cast< double >( currentTime ) ).
+                    template cast< StateScalarType >( );
+            currentTime += timeStep;
+        }
+
+        if( cacheDirectory != "" )
+        {
+            input_output::writeStateHistoryToBinaryCacheFile( timeHistoryOfState, cacheFileName, cacheKey );
+        }
     }
 
     // Create interpolator.
@@ -612,8 +933,97 @@ boost::shared_ptr< ephemerides::Ephemeris > createTabulatedEphemerisFromSpice(
     return boost::make_shared< ephemerides::TabulatedCartesianEphemeris< StateScalarType, TimeType > >(
                 interpolator, observerName, referenceFrameName );
 }
+
+//! Function to create a piecewise Chebyshev ephemeris using data from Spice.
+/*!
+ *  Function to create a piecewise Chebyshev ephemeris using data from Spice, fitted to the given tolerances (see
+ *  ephemerides::fitChebyshevEphemeris).
+ * \param body Name of body for which ephemeris data is to be retrieved.
+ * \param initialTime Start time of the ephemeris.
+ * \param endTime End time of the ephemeris.
+ * \param maximumBlockLength Maximum length of each block in which a single set of polynomials is used.
+ * \param maximumPolynomialDegree Maximum polynomial degree in each block.
+ * \param positionTolerance Maximum error of each position component.
+ * \param velocityTolerance Maximum error of each velocity component.
+ * \param observerName Name of body relative to which the ephemeris is to be calculated.
+ * \param referenceFrameName Orientatioan of the reference frame in which the epehemeris is to be
+ *          calculated.
+ * \return Piecewise Chebyshev ephemeris using data from Spice.
+ */
+boost::shared_ptr< ephemerides::Ephemeris > createChebyshevEphemerisFromSpice(
+        const std::string& body,
+        const double initialTime,
+        const double endTime,
+        const double maximumBlockLength,
+        const unsigned int maximumPolynomialDegree,
+        const double positionTolerance,
+        const double velocityTolerance,
+        const std::string& observerName,
+        const std::string& referenceFrameName );
 #endif
 
+//! Function to create the state interpolator of a tabulated ephemeris.
+/*!
+ *  Function to create the state interpolator of a tabulated ephemeris from its settings. If no interpolator settings
+ *  are provided in tabulatedEphemerisSettings, a 6th order Lagrange interpolator is created. Otherwise, the
+ *  interpolator is created from the interpolator settings, using the acceleration history (if provided) for the
+ *  derivatives of the states.
+ *  \param tabulatedEphemerisSettings Settings for the tabulated ephemeris.
+ *  \return State interpolator of tabulated ephemeris.
+ */
+template< typename StateScalarType >
+boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::Matrix< StateScalarType, 6, 1 > > >
+createTabulatedEphemerisInterpolator(
+        const boost::shared_ptr< TabulatedEphemerisSettings > tabulatedEphemerisSettings )
+{
+    typedef Eigen::Matrix< StateScalarType, 6, 1 > StateType;
+
+    // Cast input history to required type.
+    std::map< double, Eigen::Vector6d > originalStateHistory = tabulatedEphemerisSettings->getBodyStateHistory( );
+    std::map< double, StateType > stateHistory;
+    for( std::map< double, Eigen::Vector6d >::const_iterator stateIterator = originalStateHistory.begin( );
+         stateIterator != originalStateHistory.end( ); stateIterator++ )
+    {
+        stateHistory[ stateIterator->first ] = stateIterator->second.template cast< StateScalarType >( );
+    }
+
+    boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, StateType > > interpolator;
+    if( tabulatedEphemerisSettings->getInterpolatorSettings( ) == NULL )
+    {
+        interpolator = boost::make_shared< interpolators::LagrangeInterpolator< double, StateType > >(
+                    stateHistory, 6, interpolators::equidistantLookup,
+                    interpolators::lagrange_cubic_spline_boundary_interpolation );
+    }
+    else
+    {
+        // Create state derivatives from velocities and accelerations, if accelerations are provided.
+        std::map< double, Eigen::Vector3d > accelerationHistory =
+                tabulatedEphemerisSettings->getBodyAccelerationHistory( );
+        std::vector< StateType > stateDerivatives;
+        if( accelerationHistory.size( ) > 0 )
+        {
+            StateType currentStateDerivative;
+            for( typename std::map< double, StateType >::const_iterator stateIterator = stateHistory.begin( );
+                 stateIterator != stateHistory.end( ); stateIterator++ )
+            {
+                if( accelerationHistory.count( stateIterator->first ) == 0 )
+                {
+                    throw std::runtime_error(
+                                "Error when creating tabulated ephemeris, no acceleration found at epoch " +
+                                boost::lexical_cast< std::string >( stateIterator->first ) );
+                }
+                currentStateDerivative << stateIterator->second.segment( 3, 3 ),
+                        accelerationHistory.at( stateIterator->first ).template cast< StateScalarType >( );
+                stateDerivatives.push_back( currentStateDerivative );
+            }
+        }
+
+        interpolator = interpolators::createOneDimensionalInterpolator(
+                    stateHistory, tabulatedEphemerisSettings->getInterpolatorSettings( ), stateDerivatives );
+    }
+    return interpolator;
+}
+
 //! Function to create a ephemeris model.
 /*!
  *  Function to create a ephemeris model based on model-specific settings for the ephemeris.
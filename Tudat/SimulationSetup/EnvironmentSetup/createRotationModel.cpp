@@ -8,13 +8,19 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <boost/bind.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/lexical_cast.hpp>
 
 #include "Tudat/Astrodynamics/Ephemerides/simpleRotationalEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/tabulatedRotationalEphemeris.h"
 #if USE_CSPICE
 #include "Tudat/External/SpiceInterface/spiceRotationalEphemeris.h"
 #endif
+#if USE_SOFA
+#include "Tudat/External/SofaInterface/gcrsToItrsRotationalEphemeris.h"
+#include "Tudat/External/SofaInterface/tabulatedEarthOrientation.h"
+#endif
 #include "Tudat/SimulationSetup/EnvironmentSetup/createRotationModel.h"
 
 namespace tudat
@@ -68,6 +74,71 @@ boost::shared_ptr< ephemerides::RotationalEphemeris > createRotationModel(
         break;
     }
     #endif
+    case tabulated_rotation_model:
+    {
+        // Check whether settings for tabulated rotation model are consistent with its type.
+        boost::shared_ptr< TabulatedRotationModelSettings > tabulatedRotationSettings =
+                boost::dynamic_pointer_cast< TabulatedRotationModelSettings >( rotationModelSettings );
+        if( tabulatedRotationSettings == NULL )
+        {
+            throw std::runtime_error(
+                        "Error, expected tabulated rotation model settings for " + body );
+        }
+        else
+        {
+            // Create original rotation model, and sample it to create tabulated rotation model.
+            rotationalEphemeris = createTabulatedRotationalEphemeris(
+                        createRotationModel( tabulatedRotationSettings->getOriginalRotationModelSettings( ), body ),
+                        tabulatedRotationSettings->getInitialTime( ),
+                        tabulatedRotationSettings->getFinalTime( ),
+                        tabulatedRotationSettings->getTimeStep( ) );
+        }
+        break;
+    }
+    #if USE_SOFA
+    case gcrs_to_itrs_rotation_model:
+    {
+        // Check whether settings for GCRS to ITRS rotation model are consistent with its type.
+        boost::shared_ptr< GcrsToItrsRotationModelSettings > gcrsToItrsRotationSettings =
+                boost::dynamic_pointer_cast< GcrsToItrsRotationModelSettings >( rotationModelSettings );
+        if( gcrsToItrsRotationSettings == NULL )
+        {
+            throw std::runtime_error(
+                        "Error, expected GCRS to ITRS rotation model settings for " + body );
+        }
+        else
+        {
+            // Set function to compute the CIP position, either from tabulated values or from Sofa series directly.
+            boost::function< std::pair< Eigen::Vector2d, double >( const double ) > cipPositionFunction;
+            if( gcrsToItrsRotationSettings->useTabulatedPrecessionNutation( ) )
+            {
+                boost::shared_ptr< sofa_interface::TabulatedPrecessionNutationCalculator > precessionNutationCalculator =
+                        sofa_interface::createTabulatedPrecessionNutationCalculator(
+                            gcrsToItrsRotationSettings->getTabulationInitialTime( ),
+                            gcrsToItrsRotationSettings->getTabulationFinalTime( ),
+                            gcrsToItrsRotationSettings->getTabulationTimeStep( ),
+                            gcrsToItrsRotationSettings->getPrecessionNutationTheory( ),
+                            gcrsToItrsRotationSettings->getNumberOfThreads( ),
+                            gcrsToItrsRotationSettings->getCacheDirectory( ) );
+                cipPositionFunction = boost::bind(
+                            &sofa_interface::TabulatedPrecessionNutationCalculator::getPositionOfCipInGcrs,
+                            precessionNutationCalculator, _1 );
+            }
+            else
+            {
+                cipPositionFunction = boost::bind(
+                            &sofa_interface::getPositionOfCipInGcrs, _1, basic_astrodynamics::JULIAN_DAY_ON_J2000,
+                            gcrsToItrsRotationSettings->getPrecessionNutationTheory( ) );
+            }
+
+            rotationalEphemeris = boost::make_shared< GcrsToItrsRotationalEphemeris >(
+                        cipPositionFunction,
+                        gcrsToItrsRotationSettings->getOriginalFrame( ),
+                        gcrsToItrsRotationSettings->getTargetFrame( ) );
+        }
+        break;
+    }
+    #endif
     default:
         throw std::runtime_error(
                  "Error, did not recognize rotation model settings type " +
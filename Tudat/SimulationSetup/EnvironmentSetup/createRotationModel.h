@@ -18,6 +18,10 @@
 
 #include "Tudat/SimulationSetup/EnvironmentSetup/body.h"
 #include "Tudat/Astrodynamics/Ephemerides/rotationalEphemeris.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#if USE_SOFA
+#include "Tudat/External/SofaInterface/earthOrientation.h"
+#endif
 
 
 namespace tudat
@@ -34,7 +38,9 @@ namespace simulation_setup
 enum RotationModelType
 {
     simple_rotation_model,
-    spice_rotation_model
+    spice_rotation_model,
+    tabulated_rotation_model,
+    gcrs_to_itrs_rotation_model
 };
 
 //! Class for providing settings for rotation model.
@@ -166,6 +172,195 @@ private:
     double rotationRate_;
 };
 
+//! RotationModelSettings derived class for defining settings of a tabulated rotational ephemeris.
+/*!
+ *  RotationModelSettings derived class for defining settings of a tabulated rotational ephemeris. The rotation model
+ *  defined by the original settings is created, and sampled once at equidistant times, after which the rotation is
+ *  interpolated from the tabulated quaternions (see ephemerides::TabulatedRotationalEphemeris). This is typically used
+ *  to avoid repeated evaluations of a computationally expensive rotation model (such as a Spice rotation model) at each
+ *  environment update.
+ */
+class TabulatedRotationModelSettings: public RotationModelSettings
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor, sets settings of rotation model that is to be tabulated, and time settings of tabulation.
+     *  \param originalRotationModelSettings Settings of rotation model that is to be tabulated.
+     *  \param initialTime Start time of the tabulated rotation model.
+     *  \param finalTime End time of the tabulated rotation model.
+     *  \param timeStep Time between subsequent tabulated rotations.
+     */
+    TabulatedRotationModelSettings( const boost::shared_ptr< RotationModelSettings > originalRotationModelSettings,
+                                    const double initialTime,
+                                    const double finalTime,
+                                    const double timeStep = 300.0 ):
+        RotationModelSettings( tabulated_rotation_model, originalRotationModelSettings->getOriginalFrame( ),
+                               originalRotationModelSettings->getTargetFrame( ) ),
+        originalRotationModelSettings_( originalRotationModelSettings ),
+        initialTime_( initialTime ), finalTime_( finalTime ), timeStep_( timeStep ){ }
+
+    //! Function to return settings of rotation model that is to be tabulated.
+    /*!
+     *  Function to return settings of rotation model that is to be tabulated.
+     *  \return Settings of rotation model that is to be tabulated.
+     */
+    boost::shared_ptr< RotationModelSettings > getOriginalRotationModelSettings( )
+    {
+        return originalRotationModelSettings_;
+    }
+
+    //! Function to return start time of the tabulated rotation model.
+    /*!
+     *  Function to return start time of the tabulated rotation model.
+     *  \return Start time of the tabulated rotation model.
+     */
+    double getInitialTime( ){ return initialTime_; }
+
+    //! Function to return end time of the tabulated rotation model.
+    /*!
+     *  Function to return end time of the tabulated rotation model.
+     *  \return End time of the tabulated rotation model.
+     */
+    double getFinalTime( ){ return finalTime_; }
+
+    //! Function to return time between subsequent tabulated rotations.
+    /*!
+     *  Function to return time between subsequent tabulated rotations.
+     *  \return Time between subsequent tabulated rotations.
+     */
+    double getTimeStep( ){ return timeStep_; }
+
+private:
+
+    //! Settings of rotation model that is to be tabulated.
+    boost::shared_ptr< RotationModelSettings > originalRotationModelSettings_;
+
+    //! Start time of the tabulated rotation model.
+    double initialTime_;
+
+    //! End time of the tabulated rotation model.
+    double finalTime_;
+
+    //! Time between subsequent tabulated rotations.
+    double timeStep_;
+};
+
+#if USE_SOFA
+//! RotationModelSettings derived class for defining settings of a GCRS to ITRS rotation model of the Earth.
+/*!
+ *  RotationModelSettings derived class for defining settings of a GCRS to ITRS rotation model of the Earth (see
+ *  ephemerides::GcrsToItrsRotationalEphemeris), computed with the precession-nutation model of the given IAU
+ *  conventions. If a tabulation interval is provided, the CIP position and CIO locator are interpolated from values
+ *  tabulated once from the Sofa series (see sofa_interface::createTabulatedPrecessionNutationCalculator), instead
+ *  of evaluating the series at each call.
+ */
+class GcrsToItrsRotationModelSettings: public RotationModelSettings
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor, sets precession-nutation settings, and (optional) tabulation settings.
+     *  \param precessionNutationTheory IAU conventions that are to be used for the precession-nutation model.
+     *  \param originalFrame Base frame of rotation model (GCRS).
+     *  \param tabulationInitialTime Start time (TT in seconds since J2000) of the tabulated precession-nutation
+     *  values (no tabulation if NaN).
+     *  \param tabulationFinalTime End time (TT in seconds since J2000) of the tabulated precession-nutation values
+     *  (no tabulation if NaN).
+     *  \param tabulationTimeStep Time between subsequent tabulated precession-nutation values.
+     *  \param cacheDirectory Directory in which binary file with tabulated values is to be stored (none if empty).
+     *  \param numberOfThreads Number of threads over which the tabulation is distributed.
+     */
+    GcrsToItrsRotationModelSettings(
+            const IAUConventions precessionNutationTheory = iau_2006,
+            const std::string& originalFrame = "J2000",
+            const double tabulationInitialTime = TUDAT_NAN,
+            const double tabulationFinalTime = TUDAT_NAN,
+            const double tabulationTimeStep = 6.0 * 3600.0,
+            const std::string& cacheDirectory = "",
+            const unsigned int numberOfThreads = 1 ):
+        RotationModelSettings( gcrs_to_itrs_rotation_model, originalFrame, "ITRS" ),
+        precessionNutationTheory_( precessionNutationTheory ),
+        tabulationInitialTime_( tabulationInitialTime ), tabulationFinalTime_( tabulationFinalTime ),
+        tabulationTimeStep_( tabulationTimeStep ), cacheDirectory_( cacheDirectory ),
+        numberOfThreads_( numberOfThreads ){ }
+
+    //! Function to return IAU conventions that are to be used for the precession-nutation model.
+    /*!
+     *  Function to return IAU conventions that are to be used for the precession-nutation model.
+     *  \return IAU conventions that are to be used for the precession-nutation model.
+     */
+    IAUConventions getPrecessionNutationTheory( ){ return precessionNutationTheory_; }
+
+    //! Function to return whether the precession-nutation values are to be tabulated.
+    /*!
+     *  Function to return whether the precession-nutation values are to be tabulated.
+     *  \return True if the precession-nutation values are to be tabulated.
+     */
+    bool useTabulatedPrecessionNutation( )
+    {
+        return ( tabulationInitialTime_ == tabulationInitialTime_ ) && ( tabulationFinalTime_ == tabulationFinalTime_ );
+    }
+
+    //! Function to return start time of the tabulated precession-nutation values.
+    /*!
+     *  Function to return start time of the tabulated precession-nutation values.
+     *  \return Start time of the tabulated precession-nutation values.
+     */
+    double getTabulationInitialTime( ){ return tabulationInitialTime_; }
+
+    //! Function to return end time of the tabulated precession-nutation values.
+    /*!
+     *  Function to return end time of the tabulated precession-nutation values.
+     *  \return End time of the tabulated precession-nutation values.
+     */
+    double getTabulationFinalTime( ){ return tabulationFinalTime_; }
+
+    //! Function to return time between subsequent tabulated precession-nutation values.
+    /*!
+     *  Function to return time between subsequent tabulated precession-nutation values.
+     *  \return Time between subsequent tabulated precession-nutation values.
+     */
+    double getTabulationTimeStep( ){ return tabulationTimeStep_; }
+
+    //! Function to return directory in which binary file with tabulated values is to be stored.
+    /*!
+     *  Function to return directory in which binary file with tabulated values is to be stored.
+     *  \return Directory in which binary file with tabulated values is to be stored (none if empty).
+     */
+    std::string getCacheDirectory( ){ return cacheDirectory_; }
+
+    //! Function to return number of threads over which the tabulation is distributed.
+    /*!
+     *  Function to return number of threads over which the tabulation is distributed.
+     *  \return Number of threads over which the tabulation is distributed.
+     */
+    unsigned int getNumberOfThreads( ){ return numberOfThreads_; }
+
+private:
+
+    //! IAU conventions that are to be used for the precession-nutation model.
+    IAUConventions precessionNutationTheory_;
+
+    //! Start time of the tabulated precession-nutation values.
+    double tabulationInitialTime_;
+
+    //! End time of the tabulated precession-nutation values.
+    double tabulationFinalTime_;
+
+    //! Time between subsequent tabulated precession-nutation values.
+    double tabulationTimeStep_;
+
+    //! Directory in which binary file with tabulated values is to be stored (none if empty).
+    std::string cacheDirectory_;
+
+    //! Number of threads over which the tabulation is distributed.
+    unsigned int numberOfThreads_;
+};
+#endif
+
 //! Function to create a rotation model.
 /*!
  *  Function to create a rotation model based on model-specific settings for the rotation.
@@ -190,6 +190,135 @@ createLightTimeCalculator(
                 bodyMap, lightTimeCorrections, transmittingLinkEnd, receivingLinkEnd );
 }
 
+//! Class to share light-time calculators, and their solutions, between observation models of identical links.
+/*!
+ *  Class to share light-time calculators, and their solutions, between observation models of identical links. When the
+ *  same link (transmitter, receiver and light-time corrections) is used for multiple observables (e.g. one-way range,
+ *  one-way Doppler and angular position), the observation models created with the same object of this type use a single
+ *  LightTimeCalculator, which stores its solutions (light time and link end states) per time and reference link end in a
+ *  LightTimeSolutionCache. Consequently, the light-time equation is solved, and the link end ephemerides are evaluated,
+ *  only once per epoch for all observables of the link. The observation partials are computed from the link end states
+ *  returned by the observation models, so that they also use these shared solutions.
+ *  NOTE: the stored solutions must be cleared (clearSolutions) whenever the environment (e.g. ephemerides) changes.
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+class ObservationEvaluationCache
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param maximumNumberOfSolutionsPerLink Maximum number of stored light-time solutions per link.
+     */
+    ObservationEvaluationCache( const unsigned int maximumNumberOfSolutionsPerLink = 100000 ):
+        maximumNumberOfSolutionsPerLink_( maximumNumberOfSolutionsPerLink ){ }
+
+    //! Function to retrieve the (shared) light-time calculator for a given link, creating it if it does not yet exist.
+    /*!
+     * Function to retrieve the (shared) light-time calculator for a given link, creating it if it does not yet exist.
+     * Light-time calculators are shared if the lists of light-time correction settings define identical corrections
+     * (compared by type and parameters, see areLightTimeCorrectionSettingsListsEqual), even if the settings objects
+     * themselves are different.
+     * \param transmittingLinkEnd Identifier for transmitting link end.
+     * \param receivingLinkEnd Identifier for receiving link end.
+     * \param bodyMap List of body objects that comprises the environment
+     * \param lightTimeCorrections List of light time corrections (w.r.t. Euclidean distance) that are applied when
+     * computing light time.
+     * \return Light-time calculator for given link.
+     */
+    boost::shared_ptr< LightTimeCalculator< ObservationScalarType, TimeType > > getLightTimeCalculator(
+            const LinkEndId& transmittingLinkEnd,
+            const LinkEndId& receivingLinkEnd,
+            const simulation_setup::NamedBodyMap& bodyMap,
+            const std::vector< boost::shared_ptr< LightTimeCorrectionSettings > >& lightTimeCorrections )
+    {
+        std::vector< CalculatorWithCorrections >& calculatorsOfLink =
+                lightTimeCalculators_[ std::make_pair( transmittingLinkEnd, receivingLinkEnd ) ];
+
+        // Retrieve light-time calculator with identical corrections, if it exists.
+        for( unsigned int i = 0; i < calculatorsOfLink.size( ); i++ )
+        {
+            if( areLightTimeCorrectionSettingsListsEqual( calculatorsOfLink.at( i ).first, lightTimeCorrections ) )
+            {
+                return calculatorsOfLink.at( i ).second;
+            }
+        }
+
+        // Create light-time calculator, and associated solution cache.
+        boost::shared_ptr< LightTimeCalculator< ObservationScalarType, TimeType > > lightTimeCalculator =
+                createLightTimeCalculator< ObservationScalarType, TimeType >(
+                    transmittingLinkEnd, receivingLinkEnd, bodyMap, lightTimeCorrections );
+        lightTimeCalculator->setSolutionCache(
+                    boost::make_shared< LightTimeSolutionCache< ObservationScalarType, TimeType > >(
+                        maximumNumberOfSolutionsPerLink_ ) );
+        lightTimeCalculator->setUseWarmStart( true );
+        calculatorsOfLink.push_back( std::make_pair( lightTimeCorrections, lightTimeCalculator ) );
+
+        return lightTimeCalculator;
+    }
+
+    //! Function to remove all stored light-time solutions, for all links.
+    void clearSolutions( )
+    {
+        for( typename std::map< std::pair< LinkEndId, LinkEndId >, std::vector< CalculatorWithCorrections > >::
+             iterator calculatorIterator = lightTimeCalculators_.begin( );
+             calculatorIterator != lightTimeCalculators_.end( ); calculatorIterator++ )
+        {
+            for( unsigned int i = 0; i < calculatorIterator->second.size( ); i++ )
+            {
+                calculatorIterator->second.at( i ).second->getSolutionCache( )->clearSolutions( );
+            }
+        }
+    }
+
+private:
+
+    //! Typedef for light-time calculator, with the list of light-time correction settings with which it was created.
+    typedef std::pair< std::vector< boost::shared_ptr< LightTimeCorrectionSettings > >,
+    boost::shared_ptr< LightTimeCalculator< ObservationScalarType, TimeType > > > CalculatorWithCorrections;
+
+    //! List of light-time calculators (one per distinct set of light-time corrections), per transmitter/receiver pair.
+    std::map< std::pair< LinkEndId, LinkEndId >, std::vector< CalculatorWithCorrections > > lightTimeCalculators_;
+
+    //! Maximum number of stored light-time solutions per link.
+    unsigned int maximumNumberOfSolutionsPerLink_;
+};
+
+//! Function to create a light-time calculation object, or retrieve it from a set of shared light-time calculators
+/*!
+ *  Function to create a light-time calculation object from light time correction settings environment and link end
+ *  identifiers. If an ObservationEvaluationCache is provided, the light-time calculator is retrieved from it (and
+ *  shared with all other observation models of the same link created with this object).
+ *  \param transmittingLinkEnd Identifier for transmitting link end.
+ *  \param receivingLinkEnd Identifier for receiving link end.
+ *  \param bodyMap List of body objects that comprises the environment
+ *  \param lightTimeCorrections List of light time corrections (w.r.t. Euclidean distance) that are applied when computing
+ *  light time.
+ *  \param observationEvaluationCache Object from which to retrieve shared light-time calculators (if NULL, a new
+ *  light-time calculator is created).
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+boost::shared_ptr< observation_models::LightTimeCalculator< ObservationScalarType, TimeType > >
+createLightTimeCalculator(
+        const LinkEndId& transmittingLinkEnd,
+        const LinkEndId& receivingLinkEnd,
+        const simulation_setup::NamedBodyMap& bodyMap,
+        const std::vector< boost::shared_ptr< LightTimeCorrectionSettings > >& lightTimeCorrections,
+        const boost::shared_ptr< ObservationEvaluationCache< ObservationScalarType, TimeType > > observationEvaluationCache )
+{
+    if( observationEvaluationCache == NULL )
+    {
+        return createLightTimeCalculator< ObservationScalarType, TimeType >(
+                    transmittingLinkEnd, receivingLinkEnd, bodyMap, lightTimeCorrections );
+    }
+    else
+    {
+        return observationEvaluationCache->getLightTimeCalculator(
+                    transmittingLinkEnd, receivingLinkEnd, bodyMap, lightTimeCorrections );
+    }
+}
+
 } // namespace observation_models
 
 } // namespace tudat
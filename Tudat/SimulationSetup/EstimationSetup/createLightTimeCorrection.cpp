@@ -98,6 +98,73 @@ boost::shared_ptr< LightTimeCorrection > createLightTimeCorrections(
     return lightTimeCorrection;
 }
 
+//! Function to determine whether two light-time correction settings objects define an identical correction
+bool areLightTimeCorrectionSettingsEqual(
+        const boost::shared_ptr< LightTimeCorrectionSettings > firstCorrectionSettings,
+        const boost::shared_ptr< LightTimeCorrectionSettings > secondCorrectionSettings )
+{
+    // Identical (or both NULL) objects define identical corrections
+    if( firstCorrectionSettings == secondCorrectionSettings )
+    {
+        return true;
+    }
+    else if( ( firstCorrectionSettings == NULL ) || ( secondCorrectionSettings == NULL ) ||
+             ( firstCorrectionSettings->getCorrectionType( ) != secondCorrectionSettings->getCorrectionType( ) ) )
+    {
+        return false;
+    }
+
+    bool areSettingsEqual = false;
+
+    // Compare parameters of the correction
+    switch( firstCorrectionSettings->getCorrectionType( ) )
+    {
+    case first_order_relativistic:
+    {
+        boost::shared_ptr< FirstOrderRelativisticLightTimeCorrectionSettings > firstRelativisticSettings =
+                boost::dynamic_pointer_cast< FirstOrderRelativisticLightTimeCorrectionSettings >(
+                    firstCorrectionSettings );
+        boost::shared_ptr< FirstOrderRelativisticLightTimeCorrectionSettings > secondRelativisticSettings =
+                boost::dynamic_pointer_cast< FirstOrderRelativisticLightTimeCorrectionSettings >(
+                    secondCorrectionSettings );
+        if( ( firstRelativisticSettings != NULL ) && ( secondRelativisticSettings != NULL ) )
+        {
+            areSettingsEqual = ( firstRelativisticSettings->getPerturbingBodies( ) ==
+                                 secondRelativisticSettings->getPerturbingBodies( ) );
+        }
+        break;
+    }
+    default:
+
+        // Settings of unknown type are only equal if they are the same object
+        areSettingsEqual = false;
+        break;
+    }
+
+    return areSettingsEqual;
+}
+
+//! Function to determine whether two lists of light-time correction settings define identical corrections
+bool areLightTimeCorrectionSettingsListsEqual(
+        const std::vector< boost::shared_ptr< LightTimeCorrectionSettings > >& firstCorrectionSettingsList,
+        const std::vector< boost::shared_ptr< LightTimeCorrectionSettings > >& secondCorrectionSettingsList )
+{
+    if( firstCorrectionSettingsList.size( ) != secondCorrectionSettingsList.size( ) )
+    {
+        return false;
+    }
+
+    for( unsigned int i = 0; i < firstCorrectionSettingsList.size( ); i++ )
+    {
+        if( !areLightTimeCorrectionSettingsEqual( firstCorrectionSettingsList.at( i ),
+                                                  secondCorrectionSettingsList.at( i ) ) )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 }
 
 }
@@ -101,6 +101,30 @@ private:
 
 };
 
+//! Function to determine whether two light-time correction settings objects define an identical correction
+/*!
+ * Function to determine whether two light-time correction settings objects define an identical correction, i.e. whether
+ * they are of the same type and have the same parameters (the objects themselves need not be the same).
+ * \param firstCorrectionSettings First light-time correction settings object that is to be compared.
+ * \param secondCorrectionSettings Second light-time correction settings object that is to be compared.
+ * \return True if both settings objects define an identical light-time correction.
+ */
+bool areLightTimeCorrectionSettingsEqual(
+        const boost::shared_ptr< LightTimeCorrectionSettings > firstCorrectionSettings,
+        const boost::shared_ptr< LightTimeCorrectionSettings > secondCorrectionSettings );
+
+//! Function to determine whether two lists of light-time correction settings define identical corrections
+/*!
+ * Function to determine whether two lists of light-time correction settings define identical corrections, by comparing
+ * the entries of the lists (in order) using areLightTimeCorrectionSettingsEqual.
+ * \param firstCorrectionSettingsList First list of light-time correction settings that is to be compared.
+ * \param secondCorrectionSettingsList Second list of light-time correction settings that is to be compared.
+ * \return True if both lists define identical light-time corrections.
+ */
+bool areLightTimeCorrectionSettingsListsEqual(
+        const std::vector< boost::shared_ptr< LightTimeCorrectionSettings > >& firstCorrectionSettingsList,
+        const std::vector< boost::shared_ptr< LightTimeCorrectionSettings > >& secondCorrectionSettingsList );
+
 //! Function to create object that computes a single (type of) correction to the light-time
 /*!
  * Function to create object that computes a single (type of) correction to the light-time
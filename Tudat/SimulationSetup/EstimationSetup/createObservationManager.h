@@ -35,13 +35,17 @@ namespace observation_models
  *  \param settingsPerLinkEnds Map of settings for the observation models that are to be created in the simulator object: one
  *  for each required set of link ends (each settings object must be consistent with observableType).
  *  \param bodyMap Map of Body objects that comprise the environment
+ *  \param observationEvaluationCache Object from which to retrieve light-time calculators that are shared between
+ *  observation models of the same link (default none).
  *  \return Object that simulates the observables according to the provided settings.
  */
 template< int ObservationSize = 1, typename ObservationScalarType = double, typename TimeType = double >
 boost::shared_ptr< ObservationSimulator< ObservationSize, ObservationScalarType, TimeType > > createObservationSimulator(
         const ObservableType observableType,
         const std::map< LinkEnds, boost::shared_ptr< ObservationSettings  > > settingsPerLinkEnds,
-        const simulation_setup::NamedBodyMap &bodyMap )
+        const simulation_setup::NamedBodyMap &bodyMap,
+        const boost::shared_ptr< ObservationEvaluationCache< ObservationScalarType, TimeType > > observationEvaluationCache =
+        boost::shared_ptr< ObservationEvaluationCache< ObservationScalarType, TimeType > >( ) )
 {
     std::map< LinkEnds, boost::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > >
             observationModels;
@@ -52,7 +56,7 @@ boost::shared_ptr< ObservationSimulator< ObservationSize, ObservationScalarType,
     {
         observationModels[ settingIterator->first ] = ObservationModelCreator<
                 ObservationSize, ObservationScalarType, TimeType >::createObservationModel(
-                    settingIterator->first, settingIterator->second, bodyMap );
+                    settingIterator->first, settingIterator->second, bodyMap, observationEvaluationCache );
     }
 
     return boost::make_shared< ObservationSimulator< ObservationSize, ObservationScalarType, TimeType > >(
@@ -70,6 +74,8 @@ boost::shared_ptr< ObservationSimulator< ObservationSize, ObservationScalarType,
  *  \param bodyMap Map of Body objects that comprise the environment
  *  \param parametersToEstimate Object containing the list of all parameters that are to be estimated
  *  \param stateTransitionMatrixInterface Object used to compute the state transition/sensitivity matrix at a given time
+ *  \param observationEvaluationCache Object from which to retrieve light-time calculators that are shared between
+ *  observation models of the same link (default none).
  *  \return Object that simulates the observations of a given type and associated partials
  */
 template< int ObservationSize = 1, typename ObservationScalarType = double, typename TimeType = double >
@@ -80,7 +86,9 @@ boost::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > c
         const boost::shared_ptr< estimatable_parameters::EstimatableParameterSet< ObservationScalarType > >
         parametersToEstimate,
         const boost::shared_ptr< propagators::CombinedStateTransitionAndSensitivityMatrixInterface >
-        stateTransitionMatrixInterface )
+        stateTransitionMatrixInterface,
+        const boost::shared_ptr< ObservationEvaluationCache< ObservationScalarType, TimeType > > observationEvaluationCache =
+        boost::shared_ptr< ObservationEvaluationCache< ObservationScalarType, TimeType > >( ) )
 {
     using namespace observation_models;
     using namespace observation_partials;
@@ -88,7 +96,7 @@ boost::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > c
     // Create observation simulator
     boost::shared_ptr< ObservationSimulator< ObservationSize, ObservationScalarType, TimeType > > observationSimulator =
             createObservationSimulator< ObservationSize, ObservationScalarType, TimeType >(
-                observableType, settingsPerLinkEnds, bodyMap );
+                observableType, settingsPerLinkEnds, bodyMap, observationEvaluationCache );
 
     // Get light-time corrections for current observable
     PerLinkEndPerLightTimeSolutionCorrections lightTimeCorrectionList =
@@ -129,6 +137,8 @@ boost::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > c
  *  \param bodyMap Map of Body objects that comprise the environment
  *  \param parametersToEstimate Object containing the list of all parameters that are to be estimated
  *  \param stateTransitionMatrixInterface Object used to compute the state transition/sensitivity matrix at a given time
+ *  \param observationEvaluationCache Object from which to retrieve light-time calculators that are shared between
+ *  observation models of the same link (default none).
  *  \return Object that simulates the observations of a given type and associated partials
  */
 template< typename ObservationScalarType = double, typename TimeType = double >
@@ -137,7 +147,9 @@ boost::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > c
         const std::map< LinkEnds, boost::shared_ptr< ObservationSettings  > > settingsPerLinkEnds,
         const simulation_setup::NamedBodyMap &bodyMap,
         const boost::shared_ptr< estimatable_parameters::EstimatableParameterSet< ObservationScalarType > > parametersToEstimate,
-        const boost::shared_ptr< propagators::CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionMatrixInterface )
+        const boost::shared_ptr< propagators::CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionMatrixInterface,
+        const boost::shared_ptr< ObservationEvaluationCache< ObservationScalarType, TimeType > > observationEvaluationCache =
+        boost::shared_ptr< ObservationEvaluationCache< ObservationScalarType, TimeType > >( ) )
 {
     boost::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > observationManager;
     switch( observableType )
@@ -145,22 +157,22 @@ boost::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > c
     case one_way_range:
         observationManager = createObservationManager< 1, ObservationScalarType, TimeType >(
                     observableType, settingsPerLinkEnds, bodyMap, parametersToEstimate,
-                    stateTransitionMatrixInterface );
+                    stateTransitionMatrixInterface, observationEvaluationCache );
         break;
     case one_way_doppler:
         observationManager = createObservationManager< 1, ObservationScalarType, TimeType >(
                     observableType, settingsPerLinkEnds, bodyMap, parametersToEstimate,
-                    stateTransitionMatrixInterface );
+                    stateTransitionMatrixInterface, observationEvaluationCache );
         break;
     case angular_position:
         observationManager = createObservationManager< 2, ObservationScalarType, TimeType >(
                     observableType, settingsPerLinkEnds, bodyMap, parametersToEstimate,
-                    stateTransitionMatrixInterface );
+                    stateTransitionMatrixInterface, observationEvaluationCache );
         break;
     case position_observable:
         observationManager = createObservationManager< 3, ObservationScalarType, TimeType >(
                     observableType, settingsPerLinkEnds, bodyMap, parametersToEstimate,
-                    stateTransitionMatrixInterface );
+                    stateTransitionMatrixInterface, observationEvaluationCache );
         break;
     default:
         throw std::runtime_error(
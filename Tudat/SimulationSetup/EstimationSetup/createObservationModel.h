@@ -231,13 +231,17 @@ public:
      * \param linkEnds Link ends for observation model that is to be created
      * \param observationSettings Settings for observation model that is to be created.
      * \param bodyMap List of body objects that comprises the environment
+     * \param observationEvaluationCache Object from which to retrieve light-time calculators that are shared between
+     * observation models of the same link (default none; each observation model uses its own light-time calculator).
      * \return Observation model of required settings.
      */
     static boost::shared_ptr< observation_models::ObservationModel<
     ObservationSize, ObservationScalarType, TimeType > > createObservationModel(
             const LinkEnds linkEnds,
             const boost::shared_ptr< ObservationSettings > observationSettings,
-            const simulation_setup::NamedBodyMap &bodyMap );
+            const simulation_setup::NamedBodyMap &bodyMap,
+            const boost::shared_ptr< ObservationEvaluationCache< ObservationScalarType, TimeType > >
+            observationEvaluationCache = boost::shared_ptr< ObservationEvaluationCache< ObservationScalarType, TimeType > >( ) );
 };
 
 //! Interface class for creating observation models of size 1.
@@ -252,13 +256,17 @@ public:
      * \param linkEnds Link ends for observation model that is to be created
      * \param observationSettings Settings for observation model that is to be created (must be for observation model if size 1).
      * \param bodyMap List of body objects that comprises the environment
+     * \param observationEvaluationCache Object from which to retrieve light-time calculators that are shared between
+     * observation models of the same link (default none; each observation model uses its own light-time calculator).
      * \return Observation model of required settings.
      */
     static boost::shared_ptr< observation_models::ObservationModel<
     1, ObservationScalarType, TimeType > > createObservationModel(
             const LinkEnds linkEnds,
             const boost::shared_ptr< ObservationSettings > observationSettings,
-            const simulation_setup::NamedBodyMap &bodyMap )
+            const simulation_setup::NamedBodyMap &bodyMap,
+            const boost::shared_ptr< ObservationEvaluationCache< ObservationScalarType, TimeType > >
+            observationEvaluationCache = boost::shared_ptr< ObservationEvaluationCache< ObservationScalarType, TimeType > >( ) )
     {
         using namespace observation_models;
 
@@ -300,7 +308,7 @@ public:
                     ObservationScalarType, TimeType > >(
                         createLightTimeCalculator< ObservationScalarType, TimeType >(
                         linkEnds.at( transmitter ), linkEnds.at( receiver ),
-                        bodyMap, observationSettings->lightTimeCorrectionsList_ ),
+                        bodyMap, observationSettings->lightTimeCorrectionsList_, observationEvaluationCache ),
                          observationBias );
 
             break;
@@ -337,7 +345,7 @@ public:
                      ObservationScalarType, TimeType > >(
                          createLightTimeCalculator< ObservationScalarType, TimeType >(
                          linkEnds.at( transmitter ), linkEnds.at( receiver ),
-                         bodyMap, observationSettings->lightTimeCorrectionsList_ ),
+                         bodyMap, observationSettings->lightTimeCorrectionsList_, observationEvaluationCache ),
                          observationBias );
 
              break;
@@ -365,13 +373,17 @@ public:
      * \param linkEnds Link ends for observation model that is to be created
      * \param observationSettings Settings for observation model that is to be created (must be for observation model if size 1).
      * \param bodyMap List of body objects that comprises the environment
+     * \param observationEvaluationCache Object from which to retrieve light-time calculators that are shared between
+     * observation models of the same link (default none; each observation model uses its own light-time calculator).
      * \return Observation model of required settings.
      */
     static boost::shared_ptr< observation_models::ObservationModel<
     2, ObservationScalarType, TimeType > > createObservationModel(
             const LinkEnds linkEnds,
             const boost::shared_ptr< ObservationSettings > observationSettings,
-            const simulation_setup::NamedBodyMap &bodyMap )
+            const simulation_setup::NamedBodyMap &bodyMap,
+            const boost::shared_ptr< ObservationEvaluationCache< ObservationScalarType, TimeType > >
+            observationEvaluationCache = boost::shared_ptr< ObservationEvaluationCache< ObservationScalarType, TimeType > >( ) )
     {
         using namespace observation_models;
         boost::shared_ptr< observation_models::ObservationModel<
@@ -413,7 +425,7 @@ public:
                     ObservationScalarType, TimeType > >(
                         createLightTimeCalculator< ObservationScalarType, TimeType >(
                             linkEnds.at( transmitter ), linkEnds.at( receiver ),
-                            bodyMap, observationSettings->lightTimeCorrectionsList_ ),
+                            bodyMap, observationSettings->lightTimeCorrectionsList_, observationEvaluationCache ),
                         observationBias );
 
             break;
@@ -443,13 +455,17 @@ public:
      * \param linkEnds Link ends for observation model that is to be created
      * \param observationSettings Settings for observation model that is to be created (must be for observation model if size 1).
      * \param bodyMap List of body objects that comprises the environment
+     * \param observationEvaluationCache Object from which to retrieve light-time calculators that are shared between
+     * observation models of the same link (default none; each observation model uses its own light-time calculator).
      * \return Observation model of required settings.
      */
     static boost::shared_ptr< observation_models::ObservationModel<
     3, ObservationScalarType, TimeType > > createObservationModel(
             const LinkEnds linkEnds,
             const boost::shared_ptr< ObservationSettings > observationSettings,
-            const simulation_setup::NamedBodyMap &bodyMap )
+            const simulation_setup::NamedBodyMap &bodyMap,
+            const boost::shared_ptr< ObservationEvaluationCache< ObservationScalarType, TimeType > >
+            observationEvaluationCache = boost::shared_ptr< ObservationEvaluationCache< ObservationScalarType, TimeType > >( ) )
     {
         using namespace observation_models;
         boost::shared_ptr< observation_models::ObservationModel<
@@ -454,6 +454,93 @@ std::vector< std::string > > createFullEnvironmentUpdaterSettings(
     return environmentModelsToUpdate;
 }
 
+//! Function to get the bodies for which the aerodynamic coefficients are used by translational acceleration models.
+std::vector< std::string > getBodiesUsingAerodynamicCoefficientsInAccelerations(
+        const basic_astrodynamics::AccelerationMap& translationalAccelerationModels )
+{
+    using namespace basic_astrodynamics;
+
+    std::vector< std::string > bodiesUsingAerodynamicCoefficients;
+
+    // Iterate over all bodies being accelerated, and all bodies exerting acceleration.
+    for( AccelerationMap::const_iterator acceleratedBodyIterator = translationalAccelerationModels.begin( );
+         acceleratedBodyIterator != translationalAccelerationModels.end( ); acceleratedBodyIterator++ )
+    {
+        for( SingleBodyAccelerationMap::const_iterator accelerationModelIterator =
+             acceleratedBodyIterator->second.begin( );
+             accelerationModelIterator != acceleratedBodyIterator->second.end( ); accelerationModelIterator++ )
+        {
+            for( unsigned int i = 0; i < accelerationModelIterator->second.size( ); i++ )
+            {
+                if( getAccelerationModelType( accelerationModelIterator->second.at( i ) ) == aerodynamic )
+                {
+                    bodiesUsingAerodynamicCoefficients.push_back( acceleratedBodyIterator->first );
+                }
+            }
+        }
+    }
+
+    return bodiesUsingAerodynamicCoefficients;
+}
+
+//! Function to get the bodies for which the aerodynamic coefficients are used by dependent variables.
+std::vector< std::string > getBodiesUsingAerodynamicCoefficientsInDependentVariables(
+        const std::vector< boost::shared_ptr< SingleDependentVariableSaveSettings > >& dependentVariables )
+{
+    std::vector< std::string > bodiesUsingAerodynamicCoefficients;
+    for( unsigned int i = 0; i < dependentVariables.size( ); i++ )
+    {
+        if( ( dependentVariables.at( i )->variableType_ == aerodynamic_force_coefficients_dependent_variable ) ||
+                ( dependentVariables.at( i )->variableType_ == aerodynamic_moment_coefficients_dependent_variable ) )
+        {
+            bodiesUsingAerodynamicCoefficients.push_back( dependentVariables.at( i )->associatedBody_ );
+        }
+    }
+    return bodiesUsingAerodynamicCoefficients;
+}
+
+//! Function to get the bodies for which the aerodynamic coefficients are used by propagation termination conditions.
+std::vector< std::string > getBodiesUsingAerodynamicCoefficientsInTerminationSettings(
+        const boost::shared_ptr< PropagationTerminationSettings > terminationSettings )
+{
+    std::vector< std::string > bodiesUsingAerodynamicCoefficients;
+    if( terminationSettings == NULL )
+    {
+        return bodiesUsingAerodynamicCoefficients;
+    }
+
+    switch( terminationSettings->terminationType_ )
+    {
+    case dependent_variable_stopping_condition:
+    {
+        bodiesUsingAerodynamicCoefficients = getBodiesUsingAerodynamicCoefficientsInDependentVariables(
+                    std::vector< boost::shared_ptr< SingleDependentVariableSaveSettings > >(
+                        1, boost::dynamic_pointer_cast< PropagationDependentVariableTerminationSettings >(
+                            terminationSettings )->dependentVariableSettings_ ) );
+        break;
+    }
+    case hybrid_stopping_condition:
+    {
+        std::vector< boost::shared_ptr< PropagationTerminationSettings > > singleTerminationSettings =
+                boost::dynamic_pointer_cast< PropagationHybridTerminationSettings >(
+                    terminationSettings )->terminationSettings_;
+        for( unsigned int i = 0; i < singleTerminationSettings.size( ); i++ )
+        {
+            std::vector< std::string > singleConditionBodies =
+                    getBodiesUsingAerodynamicCoefficientsInTerminationSettings( singleTerminationSettings.at( i ) );
+            bodiesUsingAerodynamicCoefficients.insert(
+                        bodiesUsingAerodynamicCoefficients.end( ),
+                        singleConditionBodies.begin( ), singleConditionBodies.end( ) );
+        }
+        break;
+    }
+    default:
+        break;
+    }
+
+    return bodiesUsingAerodynamicCoefficients;
+}
+
 } // namespace propagators
 
 } // namespace tudat
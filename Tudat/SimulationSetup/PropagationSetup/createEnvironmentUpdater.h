@@ -11,6 +11,8 @@
 #ifndef TUDAT_CREATEENVIRONMENTUPDATER_H
 #define TUDAT_CREATEENVIRONMENTUPDATER_H
 
+#include <algorithm>
+
 #include <boost/make_shared.hpp>
 
 #include "Tudat/SimulationSetup/PropagationSetup/environmentUpdater.h"
@@ -161,6 +163,140 @@ std::map< propagators::EnvironmentModelsToUpdate,
     std::vector< std::string > > createFullEnvironmentUpdaterSettings(
         const simulation_setup::NamedBodyMap& bodyMap );
 
+//! Function to get the bodies for which the aerodynamic coefficients are used by translational acceleration models.
+/*!
+ * Function to get the bodies for which the current aerodynamic coefficients are used by translational acceleration
+ * models, i.e. the bodies undergoing an aerodynamic acceleration.
+ * \param translationalAccelerationModels List of acceleration models used in simulation.
+ * \return Names of bodies for which the aerodynamic coefficients are used (may contain duplicates).
+ */
+std::vector< std::string > getBodiesUsingAerodynamicCoefficientsInAccelerations(
+        const basic_astrodynamics::AccelerationMap& translationalAccelerationModels );
+
+//! Function to get the bodies for which the aerodynamic coefficients are used by dependent variables.
+/*!
+ * Function to get the bodies for which the current aerodynamic coefficients are used by dependent variables, i.e.
+ * the bodies for which the aerodynamic force or moment coefficients are requested.
+ * \param dependentVariables List of settings for dependent variables.
+ * \return Names of bodies for which the aerodynamic coefficients are used (may contain duplicates).
+ */
+std::vector< std::string > getBodiesUsingAerodynamicCoefficientsInDependentVariables(
+        const std::vector< boost::shared_ptr< SingleDependentVariableSaveSettings > >& dependentVariables );
+
+//! Function to get the bodies for which the aerodynamic coefficients are used by propagation termination conditions.
+/*!
+ * Function to get the bodies for which the current aerodynamic coefficients are used by the dependent variables of
+ * (possibly hybrid) propagation termination conditions.
+ * \param terminationSettings Settings for propagation termination conditions.
+ * \return Names of bodies for which the aerodynamic coefficients are used (may contain duplicates).
+ */
+std::vector< std::string > getBodiesUsingAerodynamicCoefficientsInTerminationSettings(
+        const boost::shared_ptr< PropagationTerminationSettings > terminationSettings );
+
+//! Function to get the bodies for which the aerodynamic coefficients are used in a propagation.
+/*!
+ * Function to get the bodies for which the current aerodynamic coefficients are used in a propagation, by the
+ * acceleration models, the dependent variables that are to be saved, or the termination conditions.
+ * \param propagatorSettings Object providing the full settings for the dynamics that are to be propagated.
+ * \return Names of bodies for which the aerodynamic coefficients are used (may contain duplicates).
+ */
+template< typename StateScalarType >
+std::vector< std::string > getBodiesUsingAerodynamicCoefficients(
+        const boost::shared_ptr< PropagatorSettings< StateScalarType > > propagatorSettings )
+{
+    std::vector< std::string > bodiesUsingAerodynamicCoefficients;
+    std::vector< std::string > singleModelBodies;
+
+    // Check dynamics type
+    switch( propagatorSettings->stateType_ )
+    {
+    case hybrid:
+    {
+        boost::shared_ptr< MultiTypePropagatorSettings< StateScalarType > > multiTypePropagatorSettings =
+                boost::dynamic_pointer_cast< MultiTypePropagatorSettings< StateScalarType > >( propagatorSettings );
+
+        for( typename std::map< IntegratedStateType,
+             std::vector< boost::shared_ptr< PropagatorSettings< StateScalarType > > > >::const_iterator
+             typeIterator = multiTypePropagatorSettings->propagatorSettingsMap_.begin( );
+             typeIterator != multiTypePropagatorSettings->propagatorSettingsMap_.end( ); typeIterator++ )
+        {
+            for( unsigned int i = 0; i < typeIterator->second.size( ); i++ )
+            {
+                singleModelBodies = getBodiesUsingAerodynamicCoefficients< StateScalarType >(
+                            typeIterator->second.at( i ) );
+                bodiesUsingAerodynamicCoefficients.insert(
+                            bodiesUsingAerodynamicCoefficients.end( ),
+                            singleModelBodies.begin( ), singleModelBodies.end( ) );
+            }
+        }
+        break;
+    }
+    case transational_state:
+    {
+        singleModelBodies = getBodiesUsingAerodynamicCoefficientsInAccelerations(
+                    boost::dynamic_pointer_cast< TranslationalStatePropagatorSettings< StateScalarType > >(
+                        propagatorSettings )->accelerationsMap_ );
+        bodiesUsingAerodynamicCoefficients.insert(
+                    bodiesUsingAerodynamicCoefficients.end( ), singleModelBodies.begin( ), singleModelBodies.end( ) );
+        break;
+    }
+    default:
+        break;
+    }
+
+    // Add bodies for which the coefficients are used by dependent variables and termination conditions.
+    if( propagatorSettings->getDependentVariablesToSave( ) != NULL )
+    {
+        singleModelBodies = getBodiesUsingAerodynamicCoefficientsInDependentVariables(
+                    propagatorSettings->getDependentVariablesToSave( )->dependentVariables_ );
+        bodiesUsingAerodynamicCoefficients.insert(
+                    bodiesUsingAerodynamicCoefficients.end( ), singleModelBodies.begin( ), singleModelBodies.end( ) );
+    }
+
+    singleModelBodies = getBodiesUsingAerodynamicCoefficientsInTerminationSettings(
+                propagatorSettings->getTerminationSettings( ) );
+    bodiesUsingAerodynamicCoefficients.insert(
+                bodiesUsingAerodynamicCoefficients.end( ), singleModelBodies.begin( ), singleModelBodies.end( ) );
+
+    return bodiesUsingAerodynamicCoefficients;
+}
+
+//! Function to get the bodies for which the flight conditions are not to update the aerodynamic coefficients.
+/*!
+ * Function to get the bodies for which the flight conditions are updated during a propagation, but for which the
+ * aerodynamic coefficients are not used in the propagation (see getBodiesUsingAerodynamicCoefficients), so that no
+ * coefficients are interpolated if only other flight conditions (e.g. density) are used. The resulting list is stored
+ * in the environment updater, so that the settings of the flight conditions (which may be shared by several
+ * propagations) are left unchanged.
+ * \param propagatorSettings Object providing the full settings for the dynamics that are to be propagated.
+ * \param environmentModelsToUpdate List of environment models that are to be updated during the propagation.
+ * \return Names of bodies for which the flight conditions are to be updated without the aerodynamic coefficients.
+ */
+template< typename StateScalarType >
+std::vector< std::string > getBodiesWithoutAerodynamicCoefficientUpdate(
+        const boost::shared_ptr< PropagatorSettings< StateScalarType > > propagatorSettings,
+        const std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > >& environmentModelsToUpdate )
+{
+    std::vector< std::string > bodiesWithoutAerodynamicCoefficientUpdate;
+    if( environmentModelsToUpdate.count( vehicle_flight_conditions_update ) > 0 )
+    {
+        std::vector< std::string > bodiesUsingAerodynamicCoefficients =
+                getBodiesUsingAerodynamicCoefficients< StateScalarType >( propagatorSettings );
+        std::vector< std::string > bodiesWithFlightConditionsUpdate =
+                environmentModelsToUpdate.at( vehicle_flight_conditions_update );
+
+        for( unsigned int i = 0; i < bodiesWithFlightConditionsUpdate.size( ); i++ )
+        {
+            if( std::find( bodiesUsingAerodynamicCoefficients.begin( ), bodiesUsingAerodynamicCoefficients.end( ),
+                           bodiesWithFlightConditionsUpdate.at( i ) ) == bodiesUsingAerodynamicCoefficients.end( ) )
+            {
+                bodiesWithoutAerodynamicCoefficientUpdate.push_back( bodiesWithFlightConditionsUpdate.at( i ) );
+            }
+        }
+    }
+    return bodiesWithoutAerodynamicCoefficientUpdate;
+}
+
 //! Create environment updater from a list of propagation settings.
 /*!
 * Get environment updater from a list of propagation settings.
@@ -168,7 +304,8 @@ std::map< propagators::EnvironmentModelsToUpdate,
 * dynamics that are to be propagated.
 * \param bodyMap List of body objects used in the simulations.
 * \return Object that updates the environment in bodyMap, as per thhe
-* requirements set by propagatorSettings.
+* requirements set by propagatorSettings. The flight conditions in bodyMap only update the aerodynamic coefficients
+* if these are used in the propagation (see getBodiesWithoutAerodynamicCoefficientUpdate).
 */
 template< typename StateScalarType, typename TimeType >
 boost::shared_ptr< propagators::EnvironmentUpdater< StateScalarType, TimeType > >
@@ -185,9 +322,15 @@ createEnvironmentUpdaterForDynamicalEquations(
         std::vector< std::string > > environmentModelsToUpdate =
             createEnvironmentUpdaterSettings< StateScalarType >( propagatorSettings, bodyMap );
 
+    // Update aerodynamic coefficients only for bodies for which they are used.
+    std::vector< std::string > bodiesWithoutAerodynamicCoefficientUpdate =
+            getBodiesWithoutAerodynamicCoefficientUpdate< StateScalarType >(
+                propagatorSettings, environmentModelsToUpdate );
+
     // Create and return environment updater object.
     return boost::make_shared< EnvironmentUpdater< StateScalarType, TimeType > >(
-                bodyMap, environmentModelsToUpdate, integratedTypeAndBodyList );
+                bodyMap, environmentModelsToUpdate, integratedTypeAndBodyList,
+                bodiesWithoutAerodynamicCoefficientUpdate );
 }
 
 } // namespace propagators
@@ -58,6 +58,8 @@ public:
      * (value). Note that for the numerical integration of translational motion, the entry
      * in the pair will have a second entry that is empty (""), with the first entry defining
      * the body that is integrated.
+     * \param bodiesWithoutAerodynamicCoefficientUpdate List of bodies for which the flight conditions are to be
+     * updated without updating the aerodynamic coefficients (default none).
      */
     EnvironmentUpdater(
             const simulation_setup::NamedBodyMap& bodyList,
@@ -65,8 +67,11 @@ public:
             const std::map< IntegratedStateType,
             std::vector< std::pair< std::string, std::string > > >& integratedStates =
             ( std::map< IntegratedStateType,
-              std::vector< std::pair< std::string, std::string > > >( ) ) ):
-        bodyList_( bodyList ), integratedStates_( integratedStates )
+              std::vector< std::pair< std::string, std::string > > >( ) ),
+            const std::vector< std::string >& bodiesWithoutAerodynamicCoefficientUpdate =
+            std::vector< std::string >( ) ):
+        bodyList_( bodyList ), integratedStates_( integratedStates ),
+        bodiesWithoutAerodynamicCoefficientUpdate_( bodiesWithoutAerodynamicCoefficientUpdate )
     {
         // Set update function to be evaluated as dependent variables of state and time during each
         // integration time step.
@@ -538,13 +543,27 @@ private:
                         if( bodyList_.at( currentBodies.at( i ) )->getFlightConditions( ) != NULL )
                         {
                             // If vehicle has flight conditions, add flight conditions update
-                            // function to update list.
+                            // function to update list (without coefficient update if not required).
+                            boost::function< void( const double ) > flightConditionsUpdateFunction;
+                            if( std::find( bodiesWithoutAerodynamicCoefficientUpdate_.begin( ),
+                                           bodiesWithoutAerodynamicCoefficientUpdate_.end( ),
+                                           currentBodies.at( i ) ) == bodiesWithoutAerodynamicCoefficientUpdate_.end( ) )
+                            {
+                                flightConditionsUpdateFunction = boost::bind(
+                                            static_cast< void( aerodynamics::FlightConditions::* )( const double ) >
+                                            ( &aerodynamics::FlightConditions::updateConditions ),
+                                            bodyList_.at( currentBodies.at( i ) )->getFlightConditions( ), _1 );
+                            }
+                            else
+                            {
+                                flightConditionsUpdateFunction = boost::bind(
+                                            static_cast< void( aerodynamics::FlightConditions::* )(
+                                                const double, const bool ) >
+                                            ( &aerodynamics::FlightConditions::updateConditions ),
+                                            bodyList_.at( currentBodies.at( i ) )->getFlightConditions( ), _1, false );
+                            }
                             updateTimeFunctionList[ vehicle_flight_conditions_update ].push_back(
-                                        std::make_pair(
-                                            currentBodies.at( i ), boost::bind(
-                                                &aerodynamics::FlightConditions::updateConditions,
-                                                bodyList_.at( currentBodies.at( i ) )
-                                                ->getFlightConditions( ), _1 ) ) );
+                                        std::make_pair( currentBodies.at( i ), flightConditionsUpdateFunction ) );
 
                             resetFunctionVector_.push_back(
                                         boost::make_tuple(
@@ -635,6 +654,9 @@ private:
     std::map< IntegratedStateType, std::vector< std::pair< std::string, std::string > > >
     integratedStates_;
 
+    //! List of bodies for which the flight conditions are to be updated without updating the aerodynamic coefficients.
+    std::vector< std::string > bodiesWithoutAerodynamicCoefficientUpdate_;
+
     //! List of time-dependent functions to call to update the environment.
     std::vector< boost::tuple< EnvironmentModelsToUpdate, std::string, boost::function< void( const double ) > > >
     updateFunctionVector_;
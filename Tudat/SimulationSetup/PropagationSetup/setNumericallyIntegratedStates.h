@@ -302,6 +302,9 @@ void resetIntegratedEphemerides(
     createAndSetInterpolatorsForEphemerides(
                 bodyMap, bodiesToIntegrate, startIndexAndSize.first, ephemerisUpdateOrder,
                 equationsOfMotionNumericalSolution, integrationToEphemerisFrameFunctions );
+
+    // Memoized states of ephemeris origins may have been computed from the previous ephemerides.
+    simulation_setup::resetCachedBaseFrameStates( bodyMap );
 }
 
 //! Resets the mass models of the integrated bodies from the numerical integration results.
@@ -8,6 +8,7 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include "Tudat/Mathematics/Interpolators/contiguousLagrangeInterpolator.h"
 #include "Tudat/SimulationSetup/PropagationSetup/variationalEquationsSolver.h"
 
 namespace tudat
@@ -25,7 +26,7 @@ void createStateTransitionAndSensitivityMatrixInterpolator(
 {
     // Create interpolator for state transition matrix.
     stateTransitionMatrixInterpolator=
-            boost::make_shared< interpolators::LagrangeInterpolator< double, Eigen::MatrixXd > >(
+            boost::make_shared< interpolators::ContiguousLagrangeInterpolator< double, Eigen::MatrixXd > >(
                 utilities::createVectorFromMapKeys< Eigen::MatrixXd, double >( variationalEquationsSolution[ 0 ] ),
                 utilities::createVectorFromMapValues< Eigen::MatrixXd, double >( variationalEquationsSolution[ 0 ] ), 4 );
     if( clearRawSolution )
@@ -35,7 +36,7 @@ void createStateTransitionAndSensitivityMatrixInterpolator(
 
     // Create interpolator for sensitivity matrix.
     sensitivityMatrixInterpolator =
-            boost::make_shared< interpolators::LagrangeInterpolator< double, Eigen::MatrixXd > >(
+            boost::make_shared< interpolators::ContiguousLagrangeInterpolator< double, Eigen::MatrixXd > >(
                 utilities::createVectorFromMapKeys< Eigen::MatrixXd, double >( variationalEquationsSolution[ 1 ] ),
                 utilities::createVectorFromMapValues< Eigen::MatrixXd, double >( variationalEquationsSolution[ 1 ] ), 4 );
     if( clearRawSolution )
@@ -129,12 +129,7 @@ public:
 
     {
         // Reset values of parameters.
-        parametersToEstimate_->template resetParameterValues< StateScalarType >( newParameterEstimate );
-        propagatorSettings_->resetInitialStates(
-                    estimatable_parameters::getInitialStateVectorOfBodiesToEstimate( parametersToEstimate_ ) );
-
-        dynamicsStateDerivative_->template updateStateDerivativeModelSettings(
-                    propagatorSettings_->getInitialStates( ) );
+        resetParameterValues( newParameterEstimate );
 
         // Check if re-integration of variational equations is requested
         if( areVariationalEquationsToBeIntegrated )
@@ -161,6 +156,22 @@ public:
 
 protected:
 
+    //! Function to reset parameter estimate, without re-integrating the equations of motion and variational equations.
+    /*!
+     *  Function to reset parameter estimate, without re-integrating the equations of motion and variational equations,
+     *  updating the initial states in the propagator settings and the settings of the state derivative models.
+     *  \param newParameterEstimate New estimate of parameters that are to be estimated, in same order as defined
+     *  in parametersToEstimate_ member.
+     */
+    void resetParameterValues( const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > newParameterEstimate )
+    {
+        parametersToEstimate_->template resetParameterValues< StateScalarType >( newParameterEstimate );
+        propagatorSettings_->resetInitialStates(
+                    estimatable_parameters::getInitialStateVectorOfBodiesToEstimate( parametersToEstimate_ ) );
+
+        dynamicsStateDerivative_->template updateStateDerivativeModelSettings(
+                    propagatorSettings_->getInitialStates( ) );
+    }
 
     //! Create initial matrix of numerical soluation to variational + dynamical equations.
     /*!
@@ -431,7 +442,7 @@ public:
             const bool integrateEquationsOnCreation = 1 ):
         VariationalEquationsSolver< StateScalarType, TimeType >(
             bodyMap, integratorSettings, propagatorSettings, parametersToEstimate,
-            variationalOnlyIntegratorSettings, clearNumericalSolution )
+            variationalOnlyIntegratorSettings, clearNumericalSolution ), isArcWisePropagationFinished_( false )
     {
         // Check input consistency
         if( !checkPropagatorSettingsAndParameterEstimationConsistency< StateScalarType, TimeType >(
@@ -532,21 +543,7 @@ public:
                                      dynamicsSimulator_->getPropagationTerminationCondition( ), _1 ),
                         dependentVariableHistory );
 
-            std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > equationsOfMotionNumericalSolution;
-            utilities::createVectorBlockMatrixHistory(
-                        rawNumericalSolution, equationsOfMotionNumericalSolution,
-                        std::make_pair( 0, parameterVectorSize_ ), stateTransitionMatrixSize_ );
-
-            equationsOfMotionNumericalSolution = convertNumericalStateSolutionsToOutputSolutions(
-                        equationsOfMotionNumericalSolution, dynamicsStateDerivative_ );
-            dynamicsSimulator_->manuallySetAndProcessRawNumericalEquationsOfMotionSolution(
-                        equationsOfMotionNumericalSolution );
-
-            // Reset solution for state transition and sensitivity matrices.
-            setVariationalEquationsSolution< TimeType, StateScalarType >(
-                        rawNumericalSolution, variationalEquationsSolution_,
-                        std::make_pair( 0, 0 ), std::make_pair( 0, stateTransitionMatrixSize_ ),
-                        stateTransitionMatrixSize_, parameterVectorSize_ );
+            processConcurrentNumericalSolution( rawNumericalSolution );
         }
         else
         {
@@ -579,6 +576,86 @@ public:
 
     }
 
+    //! Function to reset the parameter estimate, and restart the arc-wise integration of the variational equations.
+    /*!
+     *  Function to reset the parameter estimate (without integrating the equations), and to (re)start the arc-wise
+     *  concurrent integration of the variational equations and equations of motion at the initial time of the
+     *  propagation (see integrateVariationalAndDynamicalEquationsToTime).
+     *  \param newParameterEstimate New estimate of parameters that are to be estimated, in same order as defined
+     *  in parametersToEstimate_ member.
+     */
+    void resetParameterEstimateForArcWiseIntegration( const VectorType& newParameterEstimate )
+    {
+        this->resetParameterValues( newParameterEstimate );
+
+        currentArcInitialState_ = this->createInitialConditions(
+                    dynamicsStateDerivative_->convertFromOutputSolution(
+                        propagatorSettings_->getInitialStates( ), integratorSettings_->initialTime_ ) );
+        currentArcInitialTime_ = integratorSettings_->initialTime_;
+        previousArcSolutionEnd_.clear( );
+        isArcWisePropagationFinished_ = false;
+    }
+
+    //! Function to integrate the variational equations and equations of motion over the next arc.
+    /*!
+     *  Function to concurrently integrate the variational equations and equations of motion from the end of the
+     *  previously integrated arc (or the initial time, after a call to resetParameterEstimateForArcWiseIntegration),
+     *  until numberOfOverlappingPoints / 2 time steps beyond the given time plus arcEndTimeBuffer (or until the
+     *  propagation termination condition is met). The state transition and sensitivity matrices are continuously
+     *  integrated from the initial time, so that they are identical to those of a single propagation over the full arc
+     *  (for a fixed step size integrator). At the end of this function, the stateTransitionInterface_ and the environment
+     *  are reset with the solution of the current arc only, preceded by the final points of the previous arc (all points
+     *  after the previous arc end time minus arcEndTimeBuffer, and numberOfOverlappingPoints / 2 points before it), so
+     *  that the memory usage is independent of the total propagation interval, while the interpolation of the solution
+     *  between the end of the previous arc and the given time is unaffected by the boundaries of the arc.
+     *  The arcEndTimeBuffer should be at least the maximum difference between the time at which a solution is required
+     *  for an observation and the associated observation time (i.e. the maximum light time, for observations with a
+     *  propagated body at one link end and the observation time at the other link end). The interval covered by the
+     *  solution of the current arc may be retrieved with getCurrentArcSolutionInterval.
+     *  \param arcEndTime Time up to which the solution is required.
+     *  \param numberOfOverlappingPoints Number of points of the solution that are shared between subsequent arcs
+     *  (beyond those within arcEndTimeBuffer of the arc end time).
+     *  \param arcEndTimeBuffer Time interval beyond arcEndTime over which the solution is (also) required, and before the
+     *  arcEndTime over which it is retained for the next arc.
+     *  \return True if the termination condition of the propagation is reached (i.e. no further arcs remain).
+     */
+    bool integrateVariationalAndDynamicalEquationsToTime(
+            const TimeType arcEndTime, const int numberOfOverlappingPoints = 16, const double arcEndTimeBuffer = 0.0 )
+    {
+        if( arcEndTimeBuffer < 0.0 )
+        {
+            throw std::runtime_error( "Error when integrating variational equations arc-wise, arc end time buffer is negative" );
+        }
+        return integrateNextArcOfVariationalAndDynamicalEquations(
+                    arcEndTime, true, numberOfOverlappingPoints, arcEndTimeBuffer );
+    }
+
+    //! Function to integrate the variational equations and equations of motion over the final arc.
+    /*!
+     *  Function to concurrently integrate the variational equations and equations of motion from the end of the
+     *  previously integrated arc until the propagation termination condition is met (see
+     *  integrateVariationalAndDynamicalEquationsToTime).
+     *  \param numberOfOverlappingPoints Number of points of the solution of the previous arc that are retained.
+     *  \return True if the termination condition of the propagation is reached (always true).
+     */
+    bool integrateRemainingVariationalAndDynamicalEquations( const int numberOfOverlappingPoints = 16 )
+    {
+        return integrateNextArcOfVariationalAndDynamicalEquations(
+                    integratorSettings_->initialTime_, false, numberOfOverlappingPoints, 0.0 );
+    }
+
+    //! Function to retrieve the interval covered by the solution of the most recently integrated arc.
+    /*!
+     *  Function to retrieve the interval covered by the solution of the most recently integrated arc (including the
+     *  points retained from the previous arc), when integrating the equations arc-wise. The solution (and the states of
+     *  the propagated bodies in the environment) is only valid in this interval.
+     *  \return Pair of first and last time of the solution of the current arc.
+     */
+    std::pair< double, double > getCurrentArcSolutionInterval( )
+    {
+        return currentArcSolutionInterval_;
+    }
+
     //! Function to return the numerical solution history of numerically integrated variational equations.
     /*!
      *  Function to return the numerical solution history of numerically integrated variational equations.
@@ -604,6 +681,178 @@ protected:
 
 private:
 
+    //! Function to process the numerical solution of the concurrently integrated variational equations and dynamics.
+    /*!
+     *  Function to process the numerical solution of the concurrently integrated variational equations and equations of
+     *  motion: the environment is updated with the solution of the equations of motion, and the state transition and
+     *  sensitivity matrices are stored in variationalEquationsSolution_.
+     *  NOTE: rawNumericalSolution contents are deleted by this function.
+     *  \param rawNumericalSolution Numerical solution of the concurrently integrated equations, in [Phi;S;y] form.
+     */
+    void processConcurrentNumericalSolution( std::map< TimeType, MatrixType >& rawNumericalSolution )
+    {
+        std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > equationsOfMotionNumericalSolution;
+        utilities::createVectorBlockMatrixHistory(
+                    rawNumericalSolution, equationsOfMotionNumericalSolution,
+                    std::make_pair( 0, parameterVectorSize_ ), stateTransitionMatrixSize_ );
+
+        equationsOfMotionNumericalSolution = convertNumericalStateSolutionsToOutputSolutions(
+                    equationsOfMotionNumericalSolution, dynamicsStateDerivative_ );
+        dynamicsSimulator_->manuallySetAndProcessRawNumericalEquationsOfMotionSolution(
+                    equationsOfMotionNumericalSolution );
+
+        // Reset solution for state transition and sensitivity matrices.
+        setVariationalEquationsSolution< TimeType, StateScalarType >(
+                    rawNumericalSolution, variationalEquationsSolution_,
+                    std::make_pair( 0, 0 ), std::make_pair( 0, stateTransitionMatrixSize_ ),
+                    stateTransitionMatrixSize_, parameterVectorSize_ );
+    }
+
+    //! Function to integrate the variational equations and equations of motion over the next arc.
+    /*!
+     *  Function to integrate the variational equations and equations of motion over the next arc, see
+     *  integrateVariationalAndDynamicalEquationsToTime.
+     *  \param arcEndTime Time up to which the solution is required (if stopAtArcEnd is true).
+     *  \param stopAtArcEnd Boolean denoting whether the integration is to be stopped after arcEndTime (if false, the
+     *  integration is only stopped by the termination condition of the propagation).
+     *  \param numberOfOverlappingPoints Number of points of the solution that are shared between subsequent arcs.
+     *  \param arcEndTimeBuffer Time interval beyond arcEndTime over which the solution is (also) required, and before the
+     *  arcEndTime over which it is retained for the next arc.
+     *  \return True if the termination condition of the propagation is reached (i.e. no further arcs remain).
+     */
+    bool integrateNextArcOfVariationalAndDynamicalEquations(
+            const TimeType arcEndTime, const bool stopAtArcEnd, const int numberOfOverlappingPoints,
+            const double arcEndTimeBuffer )
+    {
+        if( currentArcInitialState_.rows( ) == 0 )
+        {
+            throw std::runtime_error( "Error when integrating variational equations arc-wise, integration not started" );
+        }
+
+        if( isArcWisePropagationFinished_ )
+        {
+            return true;
+        }
+
+        // Integrate variational and state equations from end of previous arc.
+        dynamicsStateDerivative_->setPropagationSettings( std::vector< IntegratedStateType >( ), 1, 1 );
+        std::map< TimeType, Eigen::VectorXd > dependentVariableHistory;
+        std::map< TimeType, MatrixType > rawNumericalSolution;
+
+        // Temporarily set initial time of integration to start of arc (restored also if integration fails).
+        bool isPropagationForward = ( integratorSettings_->initialTimeStep_ > 0.0 );
+        double bufferedArcEndTime = static_cast< double >( arcEndTime ) +
+                ( isPropagationForward ? arcEndTimeBuffer : -arcEndTimeBuffer );
+        TimeType propagationInitialTime = integratorSettings_->initialTime_;
+        integratorSettings_->initialTime_ = currentArcInitialTime_;
+        numberOfStepsBeyondArcEnd_ = 0;
+        try
+        {
+            EquationIntegrationInterface< MatrixType, TimeType >::integrateEquations(
+                        dynamicsSimulator_->getStateDerivativeFunction( ), rawNumericalSolution,
+                        currentArcInitialState_, integratorSettings_,
+                        boost::bind( &SingleArcVariationalEquationsSolver::checkArcStopCondition,
+                                     this, _1, bufferedArcEndTime, stopAtArcEnd,
+                                     numberOfOverlappingPoints / 2 ),
+                        dependentVariableHistory );
+        }
+        catch( ... )
+        {
+            integratorSettings_->initialTime_ = propagationInitialTime;
+            throw;
+        }
+        integratorSettings_->initialTime_ = propagationInitialTime;
+
+        // Set initial conditions of next arc (final point in direction of propagation), and retain final points for
+        // next arc.
+        if( isPropagationForward )
+        {
+            currentArcInitialTime_ = rawNumericalSolution.rbegin( )->first;
+            currentArcInitialState_ = rawNumericalSolution.rbegin( )->second;
+        }
+        else
+        {
+            currentArcInitialTime_ = rawNumericalSolution.begin( )->first;
+            currentArcInitialState_ = rawNumericalSolution.begin( )->second;
+        }
+        isArcWisePropagationFinished_ = dynamicsSimulator_->getPropagationTerminationCondition( )->checkStopCondition(
+                    static_cast< double >( currentArcInitialTime_ ) );
+
+        rawNumericalSolution.insert( previousArcSolutionEnd_.begin( ), previousArcSolutionEnd_.end( ) );
+        previousArcSolutionEnd_.clear( );
+        currentArcSolutionInterval_ = std::make_pair( static_cast< double >( rawNumericalSolution.begin( )->first ),
+                                                      static_cast< double >( rawNumericalSolution.rbegin( )->first ) );
+
+        // Retain all points within arcEndTimeBuffer before the arc end time, and numberOfOverlappingPoints / 2 points
+        // before those (with at least numberOfOverlappingPoints points in total).
+        double retainedIntervalStartTime = static_cast< double >( arcEndTime ) -
+                ( isPropagationForward ? arcEndTimeBuffer : -arcEndTimeBuffer );
+        int numberOfRetainedPointsBeforeBuffer = 0;
+        int numberOfRetainedPoints = 0;
+        typename std::map< TimeType, MatrixType >::iterator solutionIterator =
+                isPropagationForward ? --rawNumericalSolution.end( ) : rawNumericalSolution.begin( );
+        while( ( numberOfRetainedPoints < numberOfOverlappingPoints ) ||
+               ( numberOfRetainedPointsBeforeBuffer < numberOfOverlappingPoints / 2 ) )
+        {
+            previousArcSolutionEnd_.insert( *solutionIterator );
+            numberOfRetainedPoints++;
+            if( !stopAtArcEnd || ( isPropagationForward ?
+                                   ( static_cast< double >( solutionIterator->first ) < retainedIntervalStartTime ) :
+                                   ( static_cast< double >( solutionIterator->first ) > retainedIntervalStartTime ) ) )
+            {
+                numberOfRetainedPointsBeforeBuffer++;
+            }
+
+            // Move to previous point (in direction of propagation), if any.
+            if( isPropagationForward )
+            {
+                if( solutionIterator == rawNumericalSolution.begin( ) )
+                {
+                    break;
+                }
+                solutionIterator--;
+            }
+            else
+            {
+                solutionIterator++;
+                if( solutionIterator == rawNumericalSolution.end( ) )
+                {
+                    break;
+                }
+            }
+        }
+
+        // Process solution of current arc.
+        processConcurrentNumericalSolution( rawNumericalSolution );
+        resetVariationalEquationsInterpolators( );
+
+        return isArcWisePropagationFinished_;
+    }
+
+    //! Function to check whether the integration of the current arc is to be stopped.
+    /*!
+     *  Function to check whether the integration of the current arc is to be stopped, i.e. whether the given number of
+     *  steps beyond the end of the arc, or the termination condition of the propagation, is reached.
+     *  \param time Current time of the integration.
+     *  \param arcEndTime Time at which the current arc ends.
+     *  \param stopAtArcEnd Boolean denoting whether the integration is to be stopped after arcEndTime.
+     *  \param numberOfStepsBeyondArcEnd Number of steps beyond the end of the arc that are to be taken.
+     *  \return True if the integration of the current arc is to be stopped.
+     */
+    bool checkArcStopCondition( const double time, const double arcEndTime, const bool stopAtArcEnd,
+                                const int numberOfStepsBeyondArcEnd )
+    {
+        if( stopAtArcEnd && ( ( integratorSettings_->initialTimeStep_ > 0.0 ) ?
+                              ( time >= arcEndTime ) : ( time <= arcEndTime ) ) )
+        {
+            if( numberOfStepsBeyondArcEnd_ >= numberOfStepsBeyondArcEnd )
+            {
+                return true;
+            }
+            numberOfStepsBeyondArcEnd_++;
+        }
+        return dynamicsSimulator_->getPropagationTerminationCondition( )->checkStopCondition( time );
+    }
 
     //! Reset solutions of variational equations.
     /*!
@@ -654,6 +903,24 @@ private:
      */
     std::vector< std::map< double, Eigen::MatrixXd > > variationalEquationsSolution_;
 
+    //! Initial time of the next arc, when integrating the equations arc-wise.
+    TimeType currentArcInitialTime_;
+
+    //! Initial conditions ([Phi;S;y]) of the next arc, when integrating the equations arc-wise.
+    MatrixType currentArcInitialState_;
+
+    //! Final points of the numerical solution of the previous arc, when integrating the equations arc-wise.
+    std::map< TimeType, MatrixType > previousArcSolutionEnd_;
+
+    //! Boolean denoting whether the termination condition is reached when integrating the equations arc-wise.
+    bool isArcWisePropagationFinished_;
+
+    //! Number of steps taken beyond the end of the current arc, when integrating the equations arc-wise.
+    int numberOfStepsBeyondArcEnd_;
+
+    //! First and last time of the solution of the current arc, when integrating the equations arc-wise.
+    std::pair< double, double > currentArcSolutionInterval_;
+
 };
 
 } // namespace propagators
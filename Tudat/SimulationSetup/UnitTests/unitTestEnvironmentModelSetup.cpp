@@ -710,6 +710,56 @@ BOOST_AUTO_TEST_CASE( test_rotationModelSetup )
 }
 #endif
 
+#if USE_SOFA
+//! Test set up of GCRS to ITRS rotation model, with and without tabulated precession-nutation.
+BOOST_AUTO_TEST_CASE( test_gcrsToItrsRotationModelSetup )
+{
+    // Create rotation model directly from Sofa series, and from tabulated values.
+    double initialTime = 1.0E8;
+    double finalTime = initialTime + 10.0 * 86400.0;
+    boost::shared_ptr< ephemerides::RotationalEphemeris > directRotationModel =
+            createRotationModel( boost::make_shared< GcrsToItrsRotationModelSettings >( iau_2006 ), "Earth" );
+    boost::shared_ptr< ephemerides::RotationalEphemeris > tabulatedRotationModel =
+            createRotationModel( boost::make_shared< GcrsToItrsRotationModelSettings >(
+                                     iau_2006, "J2000", initialTime - 86400.0, finalTime + 86400.0, 3600.0 ),
+                                 "Earth" );
+
+    BOOST_CHECK_EQUAL( tabulatedRotationModel->getBaseFrameOrientation( ), "J2000" );
+    BOOST_CHECK_EQUAL( tabulatedRotationModel->getTargetFrameOrientation( ), "ITRS" );
+
+    double timeStep = 0.4 * 86400.0 + 17.0;
+    for( double currentTime = initialTime; currentTime < finalTime; currentTime += timeStep )
+    {
+        // Check that tabulated model reproduces direct model.
+        Eigen::Matrix3d directRotation = Eigen::Matrix3d( directRotationModel->getRotationToTargetFrame( currentTime ) );
+        Eigen::Matrix3d tabulatedRotation =
+                Eigen::Matrix3d( tabulatedRotationModel->getRotationToTargetFrame( currentTime ) );
+        BOOST_CHECK_SMALL( ( directRotation - tabulatedRotation ).cwiseAbs( ).maxCoeff( ), 1.0E-11 );
+
+        // Check that the Earth pole is within the (accumulated) precession-nutation from the GCRS pole.
+        BOOST_CHECK_SMALL( ( directRotation.transpose( ) * Eigen::Vector3d::UnitZ( ) -
+                             Eigen::Vector3d::UnitZ( ) ).norm( ), 1.0E-2 );
+
+        // Check derivative of rotation matrix by central differences (precession-nutation rate neglected in model).
+        double differenceTimeStep = 10.0;
+        Eigen::Matrix3d numericalRotationDerivative =
+                ( Eigen::Matrix3d( tabulatedRotationModel->getRotationToTargetFrame( currentTime + differenceTimeStep ) ) -
+                  Eigen::Matrix3d( tabulatedRotationModel->getRotationToTargetFrame( currentTime - differenceTimeStep ) ) ) /
+                ( 2.0 * differenceTimeStep );
+        BOOST_CHECK_SMALL( ( numericalRotationDerivative -
+                             tabulatedRotationModel->getDerivativeOfRotationToTargetFrame( currentTime ) ).cwiseAbs( ).
+                           maxCoeff( ), 5.0E-11 );
+
+        // Check angular velocity (Earth rotation about its pole).
+        Eigen::Vector3d angularVelocity = tabulatedRotationModel->getRotationalVelocityVectorInTargetFrame(
+                    currentTime );
+        BOOST_CHECK_SMALL( angularVelocity.x( ), 1.0E-12 );
+        BOOST_CHECK_SMALL( angularVelocity.y( ), 1.0E-12 );
+        BOOST_CHECK_CLOSE_FRACTION( angularVelocity.z( ), 7.292115E-5, 1.0E-6 );
+    }
+}
+#endif
+
 #if USE_CSPICE
 //! Test set up of radiation pressure interfacel environment models.
 BOOST_AUTO_TEST_CASE( test_radiationPressureInterfaceSetup )
@@ -906,6 +956,20 @@ BOOST_AUTO_TEST_CASE( test_flightConditionsSetup )
                 vehicleFlightConditions->getCurrentBodyCenteredBodyFixedState( ),vehicleBodyFixedState,
                 ( 2.0 * std::numeric_limits< double >::epsilon( ) ) );
 
+    // Check that flight conditions are computed on request.
+    BOOST_CHECK_CLOSE_FRACTION(
+                vehicleFlightConditions->getCurrentDensity( ),
+                bodyMap.at( "Earth" )->getAtmosphereModel( )->getDensity(
+                    vehicleFlightConditions->getCurrentAltitude( ), testLongitude, testLatitude, testTime ),
+                std::numeric_limits< double >::epsilon( ) );
+
+    // Check that aerodynamic coefficients are updated by default.
+    BOOST_CHECK_EQUAL( vehicleFlightConditions->getUpdateAerodynamicCoefficients( ), true );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                vehicleFlightConditions->getAerodynamicCoefficientInterface( )->getCurrentForceCoefficients( ),
+                ( Eigen::Vector3d( )<<-1.1, 0.1, 2.3 ).finished( ),
+                ( 2.0 * std::numeric_limits< double >::epsilon( ) ) );
+
 
 }
 #endif